@@ -250,6 +250,18 @@ namespace cds {
                 return m_Counter.fetch_sub( 1, order );
             }
 
+            /// Adds \p n to the counter. Semantics: returns new value
+            counter_type operator +=( counter_type n )
+            {
+                return m_Counter.fetch_add( n, atomics::memory_order_relaxed ) + n;
+            }
+
+            /// Subtracts \p n from the counter. Semantics: returns new value
+            counter_type operator -=( counter_type n )
+            {
+                return m_Counter.fetch_sub( n, atomics::memory_order_relaxed ) - n;
+            }
+
             /// Preincrement
             counter_type operator ++()
             {
@@ -337,6 +349,17 @@ namespace cds {
                 return 0;
             }
 
+            /// Dummy addition. Always returns 0
+            size_t operator +=( size_t ) const
+            {
+                return 0;
+            }
+            /// Dummy subtraction. Always returns 0
+            size_t operator -=( size_t ) const
+            {
+                return 0;
+            }
+
             /// Dummy function
             static void reset(atomics::memory_order /*order*/ = atomics::memory_order_relaxed)
             {}
@@ -65,6 +65,10 @@
 #   define CDS_EXPORT_API
 #endif
 
+#ifndef CDS_PREFETCH
+#   define CDS_PREFETCH( addr ) ((void) (addr))
+#endif
+
 // Features
 #include <cds/compiler/feature_tsan.h>
 
@@ -142,6 +142,12 @@
 #   endif
 #endif
 
+// Double-width CAS (16 byte CAS on 64bit platform).
+// On amd64 cmpxchg16b is available only if -mcx16 compiler flag is specified
+#if CDS_BUILD_BITS == 64 && defined( __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16 ) && !defined( CDS_DCAS_SUPPORT )
+#   define CDS_DCAS_SUPPORT
+#endif
+
 #if CDS_OS_TYPE == CDS_OS_MINGW
 #   ifdef CDS_BUILD_LIB
 #       define CDS_EXPORT_API          __declspec(dllexport)
@@ -84,6 +84,9 @@
 #define CDS_CLASS_ALIGNMENT(n)  __attribute__ ((aligned (n)))
 #define CDS_DATA_ALIGNMENT(n)   __attribute__ ((aligned (n)))
 
+// Prefetch the cache line containing \p addr for reading
+#define CDS_PREFETCH( addr )    __builtin_prefetch( (addr) )
+
 // Attributes
 #if CDS_COMPILER_VERSION >= 40900
 #   if __cplusplus < 201103
@@ -646,6 +646,58 @@ namespace cds { namespace container {
             return base_class::contains( key, pred );
         }
 
+        /// Applies \p f to each item with the key in range <tt>[lo, hi]</tt> in ascending key order
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            The scan is weakly consistent: the items that are in the map during the entire scan are visited
+            exactly once, the items inserted or removed concurrently may or may not be visited.
+            The functor is called under RCU lock without node-level locking.
+
+            The function applies RCU lock internally. Returns the count of visited items.
+        */
+        template <typename K, typename Func>
+        size_t for_each_in_range( K const& lo, K const& hi, Func f ) const
+        {
+            return base_class::for_each_in_range( lo, hi, f );
+        }
+
+        /// Applies \p f to each item with the key in range <tt>[lo, hi]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \p for_each_in_range(K const&, K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        size_t for_each_in_range_with( K const& lo, K const& hi, Less pred, Func f ) const
+        {
+            return base_class::for_each_in_range_with( lo, hi, pred, f );
+        }
+
+        /// Counts the items with the key in range <tt>[lo, hi]</tt>
+        /**
+            Optimistic snapshot count: the result is exact if the range is not modified during the call.
+            See \ref cds_container_BronsonAVLTreeMap_rcu_ptr_count_in_range "BronsonAVLTreeMap<RCU, Key, T*>::count_in_range()" for details.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        size_t count_in_range( K const& lo, K const& hi ) const
+        {
+            return base_class::count_in_range( lo, hi );
+        }
+
+        /// Counts the items with the key in range <tt>[lo, hi]</tt> using \p pred predicate for key comparing
+        template <typename K, typename Less>
+        size_t count_in_range_with( K const& lo, K const& hi, Less pred ) const
+        {
+            return base_class::count_in_range_with( lo, hi, pred );
+        }
+
         /// Clears the map
         void clear()
         {
@@ -562,7 +562,7 @@ namespace cds { namespace container {
         {
             node_type * pNode = base_class::erase(key);
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -582,7 +582,7 @@ namespace cds { namespace container {
             CDS_UNUSED( pred );
             node_type * pNode = base_class::erase_with(key, cds::details::predicate_wrapper<node_type, Predicate, key_accessor>());
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -611,7 +611,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -632,7 +632,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase_with( key, cds::details::predicate_wrapper<node_type, Predicate, key_accessor>() );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -719,7 +719,7 @@ namespace cds { namespace container {
         /// Clears the map
         void clear()
         {
-            base_class::clear_and_dispose( node_disposer() );
+            base_class::clear_and_dispose( []( node_type * pNode ) { base_class::template dispose_unlinked<node_disposer>( pNode ); } );
         }
 
         /// Checks if the map is empty
@@ -383,6 +383,7 @@ namespace cds { namespace container {
         static unsigned int const   c_nDefaultProbesetSize = base_class::c_nDefaultProbesetSize; ///< default probeset size
         static size_t const         c_nDefaultInitialSize = base_class::c_nDefaultInitialSize;   ///< default initial size
         static unsigned int const   c_nRelocateLimit = base_class::c_nRelocateLimit;             ///< Count of attempts to relocate before giving up
+        static size_t const         c_nBatchSize = base_class::c_nBatchSize;                     ///< Count of keys processed together by batch operations, see \p insert_batch()
 
     protected:
         //@cond
@@ -620,7 +621,7 @@ namespace cds { namespace container {
         {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -640,7 +641,7 @@ namespace cds { namespace container {
             CDS_UNUSED( pred );
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>() );
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -667,7 +668,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -688,7 +689,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>() );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_unlinked<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -761,7 +762,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return base_class::find( key, [](node_type&, Q const&) {});
+            return base_class::contains( key );
         }
         //@cond
         template <typename Q>
@@ -782,7 +783,7 @@ namespace cds { namespace container {
         bool contains( Q const& key, Predicate pred )
         {
             CDS_UNUSED( pred );
-            return base_class::find_with( key, typename maker::template predicate_wrapper<Predicate, bool>(), [](node_type&, Q const&) {});
+            return base_class::contains( key, typename maker::template predicate_wrapper<Predicate, bool>() );
         }
         //@cond
         template <typename Q, typename Predicate>
@@ -793,13 +794,59 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Inserts the items for the keys of the batch
+        /**
+            The function is an analog of <tt>insert( Q const& )</tt> for \p nCount keys of the array \p pKeys.
+            The keys are processed in groups of \p c_nBatchSize: the cells of all bucket tables for the whole group
+            are prefetched before the first insertion, so the cache misses are overlapped.
+            This is useful for big sets which do not fit into the cache.
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of inserting <tt>pKeys[i]</tt>.
+            Returns the count of inserted items.
+
+            The batch is not atomic: each key is inserted by a separate operation.
+        */
+        template <typename Q>
+        size_t insert_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return insert( key ); } );
+        }
+
+        /// Checks whether the set contains the keys of the batch
+        /**
+            The function is an analog of <tt>contains( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the bucket cells are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is found.
+            Returns the count of keys found.
+        */
+        template <typename Q>
+        size_t find_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return contains( key ); } );
+        }
+
+        /// Deletes the keys of the batch
+        /**
+            The function is an analog of <tt>erase( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the bucket cells are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is deleted.
+            Returns the count of deleted items.
+        */
+        template <typename Q>
+        size_t erase_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return erase( key ); } );
+        }
+
         /// Clears the set
         /**
             The function erases all items from the set.
         */
         void clear()
         {
-            return base_class::clear_and_dispose( node_disposer() );
+            return base_class::clear_and_dispose( []( node_type * pNode ) { base_class::template dispose_unlinked<node_disposer>( pNode ); } );
         }
 
         /// Checks if the set is empty
@@ -207,6 +207,8 @@ namespace cds { namespace container {
             event_counter   m_nFindFailed;  ///< Count of failed \p find() call
             event_counter   m_nFindRetry;   ///< Count of retries during \p find()
             event_counter   m_nFindWaitShrinking;   ///< Count of waiting until shrinking completed duting \p find() call
+            event_counter   m_nScan;        ///< Count of \p for_each_in_range() and \p count_in_range() calls
+            event_counter   m_nScanRetry;   ///< Count of range traversal restarts caused by concurrent rotations
 
             event_counter   m_nInsertSuccess;       ///< Count of inserting data node
             event_counter   m_nInsertFailed;        ///< Count of insert failures
@@ -255,6 +257,8 @@ namespace cds { namespace container {
             void onFindFailed()         { ++m_nFindFailed       ; }
             void onFindRetry()          { ++m_nFindRetry        ; }
             void onFindWaitShrinking()  { ++m_nFindWaitShrinking; }
+            void onScan()               { ++m_nScan             ; }
+            void onScanRetry()          { ++m_nScanRetry        ; }
 
             void onInsertSuccess()          { ++m_nInsertSuccess; }
             void onInsertFailed()           { ++m_nInsertFailed; }
@@ -317,6 +321,8 @@ namespace cds { namespace container {
             void onFindFailed()         const {}
             void onFindRetry()          const {}
             void onFindWaitShrinking()  const {}
+            void onScan()               const {}
+            void onScanRetry()          const {}
 
             void onInsertSuccess()          const {}
             void onInsertFailed()           const {}
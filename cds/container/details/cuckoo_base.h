@@ -137,8 +137,53 @@ namespace cds { namespace container {
         using intrusive::cuckoo::probeset_type;
 #endif
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Option enabling optimistic reads
+        /**
+            @copydetails cds::intrusive::cuckoo::optimistic_read
+
+            The container destroys and deallocates an erased node via \p cuckoo::reclaim_policy
+            when no optimistic reader can access it; by default it is <tt>cuckoo::epoch_reclaim< cds::gc::EBR ></tt>.
+        */
+        template <bool Enable>
+        struct optimistic_read
+        {};
+#else
+        using intrusive::cuckoo::optimistic_read;
+#endif
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Reclamation policy: the erased nodes are deallocated immediately
+        /**
+            This is typedef for \p intrusive::cuckoo::immediate_reclaim
+        */
+        struct immediate_reclaim
+        {};
+
+        /// Reclamation policy: the erased nodes are retired via epoch-based garbage collector \p GC
+        /**
+            @copydetails cds::intrusive::cuckoo::epoch_reclaim
+        */
+        template <class GC>
+        struct epoch_reclaim
+        {};
+
+        /// Option specifying the reclamation policy of erased nodes for optimistic reads
+        /**
+            @copydetails cds::intrusive::cuckoo::reclaim_policy
+        */
+        template <typename Policy>
+        struct reclaim_policy
+        {};
+#else
+        using intrusive::cuckoo::immediate_reclaim;
+        using intrusive::cuckoo::epoch_reclaim;
+        using intrusive::cuckoo::reclaim_policy;
+#endif
+
         using intrusive::cuckoo::list;
         using intrusive::cuckoo::vector;
+        using intrusive::cuckoo::fingerprint_vector;
 
         /// Type traits for CuckooSet and CuckooMap classes
         struct traits
@@ -220,6 +265,12 @@ namespace cds { namespace container {
 
             /// Internal statistics
             typedef empty_stat                  stat;
+
+            /// Lock-free optimistic reads, see \p cuckoo::optimistic_read option
+            static bool const optimistic_read = false;
+
+            /// Reclamation policy of erased nodes, see \p cuckoo::reclaim_policy option
+            typedef opt::none   reclaim_policy;
         };
 
         /// Metafunction converting option list to CuckooSet/CuckooMap traits
@@ -255,6 +306,11 @@ namespace cds { namespace container {
                 Default is \p cuckoo::list.
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::optimistic_read - enables lock-free optimistic reads for vector-based probe-sets.
+                Default is \p false
+            - \p cuckoo::reclaim_policy - reclamation policy of erased nodes.
+                Default is \p cuckoo::immediate_reclaim, or <tt>cuckoo::epoch_reclaim< cds::gc::EBR ></tt>
+                if \p cuckoo::optimistic_read is enabled
         */
         template <typename... Options>
         struct make_traits {
@@ -54,6 +54,9 @@ namespace cds { namespace container {
         /// \p FeldmanHashMap level statistics
         typedef cds::intrusive::feldman_hashset::level_statistics level_statistics;
 
+        /// \p FeldmanHashMap memory usage statistics
+        typedef cds::intrusive::feldman_hashset::memory_statistics memory_statistics;
+
         /// \p FeldmanHashMap traits
         struct traits
         {
@@ -60,6 +60,9 @@ namespace cds { namespace container {
         /// \p FeldmanHashSet level statistics
         typedef cds::intrusive::feldman_hashset::level_statistics level_statistics;
 
+        /// \p FeldmanHashSet memory usage statistics
+        typedef cds::intrusive::feldman_hashset::memory_statistics memory_statistics;
+
         /// \p FeldmanHashSet traits
         struct traits
         {
@@ -46,6 +46,17 @@ namespace cds { namespace container {
         template <typename... Options>
         using make_traits = cds::intrusive::michael_set::make_traits< Options... >;
 
+        /// Internal statistics of expandable bucket table
+        template <typename Counter = cds::atomicity::event_counter >
+        using stat = cds::intrusive::michael_set::stat< Counter >;
+
+        /// Dummy statistics
+        typedef cds::intrusive::michael_set::empty_stat empty_stat;
+
+        /// [value-option] Dynamic bucket table option, see \p cds::intrusive::michael_set::dynamic_bucket_table
+        template <bool Value>
+        using dynamic_bucket_table = cds::intrusive::michael_set::dynamic_bucket_table< Value >;
+
         //@cond
         namespace details {
             using michael_set::details::init_hash_bitmask;
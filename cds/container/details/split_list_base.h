@@ -53,8 +53,17 @@ namespace cds { namespace container {
         template <bool Value>
         using dynamic_bucket_table = cds::intrusive::split_list::dynamic_bucket_table<Value>;
 
+        /// Selector of unbounded bucket table - typedef for \p intrusive::split_list::unbounded_bucket_table
+        template <bool Value>
+        using unbounded_bucket_table = cds::intrusive::split_list::unbounded_bucket_table<Value>;
+
+        /// Selector of dummy node allocation - typedef for \p intrusive::split_list::dummy_node_slab
+        template <bool Value>
+        using dummy_node_slab = cds::intrusive::split_list::dummy_node_slab<Value>;
+
         using cds::intrusive::split_list::static_bucket_table;
         using cds::intrusive::split_list::expandable_bucket_table;
+        using cds::intrusive::split_list::unlimited_bucket_table;
 
         //@cond
         namespace details {
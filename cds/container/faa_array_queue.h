@@ -0,0 +1,592 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_FAA_ARRAY_QUEUE_H
+#define CDSLIB_CONTAINER_FAA_ARRAY_QUEUE_H
+
+#include <memory>
+#include <cds/algo/atomic.h>
+#include <cds/opt/options.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// FAAArrayQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace faa_array_queue {
+
+        /// Queue internal statistics. May be used for debugging or profiling
+        /**
+            Template argument \p Counter defines type of counter.
+            Default is \p cds::atomicity::event_counter, that is weak, i.e. it is not guaranteed
+            strict event counting.
+            You may use stronger type of counter like as \p cds::atomicity::item_counter,
+            or even integral type, for example, \p int.
+        */
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter     counter_type;   ///< Counter type
+
+            counter_type m_EnqueueCount      ;  ///< Enqueue call count
+            counter_type m_DequeueCount      ;  ///< Dequeue call count
+            counter_type m_EnqueueRace       ;  ///< Count of enqueue race conditions (the cell has been spoiled by a dequeuer)
+            counter_type m_DequeueRace       ;  ///< Count of dequeue race conditions (the cell is not filled yet)
+            counter_type m_EmptyDequeue      ;  ///< Count of dequeue from empty queue
+            counter_type m_SegmentCreated    ;  ///< Count of created segments
+            counter_type m_SegmentRace       ;  ///< Count of segments created concurrently and then discarded
+            counter_type m_SegmentDeleted    ;  ///< Count of retired segments
+
+            /// Register enqueue call
+            void onEnqueue()                { ++m_EnqueueCount; }
+            /// Register dequeue call
+            void onDequeue()                { ++m_DequeueCount; }
+            /// Register enqueue race event
+            void onEnqueueRace()            { ++m_EnqueueRace; }
+            /// Register dequeue race event
+            void onDequeueRace()            { ++m_DequeueRace; }
+            /// Register dequeuing from empty queue
+            void onEmptyDequeue()           { ++m_EmptyDequeue; }
+            /// Register new segment
+            void onSegmentCreated()         { ++m_SegmentCreated; }
+            /// Register discarded segment
+            void onSegmentRace()            { ++m_SegmentRace; }
+            /// Register segment retiring
+            void onSegmentDeleted()         { ++m_SegmentDeleted; }
+        };
+
+        /// Dummy queue statistics - no counting is performed, no overhead. Support interface like \p faa_array_queue::stat
+        struct empty_stat
+        {
+            //@cond
+            void onEnqueue()                const {}
+            void onDequeue()                const {}
+            void onEnqueueRace()            const {}
+            void onDequeueRace()            const {}
+            void onEmptyDequeue()           const {}
+            void onSegmentCreated()         const {}
+            void onSegmentRace()            const {}
+            void onSegmentDeleted()         const {}
+            //@endcond
+        };
+
+        /// Segment size option setter
+        /**
+            The number of cells in a segment of \p FAAArrayQueue.
+            The value should be large enough to amortize segment allocation,
+            the segment occupies about <tt>Size * sizeof(void *)</tt> bytes.
+        */
+        template <size_t Size>
+        struct segment_size {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum : size_t { segment_size = Size };
+            };
+            //@endcond
+        };
+
+        /// FAAArrayQueue default traits
+        struct traits
+        {
+            /// Node allocator, it is used for the values and for the segments
+            typedef CDS_DEFAULT_ALLOCATOR       allocator;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to enable item counting
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// Internal statistics (by default, disabled)
+            /**
+                Possible option value are: \p faa_array_queue::stat, \p faa_array_queue::empty_stat (the default),
+                user-provided class that supports \p %faa_array_queue::stat interface.
+            */
+            typedef faa_array_queue::empty_stat stat;
+
+            /// C++ memory ordering model
+            /**
+                Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            */
+            typedef opt::v::relaxed_ordering    memory_model;
+
+            /// Padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+
+            /// Number of cells in a segment, see \p faa_array_queue::segment_size option
+            enum : size_t { segment_size = 1024 };
+        };
+
+        /// Metafunction converting option list to \p faa_array_queue::traits
+        /**
+            Supported \p Options are:
+            - \p opt::allocator - allocator (like \p std::allocator) used to allocate queue values and segments.
+                Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter (item counting disabled)
+                To enable item counting use \p cds::atomicity::item_counter
+            - \p opt::stat - the type to gather internal statistics.
+                Possible statistics types are: \p faa_array_queue::stat, \p faa_array_queue::empty_stat, user-provided class that supports \p %faa_array_queue::stat interface.
+                Default is \p %faa_array_queue::empty_stat.
+            - \p opt::padding - padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p faa_array_queue::segment_size - the number of cells in a segment. Default is 1024.
+
+            Example: declare \p %FAAArrayQueue with item counting and internal statistics
+            \code
+            typedef cds::container::FAAArrayQueue< cds::gc::HP, Foo,
+                typename cds::container::faa_array_queue::make_traits<
+                    cds::opt::item_counter< cds::atomicity::item_counter >,
+                    cds::opt::stat< cds::container::faa_array_queue::stat<> >
+                >::type
+            > myQueue;
+            \endcode
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+    } // namespace faa_array_queue
+
+    /// Fetch-and-add array queue
+    /** @ingroup cds_nonintrusive_queue
+        Source:
+            - [2016] P.Ramalhete, A.Correia "FAAArrayQueue - MPMC lock-free queue" (part of the Turn queue work)
+            - [2013] A.Morrison, Y.Afek "Fast concurrent queues for x86 processors" (LCRQ)
+
+        The queue is a Michael & Scott linked list of segments, each segment is an array of cells.
+        Unlike \p MSQueue, where all enqueuers and dequeuers compete by CAS on a single tail/head pointer,
+        the threads of \p %FAAArrayQueue obtain the cell index by fetch-and-add on the segment's
+        enqueue/dequeue index. The fetch-and-add always succeeds, so under contention each thread
+        gets its own cell instead of retrying:
+        - \p enqueue() takes the next cell of the tail segment and stores the item into it by CAS.
+            The CAS fails only if a dequeuer has already visited and spoiled this empty cell;
+            in that case the enqueuer takes the next cell.
+            If the tail segment is full, a new segment containing the item is appended to the list.
+        - \p dequeue() takes the next cell of the head segment and exchanges its content
+            with a "taken" mark. If the cell was empty the dequeuer takes the next cell.
+            If the head segment is exhausted, the head moves to the next segment and the old segment
+            is retired via \p GC.
+
+        The CAS on the list pointers is performed only once per segment, see \p faa_array_queue::segment_size.
+        The original LCRQ uses double-width CAS on ring cells, which is not portable; the array queue
+        uses only single-word atomics and never reuses the cells, so it needs no ABA prevention.
+
+        The items are stored by pointer, each cell is owned exclusively by one enqueuer and one dequeuer,
+        so the dequeued value is not shared and it is freed immediately. Only the segments are reclaimed by \p GC,
+        the algorithm requires one hazard pointer.
+
+        Template arguments:
+        - \p GC - garbage collector type: \p gc::HP, \p gc::DHP
+        - \p T - a type stored in the queue.
+        - \p Traits - queue traits, default is \p faa_array_queue::traits. You can use \p faa_array_queue::make_traits
+            metafunction to make your traits or just derive your traits from \p %faa_array_queue::traits:
+            \code
+            struct myTraits: public cds::container::faa_array_queue::traits {
+                typedef cds::container::faa_array_queue::stat<> stat;
+                typedef cds::atomicity::item_counter    item_counter;
+            };
+            typedef cds::container::FAAArrayQueue< cds::gc::HP, Foo, myTraits > myQueue;
+
+            // Equivalent make_traits example:
+            typedef cds::container::FAAArrayQueue< cds::gc::HP, Foo,
+                typename cds::container::faa_array_queue::make_traits<
+                    cds::opt::stat< cds::container::faa_array_queue::stat<> >,
+                    cds::opt::item_counter< cds::atomicity::item_counter >
+                >::type
+            > myQueue;
+            \endcode
+    */
+    template <typename GC, typename T, typename Traits = faa_array_queue::traits>
+    class FAAArrayQueue
+    {
+    public:
+        /// Rebind template arguments
+        template <typename GC2, typename T2, typename Traits2>
+        struct rebind {
+            typedef FAAArrayQueue< GC2, T2, Traits2> other   ;   ///< Rebinding result
+        };
+
+    public:
+        typedef GC      gc;             ///< Garbage collector used
+        typedef T       value_type;     ///< Value type stored in the queue
+        typedef Traits  traits;         ///< Queue traits
+
+        typedef typename traits::item_counter   item_counter;   ///< Item counting policy used
+        typedef typename traits::stat           stat;           ///< Internal statistics policy used
+        typedef typename traits::memory_model   memory_model;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename traits::allocator::template rebind<value_type>::other allocator_type; ///< Allocator type used for allocate/deallocate the values
+
+        static CDS_CONSTEXPR const size_t c_nSegmentSize = traits::segment_size; ///< Number of cells in a segment
+        static CDS_CONSTEXPR const size_t c_nHazardPtrCount = 1; ///< Count of hazard pointer required for the algorithm
+
+        static_assert( c_nSegmentSize > 1, "Segment size must be greater than 1" );
+
+    protected:
+        //@cond
+        // Segment cell. LSB is used as "taken" mark: nullptr | 1 means the cell was visited by a dequeuer
+        typedef cds::details::marked_ptr< value_type, 1 > cell_value;
+        typedef atomics::atomic< cell_value > cell;
+
+        typedef typename opt::details::apply_padding< atomics::atomic<size_t>, traits::padding >::padding_type index_padding;
+
+        struct segment
+        {
+            atomics::atomic<size_t>   m_nDeqIdx;
+            index_padding             pad1_;
+            cell                      m_Cells[c_nSegmentSize];
+            atomics::atomic<size_t>   m_nEnqIdx;
+            index_padding             pad2_;
+            atomics::atomic<segment *> m_pNext;
+
+            // Initializes the segment, the first cell is filled by pFirst
+            explicit segment( value_type * pFirst )
+                : m_nDeqIdx( 0 )
+                , m_nEnqIdx( pFirst ? 1 : 0 )
+                , m_pNext( nullptr )
+            {
+                m_Cells[0].store( cell_value( pFirst ), atomics::memory_order_relaxed );
+                for ( size_t i = 1; i < c_nSegmentSize; ++i )
+                    m_Cells[i].store( cell_value(), atomics::memory_order_relaxed );
+            }
+        };
+
+        typedef cds::details::Allocator< value_type, allocator_type > cxx_value_allocator;
+        typedef cds::details::Allocator< segment, typename traits::allocator > cxx_segment_allocator;
+
+        struct value_disposer {
+            void operator()( value_type * p ) const
+            {
+                cxx_value_allocator().Delete( p );
+            }
+        };
+        typedef std::unique_ptr< value_type, value_disposer > scoped_value_ptr;
+
+        struct segment_disposer {
+            void operator()( segment * p ) const
+            {
+                cxx_segment_allocator().Delete( p );
+            }
+        };
+
+        typedef atomics::atomic< segment * > atomic_segment_ptr;
+        //@endcond
+
+    protected:
+        //@cond
+        atomic_segment_ptr  m_pHead;        ///< Queue's head segment
+        typename opt::details::apply_padding< atomic_segment_ptr, traits::padding >::padding_type pad1_;
+        atomic_segment_ptr  m_pTail;        ///< Queue's tail segment
+        typename opt::details::apply_padding< atomic_segment_ptr, traits::padding >::padding_type pad2_;
+        item_counter        m_ItemCounter;  ///< Item counter
+        stat                m_Stat;         ///< Internal statistics
+        //@endcond
+
+    public:
+        /// Initializes empty queue
+        FAAArrayQueue()
+        {
+            segment * pSentinel = cxx_segment_allocator().New( static_cast<value_type *>( nullptr ));
+            m_pHead.store( pSentinel, atomics::memory_order_relaxed );
+            m_pTail.store( pSentinel, atomics::memory_order_release );
+        }
+
+        /// Destructor clears the queue
+        ~FAAArrayQueue()
+        {
+            clear();
+
+            // No concurrent access is possible, the remaining segment can be freed directly
+            segment * pHead = m_pHead.load( memory_model::memory_order_relaxed );
+            assert( pHead != nullptr );
+            assert( pHead == m_pTail.load( memory_model::memory_order_relaxed ));
+            segment_disposer()( pHead );
+        }
+
+        /// Enqueues \p val value into the queue.
+        /**
+            The function makes queue node in dynamic memory calling copy constructor for \p val
+            and then it enqueues the node into the queue.
+            The function always returns \p true.
+        */
+        bool enqueue( value_type const& val )
+        {
+            scoped_value_ptr p( cxx_value_allocator().New( val ));
+            do_enqueue( p.get() );
+            p.release();
+            return true;
+        }
+
+        /// Enqueues data to the queue using a functor
+        /**
+            \p Func is a functor called to create node.
+            The functor \p f takes one argument - a reference to a new node of type \ref value_type :
+            \code
+            cds::container::FAAArrayQueue< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.enqueue_with( [&bar]( Foo& dest ) { dest = bar; } );
+            \endcode
+        */
+        template <typename Func>
+        bool enqueue_with( Func f )
+        {
+            scoped_value_ptr p( cxx_value_allocator().New() );
+            f( *p );
+            do_enqueue( p.get() );
+            p.release();
+            return true;
+        }
+
+        /// Enqueues data of type \ref value_type constructed from <tt>std::forward<Args>(args)...</tt>
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            scoped_value_ptr p( cxx_value_allocator().MoveNew( std::forward<Args>( args )... ));
+            do_enqueue( p.get() );
+            p.release();
+            return true;
+        }
+
+        /// Synonym for \p enqueue() function
+        bool push( value_type const& val )
+        {
+            return enqueue( val );
+        }
+
+        /// Synonym for \p enqueue_with() function
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            return enqueue_with( f );
+        }
+
+        /// Dequeues a value from the queue
+        /**
+            If queue is not empty, the function returns \p true, \p dest contains copy of
+            dequeued value. The assignment operator for type \ref value_type is invoked.
+            If queue is empty, the function returns \p false, \p dest is unchanged.
+        */
+        bool dequeue( value_type& dest )
+        {
+            return dequeue_with( [&dest]( value_type& src ) { dest = std::move( src ); } );
+        }
+
+        /// Dequeues a value using a functor
+        /**
+            \p Func is a functor called to copy dequeued value.
+            The functor takes one argument - a reference to removed node:
+            \code
+            cds:container::FAAArrayQueue< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.dequeue_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called only if the queue is not empty.
+            The dequeued value is owned exclusively by the caller, so it may be moved.
+        */
+        template <typename Func>
+        bool dequeue_with( Func f )
+        {
+            value_type * p = do_dequeue();
+            if ( p ) {
+                scoped_value_ptr pVal( p );
+                f( *p );
+                return true;
+            }
+            return false;
+        }
+
+        /// Synonym for \p dequeue() function
+        bool pop( value_type& dest )
+        {
+            return dequeue( dest );
+        }
+
+        /// Synonym for \p dequeue_with() function
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            return dequeue_with( f );
+        }
+
+        /// Clear the queue
+        /**
+            The function repeatedly calls \p dequeue() until it returns \p false.
+            The function is not atomic, it is thread-safe.
+        */
+        void clear()
+        {
+            value_type * p;
+            while ( (p = do_dequeue()) != nullptr )
+                value_disposer()( p );
+        }
+
+        /// Checks if the queue is empty
+        /**
+            The queue is empty if all filled cells of the head segment are dequeued
+            and there is no next segment.
+        */
+        bool empty() const
+        {
+            typename gc::Guard guard;
+            segment * pHead = guard.protect( m_pHead );
+            return pHead->m_nDeqIdx.load( memory_model::memory_order_acquire ) >= pHead->m_nEnqIdx.load( memory_model::memory_order_acquire )
+                && pHead->m_pNext.load( memory_model::memory_order_acquire ) == nullptr;
+        }
+
+        /// Returns queue's item count
+        /**
+            The value returned depends on \p faa_array_queue::traits::item_counter.
+            For \p atomicity::empty_item_counter, this function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns reference to internal statistics
+        const stat& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        void do_enqueue( value_type * pVal )
+        {
+            assert( pVal != nullptr );
+            // LSB is used as a flag in marked pointer
+            assert( ( reinterpret_cast<uintptr_t>( pVal ) & 1 ) == 0 );
+
+            typename gc::Guard guard;
+            while ( true ) {
+                segment * pTail = guard.protect( m_pTail );
+                size_t const nIdx = pTail->m_nEnqIdx.fetch_add( 1, memory_model::memory_order_acq_rel );
+
+                if ( nIdx < c_nSegmentSize ) {
+                    cell_value nullCell;
+                    if ( pTail->m_Cells[nIdx].compare_exchange_strong( nullCell, cell_value( pVal ),
+                        memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                    {
+                        break;
+                    }
+                    // A dequeuer has visited this cell before us, try the next cell
+                    m_Stat.onEnqueueRace();
+                    continue;
+                }
+
+                // The tail segment is full
+                if ( pTail != m_pTail.load( memory_model::memory_order_acquire ))
+                    continue;
+
+                segment * pNext = pTail->m_pNext.load( memory_model::memory_order_acquire );
+                if ( pNext == nullptr ) {
+                    // Append new segment containing the value
+                    segment * pNew = cxx_segment_allocator().New( pVal );
+                    segment * pExpected = nullptr;
+                    if ( pTail->m_pNext.compare_exchange_strong( pExpected, pNew,
+                        memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                    {
+                        m_pTail.compare_exchange_strong( pTail, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                        m_Stat.onSegmentCreated();
+                        break;
+                    }
+                    // Another thread has appended the segment
+                    // The value must not be freed with the discarded segment
+                    pNew->m_Cells[0].store( cell_value(), atomics::memory_order_relaxed );
+                    segment_disposer()( pNew );
+                    m_Stat.onSegmentRace();
+                }
+                else {
+                    // Help to advance the tail
+                    m_pTail.compare_exchange_strong( pTail, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                }
+            }
+
+            ++m_ItemCounter;
+            m_Stat.onEnqueue();
+        }
+
+        value_type * do_dequeue()
+        {
+            typename gc::Guard guard;
+            while ( true ) {
+                segment * pHead = guard.protect( m_pHead );
+
+                if ( pHead->m_nDeqIdx.load( memory_model::memory_order_acquire ) >= pHead->m_nEnqIdx.load( memory_model::memory_order_acquire )
+                    && pHead->m_pNext.load( memory_model::memory_order_acquire ) == nullptr )
+                {
+                    break;
+                }
+
+                size_t const nIdx = pHead->m_nDeqIdx.fetch_add( 1, memory_model::memory_order_acq_rel );
+                if ( nIdx < c_nSegmentSize ) {
+                    cell_value item = pHead->m_Cells[nIdx].exchange( cell_value( nullptr, 1 ), memory_model::memory_order_acquire );
+                    if ( item.ptr() ) {
+                        --m_ItemCounter;
+                        m_Stat.onDequeue();
+                        return item.ptr();
+                    }
+                    // The enqueuer of this cell is late, it will take another cell
+                    m_Stat.onDequeueRace();
+                    continue;
+                }
+
+                // The head segment is exhausted
+                segment * pNext = pHead->m_pNext.load( memory_model::memory_order_acquire );
+                if ( pNext == nullptr )
+                    break;
+
+                if ( m_pHead.compare_exchange_strong( pHead, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed )) {
+                    // The tail must not point to the retired segment
+                    segment * pTail = m_pTail.load( memory_model::memory_order_acquire );
+                    if ( pTail == pHead )
+                        m_pTail.compare_exchange_strong( pTail, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                    gc::template retire<segment_disposer>( pHead );
+                    m_Stat.onSegmentDeleted();
+                }
+            }
+
+            m_Stat.onEmptyDequeue();
+            return nullptr;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_FAA_ARRAY_QUEUE_H
@@ -432,6 +432,22 @@ namespace cds { namespace container {
             base_class::get_level_statistics(stat);
         }
 
+        /// Collects memory usage statistics of array nodes into \p stat
+        /** @copydetails cds::intrusive::FeldmanHashSet::get_memory_statistics
+        */
+        void get_memory_statistics( feldman_hashset::memory_statistics& stat ) const
+        {
+            base_class::get_memory_statistics( stat );
+        }
+
+        /// Compacts the tree (not thread safe)
+        /** @copydetails cds::intrusive::FeldmanHashSet::compact
+        */
+        size_t compact()
+        {
+            return base_class::compact();
+        }
+
     public:
         ///@name Thread-safe iterators
         /** @anchor cds_container_FeldmanHashSet_rcu_iterators
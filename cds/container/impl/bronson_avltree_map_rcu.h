@@ -668,6 +668,78 @@ namespace cds { namespace container {
             return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), []( node_type * ) -> bool { return true; } );
         }
 
+        /// Applies \p f to each item with the key in range <tt>[lo, hi]</tt> in ascending key order
+        /** \anchor cds_container_BronsonAVLTreeMap_rcu_ptr_for_each_in_range
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& item );
+            };
+            \endcode
+            The function walks the tree in order under RCU lock validating the version of each node passed.
+            If a rotation moves the part of the tree being traversed, the walk is resumed from the root
+            with the key following the last visited one, so each key is visited at most once and in ascending order.
+            The scan is weakly consistent: the items that are in the map during the entire scan are visited,
+            the items inserted or removed concurrently may or may not be visited.
+
+            The functor is called under RCU lock without node-level locking, so it should not modify
+            the map and should be short. The value cannot be freed while \p f is called but it may be
+            concurrently replaced by \p update().
+
+            The function applies RCU lock internally. Returns the count of visited items.
+        */
+        template <typename K, typename Func>
+        size_t for_each_in_range( K const& lo, K const& hi, Func f ) const
+        {
+            return do_for_each_in_range( lo, hi, key_comparator(),
+                [&f]( key_type const& key, mapped_type pVal ) { f( key, *pVal ); }, false );
+        }
+
+        /// Applies \p f to each item with the key in range <tt>[lo, hi]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_container_BronsonAVLTreeMap_rcu_ptr_for_each_in_range "for_each_in_range(K const&, K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        size_t for_each_in_range_with( K const& lo, K const& hi, Less pred, Func f ) const
+        {
+            CDS_UNUSED( pred );
+            return do_for_each_in_range( lo, hi, cds::opt::details::make_comparator_from_less<Less>(),
+                [&f]( key_type const& key, mapped_type pVal ) { f( key, *pVal ); }, false );
+        }
+
+        /// Counts the items with the key in range <tt>[lo, hi]</tt>
+        /** \anchor cds_container_BronsonAVLTreeMap_rcu_ptr_count_in_range
+            The function is an optimistic snapshot count: it traverses the range like \p for_each_in_range()
+            but if the tree has been restructured under the traversal, the count is restarted from scratch.
+            If the range is not modified during the call, the result is exact. Under heavy concurrent
+            modification, after several failed attempts the function falls back to the weakly consistent
+            count that includes all the items present during the entire call.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        size_t count_in_range( K const& lo, K const& hi ) const
+        {
+            return do_for_each_in_range( lo, hi, key_comparator(), []( key_type const&, mapped_type ) {}, true );
+        }
+
+        /// Counts the items with the key in range <tt>[lo, hi]</tt> using \p pred predicate for key comparing
+        /**
+            The function is an analog of \ref cds_container_BronsonAVLTreeMap_rcu_ptr_count_in_range "count_in_range(K const&, K const&)"
+            but \p pred is used for key comparing.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        size_t count_in_range_with( K const& lo, K const& hi, Less pred ) const
+        {
+            CDS_UNUSED( pred );
+            return do_for_each_in_range( lo, hi, cds::opt::details::make_comparator_from_less<Less>(),
+                []( key_type const&, mapped_type ) {}, true );
+        }
+
         /// Clears the tree (thread safe, not atomic)
         /**
             The function unlink all items from the tree.
@@ -823,6 +895,29 @@ namespace cds { namespace container {
             return result == find_result::found;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        size_t do_for_each_in_range( Q const& lo, Q const& hi, Compare cmp, Func f, bool bSnapshot ) const
+        {
+            // In snapshot mode the traversal is restarted from scratch when the tree
+            // has been restructured under the scan, otherwise it continues after the last visited key
+            static unsigned int const c_nMaxSnapshotAttempts = 16;
+
+            size_t nCount = 0;
+            unsigned int nAttempt = 0;
+            node_type * pLast = nullptr;
+
+            rcu_lock l;
+            while ( !try_for_each_in_range( lo, hi, cmp, f, pLast, nCount )) {
+                m_stat.onScanRetry();
+                if ( bSnapshot && ++nAttempt < c_nMaxSnapshotAttempts ) {
+                    pLast = nullptr;
+                    nCount = 0;
+                }
+            }
+            m_stat.onScan();
+            return nCount;
+        }
+
         template <typename K, typename Compare, typename Func>
         int do_update( K const& key, Compare cmp, Func funcUpdate, int nFlags )
         {
@@ -1056,6 +1151,90 @@ namespace cds { namespace container {
             return find_result::retry;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        bool try_for_each_in_range( Q const& lo, Q const& hi, Compare cmp, Func& f, node_type *& pLast, size_t& nCount ) const
+        {
+            // In-order traversal with explicit stack. Each node is pushed with the version read before
+            // its children were followed; if the version changes (the node has been shrunk by a rotation
+            // or unlinked) the part of the tree below it may have moved, and the traversal fails.
+            // pLast is the last node passed, the retry continues from the key following pLast->m_key
+            assert( gc::is_locked() );
+
+            struct stack_record
+            {
+                node_type * pNode;
+                version_type nVersion;
+            };
+
+            stack_record stack[c_stackSize];
+            int pos = -1;
+            key_comparator keyCmp;
+
+            auto is_lower = [&]( node_type * pNode ) -> bool {
+                return pLast ? keyCmp( pNode->m_key, pLast->m_key ) <= 0 : cmp( lo, pNode->m_key ) > 0;
+            };
+
+            // Reads pParent's child in nDir direction and descends along the left spine of the subtree
+            // pushing the nodes that are not less than the lower bound
+            auto descend = [&]( node_type * pParent, version_type nParentVersion, int nDir ) -> bool {
+                while ( true ) {
+                    node_type * pNode = child( pParent, nDir, memory_model::memory_order_acquire );
+                    if ( !pNode )
+                        return pParent->version( memory_model::memory_order_acquire ) == nParentVersion;
+
+                    version_type nVersion = pNode->version( memory_model::memory_order_acquire );
+                    if ( nVersion & node_type::shrinking ) {
+                        m_stat.onFindWaitShrinking();
+                        pNode->template wait_until_shrink_completed<back_off>( memory_model::memory_order_acquire );
+                        return false;
+                    }
+                    if ( nVersion == node_type::unlinked || pParent->version( memory_model::memory_order_acquire ) != nParentVersion )
+                        return false;
+
+                    if ( is_lower( pNode )) {
+                        // pNode and its left subtree are out of range
+                        nDir = right_child;
+                    }
+                    else {
+                        ++pos;
+                        assert( pos < c_stackSize );
+                        stack[pos].pNode = pNode;
+                        stack[pos].nVersion = nVersion;
+                        nDir = left_child;
+                    }
+                    pParent = pNode;
+                    nParentVersion = nVersion;
+                }
+            };
+
+            if ( !descend( m_pRoot, m_pRoot->version( memory_model::memory_order_acquire ), right_child ))
+                return false;
+
+            while ( pos >= 0 ) {
+                node_type * pNode = stack[pos].pNode;
+                version_type nVersion = stack[pos].nVersion;
+                --pos;
+
+                if ( pNode->version( memory_model::memory_order_acquire ) != nVersion )
+                    return false;
+                if ( cmp( hi, pNode->m_key ) < 0 )
+                    return true;
+
+                if ( !is_lower( pNode )) {
+                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_acquire );
+                    if ( pVal ) {
+                        f( pNode->m_key, pVal );
+                        ++nCount;
+                    }
+                    pLast = pNode;
+                }
+
+                if ( !descend( pNode, nVersion, right_child ))
+                    return false;
+            }
+            return true;
+        }
+
         template <typename K, typename Compare, typename Func>
         int try_update_root( K const& key, Compare cmp, int nFlags, Func funcUpdate, rcu_disposer& disp )
         {
@@ -148,6 +148,9 @@ namespace cds { namespace container {
         /// Count of hazard pointers required
         static CDS_CONSTEXPR size_t const c_nHazardPtrCount = base_class::c_nHazardPtrCount;
 
+        /// Count of items processed together by batch operations, see \p insert_batch()
+        static CDS_CONSTEXPR size_t const c_nBatchSize = base_class::c_nBatchSize;
+
         typedef typename base_class::iterator               iterator;       ///< @ref cds_container_FeldmanHashSet_iterators "bidirectional iterator" type
         typedef typename base_class::const_iterator         const_iterator; ///< @ref cds_container_FeldmanHashSet_iterators "bidirectional const iterator" type
         typedef typename base_class::reverse_iterator       reverse_iterator;       ///< @ref cds_container_FeldmanHashSet_iterators "bidirectional reverse iterator" type
@@ -420,6 +423,66 @@ namespace cds { namespace container {
             return base_class::get( hash );
         }
 
+        /// Inserts the elements for the values of the batch
+        /**
+            The function is an analog of <tt>insert( Q const& )</tt> for \p nCount values of the array \p pVals.
+            The values are processed in groups of \p c_nBatchSize: the elements of the group are created
+            and the cells of the first two levels of the multi-level array are prefetched for all elements
+            of the group before the first insertion, so the cache misses are overlapped.
+            This is useful for big sets which do not fit into the cache.
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of inserting <tt>pVals[i]</tt>.
+            Returns the count of inserted elements.
+
+            The batch is not atomic: each element is inserted by a separate operation.
+        */
+        template <typename Q>
+        size_t insert_batch( Q const* pVals, size_t nCount, bool * pResult = nullptr )
+        {
+            return cds::details::batch_apply<c_nBatchSize>( pVals, nCount, pResult,
+                []( Q const& val ) -> value_type * { return cxx_node_allocator().New( val ); },
+                [this]( value_type * pNode ) { base_class::prefetch( hash_accessor()( *pNode ), 1 ); },
+                [this]( value_type * pNode ) { base_class::prefetch( hash_accessor()( *pNode ), 2 ); },
+                [this]( value_type * pNode, Q const& ) -> bool {
+                    scoped_node_ptr sp( pNode );
+                    if ( base_class::insert( *sp )) {
+                        sp.release();
+                        return true;
+                    }
+                    return false;
+                });
+        }
+
+        /// Checks whether the set contains the hashes of the batch
+        /**
+            The function is an analog of <tt>contains( hash_type const& )</tt> for \p nCount hashes of the array \p pHashes,
+            the cells of the multi-level array are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pHashes[i]</tt> is found.
+            Returns the count of hashes found.
+        */
+        size_t find_batch( hash_type const* pHashes, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pHashes, nCount, pResult,
+                []( hash_type const& hash ) -> hash_type const& { return hash; },
+                [this]( hash_type const& hash ) -> bool { return base_class::contains( hash ); });
+        }
+
+        /// Deletes the items with the hashes of the batch
+        /**
+            The function is an analog of <tt>erase( hash_type const& )</tt> for \p nCount hashes of the array \p pHashes,
+            the cells of the multi-level array are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if the item with <tt>pHashes[i]</tt> is deleted.
+            Returns the count of deleted items.
+        */
+        size_t erase_batch( hash_type const* pHashes, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pHashes, nCount, pResult,
+                []( hash_type const& hash ) -> hash_type const& { return hash; },
+                [this]( hash_type const& hash ) -> bool { return base_class::erase( hash ); });
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all data node from the set.
@@ -473,6 +536,22 @@ namespace cds { namespace container {
             base_class::get_level_statistics(stat);
         }
 
+        /// Collects memory usage statistics of array nodes into \p stat
+        /** @copydetails cds::intrusive::FeldmanHashSet::get_memory_statistics
+        */
+        void get_memory_statistics( feldman_hashset::memory_statistics& stat ) const
+        {
+            base_class::get_memory_statistics( stat );
+        }
+
+        /// Compacts the tree (not thread safe)
+        /** @copydetails cds::intrusive::FeldmanHashSet::compact
+        */
+        size_t compact()
+        {
+            return base_class::compact();
+        }
+
     public:
     ///@name Thread-safe iterators
         /** @anchor cds_container_FeldmanHashSet_iterators
@@ -762,6 +762,22 @@ namespace cds { namespace container {
             base_class::clear();
         }
 
+        //@cond
+        // MichaelHashMap expandable bucket table support
+        // \p pred is called for the key of each item
+        template <typename Predicate>
+        size_t split_to( MichaelKVList& lo, MichaelKVList& hi, Predicate pred )
+        {
+            return base_class::split_to( lo, hi, [&pred]( node_type const& node ) { return pred( node.m_Data.first ); } );
+        }
+
+        // Hash set batch operation support: prefetches the first node of the list
+        void prefetch() const
+        {
+            base_class::prefetch();
+        }
+        //@endcond
+
     protected:
         //@cond
         bool insert_node_at( head_type& refHead, node_type * pNode )
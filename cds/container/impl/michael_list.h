@@ -731,6 +731,22 @@ namespace cds { namespace container {
             base_class::clear();
         }
 
+        //@cond
+        // MichaelHashSet expandable bucket table support
+        // \p pred is called for the value of each item
+        template <typename Predicate>
+        size_t split_to( MichaelList& lo, MichaelList& hi, Predicate pred )
+        {
+            return base_class::split_to( lo, hi, [&pred]( node_type const& node ) { return pred( node_to_value( node ) ); } );
+        }
+
+        // Hash set batch operation support: prefetches the first node of the list
+        void prefetch() const
+        {
+            base_class::prefetch();
+        }
+        //@endcond
+
     protected:
         //@cond
         bool insert_node_at( head_type& refHead, node_type * pNode )
@@ -677,6 +677,98 @@ namespace cds { namespace container {
             return gp;
         }
 
+        /// Finds the first item that is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_hp_lower_bound
+            The function returns the guarded pointer to the first item whose key is greater than or equal to \p key.
+            If there is no such item the function returns an empty guarded pointer.
+        */
+        template <typename K>
+        guarded_ptr lower_bound( K const& key )
+        {
+            guarded_ptr gp;
+            base_class::lower_bound_( gp.guard(), key, typename base_class::key_comparator() );
+            return gp;
+        }
+
+        /// Finds the first item that is not less than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_hp_lower_bound "lower_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        guarded_ptr lower_bound_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            typedef cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor > wrapped_less;
+            guarded_ptr gp;
+            base_class::lower_bound_( gp.guard(), key, cds::opt::details::make_comparator_from_less< wrapped_less >());
+            return gp;
+        }
+
+        /// Finds the first item that is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_hp_upper_bound
+            The function returns the guarded pointer to the first item whose key is strictly greater than \p key.
+            If there is no such item the function returns an empty guarded pointer.
+        */
+        template <typename K>
+        guarded_ptr upper_bound( K const& key )
+        {
+            guarded_ptr gp;
+            base_class::upper_bound_( gp.guard(), key, typename base_class::key_comparator() );
+            return gp;
+        }
+
+        /// Finds the first item that is greater than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_hp_upper_bound "upper_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        guarded_ptr upper_bound_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            typedef cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor > wrapped_less;
+            guarded_ptr gp;
+            base_class::upper_bound_( gp.guard(), key, cds::opt::details::make_comparator_from_less< wrapped_less >());
+            return gp;
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt>
+        /** \anchor cds_nonintrusive_SkipListMap_hp_for_each_in_range
+            The function walks the items with keys from \p lo to \p hi inclusive in ascending order
+            calling \p f for each of them. The functor signature is:
+            \code
+            void f( value_type& item );
+            \endcode
+            The item passed to \p f is protected by GC's guard while \p f is called.
+            The functor should not call the functions of the map since all the guards of the current thread may be in use.
+
+            The scan is weakly consistent: each item that is in the map during the entire scan is visited exactly once;
+            items inserted or deleted concurrently may or may not be visited.
+            The function returns the count of visited items.
+        */
+        template <typename K, typename Func>
+        size_t for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            return base_class::for_each_in_range( lo, hi, [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt> using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_hp_for_each_in_range "for_each_in_range(K const&, K const&, Func)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        size_t for_each_in_range_with( K const& lo, K const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::for_each_in_range_with( lo, hi, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >(),
+                [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
         /// Clears the map
         void clear()
         {
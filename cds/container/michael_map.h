@@ -33,6 +33,7 @@
 
 #include <cds/container/details/michael_map_base.h>
 #include <cds/details/allocator.h>
+#include <cds/details/batch_apply.h>
 
 namespace cds { namespace container {
 
@@ -45,8 +46,10 @@ namespace cds { namespace container {
 
         Michael's hash table algorithm is based on lock-free ordered list and it is very simple.
         The main structure is an array \p T of size \p M. Each element in \p T is basically a pointer
-        to a hash bucket, implemented as a singly linked list. The array of buckets cannot be dynamically expanded.
+        to a hash bucket, implemented as a singly linked list. By default, the array of buckets cannot be dynamically expanded.
         However, each bucket may contain unbounded number of items.
+        If \p michael_map::traits::dynamic_bucket_table is \p true the bucket table is expanded online
+        for \p gc::HP and \p gc::DHP, see \ref cds_intrusive_MichaelHashSet_hp "intrusive MichaelHashSet" for details.
 
         Template parameters are:
         - \p GC - Garbage collector used. You may use any \ref cds_garbage_collector "Garbage collector"
@@ -204,17 +207,22 @@ namespace cds { namespace container {
 
         /// Bucket table allocator
         typedef cds::details::Allocator< bucket_type, typename traits::allocator >  bucket_table_allocator;
+
+        //@cond
+        typedef typename cds::intrusive::michael_set::details::bucket_table_selector< bucket_type, traits, hash >::type bucket_table;
+        //@endcond
+
+        /// Internal statistics of expandable bucket table, see \p michael_map::traits::stat
+        typedef typename bucket_table::stat stat;
         typedef typename bucket_type::guarded_ptr  guarded_ptr; ///< Guarded pointer
 
+        /// Count of keys processed together by batch operations, see \p insert_batch()
+        static CDS_CONSTEXPR size_t const c_nBatchSize = cds::details::c_nBatchSize;
+
     protected:
         item_counter    m_ItemCounter; ///< Item counter
         hash            m_HashFunctor; ///< Hash functor
-        bucket_type *   m_Buckets;     ///< bucket table
-
-    private:
-        //@cond
-        const size_t    m_nHashBitmask;
-        //@endcond
+        bucket_table    m_Buckets;     ///< bucket table
 
     protected:
         //@cond
@@ -222,14 +230,34 @@ namespace cds { namespace container {
         template <typename Q>
         size_t hash_value( Q const& key ) const
         {
-            return m_HashFunctor( key ) & m_nHashBitmask;
+            return m_HashFunctor( key );
         }
 
         /// Returns the bucket (ordered list) for \p key
+        /**
+            The bucket cannot be migrated while the returned object is alive
+        */
         template <typename Q>
-        bucket_type&    bucket( Q const& key )
+        typename bucket_table::bucket_ref bucket( Q const& key )
         {
-            return m_Buckets[ hash_value( key ) ];
+            return m_Buckets.bucket( hash_value( key ));
+        }
+
+        /// Applies \p op to the keys of the batch
+        /**
+            The keys are processed in groups of \p c_nBatchSize keys. For each group the hash values are computed
+            and the buckets are prefetched, then the first nodes of the bucket lists are prefetched,
+            and then <tt>op( bucket_ref&&, key )</tt> is called for each key of the group.
+            So the cache misses of the group overlap.
+        */
+        template <typename Q, typename Func>
+        size_t batch_apply( Q const* pKeys, size_t nCount, bool * pResult, Func op )
+        {
+            return cds::details::batch_apply<c_nBatchSize>( pKeys, nCount, pResult,
+                [this]( Q const& key ) -> size_t { return hash_value( key ); },
+                [this]( size_t nHash ) { m_Buckets.prefetch( nHash ); },
+                [this]( size_t nHash ) { m_Buckets.prefetch_head( nHash ); },
+                [this, &op]( size_t nHash, Q const& key ) -> bool { return op( m_Buckets.bucket( nHash ), key ); });
         }
         //@endcond
 
@@ -335,7 +363,8 @@ namespace cds { namespace container {
         */
         iterator begin()
         {
-            return iterator( m_Buckets[0].begin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() );
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a map
@@ -346,7 +375,8 @@ namespace cds { namespace container {
         */
         iterator end()
         {
-            return iterator( m_Buckets[bucket_count() - 1].end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
 
         /// Returns a forward const iterator addressing the first element in a map
@@ -377,11 +407,13 @@ namespace cds { namespace container {
         //@cond
         const_iterator get_const_begin() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[0]).begin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() );
         }
         const_iterator get_const_end() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[bucket_count() - 1]).end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
         //@endcond
 
@@ -395,11 +427,12 @@ namespace cds { namespace container {
             Note, that many popular STL hash map implementation uses load factor 1.
 
             The ctor defines hash table size as rounding <tt>nMacItemCount / nLoadFactor</tt> up to nearest power of two.
+            For expandable bucket table (see \p michael_map::traits::dynamic_bucket_table) it is the initial size of the table.
         */
         MichaelHashMap(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash map
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
-        ) : m_nHashBitmask( michael_map::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+        ) : m_Buckets( nMaxItemCount, nLoadFactor )
         {
             // GC and OrderedList::gc must be the same
             static_assert( std::is_same<gc, typename bucket_type::gc>::value, "GC and OrderedList::gc must be the same");
@@ -407,15 +440,12 @@ namespace cds { namespace container {
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert( !std::is_same<item_counter, atomicity::empty_item_counter>::value,
                            "atomicity::empty_item_counter is not allowed as a item counter");
-
-            m_Buckets = bucket_table_allocator().NewArray( bucket_count() );
         }
 
         /// Clears hash map and destroys it
         ~MichaelHashMap()
         {
             clear();
-            bucket_table_allocator().Delete( m_Buckets, bucket_count() );
         }
 
         /// Inserts new node with key and default value
@@ -432,9 +462,11 @@ namespace cds { namespace container {
         template <typename K>
         bool insert( const K& key )
         {
-            const bool bRet = bucket( key ).insert( key );
-            if ( bRet )
+            const bool bRet = bucket( key )->insert( key );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -452,9 +484,11 @@ namespace cds { namespace container {
         template <typename K, typename V>
         bool insert( K const& key, V const& val )
         {
-            const bool bRet = bucket( key ).insert( key, val );
-            if ( bRet )
+            const bool bRet = bucket( key )->insert( key, val );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -492,9 +526,11 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool insert_with( const K& key, Func func )
         {
-            const bool bRet = bucket( key ).insert_with( key, func );
-            if ( bRet )
+            const bool bRet = bucket( key )->insert_with( key, func );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -530,9 +566,11 @@ namespace cds { namespace container {
         template <typename K, typename Func >
         std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> bRet = bucket( key ).update( key, func, bAllowInsert );
-            if ( bRet.first && bRet.second )
+            std::pair<bool, bool> bRet = bucket( key )->update( key, func, bAllowInsert );
+            if ( bRet.first && bRet.second ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
         //@cond
@@ -540,9 +578,11 @@ namespace cds { namespace container {
         CDS_DEPRECATED("ensure() is deprecated, use update()")
         std::pair<bool, bool> ensure( K const& key, Func func )
         {
-            std::pair<bool, bool> bRet = bucket( key ).update( key, func, true );
-            if ( bRet.first && bRet.second )
+            std::pair<bool, bool> bRet = bucket( key )->update( key, func, true );
+            if ( bRet.first && bRet.second ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
         //@endcond
@@ -556,9 +596,11 @@ namespace cds { namespace container {
         template <typename K, typename... Args>
         bool emplace( K&& key, Args&&... args )
         {
-            const bool bRet = bucket( key ).emplace( std::forward<K>(key), std::forward<Args>(args)... );
-            if ( bRet )
+            const bool bRet = bucket( key )->emplace( std::forward<K>(key), std::forward<Args>(args)... );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -570,7 +612,7 @@ namespace cds { namespace container {
         template <typename K>
         bool erase( K const& key )
         {
-            const bool bRet = bucket( key ).erase( key );
+            const bool bRet = bucket( key )->erase( key );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -586,7 +628,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool erase_with( K const& key, Less pred )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred );
+            const bool bRet = bucket( key )->erase_with( key, pred );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -610,7 +652,7 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool erase( K const& key, Func f )
         {
-            const bool bRet = bucket( key ).erase( key, f );
+            const bool bRet = bucket( key )->erase( key, f );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -626,7 +668,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool erase_with( K const& key, Less pred, Func f )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred, f );
+            const bool bRet = bucket( key )->erase_with( key, pred, f );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -661,7 +703,7 @@ namespace cds { namespace container {
         template <typename K>
         guarded_ptr extract( K const& key )
         {
-            guarded_ptr gp( bucket( key ).extract( key ));
+            guarded_ptr gp( bucket( key )->extract( key ));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -679,7 +721,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         guarded_ptr extract_with( K const& key, Less pred )
         {
-            guarded_ptr gp( bucket( key ).extract_with( key, pred ));
+            guarded_ptr gp( bucket( key )->extract_with( key, pred ));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -707,7 +749,7 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool find( K const& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return bucket( key )->find( key, f );
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -720,7 +762,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool find_with( K const& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return bucket( key )->find_with( key, pred, f );
         }
 
         /// Checks whether the map contains \p key
@@ -731,14 +773,14 @@ namespace cds { namespace container {
         template <typename K>
         bool contains( K const& key )
         {
-            return bucket( key ).contains( key );
+            return bucket( key )->contains( key );
         }
         //@cond
         template <typename K>
         CDS_DEPRECATED("deprecated, use contains()")
         bool find( K const& key )
         {
-            return bucket( key ).contains( key );
+            return bucket( key )->contains( key );
         }
         //@endcond
 
@@ -751,14 +793,14 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool contains( K const& key, Less pred )
         {
-            return bucket( key ).contains( key, pred );
+            return bucket( key )->contains( key, pred );
         }
         //@cond
         template <typename K, typename Less>
         CDS_DEPRECATED("deprecated, use contains()")
         bool find_with( K const& key, Less pred )
         {
-            return bucket( key ).contains( key, pred );
+            return bucket( key )->contains( key, pred );
         }
         //@endcond
 
@@ -791,7 +833,7 @@ namespace cds { namespace container {
         template <typename K>
         guarded_ptr get( K const& key )
         {
-            return bucket( key ).get( key );
+            return bucket( key )->get( key );
         }
 
         /// Finds \p key and return the item found
@@ -806,14 +848,74 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         guarded_ptr get_with( K const& key, Less pred )
         {
-            return bucket( key ).get_with( key, pred );
+            return bucket( key )->get_with( key, pred );
+        }
+
+        /// Inserts the items for the keys of the batch
+        /**
+            The function is an analog of <tt>insert( K const& )</tt> for \p nCount keys of the array \p pKeys.
+            The keys are processed in groups of \p c_nBatchSize: the buckets of the whole group are prefetched
+            before the first insertion, so the cache misses are overlapped.
+            This is useful for big maps which do not fit into the cache.
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of inserting <tt>pKeys[i]</tt>.
+            Returns the count of inserted items.
+
+            The batch is not atomic: each key is inserted by a separate operation.
+        */
+        template <typename K>
+        size_t insert_batch( K const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, [this]( typename bucket_table::bucket_ref&& refBucket, K const& key ) -> bool {
+                if ( refBucket->insert( key )) {
+                    ++m_ItemCounter;
+                    m_Buckets.check_load( size());
+                    return true;
+                }
+                return false;
+            });
+        }
+
+        /// Checks whether the map contains the keys of the batch
+        /**
+            The function is an analog of <tt>contains( K const& )</tt> for \p nCount keys of the array \p pKeys,
+            the buckets are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is found.
+            Returns the count of keys found.
+        */
+        template <typename K>
+        size_t find_batch( K const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, []( typename bucket_table::bucket_ref&& refBucket, K const& key ) -> bool {
+                return refBucket->contains( key );
+            });
+        }
+
+        /// Deletes the keys of the batch
+        /**
+            The function is an analog of <tt>erase( K const& )</tt> for \p nCount keys of the array \p pKeys,
+            the buckets are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is deleted.
+            Returns the count of deleted items.
+        */
+        template <typename K>
+        size_t erase_batch( K const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, [this]( typename bucket_table::bucket_ref&& refBucket, K const& key ) -> bool {
+                if ( refBucket->erase( key )) {
+                    --m_ItemCounter;
+                    return true;
+                }
+                return false;
+            });
         }
 
         /// Clears the map (not atomic)
         void clear()
         {
-            for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear();
+            m_Buckets.clear();
             m_ItemCounter.reset();
         }
 
@@ -835,13 +937,19 @@ namespace cds { namespace container {
 
         /// Returns the size of hash table
         /**
-            Since \p %MichaelHashMap cannot dynamically extend the hash table size,
-            the value returned is an constant depending on object initialization parameters;
+            For fixed bucket table the value returned is an constant depending on object initialization parameters;
             see \p MichaelHashMap::MichaelHashMap for explanation.
+            For expandable bucket table the function returns the size of the newest table.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1;
+            return m_Buckets.bucket_count();
+        }
+
+        /// Returns const reference to internal statistics of expandable bucket table
+        stat const& statistics() const
+        {
+            return m_Buckets.statistics();
         }
     };
 }}  // namespace cds::container
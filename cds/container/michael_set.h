@@ -33,6 +33,7 @@
 
 #include <cds/container/details/michael_set_base.h>
 #include <cds/details/allocator.h>
+#include <cds/details/batch_apply.h>
 
 namespace cds { namespace container {
 
@@ -45,8 +46,10 @@ namespace cds { namespace container {
 
         Michael's hash table algorithm is based on lock-free ordered list and it is very simple.
         The main structure is an array \p T of size \p M. Each element in \p T is basically a pointer
-        to a hash bucket, implemented as a singly linked list. The array of buckets cannot be dynamically expanded.
+        to a hash bucket, implemented as a singly linked list. By default, the array of buckets cannot be dynamically expanded.
         However, each bucket may contain unbounded number of items.
+        If \p michael_set::traits::dynamic_bucket_table is \p true the bucket table is expanded online
+        for \p gc::HP and \p gc::DHP, see \ref cds_intrusive_MichaelHashSet_hp "intrusive MichaelHashSet" for details.
 
         Template parameters are:
         - \p GC - Garbage collector used. You may use any \ref cds_garbage_collector "Garbage collector"
@@ -221,17 +224,22 @@ namespace cds { namespace container {
         /// Bucket table allocator
         typedef cds::details::Allocator< bucket_type, typename traits::allocator >  bucket_table_allocator;
 
+        //@cond
+        typedef typename cds::intrusive::michael_set::details::bucket_table_selector< bucket_type, traits, hash >::type bucket_table;
+        //@endcond
+
+        /// Internal statistics of expandable bucket table, see \p michael_set::traits::stat
+        typedef typename bucket_table::stat stat;
+
         typedef typename bucket_type::guarded_ptr  guarded_ptr; ///< Guarded pointer
 
+        /// Count of keys processed together by batch operations, see \p insert_batch()
+        static CDS_CONSTEXPR size_t const c_nBatchSize = cds::details::c_nBatchSize;
+
     protected:
         item_counter    m_ItemCounter; ///< Item counter
         hash            m_HashFunctor; ///< Hash functor
-        bucket_type *   m_Buckets;     ///< bucket table
-
-    private:
-        //@cond
-        const size_t    m_nHashBitmask;
-        //@endcond
+        bucket_table    m_Buckets;     ///< bucket table
 
     protected:
         //@cond
@@ -239,14 +247,34 @@ namespace cds { namespace container {
         template <typename Q>
         size_t hash_value( Q const& key ) const
         {
-            return m_HashFunctor( key ) & m_nHashBitmask;
+            return m_HashFunctor( key );
         }
 
         /// Returns the bucket (ordered list) for \p key
+        /**
+            The bucket cannot be migrated while the returned object is alive
+        */
         template <typename Q>
-        bucket_type&    bucket( Q const& key )
+        typename bucket_table::bucket_ref bucket( Q const& key )
+        {
+            return m_Buckets.bucket( hash_value( key ));
+        }
+
+        /// Applies \p op to the keys of the batch
+        /**
+            The keys are processed in groups of \p c_nBatchSize keys. For each group the hash values are computed
+            and the buckets are prefetched, then the first nodes of the bucket lists are prefetched,
+            and then <tt>op( bucket_ref&&, key )</tt> is called for each key of the group.
+            So the cache misses of the group overlap.
+        */
+        template <typename Q, typename Func>
+        size_t batch_apply( Q const* pKeys, size_t nCount, bool * pResult, Func op )
         {
-            return m_Buckets[ hash_value( key ) ];
+            return cds::details::batch_apply<c_nBatchSize>( pKeys, nCount, pResult,
+                [this]( Q const& key ) -> size_t { return hash_value( key ); },
+                [this]( size_t nHash ) { m_Buckets.prefetch( nHash ); },
+                [this]( size_t nHash ) { m_Buckets.prefetch_head( nHash ); },
+                [this, &op]( size_t nHash, Q const& key ) -> bool { return op( m_Buckets.bucket( nHash ), key ); });
         }
         //@endcond
 
@@ -263,7 +291,8 @@ namespace cds { namespace container {
         */
         iterator begin()
         {
-            return iterator( m_Buckets[0].begin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() );
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a set
@@ -274,7 +303,8 @@ namespace cds { namespace container {
         */
         iterator end()
         {
-            return iterator( m_Buckets[bucket_count() - 1].end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
 
         /// Returns a forward const iterator addressing the first element in a set
@@ -305,11 +335,13 @@ namespace cds { namespace container {
         //@cond
         const_iterator get_const_begin() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[0]).begin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() );
         }
         const_iterator get_const_end() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[bucket_count() - 1]).end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
         //@endcond
 
@@ -322,11 +354,12 @@ namespace cds { namespace container {
             Remember, since the bucket implementation is an ordered list, searching in the bucket is linear [<tt>O(nLoadFactor)</tt>].
 
             The ctor defines hash table size as rounding <tt>nMaxItemCount / nLoadFactor</tt> up to nearest power of two.
+            For expandable bucket table (see \p michael_set::traits::dynamic_bucket_table) it is the initial size of the table.
         */
         MichaelHashSet(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash set
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
-        ) : m_nHashBitmask( michael_set::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+        ) : m_Buckets( nMaxItemCount, nLoadFactor )
         {
             // GC and OrderedList::gc must be the same
             static_assert( std::is_same<gc, typename bucket_type::gc>::value, "GC and OrderedList::gc must be the same");
@@ -334,15 +367,12 @@ namespace cds { namespace container {
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert( !std::is_same<item_counter, atomicity::empty_item_counter>::value,
                            "cds::atomicity::empty_item_counter is not allowed as a item counter");
-
-            m_Buckets = bucket_table_allocator().NewArray( bucket_count() );
         }
 
         /// Clears hash set and destroys it
         ~MichaelHashSet()
         {
             clear();
-            bucket_table_allocator().Delete( m_Buckets, bucket_count() );
         }
 
         /// Inserts new node
@@ -359,9 +389,11 @@ namespace cds { namespace container {
         template <typename Q>
         bool insert( Q const& val )
         {
-            const bool bRet = bucket( val ).insert( val );
-            if ( bRet )
+            const bool bRet = bucket( val )->insert( val );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -386,9 +418,11 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool insert( Q const& val, Func f )
         {
-            const bool bRet = bucket( val ).insert( val, f );
-            if ( bRet )
+            const bool bRet = bucket( val )->insert( val, f );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -422,9 +456,11 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         std::pair<bool, bool> update( const Q& val, Func func, bool bAllowUpdate = true )
         {
-            std::pair<bool, bool> bRet = bucket( val ).update( val, func, bAllowUpdate );
-            if ( bRet.second )
+            std::pair<bool, bool> bRet = bucket( val )->update( val, func, bAllowUpdate );
+            if ( bRet.second ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
         //@cond
@@ -443,9 +479,11 @@ namespace cds { namespace container {
         template <typename... Args>
         bool emplace( Args&&... args )
         {
-            bool bRet = bucket( value_type(std::forward<Args>(args)...) ).emplace( std::forward<Args>(args)... );
-            if ( bRet )
+            bool bRet = bucket( value_type(std::forward<Args>(args)...) )->emplace( std::forward<Args>(args)... );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -462,7 +500,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool erase( Q const& key )
         {
-            const bool bRet = bucket( key ).erase( key );
+            const bool bRet = bucket( key )->erase( key );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -478,7 +516,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         bool erase_with( Q const& key, Less pred )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred );
+            const bool bRet = bucket( key )->erase_with( key, pred );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -508,7 +546,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool erase( Q const& key, Func f )
         {
-            const bool bRet = bucket( key ).erase( key, f );
+            const bool bRet = bucket( key )->erase( key, f );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -524,7 +562,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less, typename Func>
         bool erase_with( Q const& key, Less pred, Func f )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred, f );
+            const bool bRet = bucket( key )->erase_with( key, pred, f );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -559,7 +597,7 @@ namespace cds { namespace container {
         template <typename Q>
         guarded_ptr extract( Q const& key )
         {
-            guarded_ptr gp( bucket( key ).extract( key ));
+            guarded_ptr gp( bucket( key )->extract( key ));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -577,7 +615,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         guarded_ptr extract_with( Q const& key, Less pred )
         {
-            guarded_ptr gp( bucket( key ).extract_with( key, pred ));
+            guarded_ptr gp( bucket( key )->extract_with( key, pred ));
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -611,13 +649,13 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool find( Q& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return bucket( key )->find( key, f );
         }
         //@cond
         template <typename Q, typename Func>
         bool find( Q const& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return bucket( key )->find( key, f );
         }
         //@endcond
 
@@ -631,13 +669,13 @@ namespace cds { namespace container {
         template <typename Q, typename Less, typename Func>
         bool find_with( Q& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return bucket( key )->find_with( key, pred, f );
         }
         //@cond
         template <typename Q, typename Less, typename Func>
         bool find_with( Q const& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return bucket( key )->find_with( key, pred, f );
         }
         //@endcond
 
@@ -653,7 +691,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return bucket( key ).contains( key );
+            return bucket( key )->contains( key );
         }
         //@cond
         template <typename Q>
@@ -673,7 +711,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         bool contains( Q const& key, Less pred )
         {
-            return bucket( key ).contains( key, pred );
+            return bucket( key )->contains( key, pred );
         }
         //@cond
         template <typename Q, typename Less>
@@ -713,7 +751,7 @@ namespace cds { namespace container {
         template <typename Q>
         guarded_ptr get( Q const& key )
         {
-            return bucket( key ).get( key );
+            return bucket( key )->get( key );
         }
 
         /// Finds the key \p key and return the item found
@@ -728,7 +766,68 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         guarded_ptr get_with( Q const& key, Less pred )
         {
-            return bucket( key ).get_with( key, pred );
+            return bucket( key )->get_with( key, pred );
+        }
+
+        /// Inserts the items for the keys of the batch
+        /**
+            The function is an analog of <tt>insert( Q const& )</tt> for \p nCount keys of the array \p pKeys.
+            The keys are processed in groups of \p c_nBatchSize: the buckets of the whole group are prefetched
+            before the first insertion, so the cache misses are overlapped.
+            This is useful for big sets which do not fit into the cache.
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of inserting <tt>pKeys[i]</tt>.
+            Returns the count of inserted items.
+
+            The batch is not atomic: each key is inserted by a separate operation.
+        */
+        template <typename Q>
+        size_t insert_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, [this]( typename bucket_table::bucket_ref&& refBucket, Q const& key ) -> bool {
+                if ( refBucket->insert( key )) {
+                    ++m_ItemCounter;
+                    m_Buckets.check_load( size());
+                    return true;
+                }
+                return false;
+            });
+        }
+
+        /// Checks whether the set contains the keys of the batch
+        /**
+            The function is an analog of <tt>contains( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the buckets are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is found.
+            Returns the count of keys found.
+        */
+        template <typename Q>
+        size_t find_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, []( typename bucket_table::bucket_ref&& refBucket, Q const& key ) -> bool {
+                return refBucket->contains( key );
+            });
+        }
+
+        /// Deletes the keys of the batch
+        /**
+            The function is an analog of <tt>erase( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the buckets are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is deleted.
+            Returns the count of deleted items.
+        */
+        template <typename Q>
+        size_t erase_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return batch_apply( pKeys, nCount, pResult, [this]( typename bucket_table::bucket_ref&& refBucket, Q const& key ) -> bool {
+                if ( refBucket->erase( key )) {
+                    --m_ItemCounter;
+                    return true;
+                }
+                return false;
+            });
         }
 
         /// Clears the set (non-atomic)
@@ -742,8 +841,7 @@ namespace cds { namespace container {
         */
         void clear()
         {
-            for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear();
+            m_Buckets.clear();
             m_ItemCounter.reset();
         }
 
@@ -765,13 +863,19 @@ namespace cds { namespace container {
 
         /// Returns the size of hash table
         /**
-            Since MichaelHashSet cannot dynamically extend the hash table size,
-            the value returned is an constant depending on object initialization parameters;
-            see MichaelHashSet::MichaelHashSet for explanation.
+            For fixed bucket table the value returned is an constant depending on object initialization parameters;
+            see \p MichaelHashSet::MichaelHashSet for explanation.
+            For expandable bucket table the function returns the size of the newest table.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1;
+            return m_Buckets.bucket_count();
+        }
+
+        /// Returns const reference to internal statistics of expandable bucket table
+        stat const& statistics() const
+        {
+            return m_Buckets.statistics();
         }
     };
 
@@ -138,6 +138,43 @@ namespace cds { namespace container {
             }
         };
         typedef std::unique_ptr< node_type, node_disposer >     scoped_node_ptr;
+
+        // Chain of nodes built by enqueue_bulk(); the nodes are freed if the chain is not enqueued
+        struct scoped_node_chain {
+            node_type * pFirst;
+            node_type * pLast;
+            size_t      nCount;
+
+            scoped_node_chain()
+                : pFirst( nullptr )
+                , pLast( nullptr )
+                , nCount( 0 )
+            {}
+
+            ~scoped_node_chain()
+            {
+                while ( pFirst ) {
+                    node_type * p = pFirst;
+                    pFirst = node_traits::to_value_ptr( p->m_pNext.load( atomics::memory_order_relaxed ));
+                    free_node( p );
+                }
+            }
+
+            void push_back( node_type * pNode )
+            {
+                if ( pLast )
+                    pLast->m_pNext.store( pNode, atomics::memory_order_relaxed );
+                else
+                    pFirst = pNode;
+                pLast = pNode;
+                ++nCount;
+            }
+
+            void release()
+            {
+                pFirst = pLast = nullptr;
+            }
+        };
         //@endcond
 
     public:
@@ -200,6 +237,29 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Enqueues the values of range <tt>[itFirst, itLast)</tt> into the queue
+        /**
+            The function makes a chain of nodes calling copy constructor for each value of the range
+            and then appends the nodes to the queue one by one, see \p intrusive::MoirQueue::enqueue_bulk().
+            Dereferencing of \p InputIterator should return a value convertible to \ref value_type.
+
+            Returns the number of values enqueued.
+        */
+        template <typename InputIterator>
+        size_t enqueue_bulk( InputIterator itFirst, InputIterator itLast )
+        {
+            scoped_node_chain chain;
+            for ( ; itFirst != itLast; ++itFirst )
+                chain.push_back( alloc_node( *itFirst ));
+
+            size_t const nCount = chain.nCount;
+            if ( nCount ) {
+                base_class::do_enqueue_chain( chain.pFirst, chain.pLast, nCount );
+                chain.release();
+            }
+            return nCount;
+        }
+
         /// Synonym for \p enqueue() function
         bool push( value_type const& val )
         {
@@ -247,6 +307,27 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Dequeues up to \p nMax values from the queue
+        /**
+            The function dequeues values while the queue is not empty and \p nMax is not reached.
+            Each dequeued value is moved to \p out.
+            Returns the number of values dequeued.
+
+            The hazard pointers are acquired once for the whole batch.
+        */
+        template <typename OutputIterator>
+        size_t dequeue_bulk( OutputIterator out, size_t nMax )
+        {
+            typename base_class::dequeue_result res;
+            size_t nCount = 0;
+            for ( ; nCount < nMax && base_class::do_dequeue( res ); ++nCount ) {
+                *out = std::move( node_traits::to_value_ptr( *res.pNext )->m_value );
+                ++out;
+                base_class::dispose_result( res );
+            }
+            return nCount;
+        }
+
         /// Synonym for \p dequeue() function
         bool pop( value_type& dest )
         {
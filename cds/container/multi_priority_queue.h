@@ -0,0 +1,540 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_MULTI_PRIORITY_QUEUE_H
+#define CDSLIB_CONTAINER_MULTI_PRIORITY_QUEUE_H
+
+#include <vector>
+#include <algorithm>    // std::push_heap, std::pop_heap
+#include <mutex>        // std::unique_lock
+#include <cds/algo/atomic.h>
+#include <cds/opt/options.h>
+#include <cds/opt/compare.h>
+#include <cds/sync/spinlock.h>
+#include <cds/details/allocator.h>
+#include <cds/details/type_padding.h>
+#include <cds/os/timer.h>
+#include <cds/os/topology.h>
+
+namespace cds { namespace container {
+
+    /// MultiPriorityQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace multi_priority_queue {
+
+        /// MultiPriorityQueue internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat {
+            typedef Counter counter_type;   ///< Event counter type
+
+            counter_type    m_nPush;            ///< Count of push operations
+            counter_type    m_nPop;             ///< Count of success pop operations
+            counter_type    m_nFailedPop;       ///< Count of failed pop operations (pop from empty queue)
+            counter_type    m_nPushContended;   ///< Count of attempts to lock a busy shard in push
+            counter_type    m_nPopContended;    ///< Count of attempts to lock a busy shard in pop
+            counter_type    m_nPopScan;         ///< Count of pop operations that fall back to scanning all shards
+
+            //@cond
+            void onPush()           { ++m_nPush; }
+            void onPop( bool bFailed ) { if ( bFailed ) ++m_nFailedPop; else ++m_nPop; }
+            void onPushContended()  { ++m_nPushContended; }
+            void onPopContended()   { ++m_nPopContended; }
+            void onPopScan()        { ++m_nPopScan; }
+            //@endcond
+        };
+
+        /// MultiPriorityQueue dummy statistics, no overhead
+        struct empty_stat {
+            //@cond
+            void onPush()           {}
+            void onPop( bool )      {}
+            void onPushContended()  {}
+            void onPopContended()   {}
+            void onPopScan()        {}
+            //@endcond
+        };
+
+        /// MultiPriorityQueue traits
+        struct traits
+        {
+            /// Priority compare functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for priority comparing.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none       less;
+
+            /// Shard lock type
+            /**
+                Each shard of the queue is protected by its own lock. The lock must support \p try_lock().
+                Default is \p cds::sync::spin.
+            */
+            typedef cds::sync::spin lock_type;
+
+            /// The allocator used to allocate the shards and the heap arrays
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Move policy
+            /**
+                The move policy used in \p MultiPriorityQueue::pop function
+                to move item's value.
+                Default is \p opt::v::assignment_move_policy.
+            */
+            typedef cds::opt::v::assignment_move_policy  move_policy;
+
+            /// Internal statistics
+            /**
+                Possible types: \p multi_priority_queue::stat, \p multi_priority_queue::empty_stat (the default, no overhead)
+            */
+            typedef empty_stat      stat;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            \p Options are:
+            - \p opt::compare - priority compare functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+            - \p opt::lock_type - shard lock type, it must support \p try_lock(). Default is \p cds::sync::spin.
+            - \p opt::allocator - allocator (like \p std::allocator) for the shards and the heap arrays.
+                Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::move_policy - policy for moving item's value. Default is \p opt::v::assignment_move_policy.
+                If the compiler supports move semantics it would be better to specify the move policy
+                based on the move semantics for type \p T.
+            - \p opt::stat - internal statistics. Available types: \p multi_priority_queue::stat, \p multi_priority_queue::empty_stat (the default, no overhead)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace multi_priority_queue
+
+    /// Relaxed concurrent priority queue (MultiQueue)
+    /** @ingroup cds_nonintrusive_priority_queue
+        Source:
+            - [2015] H.Rihani, P.Sanders, R.Dementiev "MultiQueues: Simpler, Faster, and Better Relaxed Concurrent Priority Queues"
+
+        Exact concurrent priority queues (\p MSPriorityQueue, \p FCPriorityQueue, \p SkipListPriorityQueue)
+        direct all \p pop() calls to the single item with highest priority, so that item is a hot spot
+        that limits scalability. \p %MultiPriorityQueue relaxes the ordering guarantee:
+        the queue consists of \p shard_count() independent sequential heaps, each protected by its own lock.
+        - \p push() inserts the item into a randomly chosen shard.
+        - \p pop() chooses two random shards, compares their tops and extracts the item
+          with higher priority of the two.
+
+        A shard that is locked by another thread is not waited for: the operation just chooses another shard.
+        The item returned by \p pop() is not necessarily the item with highest priority in the queue,
+        but its expected rank (the number of items in the queue that have higher priority) is <tt>O( shard_count() )</tt>.
+        So, the shard count is the relaxation bound: the more shards, the better scalability and the worse
+        ordering. The queue with one shard is an exact priority queue
+        (but it is not better than a \p std::priority_queue protected by a lock).
+        The paper recommends about two shards per thread.
+
+        \p pop() returns \p false only if all shards are empty at the moment of checking.
+
+        Template parameters:
+        - \p T - type to be stored in the queue. The priority is a part of \p T type.
+        - \p Traits - the traits. See \p multi_priority_queue::traits for explanation.
+             It is possible to declare option-based queue with \p multi_priority_queue::make_traits
+             metafunction instead of \p Traits template argument.
+    */
+    template <typename T, class Traits = multi_priority_queue::traits >
+    class MultiPriorityQueue
+    {
+    public:
+        typedef T           value_type  ;   ///< Value type stored in the queue
+        typedef Traits      traits      ;   ///< Traits template parameter
+
+        typedef typename opt::details::make_comparator< value_type, traits >::type key_comparator; ///< priority comparing functor based on opt::compare and opt::less option setter.
+        typedef typename traits::lock_type   lock_type;     ///< Shard lock type
+        typedef typename traits::move_policy move_policy;   ///< Move policy for type \p T
+        typedef typename traits::stat        stat;          ///< internal statistics type
+        typedef typename traits::allocator::template rebind<value_type>::other allocator_type; ///< Value allocator
+
+    protected:
+        //@cond
+        struct value_less {
+            bool operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return key_comparator()( v1, v2 ) < 0;
+            }
+        };
+
+        typedef std::vector< value_type, allocator_type > heap_type;
+
+        struct shard_data {
+            lock_type               lock;
+            heap_type               heap;
+            atomics::atomic<size_t> nSize;  // heap size, may be read without lock
+
+            shard_data()
+                : nSize( 0 )
+            {}
+        };
+        typedef typename cds::details::type_padding< shard_data, cds::c_nCacheLineSize >::type shard;
+
+        typedef cds::details::Allocator< shard, typename traits::allocator > shard_allocator;
+        typedef std::unique_lock< lock_type > scoped_lock;
+        //@endcond
+
+    protected:
+        //@cond
+        shard *             m_arrShards;
+        size_t const        m_nShardCount;
+        stat                m_Stat;
+#ifndef CDS_CXX11_THREAD_LOCAL_SUPPORT
+        atomics::atomic<unsigned int> m_nSeed;
+#endif
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue
+        /**
+            \p nShardCount is the number of internal heaps, it is the relaxation bound of the queue.
+            If \p nShardCount is 0, the queue has two shards per processor.
+        */
+        MultiPriorityQueue( size_t nShardCount = 0 )
+            : m_nShardCount( nShardCount ? nShardCount : default_shard_count() )
+        {
+#ifndef CDS_CXX11_THREAD_LOCAL_SUPPORT
+            m_nSeed.store( (unsigned int) cds::OS::Timer::random_seed() | 1, atomics::memory_order_relaxed );
+#endif
+            m_arrShards = shard_allocator().NewArray( m_nShardCount );
+        }
+
+        /// Clears priority queue and destructs the object
+        ~MultiPriorityQueue()
+        {
+            shard_allocator().Delete( m_arrShards, m_nShardCount );
+        }
+
+        /// Inserts an item into priority queue
+        /**
+            The queue is unbounded, so the function always inserts the copy of \p val
+            and returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            return do_push( [&val]( heap_type& heap ) { heap.push_back( val ); } );
+        }
+
+        /// Inserts an item into priority queue (move semantics)
+        /**
+            The function always returns \p true.
+        */
+        bool push( value_type&& val )
+        {
+            return do_push( [&val]( heap_type& heap ) { heap.push_back( std::move( val )); } );
+        }
+
+        /// Inserts an item into the queue using a functor
+        /**
+            \p Func is a functor called to initialize new item.
+            The functor \p f takes one argument - a reference to a new item of type \ref value_type :
+            \code
+            cds::container::MultiPriorityQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.push_with( [&bar]( Foo& dest ) { dest = bar; } );
+            \endcode
+            The functor is called before the item is inserted into the queue.
+        */
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            value_type val;
+            f( val );
+            return push( std::move( val ));
+        }
+
+        /// Inserts an item created from \p args into priority queue
+        /**
+            The function always returns \p true.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            value_type val( std::forward<Args>(args)... );
+            return push( std::move( val ));
+        }
+
+        /// Extracts item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the copy of extracted item.
+            The item is deleted from the queue.
+
+            The function uses \ref move_policy to move extracted value from the shard's heap
+            to \p dest.
+
+            The extracted item is not necessarily the item with highest priority in the queue,
+            see the class description.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( [&dest]( value_type& src ) { move_policy()(dest, src); } );
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and calls \p f for extracted item.
+            The item is deleted from the queue.
+
+            \p Func is a functor called to copy popped value.
+            The functor takes one argument - a reference to removed item:
+            \code
+            cds:container::MultiPriorityQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.pop_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called under the lock of the shard containing the item.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            if ( m_nShardCount > 1 ) {
+                // Two-choice pop: compare the tops of two random shards
+                // and extract the item with higher priority
+                for ( size_t nAttempt = 0; nAttempt < m_nShardCount; ++nAttempt ) {
+                    size_t const n1 = random( m_nShardCount );
+                    size_t n2 = random( m_nShardCount - 1 );
+                    if ( n2 >= n1 )
+                        ++n2;
+                    shard& s1 = m_arrShards[ n1 ];
+                    shard& s2 = m_arrShards[ n2 ];
+
+                    scoped_lock l1( s1.lock, std::try_to_lock );
+                    if ( !l1.owns_lock() ) {
+                        m_Stat.onPopContended();
+                        continue;
+                    }
+                    scoped_lock l2( s2.lock, std::try_to_lock );
+                    if ( !l2.owns_lock() )
+                        m_Stat.onPopContended();
+
+                    shard * pShard = &s1;
+                    if ( l2.owns_lock() && !s2.heap.empty()
+                        && ( s1.heap.empty() || value_less()( s1.heap.front(), s2.heap.front() )))
+                    {
+                        pShard = &s2;
+                    }
+
+                    if ( !pShard->heap.empty() ) {
+                        extract( *pShard, f );
+                        m_Stat.onPop( false );
+                        return true;
+                    }
+                }
+                m_Stat.onPopScan();
+            }
+
+            // The random shards are empty or busy; the queue may be nearly empty.
+            // Check all shards waiting for the locks
+            for ( shard * p = m_arrShards, *pEnd = m_arrShards + m_nShardCount; p != pEnd; ++p ) {
+                if ( p->nSize.load( atomics::memory_order_relaxed ) == 0 )
+                    continue;
+                scoped_lock l( p->lock );
+                if ( !p->heap.empty() ) {
+                    extract( *p, f );
+                    m_Stat.onPop( false );
+                    return true;
+                }
+            }
+
+            m_Stat.onPop( true );
+            return false;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is not atomic, but thread-safe
+        */
+        void clear()
+        {
+            clear_with( []( value_type& ) {} );
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is not atomic, but thread-safe.
+
+            For each item removed the functor \p f is called.
+            The items are cleared shard by shard, so \p f is not called in priority order.
+            \p Func interface is:
+            \code
+                struct clear_functor
+                {
+                    void operator()( value_type& item );
+                };
+            \endcode
+        */
+        template <typename Func>
+        void clear_with( Func f )
+        {
+            for ( shard * p = m_arrShards, *pEnd = m_arrShards + m_nShardCount; p != pEnd; ++p ) {
+                scoped_lock l( p->lock );
+                for ( auto& val : p->heap )
+                    f( val );
+                p->heap.clear();
+                p->nSize.store( 0, atomics::memory_order_relaxed );
+            }
+        }
+
+        /// Checks is the priority queue is empty
+        /**
+            The function checks all shards, so the result may be inexact under concurrent modifications.
+        */
+        bool empty() const
+        {
+            for ( shard const * p = m_arrShards, *pEnd = m_arrShards + m_nShardCount; p != pEnd; ++p ) {
+                if ( p->nSize.load( atomics::memory_order_relaxed ) != 0 )
+                    return false;
+            }
+            return true;
+        }
+
+        /// Returns current size of priority queue
+        /**
+            The size is the sum of shard sizes, so the result may be inexact under concurrent modifications.
+        */
+        size_t size() const
+        {
+            size_t nSize = 0;
+            for ( shard const * p = m_arrShards, *pEnd = m_arrShards + m_nShardCount; p != pEnd; ++p )
+                nSize += p->nSize.load( atomics::memory_order_relaxed );
+            return nSize;
+        }
+
+        /// Returns the number of shards (the relaxation bound)
+        size_t shard_count() const
+        {
+            return m_nShardCount;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        static size_t default_shard_count()
+        {
+            unsigned int nProcCount = cds::OS::topology::processor_count();
+            return nProcCount ? nProcCount * 2 : 2;
+        }
+
+        template <typename Func>
+        bool do_push( Func f )
+        {
+            shard * pShard;
+            scoped_lock l;
+            for ( size_t nAttempt = 0; ; ++nAttempt ) {
+                pShard = &m_arrShards[ random( m_nShardCount ) ];
+                if ( nAttempt < m_nShardCount ) {
+                    l = scoped_lock( pShard->lock, std::try_to_lock );
+                    if ( l.owns_lock() )
+                        break;
+                    m_Stat.onPushContended();
+                }
+                else {
+                    // All attempts failed, the threads may be preempted while holding the locks
+                    l = scoped_lock( pShard->lock );
+                    break;
+                }
+            }
+
+            f( pShard->heap );
+            std::push_heap( pShard->heap.begin(), pShard->heap.end(), value_less() );
+            pShard->nSize.store( pShard->heap.size(), atomics::memory_order_relaxed );
+            l.unlock();
+
+            m_Stat.onPush();
+            return true;
+        }
+
+        template <typename Func>
+        void extract( shard& s, Func& f )
+        {
+            // The shard is locked
+            std::pop_heap( s.heap.begin(), s.heap.end(), value_less() );
+            f( s.heap.back() );
+            s.heap.pop_back();
+            s.nSize.store( s.heap.size(), atomics::memory_order_relaxed );
+        }
+
+        // Returns random number in [0, nBound)
+        size_t random( size_t nBound )
+        {
+            if ( nBound <= 1 )
+                return 0;
+
+            // xorshift generator
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+            static thread_local unsigned int s_nSeed = 0;
+            unsigned int x = s_nSeed;
+            if ( x == 0 ) {
+                // Per-thread seed: the address of thread-local variable differs for each thread
+                x = (unsigned int)( cds::OS::Timer::random_seed() ^ ( reinterpret_cast<uintptr_t>( &s_nSeed ) >> 4 )) | 1;
+            }
+#else
+            unsigned int x = m_nSeed.load( atomics::memory_order_relaxed );
+#endif
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+#ifdef CDS_CXX11_THREAD_LOCAL_SUPPORT
+            s_nSeed = x;
+#else
+            m_nSeed.store( x, atomics::memory_order_relaxed );
+#endif
+            return static_cast<size_t>( ( static_cast<uint64_t>( x ) * nBound ) >> 32 );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_MULTI_PRIORITY_QUEUE_H
@@ -0,0 +1,353 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
+#define CDSLIB_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
+
+#include <functional>   // std::less
+#include <cds/container/details/skip_list_base.h>
+#include <cds/opt/compare.h>
+
+namespace cds { namespace container {
+
+    /// SkipListPriorityQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace skip_list_priority_queue {
+
+        /// \p SkipListPriorityQueue traits
+        /**
+            The traits for \p %cds::container::SkipListPriorityQueue is the same as for
+            \p cds::container::SkipListSet (see \p cds::container::skip_list::traits)
+            except the default item counter.
+        */
+        struct traits: public cds::container::skip_list::traits
+        {
+            /// Item counter
+            /**
+                Default is \p atomicity::item_counter that is required for \p SkipListPriorityQueue::size().
+                The counter is a single atomic variable shared by all threads; if you don't need \p size()
+                you may specify \p atomicity::empty_item_counter to remove that hot spot,
+                \p SkipListPriorityQueue::empty() works correctly without item counter.
+            */
+            typedef atomicity::item_counter item_counter;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            \p Options are:
+            - \p opt::compare - priority compare functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+            - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::item_counter.
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p skip_list::random_level_generator - random level generator. Can be \p skip_list::xorshift, \p skip_list::turbo_pascal
+                or user-provided one. Default is \p %skip_list::turbo_pascal.
+            - \p opt::allocator - allocator for skip-list's tower. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::back_off - back-off strategy used. Default is \p cds::backoff::Default.
+            - \p opt::stat - internal statistics. Available types: \p skip_list::stat, \p skip_list::empty_stat (the default, no overhead)
+            - \p opt::rcu_check_deadlock - a deadlock checking policy for RCU-based skip-list.
+                Default is \p opt::v::rcu_throw_deadlock
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+            template <typename T, typename Traits>
+            struct make_skip_list_priority_queue
+            {
+                typedef T value_type;
+                typedef typename opt::details::make_comparator< value_type, Traits >::type key_comparator;
+
+                // Items are ordered by descending priority, so the item with highest priority
+                // is the minimal item of the skip-list and it can be extracted from the list head.
+                // Items with equal priority are ordered by their addresses:
+                // the comparator is applied to the values stored in skip-list nodes only,
+                // so the address of a value is unique while the value is in the queue
+                struct priority_comparator {
+                    int operator()( value_type const& v1, value_type const& v2 ) const
+                    {
+                        int nCmp = key_comparator()( v2, v1 );
+                        if ( nCmp != 0 )
+                            return nCmp;
+                        if ( &v1 == &v2 )
+                            return 0;
+                        return std::less<value_type const*>()( &v1, &v2 ) ? -1 : 1;
+                    }
+                };
+
+                struct set_traits: public Traits
+                {
+                    typedef priority_comparator compare;
+                    typedef cds::opt::none      less;
+                };
+            };
+        } // namespace details
+        //@endcond
+
+    }   // namespace skip_list_priority_queue
+
+    /// Unbounded lock-free priority queue based on skip-list
+    /** @ingroup cds_nonintrusive_priority_queue
+
+        Source:
+            - [2000] Shavit, Lotan "Skiplist-Based Concurrent Priority Queues"
+            - [2013] Jonatan Linden, Bengt Jonsson "A Skiplist-Based Concurrent Priority Queue with Minimal Memory Contention"
+
+        The priority queue is built on top of lock-free \p cds::container::SkipListSet: the items are kept in the skip-list
+        sorted by descending priority, so \p pop() extracts the first item of the list.
+        Unlike \p MSPriorityQueue, the queue has no fixed capacity and no global lock:
+        \p push() is a lock-free skip-list insertion that does not touch the head of the list
+        unless the new item has highest priority; \p pop() logically deletes the first item of the list
+        by marking it and then unlinks it physically (other threads help to unlink the marked items
+        they encounter).
+
+        Unlike \p SkipListSet, the queue may contain several items with equal priority.
+        The items with equal priority are popped in unspecified order.
+
+        Template parameters:
+        - \p GC - garbage collector used: \p gc::HP, \p gc::DHP or one of \ref cds_urcu_type "RCU type".
+            \p gc::nogc is not supported since the skip-list based on \p gc::nogc does not support item removing.
+        - \p T - type to be stored in the queue. The priority is a part of \p T type.
+        - \p Traits - the traits. See \p skip_list_priority_queue::traits for explanation.
+             It is possible to declare option-based queue with \p skip_list_priority_queue::make_traits
+             metafunction instead of \p Traits template argument.
+
+        @note Before including <tt><cds/container/skip_list_priority_queue.h></tt> you should include
+        appropriate skip-list header for \p GC you use:
+        - <tt><cds/container/skip_list_set_hp.h></tt> for \p gc::HP
+        - <tt><cds/container/skip_list_set_dhp.h></tt> for \p gc::DHP
+        - <tt><cds/container/skip_list_set_rcu.h></tt> for \ref cds_urcu_type "RCU type"
+
+        For RCU-based queue \p pop() and \p clear() must not be called under RCU lock.
+
+        Usage example:
+        \code
+        #include <cds/container/skip_list_set_hp.h>
+        #include <cds/container/skip_list_priority_queue.h>
+
+        struct task {
+            int nPriority;
+            // other fields
+        };
+
+        struct task_less {
+            bool operator()( task const& t1, task const& t2 ) const
+            {
+                return t1.nPriority < t2.nPriority;
+            }
+        };
+
+        typedef cds::container::SkipListPriorityQueue< cds::gc::HP, task,
+            cds::container::skip_list_priority_queue::make_traits<
+                cds::opt::less< task_less >
+            >::type
+        > task_queue;
+        \endcode
+    */
+    template <class GC, typename T, class Traits = skip_list_priority_queue::traits >
+    class SkipListPriorityQueue
+    {
+        //@cond
+        typedef skip_list_priority_queue::details::make_skip_list_priority_queue< T, Traits > maker;
+        //@endcond
+    public:
+        typedef GC          gc;         ///< Garbage collector
+        typedef T           value_type; ///< Value type stored in the queue
+        typedef Traits      traits;     ///< Traits template parameter
+
+        typedef typename maker::key_comparator key_comparator; ///< priority comparing functor based on \p opt::compare and \p opt::less option setter.
+
+        /// Underlying skip-list set type
+        typedef cds::container::SkipListSet< gc, value_type, typename maker::set_traits > skip_list_type;
+
+        typedef typename skip_list_type::stat stat; ///< internal statistics type, see \p skip_list::stat
+
+    protected:
+        //@cond
+        skip_list_type  m_List;
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue
+        SkipListPriorityQueue()
+        {}
+
+        /// Clears priority queue and destructs the object
+        ~SkipListPriorityQueue()
+        {}
+
+        /// Inserts an item into priority queue
+        /**
+            The queue is unbounded, so the function always inserts the copy of \p val
+            and returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            return m_List.insert( val );
+        }
+
+        /// Inserts an item into the queue using a functor
+        /**
+            \p Func is a functor called to initialize new item.
+            The functor \p f takes one argument - a reference to a new item of type \ref value_type :
+            \code
+            cds::container::SkipListPriorityQueue< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.push_with( [&bar]( Foo& dest ) { dest = bar; } );
+            \endcode
+            The functor is called before the item is inserted into the queue.
+        */
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            value_type val;
+            f( val );
+            return m_List.insert( val );
+        }
+
+        /// Inserts an item created from \p args into priority queue
+        /**
+            Returns \p true.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            return m_List.emplace( std::forward<Args>(args)... );
+        }
+
+        /// Extracts item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the copy of extracted item.
+            The item is deleted from the queue.
+
+            The extracted item can be still accessed by concurrent threads until it is reclaimed by \p GC,
+            so the value is copied to \p dest, not moved.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( [&dest]( value_type& src ) { dest = src; } );
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and calls \p f for extracted item.
+            The item is deleted from the queue.
+
+            \p Func is a functor called to copy popped value.
+            The functor takes one argument - a reference to removed item:
+            \code
+            cds::container::SkipListPriorityQueue< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.pop_with( [&bar]( Foo& src ) { bar = src; } );
+            \endcode
+
+            @warning The functor must not change the priority part of the item:
+            concurrent threads traversing the skip-list may still compare it until the item is reclaimed by \p GC.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            auto p = m_List.extract_min();
+            if ( !p.empty() ) {
+                f( *p );
+                return true;
+            }
+            return false;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is not atomic, but thread-safe
+        */
+        void clear()
+        {
+            m_List.clear();
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is not atomic, but thread-safe.
+
+            For each item removed the functor \p f is called.
+            \p Func interface is:
+            \code
+                struct clear_functor
+                {
+                    void operator()( value_type& item );
+                };
+            \endcode
+        */
+        template <typename Func>
+        void clear_with( Func f )
+        {
+            while ( pop_with( std::ref( f )))
+                ;
+        }
+
+        /// Checks is the priority queue is empty
+        bool empty() const
+        {
+            return m_List.empty();
+        }
+
+        /// Returns current size of priority queue
+        /**
+            The value returned depends on \p Traits::item_counter. For \p atomicity::empty_item_counter
+            the function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_List.size();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_List.statistics();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
@@ -718,6 +718,92 @@ namespace cds { namespace container {
             return raw_ptr( base_class::get_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ));
         }
 
+        /// Finds the first item that is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_lower_bound
+            The function returns \p raw_ptr object pointed to the first item whose key is greater than or equal to \p key.
+            If there is no such item it returns empty \p raw_ptr.
+
+            RCU should be locked before call of this function.
+            Returned item is valid only while RCU is locked.
+        */
+        template <typename Q>
+        raw_ptr lower_bound( Q const& key )
+        {
+            return raw_ptr( base_class::lower_bound( key ));
+        }
+
+        /// Finds the first item that is not less than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_lower_bound "lower_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        raw_ptr lower_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return raw_ptr( base_class::lower_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ));
+        }
+
+        /// Finds the first item that is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_upper_bound
+            The function returns \p raw_ptr object pointed to the first item whose key is strictly greater than \p key.
+            If there is no such item it returns empty \p raw_ptr.
+
+            RCU should be locked before call of this function.
+        */
+        template <typename Q>
+        raw_ptr upper_bound( Q const& key )
+        {
+            return raw_ptr( base_class::upper_bound( key ));
+        }
+
+        /// Finds the first item that is greater than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_upper_bound "upper_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        raw_ptr upper_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return raw_ptr( base_class::upper_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ));
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt>
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_for_each_in_range
+            The function walks the items with keys from \p lo to \p hi inclusive in ascending order
+            calling \p f for each of them. The functor signature is:
+            \code
+            void f( value_type& item );
+            \endcode
+            The functor is called under RCU lock, RCU should not be locked before call of this function.
+
+            The scan is weakly consistent: each item that is in the set during the entire scan is visited exactly once;
+            items inserted or deleted concurrently may or may not be visited.
+            The function returns the count of visited items.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            return base_class::for_each_in_range( lo, hi, [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt> using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::for_each_in_range_with( lo, hi, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
         /// Clears the set (non-atomic).
         /**
             The function deletes all items from the set.
@@ -180,6 +180,9 @@ namespace cds { namespace container {
         typedef typename base_class::item_counter item_counter; ///< Item counter type
         typedef typename base_class::stat         stat; ///< Internal statistics
 
+        /// Count of keys processed together by batch operations, see \p insert_batch()
+        static CDS_CONSTEXPR size_t const c_nBatchSize = base_class::c_nBatchSize;
+
     protected:
         //@cond
         typedef typename maker::cxx_node_allocator    cxx_node_allocator;
@@ -782,6 +785,52 @@ namespace cds { namespace container {
             return gp;
         }
 
+        /// Inserts the items for the keys of the batch
+        /**
+            The function is an analog of <tt>insert( Q const& )</tt> for \p nCount keys of the array \p pKeys.
+            The keys are processed in groups of \p c_nBatchSize: the bucket heads of the whole group are prefetched
+            before the first insertion, so the cache misses are overlapped.
+            This is useful for big sets which do not fit into the cache.
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of inserting <tt>pKeys[i]</tt>.
+            Returns the count of inserted items.
+
+            The batch is not atomic: each key is inserted by a separate operation.
+        */
+        template <typename Q>
+        size_t insert_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return insert( key ); } );
+        }
+
+        /// Checks whether the set contains the keys of the batch
+        /**
+            The function is an analog of <tt>contains( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the bucket heads are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is found.
+            Returns the count of keys found.
+        */
+        template <typename Q>
+        size_t find_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return contains( key ); } );
+        }
+
+        /// Deletes the keys of the batch
+        /**
+            The function is an analog of <tt>erase( Q const& )</tt> for \p nCount keys of the array \p pKeys,
+            the bucket heads are prefetched like in \p insert_batch().
+
+            If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to \p true if <tt>pKeys[i]</tt> is deleted.
+            Returns the count of deleted items.
+        */
+        template <typename Q>
+        size_t erase_batch( Q const* pKeys, size_t nCount, bool * pResult = nullptr )
+        {
+            return base_class::batch_apply( pKeys, nCount, pResult, [this]( Q const& key ) { return erase( key ); } );
+        }
+
         /// Clears the set (not atomic)
         void clear()
         {
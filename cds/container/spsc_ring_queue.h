@@ -0,0 +1,488 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_SPSC_RING_QUEUE_H
+#define CDSLIB_CONTAINER_SPSC_RING_QUEUE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/buffer.h>
+#include <cds/opt/value_cleaner.h>
+#include <cds/algo/atomic.h>
+#include <cds/details/bounded_container.h>
+
+namespace cds { namespace container {
+
+    /// SPSCRingQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace spsc_ring_queue {
+
+        /// SPSCRingQueue internal statistics
+        /**
+            Each counter is changed only by one side of the queue, the producer or the consumer.
+            Template argument \p Counter defines type of counter, default is \p cds::atomicity::event_counter.
+        */
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_EnqueueCount;    ///< Count of success enqueue
+            counter_type m_DequeueCount;    ///< Count of success dequeue
+            counter_type m_FullEnqueue;     ///< Count of enqueue to full queue
+            counter_type m_EmptyDequeue;    ///< Count of dequeue from empty queue
+            counter_type m_HeadReload;      ///< Count of producer's reload of the consumer position (cached head is stale)
+            counter_type m_TailReload;      ///< Count of consumer's reload of the producer position (cached tail is stale)
+
+            //@cond
+            void onEnqueue()        { ++m_EnqueueCount; }
+            void onDequeue()        { ++m_DequeueCount; }
+            void onFullEnqueue()    { ++m_FullEnqueue; }
+            void onEmptyDequeue()   { ++m_EmptyDequeue; }
+            void onHeadReload()     { ++m_HeadReload; }
+            void onTailReload()     { ++m_TailReload; }
+            //@endcond
+        };
+
+        /// SPSCRingQueue empty internal statistics
+        struct empty_stat
+        {
+            //@cond
+            void onEnqueue()        const {}
+            void onDequeue()        const {}
+            void onFullEnqueue()    const {}
+            void onEmptyDequeue()   const {}
+            void onHeadReload()     const {}
+            void onTailReload()     const {}
+            //@endcond
+        };
+
+        /// SPSCRingQueue default traits
+        struct traits {
+            /// Buffer type for internal array
+            /*
+                The type of element for the buffer is not important: the queue rebinds
+                buffer for required type via \p rebind metafunction.
+
+                For \p SPSCRingQueue queue the buffer size should have power-of-2 size.
+            */
+            typedef cds::opt::v::dynamic_buffer< void * > buffer;
+
+            /// A functor to clean item dequeued.
+            /**
+                The functor calls the destructor for queue item.
+                After an item is dequeued, \p value_cleaner cleans the cell that the item has been occupied.
+
+                Default value is \ref opt::v::destruct_cleaner
+            */
+            typedef cds::opt::v::destruct_cleaner value_cleaner;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to enable item counting
+            /**
+                Note that \p cds::atomicity::item_counter adds an atomic RMW operation to each enqueue/dequeue.
+            */
+            typedef cds::atomicity::empty_item_counter item_counter;
+
+            /// Internal statistics (by default, disabled)
+            /**
+                Possible option value are: \p spsc_ring_queue::stat, \p spsc_ring_queue::empty_stat (the default),
+                user-provided class that supports \p %spsc_ring_queue::stat interface.
+            */
+            typedef spsc_ring_queue::empty_stat stat;
+
+            /// C++ memory ordering model
+            /**
+                Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            */
+            typedef opt::v::relaxed_ordering    memory_model;
+
+            /// Padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+        };
+
+        /// Metafunction converting option list to \p spsc_ring_queue::traits
+        /**
+            Supported \p Options are:
+            - \p opt::buffer - the buffer type for internal cyclic array. Possible types are:
+                \p opt::v::dynamic_buffer (the default), \p opt::v::static_buffer. The type of
+                element in the buffer is not important: it will be changed via \p rebind metafunction.
+            - \p opt::value_cleaner - a functor to clean item dequeued.
+                The functor calls the destructor for queue item.
+                Default value is \ref opt::v::destruct_cleaner
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter (item counting disabled)
+                To enable item counting use \p cds::atomicity::item_counter
+            - \p opt::stat - the type to gather internal statistics.
+                Possible statistics types are: \p spsc_ring_queue::stat, \p spsc_ring_queue::empty_stat,
+                user-provided class that supports \p %spsc_ring_queue::stat interface.
+                Default is \p %spsc_ring_queue::empty_stat (internal statistics disabled).
+            - \p opt::padding - padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+
+            Example: declare \p %SPSCRingQueue with static iternal buffer of size 1024:
+            \code
+            typedef cds::container::SPSCRingQueue< Foo,
+                typename cds::container::spsc_ring_queue::make_traits<
+                    cds::opt::buffer< cds::opt::v::static_buffer< void *, 1024 >>
+                >::type
+            > myQueue;
+            \endcode
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+    } //namespace spsc_ring_queue
+
+    /// Bounded single-producer/single-consumer ring queue
+    /** @ingroup cds_nonintrusive_queue
+        The queue supports exactly one producer thread and one consumer thread at any time.
+        Only the producer may call \p enqueue() and its variants, only the consumer may call \p dequeue()
+        and its variants. For multi-producer or multi-consumer access use \p VyukovMPMCCycleQueue.
+
+        The queue is a classic Lamport's ring buffer with the optimization of cached indices:
+        - the producer owns the tail position and keeps a private copy of the consumer's head position;
+        - the consumer owns the head position and keeps a private copy of the producer's tail position.
+
+        Each side reloads the other side's position (one acquire load) only when its cached copy says
+        that the queue is full (for producer) or empty (for consumer). So, on the fast path
+        the enqueue/dequeue performs no atomic read-modify-write operations and touches no cache line
+        written by the other side, except the cell itself. The position is published by one release store.
+
+        Template parameters
+        - \p T - type stored in queue. It should be default-constructible.
+        - \p Traits - queue traits, default is \p spsc_ring_queue::traits. You can use \p spsc_ring_queue::make_traits
+            metafunction to make your traits or just derive your traits from \p %spsc_ring_queue::traits:
+            \code
+            struct myTraits: public cds::container::spsc_ring_queue::traits {
+                typedef cds::container::spsc_ring_queue::stat<> stat;
+            };
+            typedef cds::container::SPSCRingQueue< Foo, myTraits > myQueue;
+
+            // Equivalent make_traits example:
+            typedef cds::container::SPSCRingQueue< Foo,
+                typename cds::container::spsc_ring_queue::make_traits<
+                    cds::opt::stat< cds::container::spsc_ring_queue::stat<> >
+                >::type
+            > myQueue;
+            \endcode
+    */
+    template <typename T, typename Traits = spsc_ring_queue::traits >
+    class SPSCRingQueue : public cds::bounded_container
+    {
+    public:
+        typedef T value_type;   ///< Value type to be stored in the queue
+        typedef Traits traits;  ///< Queue traits
+        typedef typename traits::item_counter  item_counter;  ///< Item counter type
+        typedef typename traits::stat          stat;          ///< Internal statistics type
+        typedef typename traits::memory_model  memory_model;  ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename traits::value_cleaner value_cleaner; ///< Value cleaner, see \p spsc_ring_queue::traits::value_cleaner
+
+        /// Rebind template arguments
+        template <typename T2, typename Traits2>
+        struct rebind {
+            typedef SPSCRingQueue< T2, Traits2 > other   ;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        typedef atomics::atomic<size_t> position_type;
+        typedef typename traits::buffer::template rebind<value_type>::other buffer;
+
+        // Producer's data
+        struct producer_data {
+            position_type   nTail;      // next free cell, written by producer only
+            size_t          nHeadCache; // producer's copy of consumer's head
+        };
+
+        // Consumer's data
+        struct consumer_data {
+            position_type   nHead;      // next filled cell, written by consumer only
+            size_t          nTailCache; // consumer's copy of producer's tail
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        buffer          m_buffer;
+        size_t const    m_nBufferMask;
+        typename opt::details::apply_padding< size_t, traits::padding >::padding_type pad1_;
+        producer_data   m_Producer;
+        typename opt::details::apply_padding< producer_data, traits::padding >::padding_type pad2_;
+        consumer_data   m_Consumer;
+        typename opt::details::apply_padding< consumer_data, traits::padding >::padding_type pad3_;
+        item_counter    m_ItemCounter;
+        stat            m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs the queue of capacity \p nCapacity
+        /**
+            For \p cds::opt::v::static_buffer the \p nCapacity parameter is ignored.
+
+            The buffer capacity must be the power of two.
+        */
+        SPSCRingQueue( size_t nCapacity = 0 )
+            : m_buffer( nCapacity )
+            , m_nBufferMask( m_buffer.capacity() - 1 )
+        {
+            nCapacity = m_buffer.capacity();
+
+            // Buffer capacity must be power of 2
+            assert( nCapacity >= 2 && (nCapacity & (nCapacity - 1)) == 0 );
+            CDS_UNUSED( nCapacity );
+
+            m_Producer.nTail.store( 0, memory_model::memory_order_relaxed );
+            m_Producer.nHeadCache = 0;
+            m_Consumer.nHead.store( 0, memory_model::memory_order_relaxed );
+            m_Consumer.nTailCache = 0;
+        }
+
+        /// Destroys the queue; the queue must not be used by any thread
+        ~SPSCRingQueue()
+        {
+            clear();
+        }
+
+        /// Enqueues data to the queue using a functor (producer only)
+        /**
+            \p Func is a functor called to copy a value to the queue cell.
+            The functor \p f takes one argument - a reference to a empty cell of type \ref value_type :
+            \code
+            cds::container::SPSCRingQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.enqueue_with( [&bar]( Foo& dest ) { dest = std::move(bar); } );
+            \endcode
+            Returns \p false if the queue is full.
+        */
+        template <typename Func>
+        bool enqueue_with( Func f )
+        {
+            // Only the producer changes the tail
+            size_t const nTail = m_Producer.nTail.load( atomics::memory_order_relaxed );
+            if ( nTail - m_Producer.nHeadCache > m_nBufferMask ) {
+                m_Producer.nHeadCache = m_Consumer.nHead.load( memory_model::memory_order_acquire );
+                m_Stat.onHeadReload();
+                if ( nTail - m_Producer.nHeadCache > m_nBufferMask ) {
+                    m_Stat.onFullEnqueue();
+                    return false;   // queue full
+                }
+            }
+
+            f( m_buffer[ nTail & m_nBufferMask ] );
+
+            m_Producer.nTail.store( nTail + 1, memory_model::memory_order_release );
+            ++m_ItemCounter;
+            m_Stat.onEnqueue();
+            return true;
+        }
+
+        /// Enqueues \p val value into the queue (producer only)
+        /**
+            The new queue item is created by calling placement new in free cell.
+            Returns \p true if success, \p false if the queue is full.
+        */
+        bool enqueue( value_type const& val )
+        {
+            return enqueue_with( [&val]( value_type& dest ){ new ( &dest ) value_type( val ); });
+        }
+
+        /// Enqueues \p val value into the queue, move semantics (producer only)
+        bool enqueue( value_type&& val )
+        {
+            return enqueue_with( [&val]( value_type& dest ){ new ( &dest ) value_type( std::move( val )); });
+        }
+
+        /// Synonym for \p enqueue( value_type const& )
+        bool push( value_type const& data )
+        {
+            return enqueue( data );
+        }
+
+        /// Synonym for \p enqueue( value_type&& )
+        bool push( value_type&& data )
+        {
+            return enqueue( std::move( data ));
+        }
+
+        /// Synonym for \p enqueue_with()
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            return enqueue_with( f );
+        }
+
+        /// Enqueues data of type \ref value_type constructed with <tt>std::forward<Args>(args)...</tt> (producer only)
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+#if (CDS_COMPILER == CDS_COMPILER_GCC) && (CDS_COMPILER_VERSION < 40900)
+            //work around unsupported feature in g++ 4.8 for forwarding parameter packs to lambda.
+            return enqueue_with ( std::bind([]( value_type& dest,Args ... args ){ new ( &dest ) value_type( std::forward<Args>(args)... );}, std::placeholders::_1 ,args...));
+#else
+            return enqueue_with( [&args ...]( value_type& dest ){ new ( &dest ) value_type( std::forward<Args>(args)... ); });
+#endif
+        }
+
+        /// Dequeues a value using a functor (consumer only)
+        /**
+            \p Func is a functor called to copy dequeued value.
+            The functor takes one argument - a reference to removed node:
+            \code
+            cds:container::SPSCRingQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.dequeue_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called only if the queue is not empty.
+        */
+        template <typename Func>
+        bool dequeue_with( Func f )
+        {
+            value_type * p = front();
+            if ( !p ) {
+                m_Stat.onEmptyDequeue();
+                return false;
+            }
+
+            f( *p );
+            pop_front_unsafe();
+            m_Stat.onDequeue();
+            return true;
+        }
+
+        /// Dequeues a value from the queue (consumer only)
+        /**
+            If queue is not empty, the function returns \p true, \p dest contains copy of
+            dequeued value. The assignment operator for type \ref value_type is invoked.
+            If queue is empty, the function returns \p false, \p dest is unchanged.
+        */
+        bool dequeue( value_type& dest )
+        {
+            return dequeue_with( [&dest]( value_type& src ){ dest = std::move( src ); } );
+        }
+
+        /// Synonym for \p dequeue()
+        bool pop( value_type& data )
+        {
+            return dequeue( data );
+        }
+
+        /// Synonym for \p dequeue_with()
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            return dequeue_with( f );
+        }
+
+        /// Returns a pointer to top element of the queue or \p nullptr if queue is empty (consumer only)
+        /**
+            The element stays valid until the consumer calls \p pop_front() or any dequeue function.
+        */
+        value_type * front()
+        {
+            // Only the consumer changes the head
+            size_t const nHead = m_Consumer.nHead.load( atomics::memory_order_relaxed );
+            if ( nHead == m_Consumer.nTailCache ) {
+                m_Consumer.nTailCache = m_Producer.nTail.load( memory_model::memory_order_acquire );
+                m_Stat.onTailReload();
+                if ( nHead == m_Consumer.nTailCache )
+                    return nullptr; // queue empty
+            }
+            return &m_buffer[ nHead & m_nBufferMask ];
+        }
+
+        /// Pops top element; returns \p true if queue is not empty, \p false otherwise (consumer only)
+        bool pop_front()
+        {
+            return dequeue_with( []( value_type& ) {} );
+        }
+
+        /// Checks if the queue is empty
+        /**
+            The result is exact only if it is called by the producer or by the consumer.
+        */
+        bool empty() const
+        {
+            return m_Consumer.nHead.load( memory_model::memory_order_acquire )
+                == m_Producer.nTail.load( memory_model::memory_order_acquire );
+        }
+
+        /// Clears the queue (consumer only)
+        void clear()
+        {
+            while ( pop_front() );
+        }
+
+        /// Returns queue's item count
+        /**
+            The value returned depends on \p spsc_ring_queue::traits::item_counter option.
+            For \p atomicity::empty_item_counter, the function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns capacity of the queue
+        size_t capacity() const
+        {
+            return m_buffer.capacity();
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        void pop_front_unsafe()
+        {
+            size_t const nHead = m_Consumer.nHead.load( atomics::memory_order_relaxed );
+            value_cleaner()( m_buffer[ nHead & m_nBufferMask ] );
+            m_Consumer.nHead.store( nHead + 1, memory_model::memory_order_release );
+            --m_ItemCounter;
+        }
+        //@endcond
+    };
+
+}}  // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_SPSC_RING_QUEUE_H
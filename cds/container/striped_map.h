@@ -118,6 +118,9 @@ namespace cds { namespace container {
                 significantly improve performance.
                 For other, non-sequential types of \p Container (like a \p std::map)
                 the resizing policy is not so important.
+            - \p striped_set::incremental_resize - if \p true, the map is resized stripe-by-stripe without locking
+                all stripes for the whole rehashing. Only \p striped_set::striping mutex policy supports this option.
+                Default is \p false, see \p intrusive::striped_set::incremental_resize for details.
             - \p cds::opt::copy_policy - the copy policy which is used to copy items from the old map to the new one when resizing.
                 The policy can be optionally used in adapted bucket container for performance reasons of resizing.
                 The detail of copy algorithm depends on type of bucket container and explains below.
@@ -222,6 +222,10 @@ namespace cds { namespace container {
         ///@copydoc cds::intrusive::striped_set::no_resizing
         typedef cds::intrusive::striped_set::no_resizing no_resizing;
 
+        ///@copydoc cds::intrusive::striped_set::incremental_resize
+        template <bool Enable>
+        using incremental_resize = cds::intrusive::striped_set::incremental_resize<Enable>;
+
         ///@copydoc cds::intrusive::striped_set::striping
         template <class Lock = std::mutex, class Alloc = CDS_DEFAULT_ALLOCATOR >
         using striping = cds::intrusive::striped_set::striping<Lock, Alloc>;
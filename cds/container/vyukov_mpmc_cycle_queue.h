@@ -36,6 +36,7 @@
 #include <cds/opt/value_cleaner.h>
 #include <cds/algo/atomic.h>
 #include <cds/details/bounded_container.h>
+#include <iterator>
 
 namespace cds { namespace container {
 
@@ -219,6 +220,105 @@ namespace cds { namespace container {
         item_counter    m_ItemCounter;
         //@endcond
 
+    protected:
+        //@cond
+        // Claims up to nMax free cells by one CAS on m_posEnqueue and calls f( cell.data ) for each cell in order
+        template <typename Func>
+        size_t do_enqueue_bulk( size_t nMax, Func f )
+        {
+            if ( nMax == 0 )
+                return 0;
+            if ( nMax > capacity() )
+                nMax = capacity();
+
+            back_off bkoff;
+            size_t nCount;
+            size_t pos = m_posEnqueue.load( memory_model::memory_order_relaxed );
+            for (;;)
+            {
+                // Count the free cells starting from pos; they cannot be changed until m_posEnqueue passes them
+                intptr_t dif = 0;
+                for ( nCount = 0; nCount < nMax; ++nCount ) {
+                    size_t seq = m_buffer[(pos + nCount) & m_nBufferMask].sequence.load( memory_model::memory_order_acquire );
+                    dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + nCount);
+                    if ( dif != 0 )
+                        break;
+                }
+
+                if ( nCount ) {
+                    if ( m_posEnqueue.compare_exchange_weak( pos, pos + nCount, memory_model::memory_order_relaxed, atomics::memory_order_relaxed ))
+                        break;
+                }
+                else if ( dif < 0 ) {
+                    // Queue full?
+                    if ( pos - m_posDequeue.load( memory_model::memory_order_relaxed ) == capacity() )
+                        return 0;   // queue full
+                    bkoff();
+                    pos = m_posEnqueue.load( memory_model::memory_order_relaxed );
+                }
+                else
+                    pos = m_posEnqueue.load( memory_model::memory_order_relaxed );
+            }
+
+            for ( size_t i = 0; i < nCount; ++i ) {
+                cell_type * cell = &m_buffer[(pos + i) & m_nBufferMask];
+                f( cell->data );
+                cell->sequence.store( pos + i + 1, memory_model::memory_order_release );
+            }
+            m_ItemCounter += nCount;
+
+            return nCount;
+        }
+
+        // Claims up to nMax filled cells by one CAS on m_posDequeue and calls f( cell.data ) for each cell in order
+        template <typename Func>
+        size_t do_dequeue_bulk( size_t nMax, Func f )
+        {
+            if ( nMax == 0 )
+                return 0;
+            if ( nMax > capacity() )
+                nMax = capacity();
+
+            back_off bkoff;
+            size_t nCount;
+            size_t pos = m_posDequeue.load( memory_model::memory_order_relaxed );
+            for (;;)
+            {
+                intptr_t dif = 0;
+                for ( nCount = 0; nCount < nMax; ++nCount ) {
+                    size_t seq = m_buffer[(pos + nCount) & m_nBufferMask].sequence.load( memory_model::memory_order_acquire );
+                    dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + nCount + 1);
+                    if ( dif != 0 )
+                        break;
+                }
+
+                if ( nCount ) {
+                    if ( m_posDequeue.compare_exchange_weak( pos, pos + nCount, memory_model::memory_order_relaxed, atomics::memory_order_relaxed ))
+                        break;
+                }
+                else if ( dif < 0 ) {
+                    // Queue empty?
+                    if ( pos - m_posEnqueue.load( memory_model::memory_order_relaxed ) == 0 )
+                        return 0;   // queue empty
+                    bkoff();
+                    pos = m_posDequeue.load( memory_model::memory_order_relaxed );
+                }
+                else
+                    pos = m_posDequeue.load( memory_model::memory_order_relaxed );
+            }
+
+            for ( size_t i = 0; i < nCount; ++i ) {
+                cell_type * cell = &m_buffer[(pos + i) & m_nBufferMask];
+                f( cell->data );
+                value_cleaner()( cell->data );
+                cell->sequence.store( pos + i + m_nBufferMask + 1, memory_model::memory_order_release );
+            }
+            m_ItemCounter -= nCount;
+
+            return nCount;
+        }
+        //@endcond
+
     public:
         /// Constructs the queue of capacity \p nCapacity
         /**
@@ -319,6 +419,23 @@ namespace cds { namespace container {
             return enqueue_with( f );
         }
 
+        /// Enqueues the values of range <tt>[itFirst, itLast)</tt> into the queue
+        /**
+            The function claims a contiguous range of free cells by one CAS on the enqueue position
+            and then copies the values into the cells in the range order.
+            If there is not enough free cells, only the first values of the range are enqueued.
+            \p ForwardIterator should be a forward iterator, dereferencing of it should return
+            a value convertible to \ref value_type.
+
+            Returns the number of values enqueued; 0 means the queue is full.
+        */
+        template <typename ForwardIterator>
+        size_t enqueue_bulk( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            return do_enqueue_bulk( static_cast<size_t>( std::distance( itFirst, itLast )),
+                [&itFirst]( value_type& dest ) { new ( &dest ) value_type( *itFirst ); ++itFirst; } );
+        }
+
         /// Enqueues data of type \ref value_type constructed with <tt>std::forward<Args>(args)...</tt>
         template <typename... Args>
         bool emplace( Args&&... args )
@@ -378,6 +495,18 @@ namespace cds { namespace container {
             return true;
         }
 
+        /// Dequeues up to \p nMax values from the queue
+        /**
+            The function claims a contiguous range of filled cells by one CAS on the dequeue position,
+            each dequeued value is moved to \p out.
+            Returns the number of values dequeued; 0 means the queue is empty.
+        */
+        template <typename OutputIterator>
+        size_t dequeue_bulk( OutputIterator out, size_t nMax )
+        {
+            return do_dequeue_bulk( nMax, [&out]( value_type& src ) { *out = std::move( src ); ++out; } );
+        }
+
         /// Dequeues a value from the queue
         /**
             If queue is not empty, the function returns \p true, \p dest contains copy of
@@ -0,0 +1,99 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_DETAILS_BATCH_APPLY_H
+#define CDSLIB_DETAILS_BATCH_APPLY_H
+
+#include <type_traits>
+#include <cds/details/defs.h>
+
+//@cond
+namespace cds { namespace details {
+
+    /// Count of keys processed together by batch operations of hash containers
+    static CDS_CONSTEXPR size_t const c_nBatchSize = 16;
+
+    /// Empty prefetch hook for \p batch_apply()
+    struct empty_batch_prefetch
+    {
+        template <typename T>
+        void operator()( T const& ) const
+        {}
+    };
+
+    /// Calls \p op for each key of the batch
+    /**
+        The function implements \p insert_batch(), \p find_batch() and \p erase_batch() of hash containers.
+        The keys of array \p pKeys are processed in groups of \p BatchSize keys. For each group:
+        - <tt>h[i] = hash( key )</tt> and <tt>prefetch( h[i] )</tt> are called for each key of the group;
+        - <tt>prefetch_next( h[i] )</tt> is called for each key of the group, it may load the memory
+          pointed to by the cells prefetched at first stage;
+        - <tt>op( h[i], key )</tt> is called for each key of the group.
+
+        So the cache misses of the group overlap. \p hash may return any value the hooks need,
+        for example, the bucket number or the newly created node.
+
+        If \p pResult is not \p nullptr, <tt>pResult[i]</tt> is set to the result of \p op for <tt>pKeys[i]</tt>.
+        Returns the count of the keys for which \p op returned \p true.
+    */
+    template <size_t BatchSize, typename Q, typename Hash, typename Prefetch, typename PrefetchNext, typename Func>
+    static inline size_t batch_apply( Q const* pKeys, size_t nCount, bool * pResult,
+        Hash hash, Prefetch prefetch, PrefetchNext prefetch_next, Func op )
+    {
+        typedef typename std::decay< decltype( hash( *pKeys ))>::type hash_type;
+
+        hash_type arrHash[BatchSize];
+        size_t nSuccess = 0;
+        for ( size_t nStart = 0; nStart < nCount; nStart += BatchSize ) {
+            Q const* pGroup = pKeys + nStart;
+            size_t const nSize = nCount - nStart < BatchSize ? nCount - nStart : BatchSize;
+
+            for ( size_t i = 0; i < nSize; ++i ) {
+                arrHash[i] = hash( pGroup[i] );
+                prefetch( arrHash[i] );
+            }
+            for ( size_t i = 0; i < nSize; ++i )
+                prefetch_next( arrHash[i] );
+
+            for ( size_t i = 0; i < nSize; ++i ) {
+                bool const bRet = op( arrHash[i], pGroup[i] );
+                if ( pResult )
+                    pResult[nStart + i] = bRet;
+                if ( bRet )
+                    ++nSuccess;
+            }
+        }
+        return nSuccess;
+    }
+
+}} // namespace cds::details
+//@endcond
+
+#endif // #ifndef CDSLIB_DETAILS_BATCH_APPLY_H
@@ -32,6 +32,7 @@
 #define CDSLIB_GC_DETAILS_DHP_H
 
 #include <mutex>        // unique_lock
+#include <chrono>       // steady_clock for retire-to-free latency statistics
 #include <cds/algo/atomic.h>
 #include <cds/algo/int_algo.h>
 #include <cds/gc/details/retired_ptr.h>
@@ -88,6 +89,7 @@ namespace cds { namespace gc {
                 retired_ptr         m_ptr   ;   ///< retired pointer
                 atomics::atomic<retired_ptr_node *>  m_pNext     ;   ///< next retired pointer in buffer
                 atomics::atomic<retired_ptr_node *>  m_pNextFree ;   ///< next item in free list of \p retired_ptr_node
+                uint64_t            m_nRetireTime;  ///< Retire timestamp in nanoseconds, 0 if statistics is disabled
             };
 
             /// Internal guard representation
@@ -310,7 +312,7 @@ namespace cds { namespace gc {
                         // pHead is changed by compare_exchange_weak
                     } while ( !m_pHead.compare_exchange_weak( pHead, pFirst, atomics::memory_order_release, atomics::memory_order_relaxed ) );
 
-                    return m_nItemCount.fetch_add( nSize, atomics::memory_order_relaxed ) + 1;
+                    return m_nItemCount.fetch_add( nSize, atomics::memory_order_relaxed ) + nSize;
                 }
 
                 /// Result of \ref dhp_gc_privatize "privatize" function.
@@ -510,6 +512,54 @@ namespace cds { namespace gc {
                 }
             };
 
+            /// Thread-local batch of retired pointers
+            /**
+                The thread collects retired pointers into its batch and hands off the whole batch
+                to global retired buffer by one CAS when the batch is full.
+                The batches are linked into accumulating global list (by \p m_pGlobalNext field)
+                so that the GC can release the batches of non-detached threads on destruction.
+            */
+            struct retired_batch {
+                retired_ptr_node *  m_pFirst;   ///< head of the batch (linked by retired_ptr_node::m_pNext field)
+                retired_ptr_node *  m_pLast;    ///< tail of the batch
+                size_t              m_nSize;    ///< item count in the batch
+
+                atomics::atomic<bool>            m_bBusy;       ///< the batch is owned by a thread
+                atomics::atomic<retired_batch *> m_pGlobalNext; ///< next item of global list of batches
+
+                retired_batch() CDS_NOEXCEPT
+                    : m_pFirst( nullptr )
+                    , m_pLast( nullptr )
+                    , m_nSize( 0 )
+                    , m_bBusy( true )
+                    , m_pGlobalNext( nullptr )
+                {}
+
+                /// Pushes \p node to the batch, returns batch size
+                size_t push( retired_ptr_node& node ) CDS_NOEXCEPT
+                {
+                    node.m_pNext.store( m_pFirst, atomics::memory_order_relaxed );
+                    m_pFirst = &node;
+                    if ( !m_pLast )
+                        m_pLast = &node;
+                    return ++m_nSize;
+                }
+
+                /// Clears the batch
+                void clear() CDS_NOEXCEPT
+                {
+                    m_pFirst =
+                        m_pLast = nullptr;
+                    m_nSize = 0;
+                }
+
+                /// Checks if the batch is empty
+                bool empty() const CDS_NOEXCEPT
+                {
+                    return m_nSize == 0;
+                }
+            };
+
             /// Uninitialized guard
             class guard
             {
@@ -722,10 +772,20 @@ namespace cds { namespace gc {
             {
                 atomics::atomic<size_t>  m_nGuardCount       ;   ///< Total guard count
                 atomics::atomic<size_t>  m_nFreeGuardCount   ;   ///< Count of free guard
+                atomics::atomic<size_t>  m_nScanCount        ;   ///< Count of \p scan() calls
+                atomics::atomic<size_t>  m_nBatchCount       ;   ///< Count of thread-local batches handed off to global retired buffer
+                atomics::atomic<size_t>  m_nFreedCount       ;   ///< Count of freed retired pointers that have retire timestamp
+                atomics::atomic<uint64_t> m_nRetireToFreeTotal;  ///< Total retire-to-free latency, in nanoseconds
+                atomics::atomic<uint64_t> m_nRetireToFreeMax ;   ///< Max retire-to-free latency, in nanoseconds
 
                 internal_stat()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nScanCount(0)
+                    , m_nBatchCount(0)
+                    , m_nFreedCount(0)
+                    , m_nRetireToFreeTotal(0)
+                    , m_nRetireToFreeMax(0)
                 {}
             };
 
@@ -746,32 +806,65 @@ namespace cds { namespace gc {
             {
                 size_t m_nGuardCount       ;   ///< Total guard count
                 size_t m_nFreeGuardCount   ;   ///< Count of free guard
+                size_t m_nScanCount        ;   ///< Count of \p scan() calls
+                size_t m_nBatchCount       ;   ///< Count of thread-local batches handed off to global retired buffer
+                size_t m_nFreedCount       ;   ///< Count of freed retired pointers that have retire timestamp
+                uint64_t m_nRetireToFreeTotal; ///< Total retire-to-free latency, in nanoseconds
+                uint64_t m_nRetireToFreeMax;   ///< Max retire-to-free latency, in nanoseconds
 
                 //@cond
                 InternalState()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nScanCount(0)
+                    , m_nBatchCount(0)
+                    , m_nFreedCount(0)
+                    , m_nRetireToFreeTotal(0)
+                    , m_nRetireToFreeMax(0)
                 {}
 
                 InternalState& operator =( internal_stat const& s )
                 {
                     m_nGuardCount = s.m_nGuardCount.load(atomics::memory_order_relaxed);
                     m_nFreeGuardCount = s.m_nFreeGuardCount.load(atomics::memory_order_relaxed);
+                    m_nScanCount = s.m_nScanCount.load(atomics::memory_order_relaxed);
+                    m_nBatchCount = s.m_nBatchCount.load(atomics::memory_order_relaxed);
+                    m_nFreedCount = s.m_nFreedCount.load(atomics::memory_order_relaxed);
+                    m_nRetireToFreeTotal = s.m_nRetireToFreeTotal.load(atomics::memory_order_relaxed);
+                    m_nRetireToFreeMax = s.m_nRetireToFreeMax.load(atomics::memory_order_relaxed);
 
                     return *this;
                 }
                 //@endcond
+
+                /// Average retire-to-free latency, in nanoseconds
+                double avg_retire_to_free() const
+                {
+                    return m_nFreedCount ? double( m_nRetireToFreeTotal ) / m_nFreedCount : 0.0;
+                }
             };
 
+            /// Batch disposer
+            /**
+                If the batch disposer is set, \p scan() does not call the disposer of each retired pointer freed.
+                Instead, the freed retired pointers are collected into an array and the batch disposer is called
+                for the array. So, the batch disposer can reclaim the nodes in bulk, for example, return them to a pool
+                by one operation. The batch disposer is responsible for calling \p free() for each item of \p arr.
+            */
+            typedef void (* batch_disposer_func)( retired_ptr * arr, size_t nCount );
+
         private:
             static GarbageCollector * m_pManager    ;   ///< GC global instance
 
             atomics::atomic<size_t>  m_nLiberateThreshold;   ///< Max size of retired pointer buffer to call \p scan()
             const size_t             m_nInitialThreadGuardCount; ///< Initial count of guards allocated for ThreadGC
+            const size_t             m_nRetiredBatchSize ;   ///< Size of thread-local batch of retired pointers
 
             details::guard_allocator<>      m_GuardPool         ;   ///< Guard pool
             details::retired_ptr_pool<>     m_RetiredAllocator  ;   ///< Pool of free retired pointers
             details::retired_ptr_buffer     m_RetiredBuffer     ;   ///< Retired pointer buffer for liberating
+            atomics::atomic<details::retired_batch *> m_pBatchList; ///< Head of thread-local batch list
+            atomics::atomic<batch_disposer_func>      m_pBatchDisposer; ///< Batch disposer, may be \p nullptr
 
             internal_stat   m_stat  ;   ///< Internal statistics
             bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
@@ -796,11 +889,16 @@ namespace cds { namespace gc {
                     ABA problem for internal data. \p nEpochCount specifies the epoch count,
                     i.e. the count of simultaneously working threads that remove the elements
                     of DHP-based concurrent data structure. Default value is 16.
+                - \p nRetiredBatchSize - size of thread-local batch of retired pointers. The thread collects
+                    retired pointers locally and hands off the whole batch to the global retired buffer
+                    when the batch is full. If \p nRetiredBatchSize <= 1, each retired pointer is placed
+                    to the global buffer immediately. Default value is 64.
             */
             static void CDS_STDCALL Construct(
                 size_t nLiberateThreshold = 1024
                 , size_t nInitialThreadGuardCount = 8
                 , size_t nEpochCount = 16
+                , size_t nRetiredBatchSize = 64
             );
 
             /// Destroys DHP memory manager
@@ -868,10 +966,48 @@ namespace cds { namespace gc {
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
             void retirePtr( retired_ptr const& p )
             {
-                if ( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) )
+                if ( m_RetiredBuffer.push( alloc_retired( p )) >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) )
                     scan();
             }
 
+            /// Places retired pointer \p p into thread-local \p batch
+            /**
+                When \p batch is full it is handed off to the global retired buffer
+            */
+            void retirePtr( details::retired_batch& batch, retired_ptr const& p )
+            {
+                if ( batch.push( alloc_retired( p )) >= m_nRetiredBatchSize )
+                    flushBatch( batch );
+            }
+
+            /// Hands off thread-local \p batch to the global retired buffer
+            /**
+                If \p bScan is \p true and the size of global retired buffer exceeds the threshold, \p scan() is called
+            */
+            void flushBatch( details::retired_batch& batch, bool bScan = true )
+            {
+                if ( !batch.empty() ) {
+                    size_t nSize = m_RetiredBuffer.push_list( batch.m_pFirst, batch.m_pLast, batch.m_nSize );
+                    batch.clear();
+                    if ( m_bStatEnabled )
+                        m_stat.m_nBatchCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    if ( bScan && nSize >= m_nLiberateThreshold.load( atomics::memory_order_relaxed ))
+                        scan();
+                }
+            }
+
+            /// Allocates thread-local batch of retired pointers
+            details::retired_batch * allocRetiredBatch();
+
+            /// Returns thread-local batch \p pBatch back to GC, the batch must be empty
+            void freeRetiredBatch( details::retired_batch * pBatch );
+
+            /// Sets batch disposer, returns previous one. \p nullptr resets batch disposer
+            batch_disposer_func setBatchDisposer( batch_disposer_func f )
+            {
+                return m_pBatchDisposer.exchange( f, atomics::memory_order_acq_rel );
+            }
+
         protected:
             /// Liberate function
             /** @anchor dhp_gc_liberate
@@ -903,8 +1039,21 @@ namespace cds { namespace gc {
             }
 
         private:
-            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount );
+            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount, size_t nRetiredBatchSize );
             ~GarbageCollector();
+
+            details::retired_ptr_node& alloc_retired( retired_ptr const& p )
+            {
+                details::retired_ptr_node& node = m_RetiredAllocator.alloc( p );
+                node.m_nRetireTime = m_bStatEnabled ? timestamp() : 0;
+                return node;
+            }
+
+            static uint64_t timestamp()
+            {
+                return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count() );
+            }
         };
 
         /// Thread GC
@@ -924,6 +1073,7 @@ namespace cds { namespace gc {
             GarbageCollector&   m_gc    ;   ///< reference to GC singleton
             details::guard_data *    m_pList ;   ///< Local list of guards owned by the thread
             details::guard_data *    m_pFree ;   ///< The list of free guard from m_pList
+            details::retired_batch * m_pRetired; ///< Local batch of retired pointers
 
         public:
             /// Default constructor
@@ -931,6 +1081,7 @@ namespace cds { namespace gc {
                 : m_gc( GarbageCollector::instance() )
                 , m_pList( nullptr )
                 , m_pFree( nullptr )
+                , m_pRetired( nullptr )
             {}
 
             /// The object is not copy-constructible
@@ -948,6 +1099,7 @@ namespace cds { namespace gc {
                 if ( !m_pList ) {
                     m_pList =
                         m_pFree = m_gc.allocGuardList( m_gc.m_nInitialThreadGuardCount );
+                    m_pRetired = m_gc.allocRetiredBatch();
                 }
             }
 
@@ -955,6 +1107,10 @@ namespace cds { namespace gc {
             void fini()
             {
                 if ( m_pList ) {
+                    m_gc.flushBatch( *m_pRetired );
+                    m_gc.freeRetiredBatch( m_pRetired );
+                    m_pRetired = nullptr;
+
                     m_gc.freeGuardList( m_pList );
                     m_pList =
                         m_pFree = nullptr;
@@ -1030,16 +1186,22 @@ namespace cds { namespace gc {
                 m_pFree = arr[0].get_guard();
             }
 
-            /// Places retired pointer \p and its deleter \p pFunc into list of retired pointer for deferred reclamation
+            /// Places retired pointer \p and its deleter \p pFunc into thread-local batch of retired pointer for deferred reclamation
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
             {
-                m_gc.retirePtr( p, pFunc );
+                assert( m_pRetired != nullptr );
+                m_gc.retirePtr( *m_pRetired, retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
             }
 
             /// Run retiring cycle
+            /**
+                Thread-local batch of retired pointers is handed off to GC before the cycle
+            */
             void scan()
             {
+                if ( m_pRetired )
+                    m_gc.flushBatch( *m_pRetired, false );
                 m_gc.scan();
             }
         };
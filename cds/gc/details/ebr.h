@@ -0,0 +1,567 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_DETAILS_EBR_H
+#define CDSLIB_GC_DETAILS_EBR_H
+
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+#include <cds/details/allocator.h>
+#include <cds/user_setup/cache_line.h>
+#include <cds/gc/details/retired_ptr.h>
+
+#include <algorithm>   // std::copy
+#include <stdexcept>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+    // warning C4251: 'cds::gc::ebr::GarbageCollector::m_pHead' : class 'cds::cxx11_atomic::atomic<T>'
+    // needs to have dll-interface to be used by clients of class 'cds::gc::ebr::GarbageCollector'
+#   pragma warning(disable: 4251)
+#endif
+
+//@cond
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation schema
+    /**
+    \par Sources:
+        - [2004] Keir Fraser "Practical lock-freedom"
+        - [2007] Thomas E. Hart, Paul E. McKenney, Angela Demke Brown, Jonathan Walpole
+            "Performance of memory reclamation for lockless synchronization"
+
+        The \p cds::gc::ebr namespace and its members are internal representation of Epoch-based GC and should not be used directly.
+        Use \p cds::gc::EBR class in your code.
+
+        The schema maintains the global epoch counter. A thread that reads shared data
+        announces (pins) the current global epoch in its thread record; the announcement is made once
+        for the outermost guard of the thread, so the guards are just plain pointers.
+        A retired pointer is tagged with the global epoch of the retirement.
+        The global epoch is advanced when all pinned threads have announced the current epoch.
+        The retired pointer tagged with epoch \p e may be freed when the global epoch
+        reaches <tt>e + 2</tt>: no thread can hold a reference to it at this time.
+    */
+    namespace ebr {
+
+        // forwards
+        class GarbageCollector;
+        class ThreadGC;
+
+        using cds::gc::details::free_retired_ptr_func;
+
+        namespace details {
+
+            /// Retired pointer
+            typedef cds::gc::details::retired_ptr   retired_ptr;
+
+            /// Retired pointer tagged with the epoch of retirement
+            struct epoch_retired_ptr {
+                retired_ptr m_ptr   ;   ///< retired pointer
+                uint64_t    m_nEpoch;   ///< global epoch at the moment of retirement
+            };
+
+            /// Thread-local array of retired pointers
+            /**
+                The array belongs to the thread record: owner thread writes to the array,
+                the array is expanded if the epoch cannot be advanced for a long time.
+            */
+            class retired_vector {
+                typedef cds::details::Allocator< epoch_retired_ptr, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                epoch_retired_ptr * m_arr       ;   ///< the array of retired pointers
+                size_t              m_nCapacity ;   ///< Capacity of \p m_arr
+                size_t              m_nSize     ;   ///< Current size of \p m_arr
+
+            public:
+                /// Iterator
+                typedef epoch_retired_ptr * iterator;
+
+                /// Allocates the array of \p nCapacity retired pointers
+                explicit retired_vector( size_t nCapacity )
+                    : m_nCapacity( nCapacity ? nCapacity : 16 )
+                    , m_nSize( 0 )
+                {
+                    m_arr = allocator_impl().NewArray( m_nCapacity );
+                }
+
+                /// Frees the array
+                ~retired_vector()
+                {
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                }
+
+                /// Current size of the array
+                size_t size() const CDS_NOEXCEPT
+                {
+                    return m_nSize;
+                }
+
+                /// Sets the size of the array, \p nSize <= \p size()
+                void size( size_t nSize ) CDS_NOEXCEPT
+                {
+                    assert( nSize <= m_nSize );
+                    m_nSize = nSize;
+                }
+
+                /// Capacity of the array
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Checks if the array is empty
+                bool empty() const CDS_NOEXCEPT
+                {
+                    return m_nSize == 0;
+                }
+
+                /// Pushes retired pointer \p p tagged by \p nEpoch; expands the array if it is full
+                void push( retired_ptr const& p, uint64_t nEpoch )
+                {
+                    if ( m_nSize == m_nCapacity )
+                        grow();
+                    m_arr[m_nSize].m_ptr = p;
+                    m_arr[m_nSize].m_nEpoch = nEpoch;
+                    ++m_nSize;
+                }
+
+                /// Begin iterator
+                iterator begin() CDS_NOEXCEPT
+                {
+                    return m_arr;
+                }
+
+                /// End iterator
+                iterator end() CDS_NOEXCEPT
+                {
+                    return m_arr + m_nSize;
+                }
+
+            private:
+                void grow()
+                {
+                    size_t const nCapacity = m_nCapacity * 2;
+                    epoch_retired_ptr * pNew = allocator_impl().NewArray( nCapacity );
+                    std::copy( m_arr, m_arr + m_nSize, pNew );
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                    m_arr = pNew;
+                    m_nCapacity = nCapacity;
+                }
+            };
+
+            /// Thread record
+            /**
+                The record is allocated for each thread attached to EBR GC and is never freed
+                until the GC is destroyed: a record of detached thread is reused by other thread.
+
+                \p m_nEpoch is the epoch announced by the owner thread: <tt>(epoch << 1) | 1</tt>
+                if the thread is pinned, 0 otherwise.
+            */
+            struct thread_record
+            {
+                atomics::atomic<uint64_t>       m_nEpoch    ;   ///< Announced epoch, 0 - the thread is not pinned
+                size_t                          m_nNesting  ;   ///< Pin nesting level, owner thread only
+                char pad1_[cds::c_nCacheLineSize - sizeof(atomics::atomic<uint64_t>) - sizeof(size_t)];
+
+                retired_vector                  m_arrRetired;   ///< Retired pointers
+                size_t                          m_nNextScan ;   ///< \p m_arrRetired size to call \p scan()
+                atomics::atomic<OS::ThreadId>   m_idOwner   ;   ///< Owner thread id; \p c_NullThreadId - the record is free
+                thread_record *                 m_pNext     ;   ///< Next record in global list of records
+
+                //@cond
+                thread_record( size_t nScanThreshold )
+                    : m_nEpoch( 0 )
+                    , m_nNesting( 0 )
+                    , m_arrRetired( nScanThreshold * 2 )
+                    , m_nNextScan( nScanThreshold )
+                    , m_idOwner( OS::c_NullThreadId )
+                    , m_pNext( nullptr )
+                {}
+                //@endcond
+
+                /// Checks if the owner thread is pinned
+                bool is_pinned() const CDS_NOEXCEPT
+                {
+                    return m_nNesting != 0;
+                }
+            };
+
+            /// Native guard of \p cds::gc::EBR::guarded_ptr
+            /**
+                The guard is a plain pointer, the pointee is protected by the epoch pinned
+                by the owner \p guarded_ptr.
+            */
+            class guard
+            {
+                void * m_p;
+
+            public:
+                //@cond
+                guard() CDS_NOEXCEPT
+                    : m_p( nullptr )
+                {}
+                //@endcond
+
+                /// Sets the guard value
+                template <typename T>
+                void set( T * p ) CDS_NOEXCEPT
+                {
+                    m_p = reinterpret_cast<void *>( const_cast<typename std::remove_cv<T>::type *>( p ));
+                }
+
+                /// Returns the guard value
+                void * get( atomics::memory_order /*order*/ = atomics::memory_order_relaxed ) const CDS_NOEXCEPT
+                {
+                    return m_p;
+                }
+
+                /// Clears the guard
+                void clear() CDS_NOEXCEPT
+                {
+                    m_p = nullptr;
+                }
+            };
+
+        } // namespace details
+
+        /// Memory manager (Garbage collector)
+        class CDS_EXPORT_API GarbageCollector
+        {
+        private:
+            friend class ThreadGC;
+
+            /// Internal GC statistics
+            struct internal_stat
+            {
+                atomics::atomic<size_t>  m_nRecordCount      ;   ///< Count of thread records allocated
+                atomics::atomic<size_t>  m_nEpochAdvanceCount;   ///< Count of global epoch advancing
+                atomics::atomic<size_t>  m_nScanCount        ;   ///< Count of \p scan() calls
+                atomics::atomic<size_t>  m_nHelpScanCount    ;   ///< Count of retired pointers of free records freed by other threads
+                atomics::atomic<size_t>  m_nFreedCount       ;   ///< Count of freed retired pointers
+
+                internal_stat()
+                    : m_nRecordCount(0)
+                    , m_nEpochAdvanceCount(0)
+                    , m_nScanCount(0)
+                    , m_nHelpScanCount(0)
+                    , m_nFreedCount(0)
+                {}
+            };
+
+        public:
+            /// Exception "No GarbageCollector object is created"
+            class not_initialized : public std::runtime_error
+            {
+            public:
+                //@cond
+                not_initialized()
+                    : std::runtime_error( "Global EBR GarbageCollector is not initialized" )
+                {}
+                //@endcond
+            };
+
+            /// Internal GC statistics
+            struct InternalState
+            {
+                size_t   m_nRecordCount      ;   ///< Count of thread records allocated
+                size_t   m_nEpochAdvanceCount;   ///< Count of global epoch advancing
+                size_t   m_nScanCount        ;   ///< Count of \p scan() calls
+                size_t   m_nHelpScanCount    ;   ///< Count of retired pointers of free records freed by other threads
+                size_t   m_nFreedCount       ;   ///< Count of freed retired pointers
+                uint64_t m_nGlobalEpoch      ;   ///< Current global epoch
+
+                //@cond
+                InternalState()
+                    : m_nRecordCount(0)
+                    , m_nEpochAdvanceCount(0)
+                    , m_nScanCount(0)
+                    , m_nHelpScanCount(0)
+                    , m_nFreedCount(0)
+                    , m_nGlobalEpoch(0)
+                {}
+
+                InternalState& operator =( internal_stat const& s )
+                {
+                    m_nRecordCount       = s.m_nRecordCount.load( atomics::memory_order_relaxed );
+                    m_nEpochAdvanceCount = s.m_nEpochAdvanceCount.load( atomics::memory_order_relaxed );
+                    m_nScanCount         = s.m_nScanCount.load( atomics::memory_order_relaxed );
+                    m_nHelpScanCount     = s.m_nHelpScanCount.load( atomics::memory_order_relaxed );
+                    m_nFreedCount        = s.m_nFreedCount.load( atomics::memory_order_relaxed );
+                    return *this;
+                }
+                //@endcond
+            };
+
+        private:
+            static GarbageCollector * m_pManager    ;   ///< GC global instance
+
+            atomics::atomic<uint64_t>   m_nGlobalEpoch  ;   ///< Global epoch
+            char pad1_[cds::c_nCacheLineSize - sizeof(atomics::atomic<uint64_t>)];
+
+            atomics::atomic<details::thread_record *> m_pHead; ///< Head of thread record list
+            const size_t    m_nScanThreshold;   ///< Count of retired pointers of the thread to call \p scan()
+
+            internal_stat   m_stat          ;   ///< Internal statistics
+            bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+
+        public:
+            /// Initializes EBR memory manager singleton
+            /**
+                This member function creates and initializes EBR global object.
+                The function should be called before using CDS data structure based on \p cds::gc::EBR GC. Usually,
+                this member function is called in the \p main() function.
+                After calling of this function you may use CDS data structures based on \p cds::gc::EBR.
+
+                \par Parameters
+                - \p nScanThreshold - \p scan() threshold. When the count of retired pointers of a thread reaches this value,
+                    the \p scan() member function would be called for freeing retired pointers.
+                    If the epoch cannot be advanced, the threshold of the thread is increased
+                    by \p nScanThreshold. Default value is 256.
+            */
+            static void CDS_STDCALL Construct( size_t nScanThreshold = 256 );
+
+            /// Destroys EBR memory manager
+            /**
+                The member function destroys EBR global object. After calling of this function you may \b NOT
+                use CDS data structures based on \p cds::gc::EBR. Usually, the \p Destruct function is called
+                at the end of your \p main().
+            */
+            static void CDS_STDCALL Destruct();
+
+            /// Returns pointer to GarbageCollector instance
+            /**
+                If EBR GC is not initialized, \p not_initialized exception is thrown
+            */
+            static GarbageCollector&   instance()
+            {
+                if ( m_pManager == nullptr )
+                    throw not_initialized();
+                return *m_pManager;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pManager != nullptr;
+            }
+
+            /// Returns current global epoch
+            uint64_t epoch() const CDS_NOEXCEPT
+            {
+                return m_nGlobalEpoch.load( atomics::memory_order_acquire );
+            }
+
+        public:
+            //@{
+            /// Internal interface
+
+            /// Allocates thread record for current thread
+            details::thread_record * alloc_thread_record();
+
+            /// Frees thread record \p pRec. The retired pointers that cannot be freed yet are left in the record
+            void free_thread_record( details::thread_record * pRec );
+
+            /// Pins the global epoch for the owner thread of \p rec
+            void enter( details::thread_record& rec ) CDS_NOEXCEPT
+            {
+                if ( rec.m_nNesting++ == 0 ) {
+                    rec.m_nEpoch.store( (m_nGlobalEpoch.load( atomics::memory_order_relaxed ) << 1) | 1, atomics::memory_order_relaxed );
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                }
+            }
+
+            /// Unpins the epoch for the owner thread of \p rec
+            void leave( details::thread_record& rec ) CDS_NOEXCEPT
+            {
+                assert( rec.m_nNesting > 0 );
+                if ( --rec.m_nNesting == 0 )
+                    rec.m_nEpoch.store( 0, atomics::memory_order_release );
+            }
+
+            /// Places retired pointer \p p into retired array of \p rec
+            /**
+                The pointer is tagged with current global epoch.
+                When the size of the retired array reaches the scan threshold of the record, \p scan() is called.
+            */
+            void retire( details::thread_record& rec, details::retired_ptr const& p )
+            {
+                // Orders the unlinking of p performed before against the reading of the global epoch,
+                // like the fence in try_advance()
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                rec.m_arrRetired.push( p, m_nGlobalEpoch.load( atomics::memory_order_acquire ));
+                if ( rec.m_arrRetired.size() >= rec.m_nNextScan )
+                    scan( rec );
+            }
+
+            /// Tries to advance the global epoch and frees the retired pointers of \p rec that are safe to free
+            void scan( details::thread_record& rec );
+
+            /// Frees all retired pointers of \p rec if no other thread has pinned the epoch
+            /**
+                A pointer retired in epoch \p e may be freed in epoch <tt>e + 2</tt>,
+                so unlike \p scan() the function tries to advance the global epoch twice.
+            */
+            void force_dispose( details::thread_record& rec );
+            //@}
+
+        public:
+            /// Get internal statistics
+            InternalState& getInternalState(InternalState& stat) const
+            {
+                stat = m_stat;
+                stat.m_nGlobalEpoch = epoch();
+                return stat;
+            }
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const
+            {
+                return m_bStatEnabled;
+            }
+
+            /// Enables/disables internal statistics
+            bool  enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled;
+                m_bStatEnabled = bEnable;
+                return bEnabled;
+            }
+
+        private:
+            GarbageCollector( size_t nScanThreshold );
+            ~GarbageCollector();
+
+            bool try_advance();
+            size_t free_retired( details::thread_record& rec, uint64_t nEpoch );
+            void help_scan( details::thread_record& rec, uint64_t nEpoch );
+        };
+
+        /// Thread GC
+        /**
+            To use Epoch-based reclamation schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses EBR GC. Before terminating the thread linked to EBR GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+        */
+        class ThreadGC
+        {
+            GarbageCollector&           m_gc    ;   ///< reference to GC singleton
+            details::thread_record *    m_pRec  ;   ///< Thread record
+
+        public:
+            /// Default constructor
+            ThreadGC()
+                : m_gc( GarbageCollector::instance() )
+                , m_pRec( nullptr )
+            {}
+
+            /// The object is not copy-constructible
+            ThreadGC( ThreadGC const& ) = delete;
+
+            /// Dtor calls fini()
+            ~ThreadGC()
+            {
+                fini();
+            }
+
+            /// Initialization. Repeat call is available
+            void init()
+            {
+                if ( !m_pRec )
+                    m_pRec = m_gc.alloc_thread_record();
+            }
+
+            /// Finalization. Repeat call is available
+            void fini()
+            {
+                if ( m_pRec ) {
+                    m_gc.free_thread_record( m_pRec );
+                    m_pRec = nullptr;
+                }
+            }
+
+        public:
+            /// Pins current global epoch; nested calls are allowed
+            void enter() CDS_NOEXCEPT
+            {
+                assert( m_pRec != nullptr );
+                m_gc.enter( *m_pRec );
+            }
+
+            /// Unpins the epoch
+            void leave() CDS_NOEXCEPT
+            {
+                assert( m_pRec != nullptr );
+                m_gc.leave( *m_pRec );
+            }
+
+            /// Checks if the thread is pinned
+            bool is_pinned() const CDS_NOEXCEPT
+            {
+                return m_pRec && m_pRec->is_pinned();
+            }
+
+            /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                retirePtr( details::retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+            }
+
+            /// Places retired pointer \p p into thread's array of retired pointer for deferred reclamation
+            void retirePtr( details::retired_ptr const& p )
+            {
+                assert( m_pRec != nullptr );
+                m_gc.retire( *m_pRec, p );
+            }
+
+            /// Run retiring cycle
+            void scan()
+            {
+                assert( m_pRec != nullptr );
+                m_gc.scan( *m_pRec );
+            }
+
+            /// Frees all retired pointers of the thread that are not accessible by other threads
+            void force_dispose()
+            {
+                assert( m_pRec != nullptr );
+                m_gc.force_dispose( *m_pRec );
+            }
+        };
+    }   // namespace ebr
+}}  // namespace cds::gc
+//@endcond
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif // #ifndef CDSLIB_GC_DETAILS_EBR_H
@@ -33,15 +33,17 @@
 
 #include <cds/algo/atomic.h>
 #include <cds/os/thread.h>
-#include <cds/details/bounded_array.h>
+#include <cds/details/allocator.h>
 #include <cds/user_setup/cache_line.h>
 
 #include <cds/gc/details/hp_type.h>
 #include <cds/gc/details/hp_alloc.h>
 
+#include <algorithm>   // std::copy
+
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
-    // warning C4251: 'cds::gc::hp::GarbageCollector::m_pListHead' : class 'cds::cxx11_atomic::atomic<T>'
+    // warning C4251: 'cds::gc::hp::GarbageCollector::m_nRecCount' : class 'cds::cxx11_atomic::atomic<T>'
     // needs to have dll-interface to be used by clients of class 'cds::gc::hp::GarbageCollector'
 #   pragma warning(disable: 4251)
 #endif
@@ -99,30 +101,38 @@ namespace cds {
                 The Hazard Pointer schema is build on thread-static arrays. For each HP-enabled thread the HP manager allocates
                 array of retired pointers. The array belongs to the thread: owner thread writes to the array, other threads
                 just read it.
+
+                The initial capacity of the array is defined by cds::gc::hp::GarbageCollector. Since the count of threads
+                is not limited, the array can be expanded by \p GarbageCollector::Scan when most of retired pointers
+                in the array are guarded.
             */
             class retired_vector {
-                /// Underlying vector implementation
-                typedef cds::details::bounded_array<retired_ptr>    retired_vector_impl;
+                //@cond
+                typedef cds::details::Allocator< retired_ptr, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+                //@endcond
 
-                retired_vector_impl m_arr   ;   ///< the array of retired pointers
-                size_t              m_nSize ;   ///< Current size of \p m_arr
+                retired_ptr *   m_arr       ;   ///< the array of retired pointers
+                size_t          m_nCapacity ;   ///< Capacity of \p m_arr
+                size_t          m_nSize     ;   ///< Current size of \p m_arr
 
             public:
                 /// Iterator
-                typedef retired_vector_impl::iterator  iterator;
+                typedef retired_ptr *  iterator;
 
                 /// Constructor
                 retired_vector( const cds::gc::hp::GarbageCollector& HzpMgr ); // inline
                 ~retired_vector()
-                {}
+                {
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                }
 
                 /// Vector capacity.
                 /**
-                    The capacity is constant for any thread. It is defined by cds::gc::hp::GarbageCollector.
+                    The initial capacity is defined by cds::gc::hp::GarbageCollector.
                 */
                 size_t capacity() const CDS_NOEXCEPT
                 {
-                    return m_arr.capacity();
+                    return m_nCapacity;
                 }
 
                 /// Current vector size (count of retired pointers in the vector)
@@ -152,16 +162,30 @@ namespace cds {
                     return m_nSize >= capacity();
                 }
 
+                /// Doubles the capacity of the vector. Uses internally
+                /**
+                    Only owner thread of the vector may call this function.
+                */
+                void grow()
+                {
+                    allocator_impl a;
+                    retired_ptr * pNew = a.NewArray( m_nCapacity * 2 );
+                    std::copy( m_arr, m_arr + m_nSize, pNew );
+                    a.Delete( m_arr, m_nCapacity );
+                    m_arr = pNew;
+                    m_nCapacity *= 2;
+                }
+
                 /// Begin iterator
                 iterator    begin() CDS_NOEXCEPT
                 {
-                    return m_arr.begin();
+                    return m_arr;
                 }
 
                 /// End iterator
                 iterator    end() CDS_NOEXCEPT
                 {
-                    return m_arr.begin() +  m_nSize;
+                    return m_arr + m_nSize;
                 }
 
                 /// Clears the vector. After clearing, size() == 0
@@ -207,7 +231,8 @@ namespace cds {
         */
         enum scan_type {
             classic,    ///< classic scan as described in Michael's works (see GarbageCollector::classic_scan)
-            inplace     ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            inplace,    ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            batched     ///< snapshot scan with hash set lookup (see GarbageCollector::batched_scan)
         };
 
         /// Hazard Pointer singleton
@@ -288,30 +313,74 @@ namespace cds {
                 event_counter  m_DeferredNode            ;    ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
             };
 
-            /// Internal list of cds::gc::hp::details::hp_record
+            /// HP record with GC internal fields
             struct hplist_node : public details::hp_record
             {
-                hplist_node *                    m_pNextNode; ///< next hazard ptr record in list
                 atomics::atomic<OS::ThreadId>    m_idOwner;   ///< Owner thread id; 0 - the record is free (not owned)
                 atomics::atomic<bool>            m_bFree;     ///< true if record if free (not owned)
+                const size_t                     m_nIndex;    ///< Index of the record in HP record table
+                atomics::atomic<uint32_t>        m_nNextFree; ///< Next record in the free-list: record index + 1, 0 - end of the list
+
+                void **                          m_pScanBuf;        ///< Thread-private hash set of hazard pointers for \p batched_scan
+                size_t                           m_nScanBufCapacity;///< Capacity of \p m_pScanBuf
 
                 //@cond
-                hplist_node( const GarbageCollector& HzpMgr )
+                hplist_node( const GarbageCollector& HzpMgr, size_t nIndex )
                     : hp_record( HzpMgr ),
-                    m_pNextNode( nullptr ),
                     m_idOwner( OS::c_NullThreadId ),
-                    m_bFree( true )
+                    m_bFree( true ),
+                    m_nIndex( nIndex ),
+                    m_nNextFree( 0 ),
+                    m_pScanBuf( nullptr ),
+                    m_nScanBufCapacity( 0 )
                 {}
 
                 ~hplist_node()
                 {
                     assert( m_idOwner.load( atomics::memory_order_relaxed ) == OS::c_NullThreadId );
                     assert( m_bFree.load(atomics::memory_order_relaxed) );
+                    assert( m_pScanBuf == nullptr );
+                }
+                //@endcond
+            };
+
+            /// Chunk of HP record table
+            /**
+                HP record table is a directory of chunks. The capacity of chunk \p k is <tt>m_nChunkCapacity << k</tt>,
+                so the table can grow up to any reasonable thread count. A slot of the chunk is \p nullptr
+                until the record with appropriate index is allocated.
+                Chunks and records are never freed while GC is alive.
+            */
+            struct hprec_chunk
+            {
+                atomics::atomic<size_t>         m_nUsed;     ///< Count of records with \p m_bFree == \p false. The scan skips the chunk if it is zero
+                const size_t                    m_nCapacity; ///< Capacity of the chunk
+                atomics::atomic<hplist_node *> * m_arrRec;   ///< Record slots
+
+                //@cond
+                explicit hprec_chunk( size_t nCapacity )
+                    : m_nUsed( 0 )
+                    , m_nCapacity( nCapacity )
+                    , m_arrRec( new atomics::atomic<hplist_node *>[ nCapacity ] )
+                {
+                    for ( size_t i = 0; i < nCapacity; ++i )
+                        m_arrRec[i].store( nullptr, atomics::memory_order_relaxed );
+                }
+
+                ~hprec_chunk()
+                {
+                    delete [] m_arrRec;
                 }
                 //@endcond
             };
 
-            atomics::atomic<hplist_node *>   m_pListHead  ;  ///< Head of GC list
+            //@cond
+            static CDS_CONSTEXPR const size_t c_nMaxChunkCount = 32;  ///< Max chunk count of HP record table, 32 chunks is enough for 2**32 records
+            //@endcond
+
+            atomics::atomic<hprec_chunk *>   m_arrChunk[c_nMaxChunkCount]; ///< HP record table
+            atomics::atomic<size_t>          m_nRecCount  ;  ///< Count of HP records allocated
+            atomics::atomic<uint64_t>        m_FreeList   ;  ///< Free-list of released HP records: low 32 bits - record index + 1, high 32 bits - ABA tag
 
             static GarbageCollector *    m_pHZPManager  ;   ///< GC instance pointer
 
@@ -319,8 +388,9 @@ namespace cds {
             bool                    m_bStatEnabled      ;   ///< true - statistics enabled
 
             const size_t            m_nHazardPointerCount   ;   ///< max count of thread's hazard pointer
-            const size_t            m_nMaxThreadCount       ;   ///< max count of thread
-            const size_t            m_nMaxRetiredPtrCount   ;   ///< max count of retired ptr per thread
+            const size_t            m_nMaxThreadCount       ;   ///< initial thread count, the capacity of first chunk of HP record table
+            const size_t            m_nMaxRetiredPtrCount   ;   ///< initial capacity of retired ptr array per thread
+            const size_t            m_nChunkCapacity        ;   ///< capacity of first chunk of HP record table, power of 2
             scan_type               m_nScanType             ;   ///< scan type (see \ref scan_type enum)
 
 
@@ -336,8 +406,8 @@ namespace cds {
             /// Dtor
             ~GarbageCollector();
 
-            /// Allocate new HP record
-            hplist_node * NewHPRec();
+            /// Allocate new HP record with index \p nIndex
+            hplist_node * NewHPRec( size_t nIndex );
 
             /// Permanently deletes HPrecord \p pNode
             /**
@@ -347,6 +417,29 @@ namespace cds {
 
             void detachAllThread();
 
+            /// Returns chunk number of HP record \p nIndex, \p nOffset is the index of the record in the chunk
+            size_t chunk_index( size_t nIndex, size_t& nOffset ) const;
+
+            /// Returns chunk \p nChunk of HP record table, allocates the chunk if needed
+            hprec_chunk * get_chunk( size_t nChunk );
+
+            /// Calls \p f for each allocated HP record; if \p bUsedOnly is \p true then chunks without used records are skipped
+            template <typename Func>
+            void for_each_record( Func f, bool bUsedOnly ) const;   // defined in hp_gc.cpp
+
+            /// Calls \p f for first \p nRecCount HP records, see \ref for_each_record( Func, bool ) const
+            template <typename Func>
+            void for_each_record( Func f, bool bUsedOnly, size_t nRecCount ) const; // defined in hp_gc.cpp
+
+            /// Pops a record from the free-list, returns \p nullptr if the free-list is empty
+            hplist_node * pop_free_record();
+
+            /// Pushes released record \p pNode to the free-list
+            void push_free_record( hplist_node * pNode );
+
+            /// Sets \p m_bFree flag of \p pNode and updates used record counter of its chunk
+            void set_free_flag( hplist_node * pNode, bool bFree );
+
         public:
             /// Creates GarbageCollector singleton
             /**
@@ -359,15 +452,18 @@ namespace cds {
                                      the data structure algorithms. By default, if \p nHazardPtrCount = 0,
                                      the function uses maximum of HP count for CDS library.
 
-                \p nMaxThreadCount - max count of thread with using HP GC in your application. Default is 100.
+                \p nMaxThreadCount - expected count of thread with using HP GC in your application. Default is 100.
+                                    It is not a limit: HP record table grows when more threads are attached.
+                                    The value is used as the capacity of first chunk of HP record table.
 
-                \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
-                                    \p nHazardPtrCount * \p nMaxThreadCount.
+                \p nMaxRetiredPtrCount - initial capacity of array of retired pointers for each thread.
                                     Default is 2 * \p nHazardPtrCount * \p nMaxThreadCount.
+                                    The array is expanded when more than half of retired pointers cannot be freed
+                                    after the scan.
             */
             static void    CDS_STDCALL Construct(
                 size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
-                size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
+                size_t nMaxThreadCount = 0,     ///< Expected count of simultaneous working thread in your application
                 size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
                 scan_type nScanType = inplace   ///< Scan type (see \ref scan_type enum)
             );
@@ -403,13 +499,16 @@ namespace cds {
                 return m_nHazardPointerCount;
             }
 
-            /// Returns max thread count defined in construction time
+            /// Returns expected thread count defined in construction time
+            /**
+                The thread count is not limited, see \p Construct().
+            */
             size_t            getMaxThreadCount() const CDS_NOEXCEPT
             {
                 return m_nMaxThreadCount;
             }
 
-            /// Returns max size of retired objects array. It is defined in construction time
+            /// Returns initial size of retired objects array. It is defined in construction time
             size_t            getMaxRetiredPtrCount() const CDS_NOEXCEPT
             {
                 return m_nMaxRetiredPtrCount;
@@ -474,6 +573,7 @@ namespace cds {
                 There are the following scan algorithm:
                 - \ref hzp_gc_classic_scan "classic_scan" allocates memory for internal use
                 - \ref hzp_gc_inplace_scan "inplace_scan" does not allocate any memory
+                - \ref hzp_gc_batched_scan "batched_scan" uses thread-private hash set of hazard pointers
 
                 Use \ref hzp_gc_setScanType "setScanType" member function to setup appropriate scan algorithm.
             */
@@ -483,12 +583,19 @@ namespace cds {
                     case inplace:
                         inplace_scan( pRec );
                         break;
+                    case batched:
+                        batched_scan( pRec );
+                        break;
                     default:
                         assert(false)   ;   // Forgotten something?..
                     case classic:
                         classic_scan( pRec );
                         break;
                 }
+
+                // Most of retired pointers are guarded: there are more threads than the array was sized for
+                if ( pRec->m_arrRetired.size() * 2 > pRec->m_arrRetired.capacity() )
+                    pRec->m_arrRetired.grow();
             }
 
             /// Helper scan routine
@@ -535,6 +642,28 @@ namespace cds {
                 All operations are performed in-place.
             */
             void inplace_scan( details::hp_record * pRec );
+
+            /// Batched scan algorithm
+            /** @anchor hzp_gc_batched_scan
+                The algorithm is intended for large count of hazard pointers and threads.
+
+                In the first stage all non-null hazard pointers of active HP records are copied
+                to the thread-private cache-aligned open-addressing hash set. Only one memory fence
+                is issued for the whole snapshot instead of synchronization per hazard pointer.
+                The hash set is split into buckets of four pointers; a bucket is compared with
+                a retired pointer by SIMD instructions if they are available (SSE2 on x86-64).
+
+                In the second stage retired pointers are checked against the hash set in batches:
+                hash buckets of a batch are computed and prefetched before searching,
+                so the memory latency is hidden.
+
+                The hash set buffer belongs to the HP record and is reused in subsequent scans.
+                It grows when the count of HP records increases.
+            */
+            void batched_scan( details::hp_record * pRec );
+
+            /// Frees \p batched_scan buffer of HP record \p pNode
+            void free_scan_buffer( hplist_node * pNode );
         };
 
         /// Thread's hazard pointer manager
@@ -739,8 +868,9 @@ namespace cds {
     namespace gc { namespace hp { namespace details {
 
         inline retired_vector::retired_vector( const cds::gc::hp::GarbageCollector& HzpMgr )
-            : m_arr( HzpMgr.getMaxRetiredPtrCount() ),
-            m_nSize(0)
+            : m_arr( allocator_impl().NewArray( HzpMgr.getMaxRetiredPtrCount() ))
+            , m_nCapacity( HzpMgr.getMaxRetiredPtrCount() )
+            , m_nSize(0)
         {}
 
         inline hp_record::hp_record( const cds::gc::hp::GarbageCollector& HzpMgr )
@@ -615,14 +615,19 @@ namespace cds { namespace gc {
                 ABA problem for internal data. \p nEpochCount specifies the epoch count,
                 i.e. the count of simultaneously working threads that remove the elements
                 of DHP-based concurrent data structure. Default value is 16.
+            - \p nRetiredBatchSize - size of thread-local batch of retired pointers. Each thread collects
+                retired pointers locally and hands off the whole batch to the global retired buffer
+                by one CAS when the batch is full. So, the threads contend on the global buffer
+                <tt>nRetiredBatchSize</tt> times less. Default value is 64.
         */
         DHP(
             size_t nLiberateThreshold = 1024
             , size_t nInitialThreadGuardCount = 8
             , size_t nEpochCount = 16
+            , size_t nRetiredBatchSize = 64
         )
         {
-            dhp::GarbageCollector::Construct( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount );
+            dhp::GarbageCollector::Construct( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount, nRetiredBatchSize );
         }
 
         /// Destroys %DHP memory manager
@@ -657,12 +662,14 @@ namespace cds { namespace gc {
             The function places pointer \p p to array of pointers ready for removing.
             (so called retired pointer array). The pointer can be safely removed when no guarded pointer points to it.
             Deleting the pointer is the function \p pFunc call.
+
+            If the current thread is attached to \p libcds, the pointer is placed into thread-local batch
+            of retired pointers first, the batch is handed off to the GC when it is full.
+            The function may be called from the thread that is not attached to \p libcds,
+            in that case the pointer is placed directly into the global retired buffer.
         */
         template <typename T>
-        static void retire( T * p, void (* pFunc)(T *) )
-        {
-            dhp::GarbageCollector::instance().retirePtr( p, pFunc );
-        }
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in dhp_impl.h
 
         /// Retire pointer \p p with functor of type \p Disposer
         /**
@@ -677,6 +684,30 @@ namespace cds { namespace gc {
             retire( p, cds::details::static_functor<Disposer, T>::call );
         }
 
+        /// Batch disposer type, see \p set_batch_disposer()
+        typedef dhp::GarbageCollector::batch_disposer_func batch_disposer_func;
+
+        /// Sets batch disposer, returns previous one
+        /**
+            By default, each retired pointer is freed by its own disposer.
+            If the batch disposer \p f is set, the retired pointers freed by \p scan() are collected
+            into the array and \p f is called for whole array:
+            \code
+            void my_batch_disposer( cds::gc::details::retired_ptr * arr, size_t nCount )
+            {
+                // Reclaim arr[0] ... arr[nCount - 1] in bulk
+                for ( size_t i = 0; i < nCount; ++i )
+                    arr[i].free();
+            }
+            \endcode
+            \p f may be called from any thread that calls \p scan().
+            Pass \p nullptr to reset the batch disposer.
+        */
+        static batch_disposer_func set_batch_disposer( batch_disposer_func f )
+        {
+            return dhp::GarbageCollector::instance().setBatchDisposer( f );
+        }
+
         /// Checks if Dynamic Hazard Pointer GC is constructed and may be used
         static bool isUsed()
         {
@@ -86,6 +86,15 @@ namespace cds { namespace gc {
         cds::threading::getGC<DHP>().freeGuard(g);
     }
 
+    template <typename T>
+    inline void DHP::retire( T * p, void (* pFunc)(T *) )
+    {
+        if ( cds::threading::Manager::isThreadAttached())
+            cds::threading::getGC<DHP>().retirePtr( p, pFunc );
+        else
+            dhp::GarbageCollector::instance().retirePtr( p, pFunc );
+    }
+
     inline void DHP::scan()
     {
         cds::threading::getGC<DHP>().scan();
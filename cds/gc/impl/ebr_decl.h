@@ -0,0 +1,653 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_IMPL_EBR_DECL_H
+#define CDSLIB_GC_IMPL_EBR_DECL_H
+
+#include <cds/gc/details/ebr.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/static_functor.h>
+
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation garbage collector
+    /**  @ingroup cds_garbage_collector
+        @headerfile cds/gc/ebr.h
+
+        Implementation of Epoch-based reclamation (EBR) garbage collector.
+
+        Sources:
+            - [2004] Keir Fraser "Practical lock-freedom"
+            - [2007] Thomas E. Hart, Paul E. McKenney, Angela Demke Brown, Jonathan Walpole
+                "Performance of memory reclamation for lockless synchronization"
+
+        %EBR provides the same \p Guard, \p GuardArray, \p guarded_ptr and \p retire() interface
+        as \p cds::gc::HP and \p cds::gc::DHP, so any container that can be instantiated with \p %HP
+        can be instantiated with \p %EBR.
+
+        Unlike hazard pointers, a guard does not publish the pointer it protects.
+        Instead, the first guard of the thread pins the current global epoch, and the nested guards
+        are just plain pointers. So, \p protect() is a single atomic load without any memory fence,
+        and the cost of the read side is near zero. Retired pointers are tagged by the epoch of retirement
+        and are freed when the global epoch is advanced twice.
+
+        The drawback is that a thread that holds a guard (or \p guarded_ptr) for a long time prevents the global epoch
+        from advancing, so the retired pointers of all threads are accumulated until the guard is released.
+        Do not hold guards and guarded pointers longer than needed.
+
+        See \ref cds_how_to_use "How to use" section for details how to apply garbage collector.
+    */
+    class EBR
+    {
+    public:
+        /// Native guarded pointer type
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        typedef void * guarded_pointer;
+
+        /// Atomic reference
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_ref = atomics::atomic<T *>;
+
+        /// Atomic type
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_type = atomics::atomic<T>;
+
+        /// Atomic marked pointer
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename MarkedPtr> using atomic_marked_ptr = atomics::atomic<MarkedPtr>;
+
+        /// Thread GC implementation for internal usage
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        typedef ebr::ThreadGC   thread_gc_impl;
+
+        /// Thread-level garbage collector
+        /**
+            @headerfile cds/gc/ebr.h
+            This class performs automatically attaching/detaching Epoch-based GC
+            for the current thread.
+        */
+        class thread_gc: public thread_gc_impl
+        {
+            //@cond
+            bool    m_bPersistent;
+            //@endcond
+        public:
+            /// Constructor
+            /**
+                The constructor attaches the current thread to the Epoch-based GC
+                if it is not yet attached.
+                The \p bPersistent parameter specifies attachment persistence:
+                - \p true - the class destructor will not detach the thread from Epoch-based GC.
+                - \p false (default) - the class destructor will detach the thread from Epoch-based GC.
+            */
+            thread_gc(
+                bool    bPersistent = false
+            )   ;   // inline in ebr_impl.h
+
+            /// Destructor
+            /**
+                If the object has been created in persistent mode, the destructor does nothing.
+                Otherwise it detaches the current thread from Epoch-based GC.
+            */
+            ~thread_gc()    ;   // inline in ebr_impl.h
+
+        public: // for internal use only!!!
+            //@cond
+            static void enter(); // inline in ebr_impl.h
+            static void leave(); // inline in ebr_impl.h
+            //@endcond
+        };
+
+
+        /// Epoch-based guard
+        /**
+            @headerfile cds/gc/ebr.h
+
+            The guard pins the global epoch for its lifetime; the value of the guard is a plain pointer.
+
+            A \p %Guard object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        class Guard
+        {
+            //@cond
+            guarded_pointer m_p;
+            //@endcond
+
+        public: // for internal use only
+            //@cond
+            typedef cds::gc::ebr::details::guard native_guard;
+            //@endcond
+
+        public:
+            /// Default ctor pins the epoch
+            Guard();    // inline in ebr_impl.h
+
+            /// Dtor unpins the epoch
+            ~Guard();   // inline in ebr_impl.h
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& s ) = delete;
+            Guard& operator=(Guard const&) = delete;
+            Guard& operator=(Guard&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                Since the epoch is pinned, the function is just an acquire load of \p toGuard;
+                no validating loop is needed.
+            */
+            template <typename T>
+            T protect( atomics::atomic<T> const& toGuard )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                assign( pCur );
+                return pCur;
+            }
+
+            /// Protects a converted pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores result of \p f functor to the guard.
+                The parameter \p f of type Func is a functor that makes the conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+            */
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                assign( f( pCur ));
+                return pCur;
+            }
+
+            /// Store \p p to the guard
+            template <typename T>
+            T * assign( T * p )
+            {
+                m_p = const_cast<void *>( static_cast<void const *>( p ));
+                return p;
+            }
+
+            //@cond
+            std::nullptr_t assign( std::nullptr_t )
+            {
+                m_p = nullptr;
+                return nullptr;
+            }
+            //@endcond
+
+            /// Store marked pointer \p p to the guard
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return assign( p.ptr() );
+            }
+
+            /// Copy from \p src guard to \p this guard
+            void copy( Guard const& src )
+            {
+                assign( src.get_native() );
+            }
+
+            /// Clears value of the guard
+            void clear()
+            {
+                m_p = nullptr;
+            }
+
+            /// Gets the value currently protected
+            template <typename T>
+            T * get() const
+            {
+                return reinterpret_cast<T *>( get_native() );
+            }
+
+            /// Gets native guarded pointer stored
+            guarded_pointer get_native() const
+            {
+                return m_p;
+            }
+        };
+
+        /// Array of Epoch-based guards
+        /**
+            @headerfile cds/gc/ebr.h
+            The array pins the global epoch once for all its guards.
+            Template parameter \p Count defines the size of the array.
+
+            A \p %GuardArray object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        template <size_t Count>
+        class GuardArray
+        {
+            //@cond
+            guarded_pointer m_arr[Count];
+            //@endcond
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            /// Default ctor pins the epoch
+            GuardArray();   // inline in ebr_impl.h
+
+            /// Dtor unpins the epoch
+            ~GuardArray();  // inline in ebr_impl.h
+
+            //@cond
+            GuardArray( GuardArray const& ) = delete;
+            GuardArray( GuardArray&& ) = delete;
+            GuardArray& operator=(GuardArray const&) = delete;
+            GuardArray& operator=(GuardArray&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard stored to the slot \p nIndex
+            */
+            template <typename T>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard )
+            {
+                T pRet = toGuard.load(atomics::memory_order_acquire);
+                assign( nIndex, pRet );
+                return pRet;
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The result of <tt> f( toGuard.load() ) </tt> is stored to the slot \p nIndex,
+                see \p Guard::protect().
+            */
+            template <typename T, class Func>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pRet = toGuard.load(atomics::memory_order_acquire);
+                assign( nIndex, f( pRet ));
+                return pRet;
+            }
+
+            /// Store \p p to the slot \p nIndex
+            template <typename T>
+            T * assign( size_t nIndex, T * p )
+            {
+                assert( nIndex < capacity() );
+                m_arr[nIndex] = const_cast<void *>( static_cast<void const *>( p ));
+                return p;
+            }
+
+            /// Store marked pointer \p p to the guard
+            template <typename T, int Bitmask>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, Bitmask> p )
+            {
+                return assign( nIndex, p.ptr() );
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                assign( nIndex, src.get_native() );
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to slot at index \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                assign( nDestIndex, get_native( nSrcIndex ));
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                assert( nIndex < capacity() );
+                m_arr[nIndex] = nullptr;
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex ) const
+            {
+                return reinterpret_cast<T *>( get_native( nIndex ) );
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                assert( nIndex < capacity() );
+                return m_arr[nIndex];
+            }
+
+            /// Capacity of the guard array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count;
+            }
+        };
+
+        /// Guarded pointer
+        /**
+            A guarded pointer is a pair of a pointer and pinned epoch.
+            Usually, it is used for returning a pointer to the item from an lock-free container.
+            While the guarded pointer is not empty, the epoch is pinned and the pointer cannot be disposed (freed) by GC.
+            After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+            Template arguments:
+            - \p GuardedType - a type which the guard stores
+            - \p ValueType - a value type
+            - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>. Default is \p void (no casting).
+
+            See \p cds::gc::HP::guarded_ptr for example.
+
+            The guarded pointer pins the epoch of the current thread, so it must not be passed to other thread.
+            Long-lived guarded pointer prevents the global epoch from advancing.
+
+            You don't need use this class directly.
+            All set/map container classes from \p libcds declare the typedef for \p %guarded_ptr with appropriate casting functor.
+        */
+        template <typename GuardedType, typename ValueType=GuardedType, typename Cast=void >
+        class guarded_ptr
+        {
+            //@cond
+            struct trivial_cast {
+                ValueType * operator()( GuardedType * p ) const
+                {
+                    return p;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef GuardedType guarded_type; ///< Guarded type
+            typedef ValueType   value_type;   ///< Value type
+
+            /// Functor for casting \p guarded_type to \p value_type
+            typedef typename std::conditional< std::is_same<Cast, void>::value, trivial_cast, Cast >::type value_cast;
+
+            //@cond
+            typedef cds::gc::ebr::details::guard native_guard;
+            //@endcond
+
+        private:
+            //@cond
+            native_guard    m_guard;
+            bool            m_bPinned;
+            //@endcond
+
+        public:
+            /// Creates empty guarded pointer
+            guarded_ptr() CDS_NOEXCEPT
+                : m_bPinned( false )
+            {}
+
+            //@cond
+            /// Initializes guarded pointer with \p p
+            explicit guarded_ptr( guarded_type * p ) CDS_NOEXCEPT
+                : m_bPinned( false )
+            {
+                reset( p );
+            }
+            explicit guarded_ptr( std::nullptr_t ) CDS_NOEXCEPT
+                : m_bPinned( false )
+            {}
+            //@endcond
+
+            /// Move ctor
+            /**
+                An empty source does not pass its pinned epoch to the new object,
+                so an empty guarded pointer does not prevent the global epoch from advancing.
+            */
+            guarded_ptr( guarded_ptr&& gp ) CDS_NOEXCEPT
+                : m_bPinned( false )
+            {
+                move_from( gp );
+            }
+
+            /// The guarded pointer is not copy-constructible
+            guarded_ptr( guarded_ptr const& gp ) = delete;
+
+            /// Clears the guarded pointer
+            /**
+                \ref release is called if guarded pointer is not \ref empty
+            */
+            ~guarded_ptr() CDS_NOEXCEPT
+            {
+                release();
+            }
+
+            /// Move-assignment operator
+            guarded_ptr& operator=( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                if ( this != &gp ) {
+                    release();
+                    move_from( gp );
+                }
+                return *this;
+            }
+
+            /// The guarded pointer is not copy-assignable
+            guarded_ptr& operator=(guarded_ptr const& gp) = delete;
+
+            /// Returns a pointer to guarded value
+            value_type * operator ->() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return value_cast()( reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns a reference to guarded value
+            value_type& operator *() CDS_NOEXCEPT
+            {
+                assert( !empty());
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Returns const reference to guarded value
+            value_type const& operator *() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_guard.get()));
+            }
+
+            /// Checks if the guarded pointer is \p nullptr
+            bool empty() const CDS_NOEXCEPT
+            {
+                return m_guard.get() == nullptr;
+            }
+
+            /// \p bool operator returns <tt>!empty()</tt>
+            explicit operator bool() const CDS_NOEXCEPT
+            {
+                return !empty();
+            }
+
+            /// Clears guarded pointer
+            /**
+                If the guarded pointer has been released, the pointer can be disposed (freed) at any time.
+                Dereferncing the guarded pointer after \p release() is dangerous.
+            */
+            void release() CDS_NOEXCEPT
+            {
+                m_guard.clear();
+                if ( m_bPinned ) {
+                    m_bPinned = false;
+                    thread_gc::leave();
+                }
+            }
+
+            //@cond
+            // For internal use only!!!
+            native_guard& guard() CDS_NOEXCEPT
+            {
+                pin();
+                return m_guard;
+            }
+
+            void reset(guarded_type * p) CDS_NOEXCEPT
+            {
+                pin();
+                m_guard.set(p);
+            }
+            //@endcond
+
+        private:
+            //@cond
+            void pin()
+            {
+                if ( !m_bPinned ) {
+                    thread_gc::enter();
+                    m_bPinned = true;
+                }
+            }
+
+            void move_from( guarded_ptr& gp ) CDS_NOEXCEPT
+            {
+                if ( gp.empty()) {
+                    // The search has failed, nothing to protect
+                    gp.release();
+                }
+                else {
+                    m_guard = gp.m_guard;
+                    m_bPinned = gp.m_bPinned;
+                    gp.m_guard.clear();
+                    gp.m_bPinned = false;
+                }
+            }
+            //@endcond
+        };
+
+    public:
+        /// Initializes %EBR memory manager singleton
+        /**
+            Constructor creates and initializes %EBR global object.
+            %EBR object should be created before using CDS data structure based on \p %cds::gc::EBR GC. Usually,
+            it is created in the \p main() function.
+            After creating of global object you may use CDS data structures based on \p %cds::gc::EBR.
+
+            \par Parameters
+            - \p nScanThreshold - \p scan() threshold. When the count of retired pointers of a thread reaches this value,
+                the \p scan() member function would be called for freeing retired pointers. Default value is 256.
+        */
+        EBR( size_t nScanThreshold = 256 )
+        {
+            ebr::GarbageCollector::Construct( nScanThreshold );
+        }
+
+        /// Destroys %EBR memory manager
+        /**
+            The destructor destroys %EBR global object. After calling of this function you may \b NOT
+            use CDS data structures based on \p %cds::gc::EBR.
+            Usually, %EBR object is destroyed at the end of your \p main().
+        */
+        ~EBR()
+        {
+            ebr::GarbageCollector::Destruct();
+        }
+
+        /// Checks if count of guards is no less than \p nCountNeeded
+        /**
+            The function always returns \p true since the guard count is unlimited for
+            \p %gc::EBR garbage collector.
+        */
+        static CDS_CONSTEXPR bool check_available_guards(
+#ifdef CDS_DOXYGEN_INVOKED
+            size_t nCountNeeded,
+#else
+            size_t,
+#endif
+            bool /*bRaiseException*/ = true )
+        {
+            return true;
+        }
+
+        /// Retire pointer \p p with function \p pFunc
+        /**
+            The function places pointer \p p to thread's array of retired pointers tagged by current global epoch.
+            The pointer will be freed by calling \p pFunc when the global epoch is advanced twice.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in ebr_impl.h
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            The function places pointer \p p to thread's array of retired pointers tagged by current global epoch.
+
+            See \p gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p )
+        {
+            retire( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Checks if Epoch-based GC is constructed and may be used
+        static bool isUsed()
+        {
+            return ebr::GarbageCollector::isUsed();
+        }
+
+        /// Forced GC cycle call for current thread
+        /**
+            Usually, this function should not be called directly.
+        */
+        static void scan()  ;   // inline in ebr_impl.h
+
+        /// Forced disposing of the retired pointers of current thread
+        /**
+            Unlike \ref scan(), the function frees all retired pointers of current thread
+            if no other thread has pinned an epoch.
+        */
+        static void force_dispose();    // inline in ebr_impl.h
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_IMPL_EBR_DECL_H
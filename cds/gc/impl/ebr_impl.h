@@ -0,0 +1,108 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_IMPL_EBR_IMPL_H
+#define CDSLIB_GC_IMPL_EBR_IMPL_H
+
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace gc {
+
+    inline EBR::thread_gc::thread_gc(
+        bool    bPersistent
+        )
+        : m_bPersistent( bPersistent )
+    {
+        if ( !cds::threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread();
+    }
+
+    inline EBR::thread_gc::~thread_gc()
+    {
+        if ( !m_bPersistent )
+            cds::threading::Manager::detachThread();
+    }
+
+    inline /*static*/ void EBR::thread_gc::enter()
+    {
+        cds::threading::getGC<EBR>().enter();
+    }
+
+    inline /*static*/ void EBR::thread_gc::leave()
+    {
+        cds::threading::getGC<EBR>().leave();
+    }
+
+    inline EBR::Guard::Guard()
+        : m_p( nullptr )
+    {
+        thread_gc::enter();
+    }
+
+    inline EBR::Guard::~Guard()
+    {
+        thread_gc::leave();
+    }
+
+    template <size_t Count>
+    inline EBR::GuardArray<Count>::GuardArray()
+    {
+        for ( size_t i = 0; i < Count; ++i )
+            m_arr[i] = nullptr;
+        thread_gc::enter();
+    }
+
+    template <size_t Count>
+    inline EBR::GuardArray<Count>::~GuardArray()
+    {
+        thread_gc::leave();
+    }
+
+    template <typename T>
+    inline void EBR::retire( T * p, void (* pFunc)(T *) )
+    {
+        cds::threading::getGC<EBR>().retirePtr( p, pFunc );
+    }
+
+    inline void EBR::scan()
+    {
+        cds::threading::getGC<EBR>().scan();
+    }
+
+    inline void EBR::force_dispose()
+    {
+        cds::threading::getGC<EBR>().force_dispose();
+    }
+
+}} // namespace cds::gc
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_IMPL_EBR_IMPL_H
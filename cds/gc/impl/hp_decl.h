@@ -599,7 +599,8 @@ namespace cds { namespace gc {
         /// \p scan() type
         enum class scan_type {
             classic = hp::classic,    ///< classic scan as described in Michael's papers
-            inplace = hp::inplace     ///< inplace scan without allocation
+            inplace = hp::inplace,    ///< inplace scan without allocation
+            batched = hp::batched     ///< snapshot of all hazard pointers into hash set, batched search of retired pointers
         };
         /// Initializes %HP singleton
         /**
@@ -611,13 +612,15 @@ namespace cds { namespace gc {
             - \p nHazardPtrCount - hazard pointer count per thread. Usually it is small number (up to 10) depending from
                 the data structure algorithms. By default, if \p nHazardPtrCount = 0, the function
                 uses maximum of the hazard pointer count for CDS library.
-            - \p nMaxThreadCount - max count of thread with using Hazard Pointer GC in your application. Default is 100.
-            - \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
+            - \p nMaxThreadCount - expected count of thread with using Hazard Pointer GC in your application. Default is 100.
+                It is not a limit: HP records are allocated in growable chunks, \p nMaxThreadCount is the capacity of the first chunk.
+            - \p nMaxRetiredPtrCount - initial capacity of array of retired pointers for each thread. Should be greater than
                 <tt> nHazardPtrCount * nMaxThreadCount </tt>. Default is <tt>2 * nHazardPtrCount * nMaxThreadCount </tt>.
+                The array grows if the most of retired pointers are still guarded after scanning.
         */
         HP(
             size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
-            size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
+            size_t nMaxThreadCount = 0,     ///< Expected count of simultaneous working thread in your application
             size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
             scan_type nScanType = scan_type::inplace   ///< Scan type (see \p scan_type enum)
         )
@@ -663,7 +666,7 @@ namespace cds { namespace gc {
             return hp::GarbageCollector::instance().getHazardPointerCount();
         }
 
-        /// Returns max count of thread
+        /// Returns expected count of thread (initial capacity of HP record table)
         static size_t max_thread_count()
         {
             return hp::GarbageCollector::instance().getMaxThreadCount();
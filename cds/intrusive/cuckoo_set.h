@@ -35,13 +35,31 @@
 #include <type_traits>
 #include <mutex>
 #include <functional>   // ref
+#include <cstring>      // memcpy
 #include <cds/intrusive/details/base.h>
 #include <cds/opt/compare.h>
 #include <cds/opt/hash.h>
 #include <cds/sync/lock_array.h>
 #include <cds/os/thread.h>
 #include <cds/sync/spinlock.h>
+#include <cds/details/batch_apply.h>
+#include <cds/algo/bitop.h>
+#include <cds/algo/backoff_strategy.h>
+
+//@cond
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   define CDS_CUCKOO_FINGERPRINT_SSE2
+#   include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#   define CDS_CUCKOO_FINGERPRINT_AVX2
+#   include <immintrin.h>
+#endif
 
+namespace cds { namespace gc {
+    class EBR;
+}} // namespace cds::gc
+//@endcond
 
 namespace cds { namespace intrusive {
 
@@ -56,6 +74,9 @@ namespace cds { namespace intrusive {
             - \p cds::intrusive::cuckoo::vector<Capacity> - the probeset is a vector
                 with constant-size \p Capacity where \p Capacity is an <tt>unsigned int</tt> constant.
                 The node does not contain any auxiliary data.
+            - \p cds::intrusive::cuckoo::fingerprint_vector<Capacity> - the probeset is a vector
+                like \p %vector<Capacity> that also keeps one-byte hash fingerprints of its items
+                in a contiguous array. The node does not contain any auxiliary data.
         */
         template <typename Type>
         struct probeset_type
@@ -95,6 +116,109 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Option enabling optimistic reads
+        /**
+            If \p Enable is \p true, \p CuckooSet::contains() and unsuccessful \p CuckooSet::find()
+            do not acquire any lock. Instead, the set keeps version counters for groups of buckets
+            (seqlock-style): a writer increments the counters of the buckets it modifies before
+            and after the modification, and a reader reads both candidate buckets without locking
+            and retries if any counter has been changed meanwhile. If the read does not succeed
+            after a few attempts the usual locked search is performed.
+
+            Optimistic reads are supported for vector-based probe-sets only
+            (\p cuckoo::vector and \p cuckoo::fingerprint_vector).
+
+            Since the reader does not lock buckets, it can read an item that is being
+            unlinked concurrently, so the unlinked items cannot be disposed immediately.
+            The unlinked items are retired via epoch-based garbage collector
+            specified by \p cuckoo::reclaim_policy option, by default it is <tt>cuckoo::epoch_reclaim< cds::gc::EBR ></tt>.
+            Thus, if optimistic reads are enabled, you should include <tt><cds/gc/ebr.h></tt>, construct \p cds::gc::EBR object
+            and attach each thread using the set to it, see \p cuckoo::epoch_reclaim.
+            \p cuckoo::immediate_reclaim policy cannot be used with optimistic reads, it is checked at compile time.
+
+            Old bucket tables are not freed on resizing, they are kept until the set is destroyed.
+
+            Default is \p false.
+        */
+        template <bool Enable>
+        struct optimistic_read
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                static bool const optimistic_read = Enable;
+            };
+            //@endcond
+        };
+
+        /// Reclamation policy: the unlinked items are disposed immediately
+        /**
+            The policy is the default one if optimistic reads are disabled.
+            It cannot be used with \p cuckoo::optimistic_read since a concurrent optimistic reader
+            can access the disposed item.
+
+            See \p cuckoo::reclaim_policy option.
+        */
+        struct immediate_reclaim
+        {
+            //@cond
+            struct read_guard
+            {};
+
+            template <typename Disposer, typename T>
+            static void dispose( T * p )
+            {
+                Disposer()( p );
+            }
+            //@endcond
+        };
+
+        /// Reclamation policy: the unlinked items are retired via epoch-based garbage collector \p GC
+        /**
+            \p GC is \p cds::gc::EBR. An optimistic reader pins the epoch of \p GC
+            by \p GC::Guard, and \p CuckooSet::clear() retires the items for \p disposer via \p GC::retire(),
+            so the disposer is called when no optimistic reader can access the item.
+            The items returned by \p CuckooSet::erase() or unlinked by \p CuckooSet::unlink()
+            should be freed by the caller via \p GC::retire() too.
+            \p GC must be constructed and each thread using the set
+            must be attached to it, see \ref cds_threading "cds::threading::Manager".
+
+            See \p cuckoo::reclaim_policy option.
+        */
+        template <class GC>
+        struct epoch_reclaim
+        {
+            typedef GC gc;  ///< Garbage collector
+
+            //@cond
+            typedef typename gc::Guard read_guard;
+
+            template <typename Disposer, typename T>
+            static void dispose( T * p )
+            {
+                gc::template retire<Disposer>( p );
+            }
+            //@endcond
+        };
+
+        /// Option specifying the reclamation policy of unlinked items for optimistic reads
+        /**
+            Possible \p Policy types are \p cuckoo::immediate_reclaim and \p cuckoo::epoch_reclaim,
+            see \p cuckoo::optimistic_read option.
+            If the option is not specified (\p opt::none) the policy is selected by \p cuckoo::optimistic_read option:
+            \p cuckoo::immediate_reclaim if optimistic reads are disabled,
+            <tt>cuckoo::epoch_reclaim< cds::gc::EBR ></tt> otherwise.
+        */
+        template <typename Policy>
+        struct reclaim_policy
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                typedef Policy reclaim_policy;
+            };
+            //@endcond
+        };
 
         //@cond
         // Probeset type placeholders
@@ -115,11 +239,36 @@ namespace cds { namespace intrusive {
             static unsigned int const c_nCapacity = Capacity;
         };
 
+        /// Vector probeset type with hash fingerprints
+        /**
+            The probeset is a vector of constant size \p Capacity like \p cuckoo::vector.
+            In addition, the bucket keeps one-byte fingerprints of item hashes in a contiguous array
+            parallel to the node array. The unordered search compares the fingerprint of the key
+            with the fingerprints of all probeset items at once (by one SSE2 or AVX2 instruction
+            if the target supports it) and dereferences only the nodes whose fingerprints match.
+            So, unsuccessful search usually does not touch any node at all.
+
+            The fingerprint array is padded up to a multiple of 16 bytes, that is a bucket
+            costs 16 or 32 bytes more than the bucket of \p cuckoo::vector.
+            \p Capacity should not be greater than 32.
+
+            The ordered search (\p CuckooSet with \p compare or \p less option)
+            cannot skip nodes and works like \p cuckoo::vector search.
+        */
+        template <unsigned int Capacity>
+        struct fingerprint_vector
+        {
+            static_assert( Capacity > 0 && Capacity <= 32, "Capacity must be in range [1, 32]" );
+
+            /// Vector capacity
+            static unsigned int const c_nCapacity = Capacity;
+        };
+
         /// CuckooSet node
         /**
             Template arguments:
-            - \p ProbesetType - type of probeset. Can be \p cds::intrusive::cuckoo::list
-                or \p cds::intrusive::cuckoo::vector<Capacity>.
+            - \p ProbesetType - type of probeset. Can be \p cds::intrusive::cuckoo::list,
+                \p cds::intrusive::cuckoo::vector<Capacity> or \p cds::intrusive::cuckoo::fingerprint_vector<Capacity>.
             - \p StoreHashCount - constant that defines whether to store node hash values.
                 See cuckoo::store_hash option for explanation
             - \p Tag - a \ref cds_intrusive_hook_tag "tag"
@@ -256,6 +405,13 @@ namespace cds { namespace intrusive {
             void clear()
             {}
         };
+
+        template <unsigned int VectorSize, unsigned int StoreHashCount, typename Tag>
+        struct node< cuckoo::fingerprint_vector<VectorSize>, StoreHashCount, Tag>: public node< cuckoo::vector<VectorSize>, StoreHashCount, Tag >
+        {
+            // Fingerprints are stored in the bucket, the node is the same as the vector node
+            typedef cuckoo::fingerprint_vector<VectorSize>  probeset_type;
+        };
         //@endcond
 
 
@@ -1021,6 +1177,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nFindWithSuccess         ;   ///< Count of success \p find_with function call
             counter_type    m_nFindWithFailed          ;   ///< Count of failed \p find_with function call
 
+            counter_type    m_nOptimisticReadRetry     ;   ///< Count of optimistic read retries due to concurrent modification
+            counter_type    m_nOptimisticReadFallback  ;   ///< Count of optimistic reads that have fallen back to the locked search
+
             //@cond
             void    onRelocateCall()        { ++m_nRelocateCallCount; }
             void    onRelocateRound()       { ++m_nRelocateRoundCount; }
@@ -1057,6 +1216,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     { ++m_nFindWithSuccess; }
             void    onFindWithFailed()      { ++m_nFindWithFailed; }
+
+            void    onOptimisticReadRetry()    { ++m_nOptimisticReadRetry; }
+            void    onOptimisticReadFallback() { ++m_nOptimisticReadFallback; }
             //@endcond
         };
 
@@ -1098,6 +1260,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     const {}
             void    onFindWithFailed()      const {}
+
+            void    onOptimisticReadRetry()    const {}
+            void    onOptimisticReadFallback() const {}
             //@endcond
         };
 
@@ -1181,6 +1346,12 @@ namespace cds { namespace intrusive {
 
             /// Internal statistics. Available statistics: \p cuckoo::stat, \p cuckoo::empty_stat
             typedef empty_stat                  stat;
+
+            /// Lock-free optimistic reads, see \p cuckoo::optimistic_read option
+            static const bool optimistic_read = false;
+
+            /// Reclamation policy of unlinked items, see \p cuckoo::reclaim_policy option
+            typedef opt::none   reclaim_policy;
         };
 
         /// Metafunction converting option list to \p CuckooSet traits
@@ -1213,6 +1384,10 @@ namespace cds { namespace intrusive {
                 freeing nodes. Default is \p intrusive::opt::v::empty_disposer
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::optimistic_read - enables lock-free optimistic reads. Default is \p false
+            - \p cuckoo::reclaim_policy - reclamation policy of unlinked items.
+                Default is \p cuckoo::immediate_reclaim, or <tt>cuckoo::epoch_reclaim< cds::gc::EBR ></tt>
+                if \p cuckoo::optimistic_read is enabled
 
             The probe set traits \p cuckoo::probeset_type and \p cuckoo::store_hash are taken from \p node type
             specified by \p opt::hook option.
@@ -1316,7 +1491,7 @@ namespace cds { namespace intrusive {
                     return iterator();
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
                 {
                     node_type * pPrev = it.pNode;
                     if ( pPrev ) {
@@ -1379,6 +1554,10 @@ namespace cds { namespace intrusive {
                 }
             };
 
+            // The fields of vector-based probe-sets are atomic since an optimistic reader reads them
+            // without locking while the writer holding the bucket lock changes them.
+            // The writer stores the node pointer with release semantics, so the optimistic reader
+            // that loads the pointer with acquire semantics sees the initialized node.
             template <typename Node, unsigned int Capacity>
             class bucket_entry<Node, cuckoo::vector<Capacity>>
             {
@@ -1390,33 +1569,39 @@ namespace cds { namespace intrusive {
                 static unsigned int const c_nCapacity = probeset_type::c_nCapacity;
 
             protected:
-                node_type *     m_arrNode[c_nCapacity];
-                unsigned int    m_nSize;
+                typedef atomics::atomic<node_type *>    node_ptr;
+
+                node_ptr                        m_arrNode[c_nCapacity];
+                atomics::atomic<unsigned int>   m_nSize;
 
                 void shift_up( unsigned int nFrom )
                 {
-                    assert( m_nSize < c_nCapacity );
+                    unsigned int const nSize = size();
+                    assert( nSize < c_nCapacity );
 
-                    if ( nFrom < m_nSize )
-                        std::copy_backward( m_arrNode + nFrom, m_arrNode + m_nSize, m_arrNode + m_nSize + 1 );
+                    for ( unsigned int i = nSize; i > nFrom; --i )
+                        m_arrNode[i].store( m_arrNode[i - 1].load( atomics::memory_order_relaxed ), atomics::memory_order_release );
                 }
 
-                void shift_down( node_type ** pFrom )
+                void shift_down( node_ptr * pFrom )
                 {
-                    assert( m_arrNode <= pFrom && pFrom < m_arrNode + m_nSize);
-                    std::copy( pFrom + 1, m_arrNode + m_nSize, pFrom );
+                    unsigned int const nSize = size();
+                    assert( m_arrNode <= pFrom && pFrom < m_arrNode + nSize );
+
+                    for ( node_ptr * p = pFrom + 1; p < m_arrNode + nSize; ++p )
+                        p[-1].store( p->load( atomics::memory_order_relaxed ), atomics::memory_order_release );
                 }
             public:
                 class iterator
                 {
-                    node_type **    pArr;
+                    node_ptr *  pArr;
                     friend class bucket_entry;
 
                 public:
                     iterator()
                         : pArr( nullptr )
                     {}
-                    iterator( node_type ** p )
+                    iterator( node_ptr * p )
                         : pArr(p)
                     {}
                     iterator( iterator const& it)
@@ -1432,13 +1617,13 @@ namespace cds { namespace intrusive {
                     node_type * operator->()
                     {
                         assert( pArr != nullptr );
-                        return *pArr;
+                        return pArr->load( atomics::memory_order_relaxed );
                     }
                     node_type& operator*()
                     {
                         assert( pArr != nullptr );
-                        assert( *pArr != nullptr );
-                        return *(*pArr);
+                        assert( pArr->load( atomics::memory_order_relaxed ) != nullptr );
+                        return *pArr->load( atomics::memory_order_relaxed );
                     }
 
                     // preinc
@@ -1462,7 +1647,8 @@ namespace cds { namespace intrusive {
                 bucket_entry()
                     : m_nSize(0)
                 {
-                    memset( m_arrNode, 0, sizeof(m_arrNode));
+                    for ( unsigned int i = 0; i < c_nCapacity; ++i )
+                        m_arrNode[i].store( nullptr, atomics::memory_order_relaxed );
                     static_assert(( std::is_same<typename node_type::probeset_type, probeset_type>::value ), "Incompatible node type" );
                 }
 
@@ -1475,46 +1661,284 @@ namespace cds { namespace intrusive {
                     return iterator(m_arrNode + size());
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
+                {
+                    assert( size() < c_nCapacity );
+                    assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + size()));
+
+                    unsigned int const nPos = it.pArr ? static_cast<unsigned int>(it.pArr - m_arrNode) + 1 : 0;
+                    shift_up( nPos );
+                    m_arrNode[nPos].store( p, atomics::memory_order_release );
+                    m_nSize.store( size() + 1, atomics::memory_order_relaxed );
+                }
+
+                void remove( iterator /*itPrev*/, iterator itWhat )
                 {
-                    assert( m_nSize < c_nCapacity );
-                    assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + m_nSize));
+                    itWhat->clear();
+                    shift_down( itWhat.pArr );
+                    m_nSize.store( size() - 1, atomics::memory_order_relaxed );
+                }
 
-                    if ( it.pArr ) {
-                        shift_up( static_cast<unsigned int>(it.pArr - m_arrNode) + 1 );
-                        it.pArr[1] = p;
+                void clear()
+                {
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
+                }
+
+                template <typename Disposer>
+                void clear( Disposer disp )
+                {
+                    for ( unsigned int i = 0, nSize = size(); i < nSize; ++i ) {
+                        disp( m_arrNode[i].load( atomics::memory_order_relaxed ));
                     }
-                    else {
-                        shift_up(0);
-                        m_arrNode[0] = p;
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
+                }
+
+                unsigned int size() const
+                {
+                    return m_nSize.load( atomics::memory_order_relaxed );
+                }
+
+                // Optimistic reader side: copies the item pointers into arrNode
+                // and returns the count of the items copied. The bucket is not locked,
+                // so the result is valid only if the bucket has not been changed meanwhile
+                unsigned int snapshot( node_type ** arrNode, size_t /*nHash*/ ) const
+                {
+                    unsigned int const nSize = size();
+                    unsigned int nCount = 0;
+                    for ( unsigned int i = 0; i < nSize; ++i ) {
+                        node_type * p = m_arrNode[i].load( atomics::memory_order_acquire );
+                        if ( p )
+                            arrNode[nCount++] = p;
                     }
-                    ++m_nSize;
+                    return nCount;
+                }
+            };
+
+            template <typename Node, unsigned int Capacity>
+            class bucket_entry<Node, cuckoo::fingerprint_vector<Capacity>>
+            {
+            public:
+                typedef Node                                node_type;
+                typedef cuckoo::vector_probeset_class       probeset_class;
+                typedef cuckoo::fingerprint_vector<Capacity> probeset_type;
+                typedef uint8_t                             fingerprint_type;
+
+                static unsigned int const c_nCapacity = probeset_type::c_nCapacity;
+
+            protected:
+                typedef atomics::atomic<node_type *>        node_ptr;
+                typedef atomics::atomic<fingerprint_type>   atomic_fingerprint;
+
+                // The fingerprint array is padded to whole number of SSE2 vectors
+                static unsigned int const c_nFingerprintSize = ( c_nCapacity + 15 ) & ~15u;
+
+                // match() reads the fingerprints under the bucket lock by vector loads
+                static_assert( sizeof( atomic_fingerprint ) == sizeof( fingerprint_type ), "atomic fingerprint must have the size of fingerprint" );
+
+                atomic_fingerprint              m_arrFingerprint[c_nFingerprintSize];
+                node_ptr                        m_arrNode[c_nCapacity];
+                atomics::atomic<unsigned int>   m_nSize;
+
+                void shift_up( unsigned int nFrom )
+                {
+                    unsigned int const nSize = size();
+                    assert( nSize < c_nCapacity );
+
+                    for ( unsigned int i = nSize; i > nFrom; --i ) {
+                        m_arrNode[i].store( m_arrNode[i - 1].load( atomics::memory_order_relaxed ), atomics::memory_order_release );
+                        m_arrFingerprint[i].store( m_arrFingerprint[i - 1].load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                    }
+                }
+
+                void shift_down( node_ptr * pFrom )
+                {
+                    unsigned int const nSize = size();
+                    assert( m_arrNode <= pFrom && pFrom < m_arrNode + nSize );
+
+                    for ( unsigned int i = static_cast<unsigned int>( pFrom - m_arrNode ) + 1; i < nSize; ++i ) {
+                        m_arrNode[i - 1].store( m_arrNode[i].load( atomics::memory_order_relaxed ), atomics::memory_order_release );
+                        m_arrFingerprint[i - 1].store( m_arrFingerprint[i].load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                    }
+                }
+
+            public:
+                class iterator
+                {
+                    node_ptr *  pArr;
+                    friend class bucket_entry;
+
+                public:
+                    iterator()
+                        : pArr( nullptr )
+                    {}
+                    iterator( node_ptr * p )
+                        : pArr(p)
+                    {}
+                    iterator( iterator const& it)
+                        : pArr( it.pArr )
+                    {}
+
+                    iterator& operator=( iterator const& it )
+                    {
+                        pArr = it.pArr;
+                        return *this;
+                    }
+
+                    node_type * operator->()
+                    {
+                        assert( pArr != nullptr );
+                        return pArr->load( atomics::memory_order_relaxed );
+                    }
+                    node_type& operator*()
+                    {
+                        assert( pArr != nullptr );
+                        assert( pArr->load( atomics::memory_order_relaxed ) != nullptr );
+                        return *pArr->load( atomics::memory_order_relaxed );
+                    }
+
+                    // preinc
+                    iterator& operator ++()
+                    {
+                        ++pArr;
+                        return *this;
+                    }
+
+                    bool operator==(iterator const& it ) const
+                    {
+                        return pArr == it.pArr;
+                    }
+                    bool operator!=(iterator const& it ) const
+                    {
+                        return !( *this == it );
+                    }
+                };
+
+            public:
+                bucket_entry()
+                    : m_nSize(0)
+                {
+                    for ( unsigned int i = 0; i < c_nFingerprintSize; ++i )
+                        m_arrFingerprint[i].store( 0, atomics::memory_order_relaxed );
+                    for ( unsigned int i = 0; i < c_nCapacity; ++i )
+                        m_arrNode[i].store( nullptr, atomics::memory_order_relaxed );
+                    static_assert(( std::is_same<typename node_type::probeset_type, probeset_type>::value ), "Incompatible node type" );
+                }
+
+                iterator begin()
+                {
+                    return iterator(m_arrNode);
+                }
+                iterator end()
+                {
+                    return iterator(m_arrNode + size());
+                }
+
+                // Returns iterator to the item nIndex
+                iterator item( unsigned int nIndex )
+                {
+                    assert( nIndex < c_nCapacity );
+                    return iterator( m_arrNode + nIndex );
+                }
+
+                void insert_after( iterator it, node_type * p, size_t nHash )
+                {
+                    assert( size() < c_nCapacity );
+                    assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + size()));
+
+                    unsigned int const nPos = it.pArr ? static_cast<unsigned int>(it.pArr - m_arrNode) + 1 : 0;
+                    shift_up( nPos );
+                    m_arrNode[nPos].store( p, atomics::memory_order_release );
+                    m_arrFingerprint[nPos].store( fingerprint( nHash ), atomics::memory_order_relaxed );
+                    m_nSize.store( size() + 1, atomics::memory_order_relaxed );
                 }
 
                 void remove( iterator /*itPrev*/, iterator itWhat )
                 {
                     itWhat->clear();
                     shift_down( itWhat.pArr );
-                    --m_nSize;
+                    m_nSize.store( size() - 1, atomics::memory_order_relaxed );
                 }
 
                 void clear()
                 {
-                    m_nSize = 0;
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
                 }
 
                 template <typename Disposer>
                 void clear( Disposer disp )
                 {
-                    for ( unsigned int i = 0; i < m_nSize; ++i ) {
-                        disp( m_arrNode[i] );
+                    for ( unsigned int i = 0, nSize = size(); i < nSize; ++i ) {
+                        disp( m_arrNode[i].load( atomics::memory_order_relaxed ));
                     }
-                    m_nSize = 0;
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
                 }
 
                 unsigned int size() const
                 {
-                    return m_nSize;
+                    return m_nSize.load( atomics::memory_order_relaxed );
+                }
+
+                // Returns bit mask of the items whose fingerprint is equal to the fingerprint of nHash:
+                // bit i of the result is set if the fingerprint of item i matches.
+                // The bucket must be locked
+                uint32_t match( size_t nHash ) const
+                {
+                    fingerprint_type const fp = fingerprint( nHash );
+                    unsigned int const nSize = size();
+                    uint32_t const nSizeMask = nSize < 32 ? ( uint32_t(1) << nSize ) - 1 : ~uint32_t(0);
+                    uint32_t nMask = 0;
+
+#if defined(CDS_CUCKOO_FINGERPRINT_AVX2)
+                    if ( c_nFingerprintSize == 32 ) {
+                        __m256i const eq = _mm256_cmpeq_epi8(
+                            _mm256_loadu_si256( reinterpret_cast<__m256i const *>( m_arrFingerprint )),
+                            _mm256_set1_epi8( static_cast<char>( fp )));
+                        return static_cast<uint32_t>( _mm256_movemask_epi8( eq )) & nSizeMask;
+                    }
+#endif
+#if defined(CDS_CUCKOO_FINGERPRINT_SSE2)
+                    __m128i const key = _mm_set1_epi8( static_cast<char>( fp ));
+                    for ( unsigned int i = 0; i < c_nFingerprintSize; i += 16 ) {
+                        __m128i const eq = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const *>( m_arrFingerprint + i )), key );
+                        nMask |= static_cast<uint32_t>( _mm_movemask_epi8( eq )) << i;
+                    }
+#else
+                    for ( unsigned int i = 0; i < nSize; ++i ) {
+                        if ( m_arrFingerprint[i].load( atomics::memory_order_relaxed ) == fp )
+                            nMask |= uint32_t(1) << i;
+                    }
+#endif
+                    return nMask & nSizeMask;
+                }
+
+                // Optimistic reader side: copies the pointers of the items with matching fingerprint into arrNode
+                // and returns the count of the items copied. The bucket is not locked, so the fingerprints
+                // are read one by one by atomic loads, and the result is valid only if the bucket
+                // has not been changed meanwhile
+                unsigned int snapshot( node_type ** arrNode, size_t nHash ) const
+                {
+                    fingerprint_type const fp = fingerprint( nHash );
+                    unsigned int const nSize = size();
+                    unsigned int nCount = 0;
+                    for ( unsigned int i = 0; i < nSize; ++i ) {
+                        if ( m_arrFingerprint[i].load( atomics::memory_order_relaxed ) == fp ) {
+                            node_type * p = m_arrNode[i].load( atomics::memory_order_acquire );
+                            if ( p )
+                                arrNode[nCount++] = p;
+                        }
+                    }
+                    return nCount;
+                }
+
+                // The bucket index is built from the low bits of the hash, so all items of the bucket share them.
+                // The fingerprint is the top byte of the Fibonacci product that depends on all bits of the hash
+                static fingerprint_type fingerprint( size_t nHash )
+                {
+#if CDS_BUILD_BITS == 64
+                    return static_cast<fingerprint_type>(( static_cast<uint64_t>( nHash ) * UINT64_C( 0x9E3779B97F4A7C15 )) >> 56 );
+#else
+                    return static_cast<fingerprint_type>(( static_cast<uint32_t>( nHash ) * UINT32_C( 0x9E3779B9 )) >> 24 );
+#endif
                 }
             };
 
@@ -1569,6 +1993,13 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                // Checks if the item found by an optimistic reader is equal to val
+                template <typename Node, typename Q, typename Compare>
+                static bool equal( Node& node, unsigned int /*nTable*/, size_t /*nHash*/, Q const& val, Compare cmp )
+                {
+                    return cmp( *NodeTraits::to_value_ptr( node ), val ) == 0;
+                }
             };
 
             template <typename NodeTraits>
@@ -1596,6 +2027,139 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                template <typename Node, unsigned int Capacity, typename Position, typename Q, typename EqualTo>
+                static bool find( bucket_entry<Node, cuckoo::fingerprint_vector<Capacity>>& probeset, Position& pos, unsigned int nTable, size_t nHash, Q const& val, EqualTo eq )
+                {
+                    // Unordered version, only the items with matching fingerprint are checked
+                    typedef bucket_entry<Node, cuckoo::fingerprint_vector<Capacity>> bucket_type;
+                    typedef typename bucket_type::iterator  bucket_iterator;
+
+                    for ( uint32_t nMask = probeset.match( nHash ); nMask; nMask &= nMask - 1 ) {
+                        unsigned int const nIdx = static_cast<unsigned int>( cds::bitop::LSBnz( nMask ));
+                        bucket_iterator it = probeset.item( nIdx );
+                        if ( hash_ops<Node, Node::hash_array_size>::equal_to( *it, nTable, nHash ) && eq( *NodeTraits::to_value_ptr(*it), val )) {
+                            pos.itFound = it;
+                            pos.itPrev = nIdx ? probeset.item( nIdx - 1 ) : bucket_iterator();
+                            return true;
+                        }
+                    }
+
+                    pos.itPrev = probeset.size() ? probeset.item( probeset.size() - 1 ) : bucket_iterator();
+                    pos.itFound = probeset.end();
+                    return false;
+                }
+
+                // Checks if the item found by an optimistic reader is equal to val
+                template <typename Node, typename Q, typename EqualTo>
+                static bool equal( Node& node, unsigned int nTable, size_t nHash, Q const& val, EqualTo eq )
+                {
+                    return hash_ops<Node, Node::hash_array_size>::equal_to( node, nTable, nHash ) && eq( *NodeTraits::to_value_ptr( node ), val );
+                }
+            };
+
+            // Version counters for optimistic reads
+            template <unsigned int Arity, bool Enable>
+            class bucket_versions
+            {
+            public:
+                static bool const c_bEnabled = false;
+
+                class update_guard
+                {
+                public:
+                    update_guard( bucket_versions&, unsigned int /*nTable*/, size_t /*nBucket*/ )
+                    {}
+                };
+
+                class table_update_guard
+                {
+                public:
+                    table_update_guard( bucket_versions& )
+                    {}
+                };
+            };
+
+            template <unsigned int Arity>
+            class bucket_versions<Arity, true>
+            {
+            public:
+                static bool const c_bEnabled = true;
+
+                // Version counter count per hash table; the bucket i is covered by counter i % c_nSize
+                static size_t const c_nSize = 1024;
+
+                typedef atomics::atomic<size_t> version_type;
+
+            protected:
+                version_type    m_nTableVersion;    // changed by resizing and clearing
+                version_type    m_arrVersion[Arity][c_nSize];
+
+            public:
+                bucket_versions()
+                    : m_nTableVersion( 0 )
+                {
+                    for ( unsigned int i = 0; i < Arity; ++i ) {
+                        for ( size_t k = 0; k < c_nSize; ++k )
+                            m_arrVersion[i][k].store( 0, atomics::memory_order_relaxed );
+                    }
+                }
+
+                // Writer side. A counter is incremented before and after the modification,
+                // the counter may be shared by several buckets locked by different writers
+                // so the reader checks that the counter is even and unchanged.
+                class update_guard
+                {
+                    version_type& m_ver;
+                public:
+                    update_guard( bucket_versions& v, unsigned int nTable, size_t nBucket )
+                        : m_ver( v.m_arrVersion[nTable][nBucket & ( c_nSize - 1 )] )
+                    {
+                        m_ver.fetch_add( 1, atomics::memory_order_relaxed );
+                        atomics::atomic_thread_fence( atomics::memory_order_release );
+                    }
+                    ~update_guard()
+                    {
+                        m_ver.fetch_add( 1, atomics::memory_order_release );
+                    }
+                };
+
+                class table_update_guard
+                {
+                    version_type& m_ver;
+                public:
+                    table_update_guard( bucket_versions& v )
+                        : m_ver( v.m_nTableVersion )
+                    {
+                        m_ver.fetch_add( 1, atomics::memory_order_relaxed );
+                        atomics::atomic_thread_fence( atomics::memory_order_release );
+                    }
+                    ~table_update_guard()
+                    {
+                        m_ver.fetch_add( 1, atomics::memory_order_release );
+                    }
+                };
+
+                // Reader side
+                size_t table_version() const
+                {
+                    return m_nTableVersion.load( atomics::memory_order_acquire );
+                }
+
+                size_t version( unsigned int nTable, size_t nBucket ) const
+                {
+                    return m_arrVersion[nTable][nBucket & ( c_nSize - 1 )].load( atomics::memory_order_acquire );
+                }
+
+                bool validate( size_t nTableVersion, size_t const * arrVersion, size_t const * arrBucket ) const
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                    for ( unsigned int i = 0; i < Arity; ++i ) {
+                        if ( m_arrVersion[i][arrBucket[i] & ( c_nSize - 1 )].load( atomics::memory_order_relaxed ) != arrVersion[i] )
+                            return false;
+                    }
+                    return m_nTableVersion.load( atomics::memory_order_relaxed ) == nTableVersion;
+                }
             };
 
         }   // namespace details
@@ -1897,6 +2461,18 @@ namespace cds { namespace intrusive {
         /// node disposer
         typedef typename traits::disposer      disposer;
 
+        /// Reclamation policy of unlinked items, see \p cuckoo::reclaim_policy
+        typedef typename std::conditional<
+            std::is_same< typename traits::reclaim_policy, opt::none >::value,
+            typename std::conditional< traits::optimistic_read, cuckoo::epoch_reclaim< cds::gc::EBR >, cuckoo::immediate_reclaim >::type,
+            typename traits::reclaim_policy
+        >::type reclaim_policy;
+
+        //@cond
+        static_assert( !traits::optimistic_read || !std::is_same< reclaim_policy, cuckoo::immediate_reclaim >::value,
+            "cuckoo::optimistic_read requires deferred reclamation, cuckoo::immediate_reclaim cannot be used" );
+        //@endcond
+
     protected:
         //@cond
         typedef typename node_type::probeset_class  probeset_class;
@@ -1921,6 +2497,18 @@ namespace cds { namespace intrusive {
 
         typedef cuckoo::details::contains< node_traits, c_isSorted > contains_action;
 
+        typedef cuckoo::details::bucket_versions< c_nArity, traits::optimistic_read > bucket_versions;
+        typedef typename bucket_versions::update_guard          version_guard;
+        typedef typename bucket_versions::table_update_guard    table_version_guard;
+
+        // Bucket tables replaced by resizing; with optimistic reads they are freed only in destructor
+        struct retired_tables {
+            bucket_entry *      arrTable[c_nArity];
+            size_t              nCapacity;
+            retired_tables *    pNext;
+        };
+        typedef cds::details::Allocator< retired_tables, allocator > retired_tables_allocator;
+
         template <typename Predicate>
         struct predicate_wrapper {
             typedef typename std::conditional< c_isSorted, cds::opt::details::make_comparator_from_less<Predicate>, Predicate>::type   type;
@@ -1933,11 +2521,12 @@ namespace cds { namespace intrusive {
         static unsigned int const   c_nDefaultProbesetSize = 4;   ///< default probeset size
         static size_t const         c_nDefaultInitialSize = 16;   ///< default initial size
         static unsigned int const   c_nRelocateLimit = c_nArity * 2 - 1; ///< Count of attempts to relocate before giving up
+        static unsigned int const   c_nOptimisticReadAttempts = 8; ///< Count of optimistic read attempts before falling back to the locked search
 
     protected:
-        bucket_entry *      m_BucketTable[ c_nArity ] ; ///< Bucket tables
+        atomics::atomic<bucket_entry *> m_BucketTable[ c_nArity ] ; ///< Bucket tables
 
-        size_t              m_nBucketMask           ;   ///< Hash bitmask; bucket table size minus 1.
+        atomics::atomic<size_t> m_nBucketMask       ;   ///< Hash bitmask; bucket table size minus 1.
         unsigned int const  m_nProbesetSize         ;   ///< Probe set size
         unsigned int const  m_nProbesetThreshold    ;   ///< Probe set threshold
 
@@ -1945,12 +2534,16 @@ namespace cds { namespace intrusive {
         mutex_policy    m_MutexPolicy       ;   ///< concurrent access policy
         item_counter    m_ItemCounter       ;   ///< item counter
         mutable stat    m_Stat              ;   ///< internal statistics
+        bucket_versions m_Versions          ;   ///< bucket version counters for optimistic reads
+        retired_tables * m_pRetiredTables   ;   ///< bucket tables replaced by resizing (optimistic reads only)
 
     protected:
         //@cond
         static void check_common_constraints()
         {
             static_assert( (c_nArity == mutex_policy::c_nArity), "The count of hash functors must be equal to mutex_policy arity" );
+            static_assert( !bucket_versions::c_bEnabled || std::is_same< probeset_class, cuckoo::vector_probeset_class >::value,
+                "Optimistic reads are supported for vector-based probe-sets only" );
         }
 
         void check_probeset_properties() const
@@ -1978,7 +2571,50 @@ namespace cds { namespace intrusive {
         bucket_entry& bucket( unsigned int nTable, size_t nHash )
         {
             assert( nTable < c_nArity );
-            return m_BucketTable[nTable][nHash & m_nBucketMask];
+            return m_BucketTable[nTable].load( atomics::memory_order_relaxed )[nHash & m_nBucketMask.load( atomics::memory_order_relaxed )];
+        }
+
+        // Bucket modification; the bucket must be locked
+        void bucket_insert( bucket_entry& bkt, unsigned int nTable, size_t nHash, bucket_iterator itPrev, node_type * pNode )
+        {
+            version_guard vg( m_Versions, nTable, nHash & m_nBucketMask.load( atomics::memory_order_relaxed ));
+            bkt.insert_after( itPrev, pNode, nHash );
+        }
+
+        void bucket_remove( unsigned int nTable, size_t nHash, bucket_iterator itPrev, bucket_iterator itWhat )
+        {
+            version_guard vg( m_Versions, nTable, nHash & m_nBucketMask.load( atomics::memory_order_relaxed ));
+            bucket( nTable, nHash ).remove( itPrev, itWhat );
+        }
+
+        // Count of keys processed together by batch operations
+        static CDS_CONSTEXPR size_t const c_nBatchSize = cds::details::c_nBatchSize;
+
+        // Hash values of a key computed by batch_apply()
+        struct batch_hash {
+            hash_array arr;
+        };
+
+        // Calls op( key ) for each of nCount keys.
+        // The keys are processed in groups of c_nBatchSize keys: for each group the hash values are computed
+        // and the cells of all bucket tables are prefetched, then op is called for each key of the group.
+        // The bucket tables are read without locking: the prefetch is a hint only,
+        // if the set is resized concurrently the prefetch is useless but harmless.
+        template <typename Q, typename Func>
+        size_t batch_apply( Q const* pKeys, size_t nCount, bool * pResult, Func op )
+        {
+            return cds::details::batch_apply<c_nBatchSize>( pKeys, nCount, pResult,
+                [this]( Q const& key ) -> batch_hash {
+                    batch_hash h;
+                    hashing( h.arr, key );
+                    return h;
+                },
+                [this]( batch_hash const& h ) {
+                    for ( unsigned int nTable = 0; nTable < c_nArity; ++nTable )
+                        CDS_PREFETCH( &bucket( nTable, h.arr[nTable] ));
+                },
+                cds::details::empty_batch_prefetch(),
+                [&op]( batch_hash const&, Q const& key ) -> bool { return op( key ); });
         }
 
         static void store_hash( node_type * pNode, size_t * pHashes )
@@ -1995,10 +2631,18 @@ namespace cds { namespace intrusive {
         {
             assert( cds::beans::is_power2( nSize ) );
 
-            m_nBucketMask = nSize - 1;
             bucket_table_allocator alloc;
             for ( unsigned int i = 0; i < c_nArity; ++i )
-                m_BucketTable[i] = alloc.NewArray( nSize );
+                m_BucketTable[i].store( alloc.NewArray( nSize ), atomics::memory_order_release );
+
+            // An optimistic reader that sees the new mask must see the new tables
+            m_nBucketMask.store( nSize - 1, atomics::memory_order_release );
+        }
+
+        void get_bucket_tables( bucket_entry ** pTable ) const
+        {
+            for ( unsigned int i = 0; i < c_nArity; ++i )
+                pTable[i] = m_BucketTable[i].load( atomics::memory_order_relaxed );
         }
 
         static void free_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
@@ -2011,7 +2655,31 @@ namespace cds { namespace intrusive {
         }
         void free_bucket_tables()
         {
-            free_bucket_tables( m_BucketTable, m_nBucketMask + 1 );
+            bucket_entry * pTable[ c_nArity ];
+            get_bucket_tables( pTable );
+            free_bucket_tables( pTable, bucket_count() );
+
+            retired_tables_allocator alloc;
+            while ( m_pRetiredTables ) {
+                retired_tables * p = m_pRetiredTables;
+                m_pRetiredTables = p->pNext;
+                free_bucket_tables( p->arrTable, p->nCapacity );
+                alloc.Delete( p );
+            }
+        }
+
+        void retire_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
+        {
+            if ( bucket_versions::c_bEnabled ) {
+                // Optimistic readers can still read the old tables
+                retired_tables * p = retired_tables_allocator().New();
+                memcpy( p->arrTable, pTable, sizeof( p->arrTable ));
+                p->nCapacity = nCapacity;
+                p->pNext = m_pRetiredTables;
+                m_pRetiredTables = p;
+            }
+            else
+                free_bucket_tables( pTable, nCapacity );
         }
 
         static CDS_CONSTEXPR unsigned int const c_nUndefTable = (unsigned int) -1;
@@ -2042,7 +2710,7 @@ namespace cds { namespace intrusive {
                 if ( nTable != c_nUndefTable ) {
                     node_type& node = *arrPos[nTable].itFound;
                     f( *node_traits::to_value_ptr(node) );
-                    bucket( nTable, arrHash[nTable]).remove( arrPos[nTable].itPrev, arrPos[nTable].itFound );
+                    bucket_remove( nTable, arrHash[nTable], arrPos[nTable].itPrev, arrPos[nTable].itFound );
                     --m_ItemCounter;
                     m_Stat.onEraseSuccess();
                     return node_traits::to_value_ptr( node );
@@ -2057,8 +2725,39 @@ namespace cds { namespace intrusive {
         bool find_( Q& val, Predicate pred, Func f )
         {
             hash_array arrHash;
-            position arrPos[ c_nArity ];
             hashing( arrHash, val );
+
+            // The functor must be called under lock, so only the absence of the key
+            // can be proved by the optimistic read
+            bool bFound;
+            if ( find_optimistic( arrHash, val, pred, bFound, std::integral_constant<bool, bucket_versions::c_bEnabled>()) && !bFound ) {
+                m_Stat.onFindFailed();
+                return false;
+            }
+            return find_locked( arrHash, val, pred, f );
+        }
+
+        template <typename Q, typename Predicate>
+        bool contains_( Q const& val, Predicate pred )
+        {
+            hash_array arrHash;
+            hashing( arrHash, val );
+
+            bool bFound;
+            if ( find_optimistic( arrHash, val, pred, bFound, std::integral_constant<bool, bucket_versions::c_bEnabled>())) {
+                if ( bFound )
+                    m_Stat.onFindSuccess();
+                else
+                    m_Stat.onFindFailed();
+                return bFound;
+            }
+            return find_locked( arrHash, val, pred, []( value_type&, Q const& ) {} );
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_locked( size_t * arrHash, Q& val, Predicate pred, Func f )
+        {
+            position arrPos[ c_nArity ];
             scoped_cell_lock sl( m_MutexPolicy, arrHash );
 
             unsigned int nTable = contains( arrPos, arrHash, val, pred );
@@ -2072,6 +2771,87 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        // Searches val without locking.
+        // Returns true if the search result bFound is consistent,
+        // false if the buckets have been changing during all attempts
+        template <typename Q, typename Predicate>
+        bool find_optimistic( size_t const * arrHash, Q const& val, Predicate pred, bool& bFound, std::true_type )
+        {
+            size_t arrBucket[ c_nArity ];
+            size_t arrVersion[ c_nArity ];
+
+            // The items unlinked concurrently must stay readable while the guard is alive, see reclaim_policy
+            typename reclaim_policy::read_guard rg;
+            CDS_UNUSED( rg );
+
+            for ( unsigned int nAttempt = 0; nAttempt < c_nOptimisticReadAttempts; ++nAttempt ) {
+                if ( nAttempt ) {
+                    m_Stat.onOptimisticReadRetry();
+                    cds::backoff::hint()();
+                }
+
+                size_t const nTableVersion = m_Versions.table_version();
+                if ( nTableVersion & 1 )
+                    continue;   // resizing or clearing is in progress
+
+                // The tables are not less than the mask, see allocate_bucket_tables()
+                size_t const nMask = m_nBucketMask.load( atomics::memory_order_acquire );
+                bool bBusy = false;
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    arrBucket[i] = arrHash[i] & nMask;
+                    arrVersion[i] = m_Versions.version( i, arrBucket[i] );
+                    bBusy |= ( arrVersion[i] & 1 ) != 0;
+                }
+                if ( bBusy )
+                    continue;
+
+                // The item pointers are copied by atomic loads before calling the predicate
+                bFound = false;
+                for ( unsigned int i = 0; i < c_nArity && !bFound; ++i ) {
+                    node_type * arrNode[ bucket_entry::c_nCapacity ];
+                    bucket_entry const& probeset = m_BucketTable[i].load( atomics::memory_order_acquire )[arrBucket[i]];
+                    for ( unsigned int k = 0, nCount = probeset.snapshot( arrNode, arrHash[i] ); k < nCount; ++k ) {
+                        if ( contains_action::equal( *arrNode[k], i, arrHash[i], val, pred )) {
+                            bFound = true;
+                            break;
+                        }
+                    }
+                }
+
+                if ( m_Versions.validate( nTableVersion, arrVersion, arrBucket ))
+                    return true;
+            }
+
+            m_Stat.onOptimisticReadFallback();
+            return false;
+        }
+
+        template <typename Q, typename Predicate>
+        bool find_optimistic( size_t const * /*arrHash*/, Q const& /*val*/, Predicate /*pred*/, bool& /*bFound*/, std::false_type )
+        {
+            return false;
+        }
+
+        // Disposes the unlinked item p by Disposer.
+        // With optimistic reads a concurrent reader can still read p, so p is disposed by reclaim_policy
+        template <typename Disposer, typename Node>
+        static void dispose_unlinked( Node * p )
+        {
+            dispose_unlinked<Disposer>( p, std::integral_constant<bool, bucket_versions::c_bEnabled>());
+        }
+
+        template <typename Disposer, typename Node>
+        static void dispose_unlinked( Node * p, std::true_type )
+        {
+            reclaim_policy::template dispose<Disposer>( p );
+        }
+
+        template <typename Disposer, typename Node>
+        static void dispose_unlinked( Node * p, std::false_type )
+        {
+            Disposer()( p );
+        }
+
         bool relocate( unsigned int nTable, size_t * arrGoalHash )
         {
             // arrGoalHash contains hash values for relocating element
@@ -2101,6 +2881,9 @@ namespace cds { namespace intrusive {
                     if ( !guard2.locked() )
                         continue ;  // try one more time
 
+                    // The item is not reachable between removing and inserting into other bucket,
+                    // so the version of the source bucket covers the entire move
+                    version_guard vg( m_Versions, nTable, arrGoalHash[nTable] & m_nBucketMask.load( atomics::memory_order_relaxed ));
                     refBucket.remove( typename bucket_entry::iterator(), refBucket.begin() );
 
                     unsigned int i = (nTable + 1) % c_nArity;
@@ -2111,7 +2894,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetThreshold ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bucket_insert( bkt, i, arrHash[i], pos.itPrev, node_traits::to_node_ptr( pVal ));
                             m_Stat.onSuccessRelocateRound();
                             return true;
                         }
@@ -2125,7 +2908,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetSize ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bucket_insert( bkt, i, arrHash[i], pos.itPrev, node_traits::to_node_ptr( pVal ));
                             nTable = i;
                             memcpy( arrGoalHash, arrHash, sizeof(arrHash));
                             m_Stat.onRelocateAboveThresholdRound();
@@ -2135,7 +2918,7 @@ namespace cds { namespace intrusive {
                     }
 
                     // all probeset is full, relocating fault
-                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ));
+                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ), arrHash[nTable] );
                     m_Stat.onFailedRelocate();
                     return false;
                 }
@@ -2159,10 +2942,12 @@ namespace cds { namespace intrusive {
                     return;
                 }
 
+                table_version_guard vg( m_Versions );
+
                 size_t nCapacity = nOldCapacity * 2;
 
                 m_MutexPolicy.resize( nCapacity );
-                memcpy( pOldTable, m_BucketTable, sizeof(pOldTable));
+                get_bucket_tables( pOldTable );
                 allocate_bucket_tables( nCapacity );
 
                 typedef typename bucket_entry::iterator bucket_iterator;
@@ -2184,7 +2969,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetThreshold ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     m_Stat.onResizeSuccessMove();
                                     goto do_next;
                                 }
@@ -2193,7 +2978,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetSize ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     assert( refBucket.size() > 1 );
                                     copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()) );
                                     m_Stat.onResizeRelocateCall();
@@ -2206,7 +2991,7 @@ namespace cds { namespace intrusive {
                     }
                 }
             }
-            free_bucket_tables( pOldTable, nOldCapacity );
+            retire_bucket_tables( pOldTable, nOldCapacity );
         }
 
         CDS_CONSTEXPR static unsigned int calc_probeset_size( unsigned int nProbesetSize ) CDS_NOEXCEPT
@@ -2234,6 +3019,7 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(0) )
             , m_nProbesetThreshold( m_nProbesetSize - 1 )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2254,6 +3040,7 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(nProbesetSize) )
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1 )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2272,6 +3059,7 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize -1 )
             , m_Hash( h )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2294,6 +3082,7 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( h )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2312,6 +3101,7 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize / 2 )
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2334,6 +3124,7 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_pRetiredTables( nullptr )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2398,7 +3189,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            bucket_insert( refBucket, i, arrHash[i], arrPos[i].itPrev, pNode );
                             f( val );
                             ++m_ItemCounter;
                             m_Stat.onInsertSuccess();
@@ -2409,7 +3200,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            bucket_insert( refBucket, i, arrHash[i], arrPos[i].itPrev, pNode );
                             f( val );
                             ++m_ItemCounter;
                             nGoalTable = i;
@@ -2492,7 +3283,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            bucket_insert( refBucket, i, arrHash[i], arrPos[i].itPrev, pNode );
                             func( true, val, val );
                             ++m_ItemCounter;
                             m_Stat.onUpdateSuccess();
@@ -2503,7 +3294,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            bucket_insert( refBucket, i, arrHash[i], arrPos[i].itPrev, pNode );
                             func( true, val, val );
                             ++m_ItemCounter;
                             nGoalTable = i;
@@ -2546,6 +3337,9 @@ namespace cds { namespace intrusive {
             unlink is successful iif <tt>&val == &item</tt>)
 
             The function returns \p true if success and \p false otherwise.
+
+            If \p cuckoo::optimistic_read option is enabled, the unlinked item can still be read
+            by a concurrent optimistic reader, see \p cuckoo::reclaim_policy.
         */
         bool unlink( value_type& val )
         {
@@ -2558,7 +3352,7 @@ namespace cds { namespace intrusive {
 
                 unsigned int nTable = contains( arrPos, arrHash, val, key_predicate() );
                 if ( nTable != c_nUndefTable && node_traits::to_value_ptr(*arrPos[nTable].itFound) == &val ) {
-                    bucket( nTable, arrHash[nTable]).remove( arrPos[nTable].itPrev, arrPos[nTable].itFound );
+                    bucket_remove( nTable, arrHash[nTable], arrPos[nTable].itPrev, arrPos[nTable].itFound );
                     --m_ItemCounter;
                     m_Stat.onUnlinkSuccess();
                     return true;
@@ -2575,6 +3369,8 @@ namespace cds { namespace intrusive {
             unlinks it from the set, and returns a pointer to unlinked item.
 
             If the item with key equal to \p val is not found the function return \p nullptr.
+            If \p cuckoo::optimistic_read option is enabled, the unlinked item can still be read
+            by a concurrent optimistic reader, see \p cuckoo::reclaim_policy.
 
             Note the hash functor should accept a parameter of type \p Q that can be not the same as \p value_type.
         */
@@ -2656,6 +3452,9 @@ namespace cds { namespace intrusive {
             should accept a parameter of type \p Q that can be not the same as \p value_type.
 
             The function returns \p true if \p val is found, \p false otherwise.
+
+            If \p cuckoo::optimistic_read option is enabled, the absence of \p val is detected without locking;
+            \p f is always called under the bucket lock.
         */
         template <typename Q, typename Func>
         bool find( Q& val, Func f )
@@ -2697,11 +3496,14 @@ namespace cds { namespace intrusive {
         /**
             The function searches the item with key equal to \p key
             and returns \p true if it is found, and \p false otherwise.
+
+            If \p cuckoo::optimistic_read option is enabled, the function does not lock the buckets
+            unless they are being changed all the time.
         */
         template <typename Q>
         bool contains( Q const& key )
         {
-            return find( key, [](value_type&, Q const& ) {} );
+            return contains_( key, key_predicate() );
         }
         //@cond
         template <typename Q>
@@ -2722,7 +3524,7 @@ namespace cds { namespace intrusive {
         bool contains( Q const& key, Predicate pred )
         {
             CDS_UNUSED( pred );
-            return find_with( key, typename predicate_wrapper<Predicate>::type(), [](value_type& , Q const& ) {} );
+            return contains_( key, typename predicate_wrapper<Predicate>::type() );
         }
         //@cond
         template <typename Q, typename Predicate>
@@ -2736,11 +3538,13 @@ namespace cds { namespace intrusive {
         /// Clears the set
         /**
             The function unlinks all items from the set.
-            For any item \ref disposer is called
+            For any item \ref disposer is called.
+            If \p cuckoo::optimistic_read option is enabled, \ref disposer is called
+            by \p cuckoo::reclaim_policy.
         */
         void clear()
         {
-            clear_and_dispose( disposer() );
+            clear_and_dispose( []( value_type * p ) { dispose_unlinked<disposer>( p ); } );
         }
 
         /// Clears the set and calls \p disposer for each item
@@ -2754,16 +3558,20 @@ namespace cds { namespace intrusive {
             \endcode
 
             The \ref disposer specified in \p Traits traits is not called.
+
+            If \p cuckoo::optimistic_read option is enabled, an item passed to \p oDisposer
+            can still be read by a concurrent optimistic reader, see \p cuckoo::reclaim_policy.
         */
         template <typename Disposer>
         void clear_and_dispose( Disposer oDisposer )
         {
             // locks entire array
             scoped_full_lock sl( m_MutexPolicy );
+            table_version_guard vg( m_Versions );
 
             for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                bucket_entry * pEntry = m_BucketTable[i];
-                bucket_entry * pEnd = pEntry + m_nBucketMask + 1;
+                bucket_entry * pEntry = m_BucketTable[i].load( atomics::memory_order_relaxed );
+                bucket_entry * pEnd = pEntry + bucket_count();
                 for ( ; pEntry != pEnd ; ++pEntry ) {
                     pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
                 }
@@ -2792,7 +3600,7 @@ namespace cds { namespace intrusive {
         */
         size_t bucket_count() const
         {
-            return m_nBucketMask + 1;
+            return m_nBucketMask.load( atomics::memory_order_relaxed ) + 1;
         }
 
         /// Returns lock array size
@@ -85,6 +85,7 @@ namespace cds { namespace intrusive {
             event_counter   m_nSlotConverting;  ///< Number of events when we encounter a slot while it is converting to array node
 
             event_counter   m_nArrayNodeCount;  ///< Number of array nodes
+            event_counter   m_nArrayNodeFreed;  ///< Number of array nodes freed by \p compact()
             event_counter   m_nHeight;          ///< Current height of the tree
 
             //@cond
@@ -106,6 +107,7 @@ namespace cds { namespace intrusive {
             void onSlotChanged()                { ++m_nSlotChanged;         }
             void onSlotConverting()             { ++m_nSlotConverting;      }
             void onArrayNodeCreated()           { ++m_nArrayNodeCount;      }
+            void onArrayNodeFreed()             { ++m_nArrayNodeFreed;      }
             void height( size_t h )             { if (m_nHeight < h ) m_nHeight = h; }
             //@endcond
         };
@@ -131,6 +133,7 @@ namespace cds { namespace intrusive {
             void onSlotChanged()                const {}
             void onSlotConverting()             const {}
             void onArrayNodeCreated()           const {}
+            void onArrayNodeFreed()             const {}
             void height(size_t)                 const {}
             //@endcond
         };
@@ -298,6 +301,33 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Memory usage statistics, see \p FeldmanHashSet::get_memory_statistics
+        /**
+            Only the array nodes are taken into account, the memory of data nodes is not included.
+        */
+        struct memory_statistics
+        {
+            size_t array_node_count;        ///< Count of array nodes including the head node
+            size_t memory_size;             ///< Total size of array nodes in bytes
+            size_t data_cell_count;         ///< The number of data cells in all array nodes
+            size_t array_cell_count;        ///< The number of array cells in all array nodes
+            size_t empty_cell_count;        ///< The number of empty cells in all array nodes
+            size_t compactable_node_count;  ///< The number of array nodes that can be freed by \p FeldmanHashSet::compact()
+            size_t compactable_memory_size; ///< The size of array nodes that can be freed by \p FeldmanHashSet::compact(), in bytes
+
+            //@cond
+            memory_statistics()
+                : array_node_count(0)
+                , memory_size(0)
+                , data_cell_count(0)
+                , array_cell_count(0)
+                , empty_cell_count(0)
+                , compactable_node_count(0)
+                , compactable_memory_size(0)
+            {}
+            //@endcond
+        };
+
         //@cond
         namespace details {
             template <typename HashType, typename UInt = size_t >
@@ -460,6 +490,30 @@ namespace cds { namespace intrusive {
                 } // while
             }
 
+            // Prefetches the cell of level nDepth for hash (the head node is level 1).
+            // The cells of upper levels should be prefetched before.
+            // If a data node is found on upper level, the data node is prefetched
+            void prefetch( hash_type const& hash, size_t nDepth ) const
+            {
+                hash_splitter splitter( hash );
+                atomic_node_ptr const * pCell = m_Head->nodes + splitter.cut( m_Metrics.head_node_size_log );
+                for ( ; nDepth > 1; --nDepth ) {
+                    node_ptr slot = pCell->load( memory_model::memory_order_acquire );
+                    if ( slot.bits() == flag_array_node ) {
+                        // array nodes are freed only in the destructor
+                        if ( splitter.eos())
+                            return;
+                        pCell = to_array( slot.ptr())->nodes + splitter.cut( m_Metrics.array_node_size_log );
+                    }
+                    else {
+                        if ( slot.bits() == 0 )
+                            CDS_PREFETCH( slot.ptr());
+                        return;
+                    }
+                }
+                CDS_PREFETCH( pCell );
+            }
+
             size_t head_size() const
             {
                 return m_Metrics.head_node_size;
@@ -476,6 +530,22 @@ namespace cds { namespace intrusive {
                 gather_level_statistics(stat, 0, m_Head, head_size());
             }
 
+            void get_memory_statistics( feldman_hashset::memory_statistics& stat ) const
+            {
+                stat = feldman_hashset::memory_statistics();
+                gather_memory_statistics( stat, m_Head, head_size());
+            }
+
+            // Collapses each subtree that contains at most one data node into its parent slot.
+            // The function is not thread-safe. Returns the number of freed array nodes
+            size_t compact()
+            {
+                size_t nFreed = 0;
+                for ( atomic_node_ptr * p = m_Head->nodes, *pLast = p + head_size(); p != pLast; ++p )
+                    compact_slot( *p, nFreed );
+                return nFreed;
+            }
+
         protected:
             array_node * head() const
             {
@@ -513,7 +583,7 @@ namespace cds { namespace intrusive {
 
             static array_node * alloc_array_node(size_t nSize, array_node * pParent, size_t idxParent)
             {
-                array_node * pNode = cxx_array_node_allocator().NewBlock(sizeof(array_node) + sizeof(atomic_node_ptr) * (nSize - 1), pParent, idxParent);
+                array_node * pNode = cxx_array_node_allocator().NewBlock( array_node_bytes( nSize ), pParent, idxParent);
                 new (pNode->nodes) atomic_node_ptr[nSize];
                 return pNode;
             }
@@ -577,6 +647,83 @@ namespace cds { namespace intrusive {
                 }
             }
 
+            struct subtree_memory {
+                size_t nDataCount;
+                size_t nNodeCount;
+                size_t nCompactable;
+            };
+
+            subtree_memory gather_memory_statistics( feldman_hashset::memory_statistics& stat, array_node * pArr, size_t nSize ) const
+            {
+                subtree_memory sub = { 0, 1, 0 };
+                ++stat.array_node_count;
+                stat.memory_size += array_node_bytes( nSize );
+
+                for ( atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p ) {
+                    node_ptr slot = p->load( memory_model::memory_order_acquire );
+                    if ( slot.bits()) {
+                        ++stat.array_cell_count;
+                        if ( slot.bits() == flag_array_node ) {
+                            subtree_memory child = gather_memory_statistics( stat, to_array( slot.ptr()), array_node_size());
+                            sub.nDataCount += child.nDataCount;
+                            sub.nNodeCount += child.nNodeCount;
+                            sub.nCompactable += child.nCompactable;
+                        }
+                    }
+                    else if ( slot.ptr()) {
+                        ++stat.data_cell_count;
+                        ++sub.nDataCount;
+                    }
+                    else
+                        ++stat.empty_cell_count;
+                }
+
+                if ( pArr == m_Head ) {
+                    // the head node is never freed
+                    stat.compactable_node_count = sub.nCompactable;
+                    stat.compactable_memory_size = sub.nCompactable * array_node_bytes( array_node_size());
+                }
+                else if ( sub.nDataCount <= 1 ) {
+                    // whole subtree is collapsible
+                    sub.nCompactable = sub.nNodeCount;
+                }
+                return sub;
+            }
+
+            // Returns the number of data nodes in the subtree of slot
+            size_t compact_slot( atomic_node_ptr& slot, size_t& nFreed )
+            {
+                node_ptr cur = slot.load( memory_model::memory_order_acquire );
+                if ( cur.bits() != flag_array_node )
+                    return cur.ptr() ? 1 : 0;
+
+                array_node * pArr = to_array( cur.ptr());
+                size_t nDataCount = 0;
+                for ( atomic_node_ptr * p = pArr->nodes, *pLast = p + array_node_size(); p != pLast; ++p )
+                    nDataCount += compact_slot( *p, nFreed );
+
+                if ( nDataCount <= 1 ) {
+                    // After compacting the children the array node contains only data and empty cells
+                    node_ptr data;
+                    for ( atomic_node_ptr * p = pArr->nodes, *pLast = p + array_node_size(); p != pLast; ++p ) {
+                        node_ptr child = p->load( memory_model::memory_order_relaxed );
+                        assert( child.bits() == 0 );
+                        if ( child.ptr())
+                            data = child;
+                    }
+                    slot.store( data, memory_model::memory_order_release );
+                    free_array_node( pArr );
+                    ++nFreed;
+                    stats().onArrayNodeFreed();
+                }
+                return nDataCount;
+            }
+
+            static size_t array_node_bytes( size_t nSize )
+            {
+                return sizeof( array_node ) + sizeof( atomic_node_ptr ) * ( nSize - 1 );
+            }
+
             bool expand_slot( traverse_data& pos, node_ptr current)
             {
                 return expand_slot( pos.pArr, pos.nSlot, current, pos.splitter.bit_offset());
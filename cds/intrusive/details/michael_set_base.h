@@ -36,6 +36,8 @@
 #include <cds/opt/hash.h>
 #include <cds/algo/bitop.h>
 #include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/details/allocator.h>
 
 namespace cds { namespace intrusive {
 
@@ -43,6 +45,44 @@ namespace cds { namespace intrusive {
     /** @ingroup cds_intrusive_helper
     */
     namespace michael_set {
+
+        /// Internal statistics of expandable bucket table
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter     counter_type;   ///< Counter type
+
+            counter_type    m_nResizeStart;         ///< Count of bucket table expansions started
+            counter_type    m_nResizeComplete;      ///< Count of bucket table expansions completed
+            counter_type    m_nBucketMigrated;      ///< Count of buckets migrated to new table
+            counter_type    m_nItemMigrated;        ///< Count of items moved to new table
+            counter_type    m_nMigrationWait;       ///< Count of wait cycles for the bucket being migrated
+            counter_type    m_nMigrationDrainWait;  ///< Count of wait cycles of migrating thread for the bucket's operations to complete
+
+            //@cond
+            void onResizeStart()            { ++m_nResizeStart; }
+            void onResizeComplete()         { ++m_nResizeComplete; }
+            void onBucketMigrated( size_t nItems )
+            {
+                ++m_nBucketMigrated;
+                m_nItemMigrated += nItems;
+            }
+            void onMigrationWait()          { ++m_nMigrationWait; }
+            void onMigrationDrainWait()     { ++m_nMigrationDrainWait; }
+            //@endcond
+        };
+
+        /// Dummy statistics - no counting is performed, no overhead. Support interface like \p michael_set::stat
+        struct empty_stat {
+            //@cond
+            void onResizeStart()            const {}
+            void onResizeComplete()         const {}
+            void onBucketMigrated( size_t ) const {}
+            void onMigrationWait()          const {}
+            void onMigrationDrainWait()     const {}
+            //@endcond
+        };
+
         /// MichaelHashSet traits
         struct traits {
             /// Hash function
@@ -71,6 +111,52 @@ namespace cds { namespace intrusive {
                 and in destructor for destroying bucket table
             */
             typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// What type of bucket table is used
+            /**
+                \p true - the bucket table is expandable: when the item count exceeds
+                    <tt>bucket_count() * nLoadFactor</tt> the table is doubled and the buckets
+                    are migrated to the new table cooperatively by the threads working with the set.
+                \p false - the bucket table is allocated in the constructor and cannot be expanded.
+
+                Default is \p false. Only \p MichaelHashSet and \p container::MichaelHashMap
+                for \p gc::HP and \p gc::DHP support expandable bucket table, other specializations ignore the option.
+
+                @warning With expandable bucket table the functors passed to \p find(), \p update(), \p erase()
+                and other member functions must not call the member functions of the same set:
+                the functor is called while the bucket is held by current thread, so the nested call
+                can wait forever for the migration of the bucket.
+            */
+            static const bool dynamic_bucket_table = false;
+
+            /// Internal statistics of expandable bucket table
+            /**
+                Possible statistics types are: \p michael_set::stat (enable internal statistics),
+                \p michael_set::empty_stat (the default, internal statistics disabled),
+                user-provided class that supports \p %michael_set::stat interface.
+            */
+            typedef michael_set::empty_stat stat;
+
+            /// Back-off strategy used to wait for the bucket migration
+            typedef cds::backoff::Default   back_off;
+        };
+
+        /// [value-option] Michael's set dynamic bucket table option
+        /**
+            The option is used to select bucket table implementation.
+            Possible values of \p Value are:
+            - \p true - the bucket table is expandable
+            - \p false - the bucket table has fixed size (the default)
+        */
+        template <bool Value>
+        struct dynamic_bucket_table
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { dynamic_bucket_table = Value };
+            };
+            //@endcond
         };
 
         /// Metafunction converting option list to traits struct
@@ -80,6 +166,10 @@ namespace cds { namespace intrusive {
             - \p opt::item_counter - optional, specifies item counting policy. See \p traits::item_counter
                 for default type.
             - \p opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p michael_set::dynamic_bucket_table - use expandable or fixed bucket table. Default is fixed table.
+            - \p opt::stat - internal statistics of expandable bucket table, default is \p michael_set::empty_stat (disabled).
+                To enable internal statistics use \p michael_set::stat.
+            - \p opt::back_off - back-off strategy used for waiting the bucket migration, default is \p cds::backoff::Default.
         */
         template <typename... Options>
         struct make_traits {
@@ -215,6 +305,414 @@ namespace cds { namespace intrusive {
                 }
 
             };
+
+            template <typename Bucket, typename Traits, typename Hash>
+            class static_bucket_table
+            {
+            public:
+                typedef Bucket bucket_type;
+                typedef cds::details::Allocator< bucket_type, typename Traits::allocator > bucket_table_allocator;
+                typedef michael_set::empty_stat stat;
+
+                class bucket_ref
+                {
+                    bucket_type * m_pBucket;
+                public:
+                    explicit bucket_ref( bucket_type * pBucket )
+                        : m_pBucket( pBucket )
+                    {}
+
+                    bucket_type * operator ->() const
+                    {
+                        return m_pBucket;
+                    }
+                };
+
+            protected:
+                bucket_type *   m_Buckets;
+                const size_t    m_nHashBitmask;
+                stat            m_Stat;
+
+            public:
+                static_bucket_table( size_t nMaxItemCount, size_t nLoadFactor )
+                    : m_nHashBitmask( init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+                {
+                    m_Buckets = bucket_table_allocator().NewArray( bucket_count() );
+                }
+
+                ~static_bucket_table()
+                {
+                    bucket_table_allocator().Delete( m_Buckets, bucket_count() );
+                }
+
+                bucket_ref bucket( size_t nHash )
+                {
+                    return bucket_ref( m_Buckets + ( nHash & m_nHashBitmask ));
+                }
+
+                void prefetch( size_t nHash ) const
+                {
+                    CDS_PREFETCH( m_Buckets + ( nHash & m_nHashBitmask ));
+                }
+
+                void prefetch_head( size_t nHash ) const
+                {
+                    m_Buckets[ nHash & m_nHashBitmask ].prefetch();
+                }
+
+                void check_load( size_t /*nItemCount*/ )
+                {}
+
+                void clear()
+                {
+                    for ( size_t i = 0; i < bucket_count(); ++i )
+                        m_Buckets[i].clear();
+                }
+
+                bucket_type * buckets() const
+                {
+                    return m_Buckets;
+                }
+
+                size_t bucket_count() const
+                {
+                    return m_nHashBitmask + 1;
+                }
+
+                stat const& statistics() const
+                {
+                    return m_Stat;
+                }
+            };
+
+            /*
+                Expandable bucket table.
+
+                The table is a sequence of levels, level L consists of <tt>nInitBucketCount << L</tt> buckets.
+                Each bucket has a state word: the count of operations working with the bucket
+                and "migrating"/"migrated" flags. An operation enters the bucket by incrementing the count;
+                if the bucket is migrated the operation goes to the next level.
+
+                When the item count exceeds <tt>bucket_count() * nLoadFactor</tt> the next level is allocated.
+                Then each operation on the set migrates one bucket before entering its own bucket:
+                it claims the next bucket index, sets "migrating" flag, waits while the operations
+                working with the bucket complete and splits the bucket list into two buckets of the next level.
+                When all buckets are migrated the next level becomes the base level.
+
+                The old levels are freed in the destructor only, so the total size of the tables
+                is less than twice of the size of the last level.
+            */
+            template <typename Bucket, typename Traits, typename Hash>
+            class expandable_bucket_table
+            {
+            public:
+                typedef Bucket bucket_type;
+                typedef Hash   hash;
+                typedef typename Traits::stat     stat;
+                typedef typename Traits::back_off back_off;
+                typedef cds::details::Allocator< bucket_type, typename Traits::allocator > bucket_table_allocator;
+
+            protected:
+                typedef atomics::atomic<size_t> bucket_state;
+                typedef cds::details::Allocator< bucket_state, typename Traits::allocator > state_table_allocator;
+
+                enum {
+                    c_nMigrated  = 1,   // the bucket is moved to the next level
+                    c_nMigrating = 2,   // the bucket is being moved to the next level
+                    c_nUseInc    = 4    // increment of the bucket's operation count
+                };
+
+                enum {
+                    c_nMaxLevelCount = sizeof( size_t ) * 8,
+                    c_nCursorLevelShift = sizeof( size_t ) * 8 - 8
+                };
+
+                struct level_table {
+                    bucket_type *   pBuckets;
+                    bucket_state *  pState;
+                };
+
+                struct split_predicate {
+                    hash const&     m_Hash;
+                    size_t const    m_nBit;
+
+                    split_predicate( hash const& h, size_t nBit )
+                        : m_Hash( h )
+                        , m_nBit( nBit )
+                    {}
+
+                    template <typename Q>
+                    bool operator()( Q const& v ) const
+                    {
+                        return ( m_Hash( v ) & m_nBit ) != 0;
+                    }
+                };
+
+            public:
+                class bucket_ref
+                {
+                    bucket_type *   m_pBucket;
+                    bucket_state *  m_pState;
+                public:
+                    bucket_ref( bucket_type * pBucket, bucket_state * pState )
+                        : m_pBucket( pBucket )
+                        , m_pState( pState )
+                    {}
+
+                    bucket_ref( bucket_ref&& src )
+                        : m_pBucket( src.m_pBucket )
+                        , m_pState( src.m_pState )
+                    {
+                        src.m_pState = nullptr;
+                    }
+
+                    bucket_ref( bucket_ref const& ) = delete;
+                    bucket_ref& operator=( bucket_ref const& ) = delete;
+
+                    ~bucket_ref()
+                    {
+                        if ( m_pState )
+                            m_pState->fetch_sub( c_nUseInc, atomics::memory_order_release );
+                    }
+
+                    bucket_type * operator ->() const
+                    {
+                        return m_pBucket;
+                    }
+                };
+
+            protected:
+                hash                    m_Hash;
+                size_t const            m_nLoadFactor;
+                size_t const            m_nInitBucketCount;
+                size_t const            m_nMaxLevel;
+                level_table             m_arrLevel[c_nMaxLevelCount];
+                atomics::atomic<size_t> m_nBaseLevel;       // all buckets of lower levels are migrated
+                atomics::atomic<size_t> m_nTopLevel;        // last allocated level
+                atomics::atomic<size_t> m_nMigrationCursor; // ( source level << c_nCursorLevelShift ) | next bucket to migrate
+                atomics::atomic<size_t> m_nMigratedCount;   // count of migrated buckets of the source level
+                atomics::atomic<bool>   m_bGrowing;
+                stat                    m_Stat;
+
+            public:
+                expandable_bucket_table( size_t nMaxItemCount, size_t nLoadFactor )
+                    : m_nLoadFactor( nLoadFactor > 0 ? nLoadFactor : 1 )
+                    , m_nInitBucketCount( init_hash_bitmask( nMaxItemCount, nLoadFactor ) + 1 )
+                    , m_nMaxLevel( c_nCursorLevelShift - cds::bitop::MSB( m_nInitBucketCount ))
+                    , m_nBaseLevel( 0 )
+                    , m_nTopLevel( 0 )
+                    , m_nMigrationCursor( 0 )
+                    , m_nMigratedCount( 0 )
+                    , m_bGrowing( false )
+                {
+                    allocate_level( 0 );
+                }
+
+                ~expandable_bucket_table()
+                {
+                    size_t const nTop = m_nTopLevel.load( atomics::memory_order_relaxed );
+                    for ( size_t nLevel = 0; nLevel <= nTop; ++nLevel ) {
+                        bucket_table_allocator().Delete( m_arrLevel[nLevel].pBuckets, level_bucket_count( nLevel ));
+                        state_table_allocator().Delete( m_arrLevel[nLevel].pState, level_bucket_count( nLevel ));
+                    }
+                }
+
+                bucket_ref bucket( size_t nHash )
+                {
+                    help_migrate();
+
+                    size_t nLevel = m_nBaseLevel.load( atomics::memory_order_acquire );
+                    while ( true ) {
+                        level_table const& tbl = m_arrLevel[nLevel];
+                        size_t const nIdx = nHash & ( level_bucket_count( nLevel ) - 1 );
+                        if ( enter( tbl.pState[nIdx] ))
+                            return bucket_ref( tbl.pBuckets + nIdx, tbl.pState + nIdx );
+                        ++nLevel;
+                    }
+                }
+
+                // The bucket of the top level is prefetched; if the table is being resized
+                // the operation may still go to the bucket of the previous level
+                void prefetch( size_t nHash ) const
+                {
+                    size_t const nLevel = m_nTopLevel.load( atomics::memory_order_acquire );
+                    size_t const nIdx = nHash & ( level_bucket_count( nLevel ) - 1 );
+                    CDS_PREFETCH( m_arrLevel[nLevel].pState + nIdx );
+                    CDS_PREFETCH( m_arrLevel[nLevel].pBuckets + nIdx );
+                }
+
+                void prefetch_head( size_t nHash ) const
+                {
+                    size_t const nLevel = m_nTopLevel.load( atomics::memory_order_acquire );
+                    m_arrLevel[nLevel].pBuckets[ nHash & ( level_bucket_count( nLevel ) - 1 ) ].prefetch();
+                }
+
+                void check_load( size_t nItemCount )
+                {
+                    size_t const nTop = m_nTopLevel.load( atomics::memory_order_acquire );
+                    if ( nItemCount <= level_bucket_count( nTop ) * m_nLoadFactor
+                        || nTop + 1 >= m_nMaxLevel
+                        || m_nBaseLevel.load( atomics::memory_order_acquire ) != nTop )
+                    {
+                        return;
+                    }
+
+                    bool bFree = false;
+                    if ( !m_bGrowing.compare_exchange_strong( bFree, true, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                        return;
+
+                    if ( m_nTopLevel.load( atomics::memory_order_relaxed ) == nTop && m_nBaseLevel.load( atomics::memory_order_acquire ) == nTop ) {
+                        allocate_level( nTop + 1 );
+                        m_nMigratedCount.store( 0, atomics::memory_order_relaxed );
+                        m_nMigrationCursor.store( nTop << c_nCursorLevelShift, atomics::memory_order_relaxed );
+                        m_nTopLevel.store( nTop + 1, atomics::memory_order_release );
+                        m_Stat.onResizeStart();
+                    }
+                    m_bGrowing.store( false, atomics::memory_order_release );
+                }
+
+                void clear()
+                {
+                    size_t const nLevel = m_nBaseLevel.load( atomics::memory_order_acquire );
+                    for ( size_t i = 0, nCount = level_bucket_count( nLevel ); i < nCount; ++i )
+                        clear_bucket( nLevel, i );
+                }
+
+                // The iterators walk the buckets of the top level only,
+                // so the pending migration is completed before the top level is returned
+                bucket_type * buckets() const
+                {
+                    const_cast<expandable_bucket_table *>( this )->complete_migration();
+                    return m_arrLevel[ m_nTopLevel.load( atomics::memory_order_acquire ) ].pBuckets;
+                }
+
+                size_t bucket_count() const
+                {
+                    return level_bucket_count( m_nTopLevel.load( atomics::memory_order_acquire ));
+                }
+
+                stat const& statistics() const
+                {
+                    return m_Stat;
+                }
+
+            protected:
+                size_t level_bucket_count( size_t nLevel ) const
+                {
+                    return m_nInitBucketCount << nLevel;
+                }
+
+                void allocate_level( size_t nLevel )
+                {
+                    size_t const nCount = level_bucket_count( nLevel );
+                    m_arrLevel[nLevel].pBuckets = bucket_table_allocator().NewArray( nCount );
+                    m_arrLevel[nLevel].pState = state_table_allocator().NewArray( nCount, size_t( 0 ));
+                }
+
+                // Increments the operation count of the bucket.
+                // Returns false if the bucket has been migrated to the next level
+                bool enter( bucket_state& state )
+                {
+                    back_off bkoff;
+                    size_t s = state.load( atomics::memory_order_acquire );
+                    while ( true ) {
+                        if ( s & c_nMigrated )
+                            return false;
+                        if ( s & c_nMigrating ) {
+                            m_Stat.onMigrationWait();
+                            bkoff();
+                            s = state.load( atomics::memory_order_acquire );
+                        }
+                        else if ( state.compare_exchange_weak( s, s + c_nUseInc, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                            return true;
+                    }
+                }
+
+                // The buckets of the next level are cleared only when the bucket is migrated:
+                // until then the migrating thread may be splitting the bucket into them
+                void clear_bucket( size_t nLevel, size_t nIdx )
+                {
+                    level_table const& tbl = m_arrLevel[nLevel];
+                    if ( enter( tbl.pState[nIdx] )) {
+                        tbl.pBuckets[nIdx].clear();
+                        tbl.pState[nIdx].fetch_sub( c_nUseInc, atomics::memory_order_release );
+                    }
+                    else {
+                        clear_bucket( nLevel + 1, nIdx );
+                        clear_bucket( nLevel + 1, nIdx + level_bucket_count( nLevel ));
+                    }
+                }
+
+                // Migrates one bucket of the source level.
+                // Returns false if there is no bucket to claim
+                bool help_migrate()
+                {
+                    size_t const nTop = m_nTopLevel.load( atomics::memory_order_acquire );
+                    if ( m_nBaseLevel.load( atomics::memory_order_acquire ) == nTop )
+                        return false;
+
+                    // Claim a bucket of the source level
+                    size_t const nLevel = nTop - 1;
+                    size_t const nCount = level_bucket_count( nLevel );
+                    size_t const nIndexMask = ( size_t( 1 ) << c_nCursorLevelShift ) - 1;
+                    size_t nCursor = m_nMigrationCursor.load( atomics::memory_order_acquire );
+                    do {
+                        if ( ( nCursor >> c_nCursorLevelShift ) != nLevel || ( nCursor & nIndexMask ) >= nCount )
+                            return false;
+                    } while ( !m_nMigrationCursor.compare_exchange_weak( nCursor, nCursor + 1, atomics::memory_order_acquire, atomics::memory_order_relaxed ));
+
+                    migrate_bucket( nLevel, nCursor & nIndexMask );
+                    return true;
+                }
+
+                // Migrates all remaining buckets of the source level and waits while
+                // other threads complete the buckets they have claimed
+                void complete_migration()
+                {
+                    back_off bkoff;
+                    while ( m_nBaseLevel.load( atomics::memory_order_acquire ) != m_nTopLevel.load( atomics::memory_order_acquire )) {
+                        if ( !help_migrate() )
+                            bkoff();
+                    }
+                }
+
+                void migrate_bucket( size_t nLevel, size_t nIdx )
+                {
+                    level_table const& src = m_arrLevel[nLevel];
+                    level_table const& dst = m_arrLevel[nLevel + 1];
+                    size_t const nCount = level_bucket_count( nLevel );
+                    bucket_state& state = src.pState[nIdx];
+
+                    // Forbid new operations on the bucket and wait for current ones
+                    state.fetch_or( c_nMigrating, atomics::memory_order_acquire );
+                    back_off bkoff;
+                    while ( state.load( atomics::memory_order_acquire ) >= c_nUseInc ) {
+                        m_Stat.onMigrationDrainWait();
+                        bkoff();
+                    }
+
+                    // Now the bucket and its two successors are accessed by current thread only:
+                    // any operation including clear() enters the successors after the bucket is migrated
+                    size_t const nItems = src.pBuckets[nIdx].split_to( dst.pBuckets[nIdx], dst.pBuckets[nIdx + nCount], split_predicate( m_Hash, nCount ));
+                    state.store( c_nMigrated, atomics::memory_order_release );
+                    m_Stat.onBucketMigrated( nItems );
+
+                    if ( m_nMigratedCount.fetch_add( 1, atomics::memory_order_acq_rel ) + 1 == nCount ) {
+                        m_nBaseLevel.store( nLevel + 1, atomics::memory_order_release );
+                        m_Stat.onResizeComplete();
+                    }
+                }
+            };
+
+            template <typename Bucket, typename Traits, typename Hash>
+            struct bucket_table_selector
+            {
+                typedef typename std::conditional<
+                    Traits::dynamic_bucket_table,
+                    expandable_bucket_table< Bucket, Traits, Hash >,
+                    static_bucket_table< Bucket, Traits, Hash >
+                >::type type;
+            };
         }
         //@endcond
     } // namespace michael_set
@@ -419,6 +419,8 @@ namespace cds { namespace intrusive {
             event_counter   m_nExtractMaxRetries    ; ///< Count of retries of \p extract_max call
             event_counter   m_nEraseWhileFind       ; ///< Count of erased item while searching
             event_counter   m_nExtractWhileFind     ; ///< Count of extracted item while searching (RCU only)
+            event_counter   m_nRangeScan            ; ///< Count of \p for_each_in_range() calls
+            event_counter   m_nRangeScanReseek      ; ///< Count of re-seeks in \p for_each_in_range() caused by concurrent deletion
 
             //@cond
             void onAddNode( unsigned int nHeight )
@@ -464,6 +466,8 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      { ++m_nExtractMaxSuccess; }
             void onExtractMaxFailed()       { ++m_nExtractMaxFailed;  }
             void onExtractMaxRetry()        { ++m_nExtractMaxRetries; }
+            void onRangeScan()              { ++m_nRangeScan;         }
+            void onRangeScanReseek()        { ++m_nRangeScanReseek;   }
 
             //@endcond
         };
@@ -505,6 +509,8 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      const {}
             void onExtractMaxFailed()       const {}
             void onExtractMaxRetry()        const {}
+            void onRangeScan()              const {}
+            void onRangeScanReseek()        const {}
 
             //@endcond
         };
@@ -214,6 +214,31 @@ namespace cds { namespace intrusive {
             */
             static const bool dynamic_bucket_table = true;
 
+            /// Unbounded bucket table
+            /**
+                \p true - use \p split_list::unlimited_bucket_table that has no fixed capacity:
+                    the table grows by lazily allocated segments of doubling size,
+                    so the load factor is kept for any item count.
+                    \p dynamic_bucket_table is ignored in this case.
+                \p false - the bucket table is selected by \p dynamic_bucket_table.
+
+                Default is \p false.
+            */
+            static const bool unbounded_bucket_table = false;
+
+            /// Dummy node allocation
+            /**
+                \p false - each dummy (bucket head) node is allocated separately by \p allocator
+                    when its bucket is initialized.
+                \p true - dummy nodes are placed in contiguous slabs, one slab per bucket table segment.
+                    The slab is allocated by \p allocator when the first bucket of the segment is initialized.
+                    The bucket heads of neighbouring buckets are close to each other in memory,
+                    and the set does not allocate a node for each new bucket.
+
+                Default is \p false.
+            */
+            static const bool dummy_node_slab = false;
+
             /// Back-off strategy
             typedef cds::backoff::Default back_off;
         };
@@ -236,6 +261,42 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// [value-option] Split-list unbounded bucket table option
+        /**
+            The option is used to select \p unlimited_bucket_table, see \p traits::unbounded_bucket_table.
+            Possible values of \p Value are:
+            - \p true - select \p unlimited_bucket_table
+            - \p false - the bucket table is selected by \p dynamic_bucket_table option
+        */
+        template <bool Value>
+        struct unbounded_bucket_table
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { unbounded_bucket_table = Value };
+            };
+            //@endcond
+        };
+
+        /// [value-option] Split-list dummy node slab option
+        /**
+            The option selects how the dummy nodes are allocated, see \p traits::dummy_node_slab.
+            Possible values of \p Value are:
+            - \p true - dummy nodes are allocated from slabs, one slab per bucket table segment
+            - \p false - each dummy node is allocated separately
+        */
+        template <bool Value>
+        struct dummy_node_slab
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { dummy_node_slab = Value };
+            };
+            //@endcond
+        };
+
         /// Metafunction converting option list to \p split_list::traits
         /**
             Available \p Options:
@@ -248,6 +309,8 @@ namespace cds { namespace intrusive {
             - \p opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
             - \p split_list::dynamic_bucket_table - use dynamic or static bucket table implementation.
                 Dynamic bucket table expands its size up to maximum bucket count when necessary
+            - \p split_list::unbounded_bucket_table - use bucket table without capacity limit, default is \p false.
+            - \p split_list::dummy_node_slab - allocate dummy nodes from per-segment slabs, default is \p false.
             - \p opt::back_off - back-off strategy used for spinning, defult is \p cds::backoff::Default.
             - \p opt::stat - internal statistics, default is \p split_list::empty_stat (disabled).
                 To enable internal statistics use \p split_list::stat.
@@ -347,6 +410,13 @@ namespace cds { namespace intrusive {
                 return m_Table[ nBucket ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the head node pointer of bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                assert( nBucket < capacity() );
+                CDS_PREFETCH( m_Table + nBucket );
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, node_type * pNode )
             {
@@ -367,6 +437,23 @@ namespace cds { namespace intrusive {
             {
                 return m_nLoadFactor;
             }
+
+            /// Returns the segment size
+            /**
+                The static table is not segmented. The function returns the bucket count
+                of dummy node slab, see \p split_list::traits::dummy_node_slab
+            */
+            size_t segment_size() const
+            {
+                if ( m_nCapacity < c_nSlabSize )
+                    return m_nCapacity;
+                return c_nSlabSize;
+            }
+
+        protected:
+            //@cond
+            static CDS_CONSTEXPR size_t const c_nSlabSize = 1024;
+            //@endcond
         };
 
         /// Expandable bucket table
@@ -545,6 +632,17 @@ namespace cds { namespace intrusive {
                 return pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the head node pointer of bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry * pSegment = m_Segments[ nSegment ].load( memory_model::memory_order_acquire );
+                if ( pSegment )
+                    CDS_PREFETCH( pSegment + ( nBucket & ( m_metrics.nSegmentSize - 1 )));
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, node_type * pNode )
             {
@@ -573,6 +671,243 @@ namespace cds { namespace intrusive {
             {
                 return m_metrics.nLoadFactor;
             }
+
+            /// Returns the segment size (bucket count in one segment)
+            size_t segment_size() const
+            {
+                return m_metrics.nSegmentSize;
+            }
+        };
+
+        //@cond
+        namespace details {
+            // Array of atomic pointers that consists of lazily allocated segments of doubling size:
+            // segment 0 contains nFirstSegmentSize items, segment k > 0 contains nFirstSegmentSize << (k - 1) items.
+            // The segments are never moved, so the array can grow without limit keeping the item addresses
+            template <typename T, class Alloc>
+            class doubling_segment_array
+            {
+            public:
+                typedef atomics::atomic<T *> item_type;
+
+            private:
+                typedef cds::details::Allocator< item_type, Alloc > segment_allocator;
+
+                // Enough for any size_t index, even if nFirstSegmentSize == 1
+                static CDS_CONSTEXPR size_t const c_nMaxSegmentCount = sizeof(size_t) * 8 + 1;
+
+                size_t const                    m_nFirstSegmentSizeLog2;
+                atomics::atomic<item_type *>    m_arrSegment[c_nMaxSegmentCount];
+
+            public:
+                explicit doubling_segment_array( size_t nFirstSegmentSize )
+                    : m_nFirstSegmentSizeLog2( cds::beans::log2floor( nFirstSegmentSize ))
+                {
+                    assert( cds::beans::is_power2( nFirstSegmentSize ));
+                    for ( size_t i = 0; i < c_nMaxSegmentCount; ++i )
+                        m_arrSegment[i].store( nullptr, atomics::memory_order_relaxed );
+                }
+
+                ~doubling_segment_array()
+                {
+                    for ( size_t i = 0; i < c_nMaxSegmentCount; ++i ) {
+                        item_type * pSegment = m_arrSegment[i].load( atomics::memory_order_relaxed );
+                        if ( pSegment )
+                            segment_allocator().Delete( pSegment, segment_size( i ));
+                    }
+                }
+
+                // Returns a pointer to item nIdx, or nullptr if its segment is not allocated yet
+                item_type * get( size_t nIdx ) const
+                {
+                    size_t const nSegment = segment_no( nIdx );
+                    item_type * pSegment = m_arrSegment[nSegment].load( atomics::memory_order_acquire );
+                    if ( pSegment == nullptr )
+                        return nullptr;
+                    return pSegment + ( nIdx - segment_start( nSegment ));
+                }
+
+                // Returns item nIdx, allocates its segment if needed
+                item_type& at( size_t nIdx )
+                {
+                    size_t const nSegment = segment_no( nIdx );
+                    atomics::atomic<item_type *>& segment = m_arrSegment[nSegment];
+                    item_type * pSegment = segment.load( atomics::memory_order_acquire );
+                    if ( pSegment == nullptr ) {
+                        item_type * pNew = segment_allocator().NewArray( segment_size( nSegment ), nullptr );
+                        if ( segment.compare_exchange_strong( pSegment, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                            pSegment = pNew;
+                        else
+                            segment_allocator().Delete( pNew, segment_size( nSegment ));
+                    }
+                    return pSegment[ nIdx - segment_start( nSegment ) ];
+                }
+
+                // Calls f( T * ) for each non-null item; must not be called concurrently with at()
+                template <typename Func>
+                void for_each( Func f ) const
+                {
+                    for ( size_t i = 0; i < c_nMaxSegmentCount; ++i ) {
+                        item_type * pSegment = m_arrSegment[i].load( atomics::memory_order_acquire );
+                        if ( pSegment ) {
+                            for ( size_t k = 0, nSize = segment_size( i ); k < nSize; ++k ) {
+                                T * p = pSegment[k].load( atomics::memory_order_relaxed );
+                                if ( p )
+                                    f( p );
+                            }
+                        }
+                    }
+                }
+
+                size_t first_segment_size() const
+                {
+                    return size_t(1) << m_nFirstSegmentSizeLog2;
+                }
+
+            private:
+                size_t segment_no( size_t nIdx ) const
+                {
+                    size_t const n = nIdx >> m_nFirstSegmentSizeLog2;
+                    return n == 0 ? 0 : cds::beans::log2floor( n ) + 1;
+                }
+
+                size_t segment_start( size_t nSegment ) const
+                {
+                    return nSegment == 0 ? 0 : size_t(1) << ( m_nFirstSegmentSizeLog2 + nSegment - 1 );
+                }
+
+                size_t segment_size( size_t nSegment ) const
+                {
+                    return nSegment == 0 ? first_segment_size() : segment_start( nSegment );
+                }
+            };
+        } // namespace details
+        //@endcond
+
+        /// Unlimited bucket table
+        /**
+            The bucket table has no capacity limit, so \p SplitListSet keeps its load factor
+            for any item count and the item count does not have to be known in advance.
+
+            The table consists of lazily allocated segments of doubling size:
+            the first segment contains <tt>nItemCount / nLoadFactor</tt> buckets rounded up to power of two,
+            the segment \p k > 0 contains <tt>first_segment_size << (k - 1)</tt> buckets.
+            A segment is allocated when the first its bucket is initialized and is never moved,
+            so the bucket lookup is lock-free and takes constant time. The segment directory
+            is a fixed array of <tt>sizeof(size_t) * 8 + 1</tt> pointers.
+
+            Template parameter:
+            - \p GC - garbage collector
+            - \p Node - node type, must be derived from \p split_list::node
+            - \p Options... - options
+
+            \p Options are:
+            - \p opt::allocator - allocator used to allocate bucket table segments. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::memory_model - memory model used. Possible types are \p opt::v::sequential_consistent, \p opt::v::relaxed_ordering
+        */
+        template <typename GC, typename Node, typename... Options>
+        class unlimited_bucket_table
+        {
+            //@cond
+            struct default_options
+            {
+                typedef CDS_DEFAULT_ALLOCATOR       allocator;
+                typedef opt::v::relaxed_ordering    memory_model;
+            };
+            typedef typename opt::make_options< default_options, Options... >::type options;
+            //@endcond
+        public:
+            typedef GC      gc;        ///< Garbage collector
+            typedef Node    node_type; ///< Bucket node type
+            typedef atomics::atomic<node_type *> table_entry; ///< Table entry type
+
+            /// Memory model for atomic operations
+            typedef typename options::memory_model memory_model;
+
+        protected:
+            //@cond
+            typedef details::doubling_segment_array< node_type, typename options::allocator > segment_array;
+
+            static CDS_CONSTEXPR size_t const c_nSlabSize = 1024;
+
+            static size_t calc_first_segment_size( size_t nItemCount, size_t nLoadFactor )
+            {
+                size_t const nBucketCount = nItemCount / nLoadFactor;
+                return nBucketCount <= 2 ? 2 : cds::beans::ceil2( nBucketCount );
+            }
+            //@endcond
+
+            const size_t    m_nLoadFactor; ///< load factor (average count of items per bucket)
+            segment_array   m_Segments;    ///< bucket table segments
+
+        public:
+            /// Constructs bucket table with the first segment of 512 buckets. Load factor is 1.
+            unlimited_bucket_table()
+                : m_nLoadFactor( 1 )
+                , m_Segments( 512 )
+            {}
+
+            /// Creates the table, \p nItemCount defines the size of the first segment
+            unlimited_bucket_table(
+                size_t nItemCount,        ///< Expected item count in split-ordered list, it is not a limit
+                size_t nLoadFactor        ///< Load factor
+                )
+                : m_nLoadFactor( nLoadFactor > 0 ? nLoadFactor : (size_t) 1 )
+                , m_Segments( calc_first_segment_size( nItemCount, m_nLoadFactor ))
+            {}
+
+            /// Returns head node of the bucket \p nBucket
+            node_type * bucket( size_t nBucket ) const
+            {
+                table_entry * pEntry = m_Segments.get( nBucket );
+                if ( pEntry == nullptr )
+                    return nullptr;    // uninitialized bucket
+                return pEntry->load( memory_model::memory_order_acquire );
+            }
+
+            /// Prefetches the head node pointer of bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                table_entry * pEntry = m_Segments.get( nBucket );
+                if ( pEntry )
+                    CDS_PREFETCH( pEntry );
+            }
+
+            /// Set \p pNode as a head of bucket \p nBucket
+            void bucket( size_t nBucket, node_type * pNode )
+            {
+                assert( nBucket < capacity() );
+                m_Segments.at( nBucket ).store( pNode, memory_model::memory_order_release );
+            }
+
+            /// Returns the capacity of the bucket table
+            /**
+                The capacity is the max bucket count of split-ordered list: the lowest bit of split-ordered key
+                distinguishes dummy and regular nodes, so the bucket number has <tt>sizeof(size_t) * 8 - 1</tt> bits.
+            */
+            size_t capacity() const
+            {
+                return size_t(1) << ( sizeof(size_t) * 8 - 1 );
+            }
+
+            /// Returns the load factor, i.e. average count of items per bucket
+            size_t load_factor() const
+            {
+                return m_nLoadFactor;
+            }
+
+            /// Returns the segment size
+            /**
+                The function returns the size of the first segment but not more than
+                the bucket count of dummy node slab, see \p split_list::traits::dummy_node_slab
+            */
+            size_t segment_size() const
+            {
+                size_t const nSize = m_Segments.first_segment_size();
+                if ( nSize < c_nSlabSize )
+                    return nSize;
+                return c_nSlabSize;
+            }
         };
 
         /// Split-list node traits
@@ -642,30 +977,26 @@ namespace cds { namespace intrusive {
 
         //@cond
         namespace details {
-            template <bool Value, typename GC, typename Node, typename... Options>
-            struct bucket_table_selector;
+            template <bool Dynamic, bool Unbounded, typename GC, typename Node, typename... Options>
+            struct bucket_table_selector
+            {
+                typedef unlimited_bucket_table<GC, Node, Options...>    type;
+            };
 
             template <typename GC, typename Node, typename... Options>
-            struct bucket_table_selector< true, GC, Node, Options...>
+            struct bucket_table_selector< true, false, GC, Node, Options...>
             {
                 typedef expandable_bucket_table<GC, Node, Options...>    type;
             };
 
             template <typename GC, typename Node, typename... Options>
-            struct bucket_table_selector< false, GC, Node, Options...>
+            struct bucket_table_selector< false, false, GC, Node, Options...>
             {
                 typedef static_bucket_table<GC, Node, Options...>    type;
             };
 
-            template <typename GC, class Alloc >
-            struct dummy_node_disposer {
-                template <typename Node>
-                void operator()( Node * p )
-                {
-                    typedef cds::details::Allocator< Node, Alloc >  node_deallocator;
-                    node_deallocator().Delete( p );
-                }
-            };
+            template <typename Node, class Alloc, bool Slab>
+            class dummy_node_pool;
 
             template <typename Q>
             struct search_value_type
@@ -736,7 +1067,7 @@ namespace cds { namespace intrusive {
                     {
                         splitlist_node_type * p = static_cast<splitlist_node_type *>( node_traits::to_node_ptr( v ));
                         if ( p->is_dummy() )
-                            dummy_node_disposer<gc, typename traits::allocator>()( p );
+                            dummy_node_pool<splitlist_node_type, typename traits::allocator, traits::dummy_node_slab>::dispose( p );
                         else
                             native_disposer()( v );
                     }
@@ -897,6 +1228,171 @@ namespace cds { namespace intrusive {
         {
             return reverse_bits( nHash ) & ~size_t(1);
         }
+
+        namespace details {
+
+            // Each dummy node is allocated separately
+            template <typename Node, class Alloc>
+            class dummy_node_pool< Node, Alloc, false >
+            {
+                typedef cds::details::Allocator< Node, Alloc >  node_allocator;
+
+            public:
+                dummy_node_pool( size_t /*nCapacity*/, size_t /*nSegmentSize*/ )
+                {}
+
+                // Returns a dummy node for bucket nBucket
+                Node * alloc( size_t nBucket )
+                {
+                    return node_allocator().New( dummy_hash( nBucket ));
+                }
+
+                // Frees the node that has not been linked into the list
+                void free( Node * p )
+                {
+                    node_allocator().Delete( p );
+                }
+
+                // Disposes the node removed from the list
+                static void dispose( Node * p )
+                {
+                    node_allocator().Delete( p );
+                }
+            };
+
+            // Dummy nodes are placed in slabs, one slab per bucket table segment.
+            // The slab is reference counted: the pool holds one reference and each node linked into the list
+            // holds one more, so the slab lives until the last of its nodes is disposed by GC,
+            // which may happen after the set has been destroyed.
+            template <typename Node, class Alloc>
+            class dummy_node_pool< Node, Alloc, true >
+            {
+                class slab;
+
+                struct slab_node: public Node
+                {
+                    slab *                  m_pSlab;
+                    atomics::atomic<bool>   m_bUsed;
+
+                    slab_node()
+                        : m_pSlab( nullptr )
+                        , m_bUsed( false )
+                    {}
+                };
+
+                typedef cds::details::Allocator< slab_node, Alloc > node_allocator;
+                typedef cds::details::Allocator< slab, Alloc >      slab_allocator;
+
+                class slab
+                {
+                    atomics::atomic<size_t> m_nRefCount;
+                    size_t const            m_nSize;
+                    slab_node *             m_arrNode;
+
+                public:
+                    slab( size_t nFirstBucket, size_t nSize )
+                        : m_nRefCount( 1 )
+                        , m_nSize( nSize )
+                        , m_arrNode( node_allocator().NewArray( nSize ))
+                    {
+                        for ( size_t i = 0; i < nSize; ++i ) {
+                            m_arrNode[i].m_nHash = dummy_hash( nFirstBucket + i );
+                            m_arrNode[i].m_pSlab = this;
+                        }
+                    }
+
+                    ~slab()
+                    {
+                        node_allocator().Delete( m_arrNode, m_nSize );
+                    }
+
+                    slab_node * node( size_t nIdx )
+                    {
+                        assert( nIdx < m_nSize );
+                        return m_arrNode + nIdx;
+                    }
+
+                    void acquire()
+                    {
+                        m_nRefCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    }
+
+                    void release()
+                    {
+                        if ( m_nRefCount.fetch_sub( 1, atomics::memory_order_acq_rel ) == 1 )
+                            slab_allocator().Delete( this );
+                    }
+                };
+
+                struct slab_releaser
+                {
+                    void operator()( slab * p ) const
+                    {
+                        p->release();
+                    }
+                };
+
+                size_t const    m_nSlabSize;
+                size_t const    m_nSlabCount;
+                doubling_segment_array< slab, Alloc > m_Slabs; // slab table grows with the bucket table
+
+            public:
+                dummy_node_pool( size_t nCapacity, size_t nSegmentSize )
+                    : m_nSlabSize( nSegmentSize )
+                    , m_nSlabCount( nCapacity / nSegmentSize + ( nCapacity % nSegmentSize ? 1 : 0 ))
+                    , m_Slabs( 1 )
+                {
+                    assert( cds::beans::is_power2( nSegmentSize ));
+                }
+
+                ~dummy_node_pool()
+                {
+                    m_Slabs.for_each( slab_releaser());
+                }
+
+                // Returns a dummy node for bucket nBucket,
+                // or nullptr if the node is already used by another thread initializing the same bucket
+                Node * alloc( size_t nBucket )
+                {
+                    slab * pSlab = get_slab( nBucket / m_nSlabSize );
+                    slab_node * p = pSlab->node( nBucket & ( m_nSlabSize - 1 ));
+                    if ( p->m_bUsed.exchange( true, atomics::memory_order_acquire ))
+                        return nullptr;
+                    pSlab->acquire();
+                    return p;
+                }
+
+                // Returns the node that has not been linked into the list
+                void free( Node * p )
+                {
+                    slab_node * pNode = static_cast<slab_node *>( p );
+                    pNode->m_bUsed.store( false, atomics::memory_order_release );
+                    pNode->m_pSlab->release();
+                }
+
+                // Disposes the node removed from the list
+                static void dispose( Node * p )
+                {
+                    static_cast<slab_node *>( p )->m_pSlab->release();
+                }
+
+            private:
+                slab * get_slab( size_t nSlab )
+                {
+                    assert( nSlab < m_nSlabCount );
+                    atomics::atomic<slab *>& entry = m_Slabs.at( nSlab );
+                    slab * p = entry.load( atomics::memory_order_acquire );
+                    if ( p == nullptr ) {
+                        slab * pNew = slab_allocator().New( nSlab * m_nSlabSize, m_nSlabSize );
+                        if ( entry.compare_exchange_strong( p, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                            p = pNew;
+                        else
+                            slab_allocator().Delete( pNew );
+                    }
+                    return p;
+                }
+            };
+        } // namespace details
         //@endcond
 
     } // namespace split_list
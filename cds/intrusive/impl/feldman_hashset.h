@@ -37,6 +37,7 @@
 
 #include <cds/intrusive/details/feldman_hashset_base.h>
 #include <cds/details/allocator.h>
+#include <cds/details/batch_apply.h>
 
 namespace cds { namespace intrusive {
     /// Intrusive hash set based on multi-level array
@@ -922,6 +923,40 @@ namespace cds { namespace intrusive {
             base_class::get_level_statistics( stat );
         }
 
+        /// Collects memory usage statistics of array nodes into \p stat
+        /** @anchor cds_intrusive_FeldmanHashSet_hp_get_memory_statistics
+            The function traverses the set and computes the count and the size of array nodes,
+            the number of data, array and empty cells, and the memory that can be reclaimed by \p compact().
+            The memory of data nodes is not taken into account.
+            The function is thread-safe and may be called in multi-threaded environment,
+            the result is approximate if other threads modify the set.
+        */
+        void get_memory_statistics( feldman_hashset::memory_statistics& stat ) const
+        {
+            base_class::get_memory_statistics( stat );
+        }
+
+        /// Compacts the tree (not thread safe)
+        /** @anchor cds_intrusive_FeldmanHashSet_hp_compact
+            An array node is never freed while the set is in use: data nodes are erased,
+            but the array nodes created for them remain in the tree. After many erasures
+            the tree may contain a lot of mostly empty array nodes.
+
+            The function collapses each subtree that contains at most one data node:
+            the data node (if any) is moved to the parent cell and the array nodes of the subtree are freed.
+            The data nodes are not copied and not disposed, the head node is never freed.
+            Use \p get_memory_statistics() to estimate the memory that can be reclaimed.
+
+            Returns the number of freed array nodes.
+
+            This function is not thread safe and may be called only when no other thread deals with the set.
+            All iterators are invalidated.
+        */
+        size_t compact()
+        {
+            return base_class::compact();
+        }
+
     public:
     ///@name Thread-safe iterators
         /** @anchor cds_intrusive_FeldmanHashSet_iterators
@@ -1087,6 +1122,23 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
+        // Count of items processed together by batch operations
+        static CDS_CONSTEXPR size_t const c_nBatchSize = cds::details::c_nBatchSize;
+
+        // Calls op( item ) for each of nCount items.
+        // The items are processed in groups of c_nBatchSize items: for each group the head array cells
+        // are prefetched, then the cells of the second level, and then op is called for each item of the group.
+        // get_hash( item ) returns the hash of the item
+        template <typename Q, typename GetHash, typename Func>
+        size_t batch_apply( Q const* pItems, size_t nCount, bool * pResult, GetHash get_hash, Func op )
+        {
+            return cds::details::batch_apply<c_nBatchSize>( pItems, nCount, pResult,
+                [&get_hash]( Q const& item ) -> hash_type { return get_hash( item ); },
+                [this]( hash_type const& hash ) { base_class::prefetch( hash, 1 ); },
+                [this]( hash_type const& hash ) { base_class::prefetch( hash, 2 ); },
+                [&op]( hash_type const&, Q const& item ) -> bool { return op( item ); });
+        }
+
         value_type * search( hash_type const& hash, typename gc::Guard& guard )
         {
             traverse_data pos( hash, *this );
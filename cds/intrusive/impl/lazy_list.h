@@ -900,6 +900,55 @@ namespace cds { namespace intrusive {
             return m_ItemCounter.value();
         }
 
+        //@cond
+        // MichaelHashSet expandable bucket table support
+        // Moves all items of the list to the tail of \p lo or \p hi preserving the order;
+        // the item goes to \p hi if pred( item ) is \p true.
+        // The caller must guarantee exclusive access to all three lists.
+        // Returns the number of items moved
+        template <typename Predicate>
+        size_t split_to( LazyList& lo, LazyList& hi, Predicate pred )
+        {
+            node_type * pLoLast = &lo.m_Head;
+            node_type * pHiLast = &hi.m_Head;
+            while ( pLoLast->m_pNext.load( memory_model::memory_order_relaxed ).ptr() != &lo.m_Tail )
+                pLoLast = pLoLast->m_pNext.load( memory_model::memory_order_relaxed ).ptr();
+            while ( pHiLast->m_pNext.load( memory_model::memory_order_relaxed ).ptr() != &hi.m_Tail )
+                pHiLast = pHiLast->m_pNext.load( memory_model::memory_order_relaxed ).ptr();
+
+            size_t nCount = 0;
+            node_type * pNode = m_Head.m_pNext.load( memory_model::memory_order_acquire ).ptr();
+            m_Head.m_pNext.store( marked_node_ptr( &m_Tail ), memory_model::memory_order_relaxed );
+            while ( pNode != &m_Tail ) {
+                // Deleted nodes are unlinked under the lock, so the list cannot contain marked nodes here
+                assert( !pNode->is_marked());
+                node_type * pNext = pNode->m_pNext.load( memory_model::memory_order_acquire ).ptr();
+                if ( pred( *node_traits::to_value_ptr( pNode ))) {
+                    pNode->m_pNext.store( marked_node_ptr( &hi.m_Tail ), memory_model::memory_order_relaxed );
+                    pHiLast->m_pNext.store( marked_node_ptr( pNode ), memory_model::memory_order_release );
+                    pHiLast = pNode;
+                    ++hi.m_ItemCounter;
+                }
+                else {
+                    pNode->m_pNext.store( marked_node_ptr( &lo.m_Tail ), memory_model::memory_order_relaxed );
+                    pLoLast->m_pNext.store( marked_node_ptr( pNode ), memory_model::memory_order_release );
+                    pLoLast = pNode;
+                    ++lo.m_ItemCounter;
+                }
+                --m_ItemCounter;
+                ++nCount;
+                pNode = pNext;
+            }
+            return nCount;
+        }
+
+        // Hash set batch operation support: prefetches the first node of the list
+        void prefetch() const
+        {
+            CDS_PREFETCH( m_Head.m_pNext.load( memory_model::memory_order_relaxed ).ptr());
+        }
+        //@endcond
+
     protected:
         //@cond
         // split-list support
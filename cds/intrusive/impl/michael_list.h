@@ -913,6 +913,58 @@ namespace cds { namespace intrusive {
             return m_ItemCounter.value();
         }
 
+        //@cond
+        // MichaelHashSet expandable bucket table support
+        // Moves all items of the list to the tail of \p lo or \p hi preserving the order;
+        // the item goes to \p hi if pred( item ) is \p true.
+        // The caller must guarantee exclusive access to all three lists.
+        // Returns the number of items moved
+        template <typename Predicate>
+        size_t split_to( MichaelList& lo, MichaelList& hi, Predicate pred )
+        {
+            atomic_node_ptr * pLoTail = &lo.m_pHead;
+            atomic_node_ptr * pHiTail = &hi.m_pHead;
+            while ( pLoTail->load( memory_model::memory_order_relaxed ).ptr())
+                pLoTail = &pLoTail->load( memory_model::memory_order_relaxed ).ptr()->m_pNext;
+            while ( pHiTail->load( memory_model::memory_order_relaxed ).ptr())
+                pHiTail = &pHiTail->load( memory_model::memory_order_relaxed ).ptr()->m_pNext;
+
+            size_t nCount = 0;
+            node_type * pNode = m_pHead.load( memory_model::memory_order_acquire ).ptr();
+            m_pHead.store( marked_node_ptr(), memory_model::memory_order_relaxed );
+            while ( pNode ) {
+                marked_node_ptr next = pNode->m_pNext.load( memory_model::memory_order_acquire );
+                if ( next.bits()) {
+                    // The node is logically deleted but not unlinked yet
+                    retire_node( pNode );
+                }
+                else {
+                    pNode->m_pNext.store( marked_node_ptr(), memory_model::memory_order_relaxed );
+                    if ( pred( *node_traits::to_value_ptr( *pNode ))) {
+                        pHiTail->store( marked_node_ptr( pNode ), memory_model::memory_order_release );
+                        pHiTail = &pNode->m_pNext;
+                        ++hi.m_ItemCounter;
+                    }
+                    else {
+                        pLoTail->store( marked_node_ptr( pNode ), memory_model::memory_order_release );
+                        pLoTail = &pNode->m_pNext;
+                        ++lo.m_ItemCounter;
+                    }
+                    --m_ItemCounter;
+                    ++nCount;
+                }
+                pNode = next.ptr();
+            }
+            return nCount;
+        }
+
+        // Hash set batch operation support: prefetches the first node of the list
+        void prefetch() const
+        {
+            CDS_PREFETCH( m_pHead.load( memory_model::memory_order_relaxed ).ptr());
+        }
+        //@endcond
+
     protected:
         //@cond
         // split-list support
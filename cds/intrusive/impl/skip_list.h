@@ -847,6 +847,79 @@ namespace cds { namespace intrusive {
             return find_with_( val, cmp, [&guard](value_type& found, Q const& ) { guard.set(&found); } );
         }
 
+        // Turns "greater or equal" position search into "strictly greater" one
+        template <typename Compare>
+        struct upper_bound_comparator
+        {
+            Compare m_cmp;
+
+            template <typename Q>
+            int operator()( value_type const& v, Q const& key ) const
+            {
+                return m_cmp( v, key ) <= 0 ? -1 : 1;
+            }
+        };
+
+        template <typename Q, typename Compare>
+        bool lower_bound_( typename guarded_ptr::native_guard& guard, Q const& val, Compare cmp )
+        {
+            position pos;
+            find_position( val, pos, cmp, false );
+
+            // pos.pSucc[0] is guarded by pos.guards[1]
+            if ( pos.pSucc[0] ) {
+                guard.set( node_traits::to_value_ptr( pos.pSucc[0] ));
+                return true;
+            }
+            return false;
+        }
+
+        template <typename Q, typename Compare>
+        bool upper_bound_( typename guarded_ptr::native_guard& guard, Q const& val, Compare cmp )
+        {
+            return lower_bound_( guard, val, upper_bound_comparator<Compare>{ cmp } );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t for_each_in_range_( Q const& lo, Q const& hi, Compare cmp, Func f )
+        {
+            // Two alternating guards: one for the current node, one for its successor
+            typename gc::template GuardArray<2> guards;
+            unsigned int nIdx = 0;
+            size_t nCount = 0;
+
+            position pos;
+            find_position( lo, pos, cmp, false );
+            node_type * pCur = pos.pSucc[0];
+            guards.assign( nIdx, node_traits::to_value_ptr( pCur ));
+
+            while ( pCur ) {
+                value_type& val = *node_traits::to_value_ptr( pCur );
+                if ( cmp( val, hi ) > 0 )
+                    break;
+
+                marked_node_ptr pNext = guards.protect( nIdx ^ 1, pCur->next( 0 ), gc_protect );
+                if ( pNext.bits() ) {
+                    // pCur has been deleted while we were here - its level 0 link is frozen
+                    // and may lead out of the list. Seek to the first node greater than pCur.
+                    m_Stat.onRangeScanReseek();
+                    find_position( val, pos, upper_bound_comparator<key_comparator>{ key_comparator() }, false );
+                    pCur = pos.pSucc[0];
+                    guards.assign( nIdx, node_traits::to_value_ptr( pCur ));
+                    continue;
+                }
+
+                f( val );
+                ++nCount;
+
+                pCur = pNext.ptr();
+                nIdx ^= 1;
+            }
+
+            m_Stat.onRangeScan();
+            return nCount;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool erase_( Q const& val, Compare cmp, Func f )
         {
@@ -1584,6 +1657,102 @@ namespace cds { namespace intrusive {
             return gp;
         }
 
+        /// Finds the first item that is not less than \p key
+        /** \anchor cds_intrusive_SkipListSet_hp_lower_bound
+            The function returns the guarded pointer to the first item whose key is greater than or equal to \p key.
+            If there is no such item the function returns an empty guarded pointer.
+
+            The item returned is protected by GC's guard and cannot be freed while \p guarded_ptr object is alive,
+            but it may be deleted from the set concurrently.
+        */
+        template <typename Q>
+        guarded_ptr lower_bound( Q const& key )
+        {
+            guarded_ptr gp;
+            lower_bound_( gp.guard(), key, key_comparator() );
+            return gp;
+        }
+
+        /// Finds the first item that is not less than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_lower_bound "lower_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        guarded_ptr lower_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            guarded_ptr gp;
+            lower_bound_( gp.guard(), key, cds::opt::details::make_comparator_from_less<Less>() );
+            return gp;
+        }
+
+        /// Finds the first item that is greater than \p key
+        /** \anchor cds_intrusive_SkipListSet_hp_upper_bound
+            The function returns the guarded pointer to the first item whose key is strictly greater than \p key.
+            If there is no such item the function returns an empty guarded pointer.
+        */
+        template <typename Q>
+        guarded_ptr upper_bound( Q const& key )
+        {
+            guarded_ptr gp;
+            upper_bound_( gp.guard(), key, key_comparator() );
+            return gp;
+        }
+
+        /// Finds the first item that is greater than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_upper_bound "upper_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        guarded_ptr upper_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            guarded_ptr gp;
+            upper_bound_( gp.guard(), key, cds::opt::details::make_comparator_from_less<Less>() );
+            return gp;
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt>
+        /** \anchor cds_intrusive_SkipListSet_hp_for_each_in_range
+            The function seeks to the first item not less than \p lo and then walks level 0 of the skip-list
+            calling \p f for each item until the key becomes greater than \p hi.
+            The functor signature is:
+            \code
+            void f( value_type& item );
+            \endcode
+            Both the current item and its successor are protected by GC's guards while \p f is called,
+            so the functor may safely read \p item but it should not call functions of the set
+            since all the guards of the current thread may be in use.
+
+            The scan is weakly consistent: each item that is in the set during the entire scan is visited exactly once,
+            in ascending key order; items inserted or deleted concurrently may or may not be visited.
+            If the current item is deleted concurrently the scan re-seeks to its successor from the head tower.
+
+            The function returns the count of visited items.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            return for_each_in_range_( lo, hi, key_comparator(), f );
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt> using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return for_each_in_range_( lo, hi, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
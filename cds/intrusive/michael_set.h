@@ -45,9 +45,15 @@ namespace cds { namespace intrusive {
 
         Michael's hash table algorithm is based on lock-free ordered list and it is very simple.
         The main structure is an array \p T of size \p M. Each element in \p T is basically a pointer
-        to a hash bucket, implemented as a singly linked list. The array of buckets cannot be dynamically expanded.
+        to a hash bucket, implemented as a singly linked list. By default, the array of buckets cannot be dynamically expanded.
         However, each bucket may contain unbounded number of items.
 
+        If \p michael_set::traits::dynamic_bucket_table is \p true the bucket table is expanded online:
+        when the item count exceeds <tt>bucket_count() * nLoadFactor</tt> the new table of double size is allocated,
+        and the buckets are migrated to it one by one by the threads performing the set operations.
+        The migration of a bucket blocks the operations on that bucket only; the progress of the migration
+        can be watched by \p michael_set::stat statistics.
+
         Template parameters are:
         - \p GC - Garbage collector used. Note the \p GC must be the same as the GC used for \p OrderedList
         - \p OrderedList - ordered list implementation used as bucket for hash set, for example, \p MichaelList, \p LazyList.
@@ -264,15 +270,17 @@ namespace cds { namespace intrusive {
         /// Bucket table allocator
         typedef cds::details::Allocator< bucket_type, typename traits::allocator > bucket_table_allocator;
 
+        //@cond
+        typedef typename michael_set::details::bucket_table_selector< bucket_type, traits, hash >::type bucket_table;
+        //@endcond
+
+        /// Internal statistics of expandable bucket table, see \p michael_set::traits::stat
+        typedef typename bucket_table::stat stat;
+
     protected:
         item_counter    m_ItemCounter;   ///< Item counter
         hash            m_HashFunctor;   ///< Hash functor
-        bucket_type *   m_Buckets;      ///< bucket table
-
-    private:
-        //@cond
-        const size_t    m_nHashBitmask;
-        //@endcond
+        bucket_table    m_Buckets;       ///< bucket table
 
     protected:
         //@cond
@@ -280,14 +288,17 @@ namespace cds { namespace intrusive {
         template <typename Q>
         size_t hash_value( const Q& key ) const
         {
-            return m_HashFunctor( key ) & m_nHashBitmask;
+            return m_HashFunctor( key );
         }
 
         /// Returns the bucket (ordered list) for \p key
+        /**
+            The bucket cannot be migrated while the returned object is alive
+        */
         template <typename Q>
-        bucket_type&    bucket( const Q& key )
+        typename bucket_table::bucket_ref bucket( const Q& key )
         {
-            return m_Buckets[ hash_value( key ) ];
+            return m_Buckets.bucket( hash_value( key ));
         }
         //@endcond
 
@@ -300,6 +311,9 @@ namespace cds { namespace intrusive {
             - The iterator cannot be moved across thread boundary since it may contain GC's guard that is thread-private GC data.
             - Iterator ensures thread-safety even if you delete the item that iterator points to. However, in case of concurrent
               deleting operations it is no guarantee that you iterate all item in the set.
+            - For expandable bucket table \p begin() and \p end() complete the pending migration of the table first,
+              so the items of not yet migrated buckets are visited too. The iterator does not prevent
+              the table from growing; concurrent inserts can start new migration, and the items moved by it may be skipped.
 
             Therefore, the use of iterators in concurrent environment is not good idea. Use the iterator for the concurrent container
             for debug purpose only.
@@ -318,7 +332,8 @@ namespace cds { namespace intrusive {
         */
         iterator begin()
         {
-            return iterator( m_Buckets[0].begin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() );
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a set
@@ -329,7 +344,8 @@ namespace cds { namespace intrusive {
         */
         iterator end()
         {
-            return iterator( m_Buckets[bucket_count() - 1].end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type * pBuckets = m_Buckets.buckets();
+            return iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
 
         /// Returns a forward const iterator addressing the first element in a set
@@ -360,11 +376,13 @@ namespace cds { namespace intrusive {
         //@cond
         const_iterator get_const_begin() const
         {
-            return const_iterator( m_Buckets[0].cbegin(), m_Buckets, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[0].cbegin(), pBuckets, pBuckets + bucket_count() );
         }
         const_iterator get_const_end() const
         {
-            return const_iterator( m_Buckets[bucket_count() - 1].cend(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() );
+            bucket_type const * pBuckets = m_Buckets.buckets();
+            return const_iterator( pBuckets[bucket_count() - 1].cend(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() );
         }
         //@endcond
 
@@ -376,11 +394,12 @@ namespace cds { namespace intrusive {
             The load factor is average size of one bucket - a small number between 1 and 10.
             The bucket is an ordered single-linked list, searching in the bucket has linear complexity <tt>O(nLoadFactor)</tt>.
             The constructor defines hash table size as rounding <tt>nMaxItemCount / nLoadFactor</tt> up to nearest power of two.
+            For expandable bucket table it is the initial size of the table.
         */
         MichaelHashSet(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash set
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket. Small integer up to 10.
-        ) : m_nHashBitmask( michael_set::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+        ) : m_Buckets( nMaxItemCount, nLoadFactor )
         {
             // GC and OrderedList::gc must be the same
             static_assert( std::is_same<gc, typename bucket_type::gc>::value, "GC and OrderedList::gc must be the same");
@@ -388,15 +407,12 @@ namespace cds { namespace intrusive {
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert( !std::is_same<item_counter, atomicity::empty_item_counter>::value,
                            "cds::atomicity::empty_item_counter is not allowed as a item counter");
-
-            m_Buckets = bucket_table_allocator().NewArray( bucket_count() );
         }
 
         /// Clears hash set object and destroys it
         ~MichaelHashSet()
         {
             clear();
-            bucket_table_allocator().Delete( m_Buckets, bucket_count() );
         }
 
         /// Inserts new node
@@ -408,9 +424,11 @@ namespace cds { namespace intrusive {
         */
         bool insert( value_type& val )
         {
-            bool bRet = bucket( val ).insert( val );
-            if ( bRet )
+            bool bRet = bucket( val )->insert( val );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -438,9 +456,11 @@ namespace cds { namespace intrusive {
         template <typename Func>
         bool insert( value_type& val, Func f )
         {
-            bool bRet = bucket( val ).insert( val, f );
-            if ( bRet )
+            bool bRet = bucket( val )->insert( val, f );
+            if ( bRet ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
 
@@ -476,9 +496,11 @@ namespace cds { namespace intrusive {
         template <typename Func>
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> bRet = bucket( val ).update( val, func, bAllowInsert );
-            if ( bRet.second )
+            std::pair<bool, bool> bRet = bucket( val )->update( val, func, bAllowInsert );
+            if ( bRet.second ) {
                 ++m_ItemCounter;
+                m_Buckets.check_load( size());
+            }
             return bRet;
         }
         //@cond
@@ -499,7 +521,7 @@ namespace cds { namespace intrusive {
         */
         bool unlink( value_type& val )
         {
-            bool bRet = bucket( val ).unlink( val );
+            bool bRet = bucket( val )->unlink( val );
             if ( bRet )
                 --m_ItemCounter;
             return bRet;
@@ -516,7 +538,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         bool erase( Q const& key )
         {
-            if ( bucket( key ).erase( key )) {
+            if ( bucket( key )->erase( key )) {
                 --m_ItemCounter;
                 return true;
             }
@@ -533,7 +555,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less>
         bool erase_with( Q const& key, Less pred )
         {
-            if ( bucket( key ).erase_with( key, pred )) {
+            if ( bucket( key )->erase_with( key, pred )) {
                 --m_ItemCounter;
                 return true;
             }
@@ -561,7 +583,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Func>
         bool erase( const Q& key, Func f )
         {
-            if ( bucket( key ).erase( key, f )) {
+            if ( bucket( key )->erase( key, f )) {
                 --m_ItemCounter;
                 return true;
             }
@@ -578,7 +600,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less, typename Func>
         bool erase_with( const Q& key, Less pred, Func f )
         {
-            if ( bucket( key ).erase_with( key, pred, f )) {
+            if ( bucket( key )->erase_with( key, pred, f )) {
                 --m_ItemCounter;
                 return true;
             }
@@ -615,7 +637,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         guarded_ptr extract( Q const& key )
         {
-            guarded_ptr gp = bucket( key ).extract( key );
+            guarded_ptr gp = bucket( key )->extract( key );
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -633,7 +655,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less>
         guarded_ptr extract_with( Q const& key, Less pred )
         {
-            guarded_ptr gp = bucket( key ).extract_with( key, pred );
+            guarded_ptr gp = bucket( key )->extract_with( key, pred );
             if ( gp )
                 --m_ItemCounter;
             return gp;
@@ -666,13 +688,13 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Func>
         bool find( Q& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return bucket( key )->find( key, f );
         }
         //@cond
         template <typename Q, typename Func>
         bool find( Q const& key, Func f )
         {
-            return bucket( key ).find( key, f );
+            return bucket( key )->find( key, f );
         }
         //@endcond
 
@@ -686,13 +708,13 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less, typename Func>
         bool find_with( Q& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return bucket( key )->find_with( key, pred, f );
         }
         //@cond
         template <typename Q, typename Less, typename Func>
         bool find_with( Q const& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f );
+            return bucket( key )->find_with( key, pred, f );
         }
         //@endcond
 
@@ -708,7 +730,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return bucket( key ).contains( key );
+            return bucket( key )->contains( key );
         }
         //@cond
         template <typename Q>
@@ -728,7 +750,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less>
         bool contains( Q const& key, Less pred )
         {
-            return bucket( key ).contains( key, pred );
+            return bucket( key )->contains( key, pred );
         }
         //@cond
         template <typename Q, typename Less>
@@ -768,7 +790,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         guarded_ptr get( Q const& key )
         {
-            return bucket( key ).get( key );
+            return bucket( key )->get( key );
         }
 
         /// Finds the key \p key and return the item found
@@ -783,7 +805,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less>
         guarded_ptr get_with( Q const& key, Less pred )
         {
-            return bucket( key ).get_with( key, pred );
+            return bucket( key )->get_with( key, pred );
         }
 
         /// Clears the set (non-atomic)
@@ -798,8 +820,7 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
-            for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear();
+            m_Buckets.clear();
             m_ItemCounter.reset();
         }
 
@@ -821,13 +842,20 @@ namespace cds { namespace intrusive {
 
         /// Returns the size of hash table
         /**
-            Since \p %MichaelHashSet cannot dynamically extend the hash table size,
-            the value returned is an constant depending on object initialization parameters,
+            For fixed bucket table the value returned is an constant depending on object initialization parameters,
             see \p MichaelHashSet::MichaelHashSet.
+            For expandable bucket table (see \p michael_set::traits::dynamic_bucket_table)
+            the function returns the size of the newest table.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1;
+            return m_Buckets.bucket_count();
+        }
+
+        /// Returns const reference to internal statistics of expandable bucket table
+        stat const& statistics() const
+        {
+            return m_Buckets.statistics();
         }
     };
 
@@ -122,6 +122,7 @@ namespace cds { namespace intrusive {
         typedef typename base_class::gc         gc;
         typedef typename base_class::node_traits node_traits;
         typedef typename base_class::memory_model   memory_model;
+        typedef typename base_class::link_checker   link_checker;
         //@endcond
 
         /// Rebind template arguments
@@ -167,6 +168,57 @@ namespace cds { namespace intrusive {
             res.pNext = pNext;
             return true;
         }
+
+        // do_dequeue() tests the tail only after the head has been moved.
+        // It is safe only if the tail lags behind the last node by one node at most,
+        // so each node is linked to the queue and the tail is advanced to it before the next node is linked.
+        // The item counter is not changed
+        void do_enqueue_node( node_type * pNew, typename gc::Guard& guard )
+        {
+            back_off bkoff;
+
+            node_type * t;
+            while ( true ) {
+                t = guard.protect( base_class::m_pTail, []( node_type * p ) -> value_type * { return node_traits::to_value_ptr( p );});
+
+                node_type * pNext = t->m_pNext.load(memory_model::memory_order_acquire);
+                if ( pNext != nullptr ) {
+                    // Tail is misplaced, advance it
+                    base_class::m_pTail.compare_exchange_weak( t, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                    base_class::m_Stat.onBadTail();
+                    continue;
+                }
+
+                node_type * tmp = nullptr;
+                if ( t->m_pNext.compare_exchange_strong( tmp, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                    break;
+
+                base_class::m_Stat.onEnqueueRace();
+                bkoff();
+            }
+
+            if ( !base_class::m_pTail.compare_exchange_strong( t, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                base_class::m_Stat.onAdvanceTailFailed();
+        }
+
+        // Hides MSQueue::do_enqueue_chain(): appending the whole chain by one CAS
+        // would make the tail lag behind by the length of the chain, see do_enqueue_node()
+        void do_enqueue_chain( node_type * pFirst, node_type * pLast, size_t nCount )
+        {
+            assert( pFirst != nullptr );
+            assert( pLast != nullptr );
+            CDS_UNUSED( pLast );
+
+            typename gc::Guard guard;
+            for ( node_type * pNode = pFirst; pNode; ) {
+                node_type * pNext = pNode->m_pNext.load( atomics::memory_order_relaxed );
+                base_class::clear_links( pNode );
+                do_enqueue_node( pNode, guard );
+                pNode = pNext;
+            }
+            base_class::m_ItemCounter += nCount;
+            base_class::m_Stat.onEnqueueBulk( nCount );
+        }
         //@endcond
 
     public:
@@ -184,6 +236,52 @@ namespace cds { namespace intrusive {
             return nullptr;
         }
 
+        /// Enqueues the items of range <tt>[itFirst, itLast)</tt> into the queue
+        /**
+            Unlike \p MSQueue::enqueue_bulk(), the items are appended to the queue one by one:
+            Moir's \ref cds_intrusive_MoirQueue_dequeue "dequeue" tests \p Tail only after \p Head has been updated,
+            that is correct only if \p Tail lags behind the last node by one node at most.
+            Thus, the items of other producers can interleave with the items of the range.
+            The guard, the item counter and the statistics are updated once for the whole range.
+            Dereferencing of \p Iterator should return \p value_type&.
+
+            The function returns the number of items enqueued.
+        */
+        template <typename Iterator>
+        size_t enqueue_bulk( Iterator itFirst, Iterator itLast )
+        {
+            if ( itFirst == itLast )
+                return 0;
+
+            typename gc::Guard guard;
+            size_t nCount = 0;
+            for ( ; itFirst != itLast; ++itFirst, ++nCount ) {
+                node_type * pNew = node_traits::to_node_ptr( *itFirst );
+                link_checker::is_empty( pNew );
+                do_enqueue_node( pNew, guard );
+            }
+            base_class::m_ItemCounter += nCount;
+            base_class::m_Stat.onEnqueueBulk( nCount );
+            return nCount;
+        }
+
+        /// Dequeues up to \p nMax items from the queue
+        /**
+            See \p MSQueue::dequeue_bulk().
+        */
+        template <typename OutputIterator>
+        size_t dequeue_bulk( OutputIterator out, size_t nMax )
+        {
+            dequeue_result res;
+            size_t nCount = 0;
+            for ( ; nCount < nMax && do_dequeue( res ); ++nCount ) {
+                base_class::dispose_result( res );
+                *out = node_traits::to_value_ptr( *res.pNext );
+                ++out;
+            }
+            return nCount;
+        }
+
         /// Synonym for \ref cds_intrusive_MoirQueue_dequeue "dequeue" function
         value_type * pop()
         {
@@ -0,0 +1,526 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_INTRUSIVE_MPSC_QUEUE_H
+#define CDSLIB_INTRUSIVE_MPSC_QUEUE_H
+
+#include <cds/intrusive/details/single_link_struct.h>
+#include <cds/gc/nogc.h>
+
+namespace cds { namespace intrusive {
+
+    /// MPSCQueue related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace mpsc_queue {
+
+        /// Queue node
+        /**
+            The node does not depend on garbage collector: \p MPSCQueue does not need any GC.
+
+            Template parameters:
+            - Tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template <typename Tag = opt::none>
+        struct node
+        {
+            typedef Tag tag ;   ///< tag
+
+            typedef atomics::atomic< node * > atomic_node_ptr ; ///< atomic pointer
+
+            /// Rebind node for other template parameters
+            template <typename Tag2 = tag>
+            struct rebind {
+                typedef node<Tag2> other ;  ///< Rebinding result
+            };
+
+            atomic_node_ptr m_pNext ; ///< pointer to the next node in the queue
+
+            node() CDS_NOEXCEPT
+            {
+                m_pNext.store( nullptr, atomics::memory_order_release );
+            }
+        };
+
+        //@cond
+        struct default_hook {
+            typedef opt::none   tag;
+        };
+
+        template < typename HookType, typename... Options>
+        struct hook
+        {
+            typedef typename opt::make_options< default_hook, Options...>::type  options;
+            typedef typename options::tag   tag;
+            typedef node<tag>   node_type;
+            typedef HookType    hook_type;
+        };
+        //@endcond
+
+        /// Base hook
+        /**
+            \p Options are:
+            - opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template < typename... Options >
+        struct base_hook: public hook< opt::base_hook_tag, Options... >
+        {};
+
+        /// Member hook
+        /**
+            \p MemberOffset specifies offset in bytes of \ref node member into your structure.
+            Use \p offsetof macro to define \p MemberOffset
+
+            \p Options are:
+            - opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template < size_t MemberOffset, typename... Options >
+        struct member_hook: public hook< opt::member_hook_tag, Options... >
+        {
+            //@cond
+            static const size_t c_nMemberOffset = MemberOffset;
+            //@endcond
+        };
+
+        /// Traits hook
+        /**
+            \p NodeTraits defines type traits for node.
+            See \ref node_traits for \p NodeTraits interface description
+
+            \p Options are:
+            - opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template <typename NodeTraits, typename... Options >
+        struct traits_hook: public hook< opt::traits_hook_tag, Options... >
+        {
+            //@cond
+            typedef NodeTraits node_traits;
+            //@endcond
+        };
+
+        /// Queue internal statistics. May be used for debugging or profiling
+        /**
+            Template argument \p Counter defines type of counter.
+            Default is \p cds::atomicity::event_counter.
+        */
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter     counter_type;   ///< Counter type
+
+            counter_type m_EnqueueCount     ;  ///< Enqueue call count
+            counter_type m_DequeueCount     ;  ///< Count of success dequeue
+            counter_type m_EmptyDequeue     ;  ///< Count of dequeue from empty queue
+            counter_type m_DequeueRace      ;  ///< Count of dequeue failed because a producer has not yet linked its item
+            counter_type m_StubEnqueue      ;  ///< Count of enqueuing of the internal stub node by the consumer
+
+            /// Register enqueue call
+            void onEnqueue()        { ++m_EnqueueCount; }
+            /// Register dequeue call
+            void onDequeue()        { ++m_DequeueCount; }
+            /// Register dequeuing from empty queue
+            void onEmptyDequeue()   { ++m_EmptyDequeue; }
+            /// Register dequeue race event
+            void onDequeueRace()    { ++m_DequeueRace; }
+            /// Register enqueuing of the stub node
+            void onStubEnqueue()    { ++m_StubEnqueue; }
+
+            //@cond
+            void reset()
+            {
+                m_EnqueueCount.reset();
+                m_DequeueCount.reset();
+                m_EmptyDequeue.reset();
+                m_DequeueRace.reset();
+                m_StubEnqueue.reset();
+            }
+
+            stat& operator +=( stat const& s )
+            {
+                m_EnqueueCount += s.m_EnqueueCount.get();
+                m_DequeueCount += s.m_DequeueCount.get();
+                m_EmptyDequeue += s.m_EmptyDequeue.get();
+                m_DequeueRace += s.m_DequeueRace.get();
+                m_StubEnqueue += s.m_StubEnqueue.get();
+
+                return *this;
+            }
+            //@endcond
+        };
+
+        /// Dummy queue statistics - no counting is performed, no overhead. Support interface like \p mpsc_queue::stat
+        struct empty_stat
+        {
+            //@cond
+            void onEnqueue()        const {}
+            void onDequeue()        const {}
+            void onEmptyDequeue()   const {}
+            void onDequeueRace()    const {}
+            void onStubEnqueue()    const {}
+
+            void reset() {}
+            empty_stat& operator +=( empty_stat const& )
+            {
+                return *this;
+            }
+            //@endcond
+        };
+
+        /// MPSCQueue default traits
+        struct traits
+        {
+            /// Hook, possible types are \p mpsc_queue::base_hook, \p mpsc_queue::member_hook, \p mpsc_queue::traits_hook
+            typedef mpsc_queue::base_hook<>     hook;
+
+            /// The functor used for dispose removed items. Default is \p opt::v::empty_disposer. This option is used only in \p clear()
+            typedef opt::v::empty_disposer      disposer;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to enable item counting
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// Internal statistics (by default, disabled)
+            /**
+                Possible option value are: \p mpsc_queue::stat, \p mpsc_queue::empty_stat (the default),
+                user-provided class that supports \p %mpsc_queue::stat interface.
+            */
+            typedef mpsc_queue::empty_stat      stat;
+
+            /// C++ memory ordering model
+            /**
+                Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            */
+            typedef opt::v::relaxed_ordering    memory_model;
+
+            /// Link checking, see \p cds::opt::link_checker
+            static CDS_CONSTEXPR const opt::link_check_type link_checker = opt::debug_check_link;
+
+            /// Padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+        };
+
+        /// Metafunction converting option list to \p mpsc_queue::traits
+        /**
+            Supported \p Options are:
+
+            - \p opt::hook - hook used. Possible hooks are: \p mpsc_queue::base_hook, \p mpsc_queue::member_hook, \p mpsc_queue::traits_hook.
+                If the option is not specified, \p %mpsc_queue::base_hook<> is used.
+            - \p opt::disposer - the functor used for dispose removed items. Default is \p opt::v::empty_disposer.
+                This option is used only in \p clear() member function.
+            - \p opt::link_checker - the type of node's link fields checking. Default is \p opt::debug_check_link
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter (item counting disabled)
+                To enable item counting use \p cds::atomicity::item_counter
+            - \p opt::stat - the type to gather internal statistics.
+                Possible statistics types are: \p mpsc_queue::stat, \p mpsc_queue::empty_stat, user-provided class that supports \p %mpsc_queue::stat interface.
+                Default is \p %mpsc_queue::empty_stat (internal statistics disabled).
+            - \p opt::padding - padding for internal critical atomic data. Default is \p opt::cache_line_padding
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+
+            Example: declare \p %MPSCQueue with item counting and internal statistics
+            \code
+            typedef cds::intrusive::MPSCQueue< Foo,
+                typename cds::intrusive::mpsc_queue::make_traits<
+                    cds::opt::item_counter< cds::atomicity::item_counter >,
+                    cds::opt::stat< cds::intrusive::mpsc_queue::stat<> >
+                >::type
+            > myQueue;
+            \endcode
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+    } // namespace mpsc_queue
+
+    /// Vyukov's intrusive multi-producer/single-consumer queue
+    /** @ingroup cds_intrusive_queue
+        This unbounded node-based queue is developed by Dmitry Vyukov (see http://www.1024cores.net).
+        Any number of threads may enqueue items, but only one thread at a time may dequeue them.
+
+        The cost of enqueue is one atomic exchange on the queue tail and one store, without any loop.
+        The dequeue is wait-free and usually performs no atomic read-modify-write operations;
+        the exception is dequeuing the last item: the consumer re-inserts the internal stub node
+        by the same one-exchange enqueue as producers do. Since only the consumer
+        dereferences the nodes, no garbage collector is needed: the item dequeued is owned by the caller
+        immediately and may be freed or enqueued again.
+
+        The queue keeps an internal stub node that is enqueued by the consumer when the last item is being
+        dequeued, so the queue is never physically empty. Note that the enqueue is not linearizable:
+        if a producer has swapped the tail but has not yet linked its item, \p dequeue() returns \p nullptr
+        although the items enqueued after it may exist. The items are dequeued later when the producer completes.
+
+        Source:
+            - http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+
+        Template arguments:
+        - \p T - type of value to be stored in the queue. A value of type \p T must be derived from \p mpsc_queue::node for \p mpsc_queue::base_hook,
+            or it should have a member of type \p %mpsc_queue::node for \p mpsc_queue::member_hook,
+            or it should be convertible to \p %mpsc_queue::node for \p mpsc_queue::traits_hook.
+        - \p Traits - queue traits, default is \p mpsc_queue::traits. You can use \p mpsc_queue::make_traits
+            metafunction to make your traits or just derive your traits from \p %mpsc_queue::traits:
+            \code
+            struct myTraits: public cds::intrusive::mpsc_queue::traits {
+                typedef cds::intrusive::mpsc_queue::stat<> stat;
+            };
+            typedef cds::intrusive::MPSCQueue< Foo, myTraits > myQueue;
+
+            // Equivalent make_traits example:
+            typedef cds::intrusive::MPSCQueue< Foo,
+                typename cds::intrusive::mpsc_queue::make_traits<
+                    cds::opt::stat< cds::intrusive::mpsc_queue::stat<> >
+                >::type
+            > myQueue;
+            \endcode
+
+        \par License
+            Simplified BSD license by Dmitry Vyukov (http://www.1024cores.net/site/1024cores/home/code-license)
+    */
+    template <typename T, typename Traits = mpsc_queue::traits>
+    class MPSCQueue
+    {
+    public:
+        typedef T  value_type;  ///< type of value to be stored in the queue
+        typedef Traits traits;  ///< Queue traits
+
+        typedef typename traits::hook       hook;       ///< hook type
+        typedef typename hook::node_type    node_type;  ///< node type
+        typedef typename traits::disposer   disposer;   ///< disposer used
+        typedef typename get_node_traits< value_type, node_type, hook>::type node_traits;   ///< node traits
+        typedef typename single_link::link_checker_selector< cds::gc::nogc, node_type, traits::link_checker >::type link_checker;   ///< link checker
+
+        typedef typename traits::item_counter item_counter; ///< Item counter class
+        typedef typename traits::stat       stat;           ///< Internal statistics
+        typedef typename traits::memory_model memory_model; ///< Memory ordering. See \p cds::opt::memory_model option
+
+        /// Rebind template arguments
+        template <typename T2, typename Traits2>
+        struct rebind {
+            typedef MPSCQueue< T2, Traits2 > other;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        typedef typename node_type::atomic_node_ptr atomic_node_ptr;
+
+        atomic_node_ptr     m_pTail;        ///< Last enqueued node, changed by producers
+        typename opt::details::apply_padding< atomic_node_ptr, traits::padding >::padding_type pad1_;
+        atomic_node_ptr     m_pHead;        ///< Node to be dequeued, changed by the consumer only
+        typename opt::details::apply_padding< atomic_node_ptr, traits::padding >::padding_type pad2_;
+        node_type           m_Stub;         ///< stub node
+        typename opt::details::apply_padding< node_type, traits::padding >::padding_type pad3_;
+        item_counter        m_ItemCounter;  ///< Item counter
+        stat                m_Stat;         ///< Internal statistics
+        //@endcond
+
+    protected:
+        //@cond
+        void do_enqueue( node_type * pNode )
+        {
+            pNode->m_pNext.store( nullptr, memory_model::memory_order_relaxed );
+            node_type * pPrev = m_pTail.exchange( pNode, memory_model::memory_order_acq_rel );
+
+            // Between exchange and the store below the consumer cannot reach pNode
+            pPrev->m_pNext.store( pNode, memory_model::memory_order_release );
+        }
+
+        value_type * unlink_head( node_type * pHead, node_type * pNext )
+        {
+            m_pHead.store( pNext, memory_model::memory_order_relaxed );
+            pHead->m_pNext.store( nullptr, memory_model::memory_order_relaxed );
+
+            --m_ItemCounter;
+            m_Stat.onDequeue();
+            return node_traits::to_value_ptr( *pHead );
+        }
+        //@endcond
+
+    public:
+        /// Initializes empty queue
+        MPSCQueue()
+        {
+            m_pTail.store( &m_Stub, memory_model::memory_order_relaxed );
+            m_pHead.store( &m_Stub, memory_model::memory_order_relaxed );
+        }
+
+        /// Destructor clears the queue
+        /**
+            The disposer specified in \p Traits is called for each item in the queue.
+            The queue must not be used by any thread.
+        */
+        ~MPSCQueue()
+        {
+            clear();
+        }
+
+        /// Enqueues \p val value into the queue (any thread)
+        /** @anchor cds_intrusive_MPSCQueue_enqueue
+            The function always returns \p true.
+        */
+        bool enqueue( value_type& val )
+        {
+            node_type * pNew = node_traits::to_node_ptr( val );
+            link_checker::is_empty( pNew );
+
+            do_enqueue( pNew );
+
+            ++m_ItemCounter;
+            m_Stat.onEnqueue();
+            return true;
+        }
+
+        /// Synonym for \p enqueue() function
+        bool push( value_type& val )
+        {
+            return enqueue( val );
+        }
+
+        /// Dequeues an item from the queue (single consumer only)
+        /** @anchor cds_intrusive_MPSCQueue_dequeue
+            If the queue is empty the function returns \p nullptr.
+            \p Traits::disposer is not called: the item dequeued is owned by the caller
+            and may be freed or enqueued again immediately.
+
+            The function may return \p nullptr if a producer is in the middle of enqueuing,
+            see the class description.
+
+            The function is wait-free. If the item being dequeued is the last one,
+            the internal stub node is enqueued by one atomic exchange on the tail.
+        */
+        value_type * dequeue()
+        {
+            node_type * pHead = m_pHead.load( memory_model::memory_order_relaxed );
+            node_type * pNext = pHead->m_pNext.load( memory_model::memory_order_acquire );
+
+            if ( pHead == &m_Stub ) {
+                if ( pNext == nullptr ) {
+                    m_Stat.onEmptyDequeue();
+                    return nullptr;
+                }
+                // Skip the stub
+                m_pHead.store( pNext, memory_model::memory_order_relaxed );
+                pHead = pNext;
+                pNext = pNext->m_pNext.load( memory_model::memory_order_acquire );
+            }
+
+            if ( pNext )
+                return unlink_head( pHead, pNext );
+
+            // pHead is the last linked node
+            if ( pHead != m_pTail.load( memory_model::memory_order_acquire )) {
+                // A producer has swapped the tail but has not yet linked its node to pHead
+                m_Stat.onDequeueRace();
+                return nullptr;
+            }
+
+            // Enqueue the stub to be able to unlink the last item
+            do_enqueue( &m_Stub );
+            m_Stat.onStubEnqueue();
+
+            pNext = pHead->m_pNext.load( memory_model::memory_order_acquire );
+            if ( pNext )
+                return unlink_head( pHead, pNext );
+
+            // A producer has enqueued its node between our tail check and the stub enqueuing
+            m_Stat.onDequeueRace();
+            return nullptr;
+        }
+
+        /// Synonym for \p dequeue() function
+        value_type * pop()
+        {
+            return dequeue();
+        }
+
+        /// Checks if the queue is empty
+        bool empty() const
+        {
+            return m_pHead.load( memory_model::memory_order_acquire ) == &m_Stub
+                && m_pTail.load( memory_model::memory_order_acquire ) == &m_Stub;
+        }
+
+        /// Clears the queue (single consumer only)
+        /**
+            \p f parameter is a functor to dispose removed items.
+            The interface of \p Disposer is:
+            \code
+            struct myDisposer {
+                void operator ()( T * val );
+            };
+            \endcode
+            The disposer will be called immediately for each item.
+        */
+        template <typename Disposer>
+        void clear( Disposer f )
+        {
+            value_type * pv;
+            while ( (pv = dequeue()) != nullptr )
+                f( pv );
+        }
+
+        /// Clears the queue (single consumer only)
+        /**
+            This function uses the disposer that is specified in \p Traits.
+        */
+        void clear()
+        {
+            clear( disposer() );
+        }
+
+        /// Returns queue's item count
+        /**
+            The value returned depends on \p mpsc_queue::traits::item_counter option.
+            For \p atomicity::empty_item_counter, this function always returns 0.
+
+            @note Even if you use real item counter and it returns 0, this fact is not mean that the queue
+            is empty. To check queue emptyness use \p empty() method.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef CDSLIB_INTRUSIVE_MPSC_QUEUE_H
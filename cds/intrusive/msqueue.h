@@ -104,9 +104,12 @@ namespace cds { namespace intrusive {
             counter_type m_AdvanceTailError  ;  ///< Count of "advance tail failed" events
             counter_type m_BadTail           ;  ///< Count of events "Tail is not pointed to the last item in the queue"
             counter_type m_EmptyDequeue      ;  ///< Count of dequeue from empty queue
+            counter_type m_EnqueueBulkCount  ;  ///< Count of \p enqueue_bulk() calls that have linked a chain of items
 
             /// Register enqueue call
             void onEnqueue()                { ++m_EnqueueCount; }
+            /// Register bulk enqueue of \p nCount items
+            void onEnqueueBulk( size_t nCount ) { ++m_EnqueueBulkCount; m_EnqueueCount += nCount; }
             /// Register dequeue call
             void onDequeue()                { ++m_DequeueCount; }
             /// Register enqueue race event
@@ -130,6 +133,7 @@ namespace cds { namespace intrusive {
                 m_AdvanceTailError.reset();
                 m_BadTail.reset();
                 m_EmptyDequeue.reset();
+                m_EnqueueBulkCount.reset();
             }
 
             stat& operator +=( stat const& s )
@@ -141,6 +145,7 @@ namespace cds { namespace intrusive {
                 m_AdvanceTailError += s.m_AdvanceTailError.get();
                 m_BadTail += s.m_BadTail.get();
                 m_EmptyDequeue += s.m_EmptyDequeue.get();
+                m_EnqueueBulkCount += s.m_EnqueueBulkCount.get();
 
                 return *this;
             }
@@ -152,6 +157,7 @@ namespace cds { namespace intrusive {
         {
             //@cond
             void onEnqueue()                const {}
+            void onEnqueueBulk( size_t )    const {}
             void onDequeue()                const {}
             void onEnqueueRace()            const {}
             void onDequeueRace()            const {}
@@ -433,6 +439,44 @@ namespace cds { namespace intrusive {
             return true;
         }
 
+        // Links the chain pFirst -> ... -> pLast of nCount nodes to the tail by one CAS.
+        // The chain must be linked by the caller, pLast->m_pNext must be nullptr
+        void do_enqueue_chain( node_type * pFirst, node_type * pLast, size_t nCount )
+        {
+            assert( pFirst != nullptr );
+            assert( pLast != nullptr );
+            assert( pLast->m_pNext.load( atomics::memory_order_relaxed ) == nullptr );
+
+            typename gc::Guard guard;
+            back_off bkoff;
+
+            node_type * t;
+            while ( true ) {
+                t = guard.protect( m_pTail, []( node_type * p ) -> value_type * { return node_traits::to_value_ptr( p );});
+
+                node_type * pNext = t->m_pNext.load(memory_model::memory_order_acquire);
+                if ( pNext != nullptr ) {
+                    // Tail is misplaced, advance it
+                    m_pTail.compare_exchange_weak( t, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                    m_Stat.onBadTail();
+                    continue;
+                }
+
+                node_type * tmp = nullptr;
+                if ( t->m_pNext.compare_exchange_strong( tmp, pFirst, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                    break;
+
+                m_Stat.onEnqueueRace();
+                bkoff();
+            }
+            m_ItemCounter += nCount;
+            m_Stat.onEnqueueBulk( nCount );
+
+            // If a helper has already moved the tail into the chain, it walks the rest of the chain itself
+            if ( !m_pTail.compare_exchange_strong( t, pLast, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                m_Stat.onAdvanceTailFailed();
+        }
+
         static void clear_links( node_type * pNode )
         {
             pNode->m_pNext.store( nullptr, memory_model::memory_order_release );
@@ -532,6 +576,36 @@ namespace cds { namespace intrusive {
             return true;
         }
 
+        /// Enqueues the items of range <tt>[itFirst, itLast)</tt> into the queue
+        /**
+            The items are linked into a chain in the range order, then the chain is appended
+            to the queue by one CAS on the tail. Thus, the items of the range are placed in the queue
+            contiguously, the items of other producers cannot interleave with them.
+            Dereferencing of \p Iterator should return \p value_type&.
+
+            The function returns the number of items enqueued.
+        */
+        template <typename Iterator>
+        size_t enqueue_bulk( Iterator itFirst, Iterator itLast )
+        {
+            if ( itFirst == itLast )
+                return 0;
+
+            node_type * pFirst = node_traits::to_node_ptr( *itFirst );
+            link_checker::is_empty( pFirst );
+            node_type * pLast = pFirst;
+            size_t nCount = 1;
+            for ( ++itFirst; itFirst != itLast; ++itFirst, ++nCount ) {
+                node_type * pNode = node_traits::to_node_ptr( *itFirst );
+                link_checker::is_empty( pNode );
+                pLast->m_pNext.store( pNode, atomics::memory_order_relaxed );
+                pLast = pNode;
+            }
+
+            do_enqueue_chain( pFirst, pLast, nCount );
+            return nCount;
+        }
+
         /// Dequeues a value from the queue
         /** @anchor cds_intrusive_MSQueue_dequeue
             If the queue is empty the function returns \p nullptr.
@@ -568,6 +642,28 @@ namespace cds { namespace intrusive {
             return nullptr;
         }
 
+        /// Dequeues up to \p nMax items from the queue
+        /**
+            The function dequeues items while the queue is not empty and \p nMax is not reached,
+            and writes the pointers to dequeued items to \p out.
+            Returns the number of items dequeued.
+
+            The hazard pointers are acquired once for the whole batch.
+            See warning about item disposing in \ref cds_intrusive_MSQueue_dequeue "dequeue()".
+        */
+        template <typename OutputIterator>
+        size_t dequeue_bulk( OutputIterator out, size_t nMax )
+        {
+            dequeue_result res;
+            size_t nCount = 0;
+            for ( ; nCount < nMax && do_dequeue( res ); ++nCount ) {
+                dispose_result( res );
+                *out = node_traits::to_value_ptr( *res.pNext );
+                ++out;
+            }
+            return nCount;
+        }
+
         /// Synonym for \ref cds_intrusive_MSQueue_enqueue "enqueue()" function
         bool push( value_type& val )
         {
@@ -1144,6 +1144,69 @@ namespace cds { namespace intrusive {
             return bRet;
         }
 
+        // Turns "greater or equal" position search into "strictly greater" one
+        template <typename Compare>
+        struct upper_bound_comparator
+        {
+            Compare m_cmp;
+
+            template <typename Q>
+            int operator()( value_type const& v, Q const& key ) const
+            {
+                return m_cmp( v, key ) <= 0 ? -1 : 1;
+            }
+        };
+
+        template <typename Q, typename Compare>
+        raw_ptr do_lower_bound( Q const& val, Compare cmp )
+        {
+            assert( gc::is_locked());
+
+            position pos;
+            find_position( val, pos, cmp, false );
+            if ( pos.pSucc[0] )
+                return raw_ptr( node_traits::to_value_ptr( pos.pSucc[0] ), raw_ptr_disposer( pos ));
+            return raw_ptr( raw_ptr_disposer( pos ));
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t do_for_each_in_range( Q const& lo, Q const& hi, Compare cmp, Func f )
+        {
+            check_deadlock_policy::check();
+
+            position pos;
+            size_t nCount = 0;
+
+            {
+                rcu_lock l;
+
+                find_position( lo, pos, cmp, false );
+                node_type * pCur = pos.pSucc[0];
+
+                while ( pCur ) {
+                    value_type& val = *node_traits::to_value_ptr( pCur );
+                    if ( cmp( val, hi ) > 0 )
+                        break;
+
+                    marked_node_ptr pNext = pCur->next( 0 ).load( memory_model::memory_order_acquire );
+                    if ( pNext.bits() ) {
+                        // pCur has been deleted while we were here, seek to the first node greater than pCur
+                        m_Stat.onRangeScanReseek();
+                        find_position( val, pos, upper_bound_comparator<key_comparator>{ key_comparator() }, false );
+                        pCur = pos.pSucc[0];
+                        continue;
+                    }
+
+                    f( val );
+                    ++nCount;
+                    pCur = pNext.ptr();
+                }
+            }
+
+            m_Stat.onRangeScan();
+            return nCount;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool do_erase( Q const& val, Compare cmp, Func f )
         {
@@ -1966,6 +2029,96 @@ namespace cds { namespace intrusive {
             return raw_ptr( raw_ptr_disposer( pos ));
         }
 
+        /// Finds the first item that is not less than \p key
+        /** \anchor cds_intrusive_SkipListSet_rcu_lower_bound
+            The function returns \p raw_ptr object pointed to the first item whose key is greater than or equal to \p key.
+            If there is no such item it returns empty \p raw_ptr.
+
+            RCU should be locked before call of this function.
+            Returned item is valid only while RCU is locked, see \ref cds_intrusive_SkipListSet_rcu_get "get()".
+        */
+        template <typename Q>
+        raw_ptr lower_bound( Q const& key )
+        {
+            return do_lower_bound( key, key_comparator() );
+        }
+
+        /// Finds the first item that is not less than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_lower_bound "lower_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        raw_ptr lower_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return do_lower_bound( key, cds::opt::details::make_comparator_from_less<Less>() );
+        }
+
+        /// Finds the first item that is greater than \p key
+        /** \anchor cds_intrusive_SkipListSet_rcu_upper_bound
+            The function returns \p raw_ptr object pointed to the first item whose key is strictly greater than \p key.
+            If there is no such item it returns empty \p raw_ptr.
+
+            RCU should be locked before call of this function.
+        */
+        template <typename Q>
+        raw_ptr upper_bound( Q const& key )
+        {
+            return do_lower_bound( key, upper_bound_comparator<key_comparator>{ key_comparator() } );
+        }
+
+        /// Finds the first item that is greater than \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_upper_bound "upper_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        raw_ptr upper_bound_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            typedef cds::opt::details::make_comparator_from_less<Less> cmp;
+            return do_lower_bound( key, upper_bound_comparator<cmp>{ cmp() } );
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt>
+        /** \anchor cds_intrusive_SkipListSet_rcu_for_each_in_range
+            The function seeks to the first item not less than \p lo and then walks level 0 of the skip-list
+            inside one RCU critical section calling \p f for each item until the key becomes greater than \p hi.
+            The functor signature is:
+            \code
+            void f( value_type& item );
+            \endcode
+            The functor is called under RCU lock so it should not call the functions of the set that
+            lock RCU themselves.
+
+            The scan is weakly consistent: each item that is in the set during the entire scan is visited exactly once,
+            in ascending key order; items inserted or deleted concurrently may or may not be visited.
+
+            RCU should not be locked before call of this function.
+            The function returns the count of visited items.
+        */
+        template <typename Q, typename Func>
+        size_t for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            return do_for_each_in_range( lo, hi, key_comparator(), f );
+        }
+
+        /// Applies \p f to each item with key in range <tt>[lo, hi]</tt> using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_for_each_in_range "for_each_in_range(Q const&, Q const&, Func)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        size_t for_each_in_range_with( Q const& lo, Q const& hi, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return do_for_each_in_range( lo, hi, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
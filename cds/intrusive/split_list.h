@@ -33,6 +33,7 @@
 
 #include <limits>
 #include <cds/intrusive/details/split_list_base.h>
+#include <cds/details/batch_apply.h>
 
 namespace cds { namespace intrusive {
 
@@ -264,11 +265,15 @@ namespace cds { namespace intrusive {
         /// Bucket table implementation
         typedef typename split_list::details::bucket_table_selector<
             traits::dynamic_bucket_table
+            , traits::unbounded_bucket_table
             , gc
             , dummy_node_type
             , opt::allocator< typename traits::allocator >
             , opt::memory_model< memory_model >
         >::type bucket_table;
+
+        /// Dummy node allocator, see \p split_list::traits::dummy_node_slab
+        typedef split_list::details::dummy_node_pool< dummy_node_type, typename traits::allocator, traits::dummy_node_slab > dummy_node_pool;
         //@endcond
 
     protected:
@@ -378,19 +383,20 @@ namespace cds { namespace intrusive {
         item_counter            m_ItemCounter;      ///< Item counter
         hash                    m_HashFunctor;      ///< Hash functor
         stat                    m_Stat;             ///< Internal statistics
+        dummy_node_pool         m_DummyNodes;       ///< Dummy node allocator
 
     protected:
         //@cond
-        typedef cds::details::Allocator< dummy_node_type, typename traits::allocator >   dummy_node_allocator;
-
-        dummy_node_type * alloc_dummy_node( size_t nHash )
+        dummy_node_type * alloc_dummy_node( size_t nBucket )
         {
-            m_Stat.onHeadNodeAllocated();
-            return dummy_node_allocator().New( nHash );
+            dummy_node_type * p = m_DummyNodes.alloc( nBucket );
+            if ( p )
+                m_Stat.onHeadNodeAllocated();
+            return p;
         }
         void free_dummy_node( dummy_node_type * p )
         {
-            dummy_node_allocator().Delete( p );
+            m_DummyNodes.free( p );
             m_Stat.onHeadNodeFreed();
         }
 
@@ -403,7 +409,7 @@ namespace cds { namespace intrusive {
 
         size_t bucket_no( size_t nHash ) const
         {
-            return nHash & ( (1 << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
+            return nHash & ( (static_cast<size_t>(1) << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
         }
 
         static size_t parent_bucket( size_t nBucket )
@@ -426,8 +432,9 @@ namespace cds { namespace intrusive {
             assert( pParentBucket != nullptr );
 
             // Allocate a dummy node for new bucket
-            {
-                dummy_node_type * pBucket = alloc_dummy_node( split_list::dummy_hash( nBucket ));
+            // In slab mode the dummy node of the bucket is unique, nullptr means another thread is inserting it
+            dummy_node_type * pBucket = alloc_dummy_node( nBucket );
+            if ( pBucket ) {
                 if ( m_List.insert_aux_node( pParentBucket, pBucket )) {
                     m_Buckets.bucket( nBucket, pBucket );
                     m_Stat.onNewBucket();
@@ -465,6 +472,25 @@ namespace cds { namespace intrusive {
             return pHead;
         }
 
+        /// Count of keys processed together by batch operations
+        static CDS_CONSTEXPR size_t const c_nBatchSize = cds::details::c_nBatchSize;
+
+        /// Calls <tt>op( key )</tt> for the keys of the batch
+        /**
+            The keys are processed in groups of \p c_nBatchSize keys. For each group the hash values are computed
+            and the bucket table entries are prefetched, then the dummy nodes of the buckets are prefetched,
+            and then \p op is called for each key of the group. So the cache misses of the group overlap.
+        */
+        template <typename Q, typename Func>
+        size_t batch_apply( Q const* pKeys, size_t nCount, bool * pResult, Func op )
+        {
+            return cds::details::batch_apply<c_nBatchSize>( pKeys, nCount, pResult,
+                [this]( Q const& key ) -> size_t { return bucket_no( hash_value( key )); },
+                [this]( size_t nBucket ) { m_Buckets.prefetch( nBucket ); },
+                [this]( size_t nBucket ) { CDS_PREFETCH( m_Buckets.bucket( nBucket )); },
+                [&op]( size_t, Q const& key ) -> bool { return op( key ); });
+        }
+
         void init()
         {
             // GC and OrderedList::gc must be the same
@@ -475,7 +501,7 @@ namespace cds { namespace intrusive {
                            "cds::atomicity::empty_item_counter is not allowed as a item counter");
 
             // Initialize bucket 0
-            dummy_node_type * pNode = alloc_dummy_node( 0 /*split_list::dummy_hash(0)*/ );
+            dummy_node_type * pNode = alloc_dummy_node( 0 );
 
             // insert_aux_node cannot return false for empty list
             CDS_VERIFY( m_List.insert_aux_node( pNode ));
@@ -628,10 +654,13 @@ namespace cds { namespace intrusive {
             The default capacity is defined in bucket table constructor.
             See \p split_list::expandable_bucket_table, \p split_list::static_bucket_table
             which selects by \p split_list::dynamic_bucket_table option.
+            If \p split_list::unbounded_bucket_table option is \p true, \p split_list::unlimited_bucket_table is used
+            and the capacity is not limited.
         */
         SplitListSet()
             : m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+            , m_DummyNodes( m_Buckets.capacity(), m_Buckets.segment_size())
         {
             init();
         }
@@ -644,6 +673,7 @@ namespace cds { namespace intrusive {
             : m_Buckets( nItemCount, nLoadFactor )
             , m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+            , m_DummyNodes( m_Buckets.capacity(), m_Buckets.segment_size())
         {
             init();
         }
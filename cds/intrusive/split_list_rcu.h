@@ -139,12 +139,16 @@ namespace cds { namespace intrusive {
         /// Bucket table implementation
         typedef typename split_list::details::bucket_table_selector<
             traits::dynamic_bucket_table
+            , traits::unbounded_bucket_table
             , gc
             , dummy_node_type
             , opt::allocator< typename traits::allocator >
             , opt::memory_model< memory_model >
         >::type bucket_table;
 
+        /// Dummy node allocator, see \p split_list::traits::dummy_node_slab
+        typedef split_list::details::dummy_node_pool< dummy_node_type, typename traits::allocator, traits::dummy_node_slab > dummy_node_pool;
+
         //@endcond
 
     protected:
@@ -272,19 +276,20 @@ namespace cds { namespace intrusive {
         item_counter            m_ItemCounter;      ///< Item counter
         hash                    m_HashFunctor;      ///< Hash functor
         stat                    m_Stat;             ///< Internal statistics accumulator
+        dummy_node_pool         m_DummyNodes;       ///< Dummy node allocator
 
     protected:
         //@cond
-        typedef cds::details::Allocator< dummy_node_type, typename traits::allocator >   dummy_node_allocator;
-
-        dummy_node_type * alloc_dummy_node( size_t nHash )
+        dummy_node_type * alloc_dummy_node( size_t nBucket )
         {
-            m_Stat.onHeadNodeAllocated();
-            return dummy_node_allocator().New( nHash );
+            dummy_node_type * p = m_DummyNodes.alloc( nBucket );
+            if ( p )
+                m_Stat.onHeadNodeAllocated();
+            return p;
         }
         void free_dummy_node( dummy_node_type * p )
         {
-            dummy_node_allocator().Delete( p );
+            m_DummyNodes.free( p );
             m_Stat.onHeadNodeFreed();
         }
 
@@ -297,7 +302,7 @@ namespace cds { namespace intrusive {
 
         size_t bucket_no( size_t nHash ) const
         {
-            return nHash & ( (1 << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
+            return nHash & ( (static_cast<size_t>(1) << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
         }
 
         static size_t parent_bucket( size_t nBucket )
@@ -320,9 +325,10 @@ namespace cds { namespace intrusive {
             assert( pParentBucket != nullptr );
 
             // Allocate a dummy node for new bucket
-            {
-                dummy_node_type * pBucket = alloc_dummy_node( split_list::dummy_hash( nBucket ) );
-                if ( m_List.insert_aux_node( pParentBucket, pBucket ) ) {
+            // In slab mode the dummy node of the bucket is unique, nullptr means another thread is inserting it
+            dummy_node_type * pBucket = alloc_dummy_node( nBucket );
+            if ( pBucket ) {
+                if ( m_List.insert_aux_node( pParentBucket, pBucket )) {
                     m_Buckets.bucket( nBucket, pBucket );
                     m_Stat.onNewBucket();
                     return pBucket;
@@ -370,7 +376,7 @@ namespace cds { namespace intrusive {
                            "cds::atomicity::empty_item_counter is not allowed as a item counter");
 
             // Initialize bucket 0
-            dummy_node_type * pNode = alloc_dummy_node( 0 /*split_list::dummy_hash(0)*/ );
+            dummy_node_type * pNode = alloc_dummy_node( 0 );
 
             // insert_aux_node cannot return false for empty list
             CDS_VERIFY( m_List.insert_aux_node( pNode ));
@@ -508,10 +514,13 @@ namespace cds { namespace intrusive {
             The default capacity is defined in bucket table constructor.
             See split_list::expandable_bucket_table, split_list::static_ducket_table
             which selects by split_list::dynamic_bucket_table option.
+            If split_list::unbounded_bucket_table option is \p true, split_list::unlimited_bucket_table is used
+            and the capacity is not limited.
         */
         SplitListSet()
             : m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()) )
+            , m_DummyNodes( m_Buckets.capacity(), m_Buckets.segment_size())
         {
             init();
         }
@@ -524,6 +533,7 @@ namespace cds { namespace intrusive {
             : m_Buckets( nItemCount, nLoadFactor )
             , m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()) )
+            , m_DummyNodes( m_Buckets.capacity(), m_Buckets.segment_size())
         {
             init();
         }
@@ -44,6 +44,18 @@ namespace cds { namespace intrusive {
             Resizing policy for \p intrusive::StripedSet, \p container::StripedSet and \p container::StripedMap.
         */
 
+        //@cond
+        namespace details {
+            template <class MutexPolicy>
+            struct is_striping: public std::false_type
+            {};
+
+            template <class Lock, class Alloc>
+            struct is_striping< striping< Lock, Alloc > >: public std::true_type
+            {};
+        } // namespace details
+        //@endcond
+
     }   // namespace striped_set
 
     /// Striped hash set
@@ -92,6 +104,9 @@ namespace cds { namespace intrusive {
             Note that the choose of resizing policy depends of \p Container type:
             for sequential containers like \p boost::intrusive::list the right policy can significantly improve performance.
             For other, non-sequential types of \p Container (like a \p boost::intrusive::set) the resizing policy is not so important.
+        - \p striped_set::incremental_resize - if \p true, the set is resized stripe-by-stripe without locking
+            all stripes for the whole rehashing. Only \p striped_set::striping mutex policy supports this option.
+            Default is \p false, see \p striped_set::incremental_resize for details.
         - \p cds::opt::buffer - a buffer type used only for \p boost::intrusive::unordered_set.
             Default is <tt>cds::opt::v::static_buffer< cds::any_type, 256 > </tt>.
 
@@ -301,6 +316,7 @@ namespace cds { namespace intrusive {
             typedef cds::opt::none                  resizing_policy;
             typedef cds::opt::none                  compare;
             typedef cds::opt::none                  less;
+            static bool const                       incremental_resize = false;
         };
 
         typedef typename cds::opt::make_options<
@@ -324,6 +340,21 @@ namespace cds { namespace intrusive {
 
         typedef cds::details::Allocator< bucket_type, allocator_type > bucket_allocator;  ///< bucket allocator type based on allocator_type
 
+        static CDS_CONSTEXPR const bool c_bIncrementalResize = options::incremental_resize; ///< \p true if the set is resized incrementally, see \p striped_set::incremental_resize
+
+        static_assert( !c_bIncrementalResize || striped_set::details::is_striping< mutex_policy >::value,
+            "striped_set::incremental_resize requires striped_set::striping mutex policy" );
+
+    protected:
+        //@cond
+        struct stripe_table {
+            bucket_type *   pBuckets;
+            size_t          nBucketMask;
+        };
+        typedef cds::details::Allocator< stripe_table, allocator_type > stripe_table_allocator;
+        typedef std::integral_constant< bool, c_bIncrementalResize > incremental_resize_tag;
+        //@endcond
+
     protected:
         bucket_type *   m_Buckets       ;   ///< Bucket table
         size_t          m_nBucketMask   ;   ///< Bucket table size - 1. m_nBucketMask + 1 should be power of two.
@@ -333,6 +364,9 @@ namespace cds { namespace intrusive {
         mutex_policy    m_MutexPolicy   ;   ///< Mutex policy
         resizing_policy m_ResizingPolicy;   ///< Resizing policy
 
+        stripe_table *  m_arrStripeTable;   ///< Current bucket table of each stripe (incremental resizing only)
+        std::mutex      m_ResizeMutex   ;   ///< Incremental resizing mutex
+
         static const size_t c_nMinimalCapacity = 16 ;   ///< Minimal capacity
 
     protected:
@@ -362,6 +396,33 @@ namespace cds { namespace intrusive {
             bucket_allocator().Delete( pBuckets, nSize );
         }
 
+        void alloc_stripe_table()
+        {
+            alloc_stripe_table( incremental_resize_tag() );
+        }
+
+        void alloc_stripe_table( std::false_type )
+        {}
+
+        void alloc_stripe_table( std::true_type )
+        {
+            // Initially, the bucket table and the lock array have the same capacity
+            size_t const nLockCount = m_MutexPolicy.lock_count();
+            assert( nLockCount <= bucket_count() );
+
+            m_arrStripeTable = stripe_table_allocator().NewArray( nLockCount );
+            for ( size_t i = 0; i < nLockCount; ++i ) {
+                m_arrStripeTable[i].pBuckets = m_Buckets;
+                m_arrStripeTable[i].nBucketMask = m_nBucketMask;
+            }
+        }
+
+        void free_stripe_table()
+        {
+            if ( m_arrStripeTable )
+                stripe_table_allocator().Delete( m_arrStripeTable, m_MutexPolicy.lock_count() );
+        }
+
         template <typename Q>
         size_t hashing( Q const& v ) const
         {
@@ -369,10 +430,22 @@ namespace cds { namespace intrusive {
         }
 
         bucket_type * bucket( size_t nHash ) const CDS_NOEXCEPT
+        {
+            return bucket( nHash, incremental_resize_tag() );
+        }
+
+        bucket_type * bucket( size_t nHash, std::false_type ) const CDS_NOEXCEPT
         {
             return m_Buckets + (nHash & m_nBucketMask);
         }
 
+        bucket_type * bucket( size_t nHash, std::true_type ) const CDS_NOEXCEPT
+        {
+            // The caller owns the stripe lock so the stripe's table cannot be changed
+            stripe_table const& tbl = m_arrStripeTable[ nHash & ( m_MutexPolicy.lock_count() - 1 ) ];
+            return tbl.pBuckets + (nHash & tbl.nBucketMask);
+        }
+
         template <typename Q, typename Func>
         bool find_( Q& val, Func f )
         {
@@ -418,7 +491,72 @@ namespace cds { namespace intrusive {
             m_ResizingPolicy.reset();
         }
 
+        void incremental_resize( size_t nNewCapacity )
+        {
+            // Only m_ResizeMutex is locked, the stripes are migrated one by one.
+            // The capacity of bucket table is a multiple of the lock count L,
+            // so the buckets j = i mod L of the old table are split into the buckets
+            // of the same stripe i in the new table
+            size_t const nOldCapacity = bucket_count();
+            size_t const nNewMask = nNewCapacity - 1;
+            size_t const nLockCount = m_MutexPolicy.lock_count();
+            bucket_type * pOldBuckets = m_Buckets;
+            bucket_type * pNewBuckets = bucket_allocator().NewArray( nNewCapacity );
+
+            typedef typename bucket_type::iterator bucket_iterator;
+            for ( size_t nStripe = 0; nStripe < nLockCount; ++nStripe ) {
+                scoped_cell_lock sl( m_MutexPolicy, nStripe );
+
+                for ( size_t nBucket = nStripe; nBucket < nOldCapacity; nBucket += nLockCount ) {
+                    bucket_type * pCur = pOldBuckets + nBucket;
+                    bucket_iterator itEnd = pCur->end();
+                    bucket_iterator itNext;
+                    for ( bucket_iterator it = pCur->begin(); it != itEnd; it = itNext ) {
+                        itNext = it;
+                        ++itNext;
+                        pNewBuckets[ m_Hash( *it ) & nNewMask ].move_item( *pCur, it );
+                    }
+                    pCur->clear();
+                }
+
+                m_arrStripeTable[nStripe].pBuckets = pNewBuckets;
+                m_arrStripeTable[nStripe].nBucketMask = nNewMask;
+            }
+
+            {
+                // No stripe refers to the old table now; publish new table size
+                scoped_full_lock fl( m_MutexPolicy );
+                m_Buckets = pNewBuckets;
+                m_nBucketMask = nNewMask;
+            }
+
+            free_bucket_table( pOldBuckets, nOldCapacity );
+
+            m_ResizingPolicy.reset();
+        }
+
         void resize()
+        {
+            resize( incremental_resize_tag() );
+        }
+
+        void resize( std::true_type )
+        {
+            size_t nOldCapacity = bucket_count();
+
+            // If another thread is resizing the set, do not wait for it
+            std::unique_lock< std::mutex > rl( m_ResizeMutex, std::try_to_lock );
+            if ( rl.owns_lock() ) {
+                if ( nOldCapacity != bucket_count() ) {
+                    // someone resized already
+                    return;
+                }
+
+                incremental_resize( nOldCapacity * 2 );
+            }
+        }
+
+        void resize( std::false_type )
         {
             size_t nOldCapacity = bucket_count();
             size_t volatile& refBucketMask = m_nBucketMask;
@@ -442,8 +580,10 @@ namespace cds { namespace intrusive {
             : m_Buckets( nullptr )
         , m_nBucketMask( c_nMinimalCapacity - 1 )
         , m_MutexPolicy( c_nMinimalCapacity )
+        , m_arrStripeTable( nullptr )
         {
             alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_stripe_table();
         }
 
         /// Ctor with initial capacity specified
@@ -453,8 +593,10 @@ namespace cds { namespace intrusive {
         : m_Buckets( nullptr )
         , m_nBucketMask( calc_init_capacity(nCapacity) - 1 )
         , m_MutexPolicy( m_nBucketMask + 1 )
+        , m_arrStripeTable( nullptr )
         {
             alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_stripe_table();
         }
 
         /// Ctor with resizing policy (copy semantics)
@@ -469,8 +611,10 @@ namespace cds { namespace intrusive {
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
         , m_MutexPolicy( m_nBucketMask + 1 )
         , m_ResizingPolicy( resizingPolicy )
+        , m_arrStripeTable( nullptr )
         {
             alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_stripe_table();
         }
 
         /// Ctor with resizing policy (move semantics)
@@ -486,13 +630,16 @@ namespace cds { namespace intrusive {
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
         , m_MutexPolicy( m_nBucketMask + 1 )
         , m_ResizingPolicy( std::forward<resizing_policy>( resizingPolicy ) )
+        , m_arrStripeTable( nullptr )
         {
             alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_stripe_table();
         }
 
         /// Destructor destroys internal data
         ~StripedSet()
         {
+            free_stripe_table();
             free_bucket_table( m_Buckets, m_nBucketMask + 1 );
         }
 
@@ -823,6 +970,11 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
+            // waits for incremental resizing in progress
+            std::unique_lock< std::mutex > rl( m_ResizeMutex, std::defer_lock );
+            if ( c_bIncrementalResize )
+                rl.lock();
+
             // locks entire array
             scoped_full_lock sl( m_MutexPolicy );
 
@@ -846,6 +998,11 @@ namespace cds { namespace intrusive {
         template <typename Disposer>
         void clear_and_dispose( Disposer disposer )
         {
+            // waits for incremental resizing in progress
+            std::unique_lock< std::mutex > rl( m_ResizeMutex, std::defer_lock );
+            if ( c_bIncrementalResize )
+                rl.lock();
+
             // locks entire array
             scoped_full_lock sl( m_MutexPolicy );
 
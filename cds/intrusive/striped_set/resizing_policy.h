@@ -288,6 +288,35 @@ namespace cds { namespace intrusive { namespace striped_set {
         {}
     };
 
+    /// Incremental resizing option
+    /** @ingroup cds_striped_resizing_policy
+        By default, \p StripedSet rehashes the whole bucket table under \p scoped_resize_lock
+        that locks every stripe, so all operations stall until the rehashing is done.
+
+        When \p Enable is \p true, the set is resized incrementally: the thread that detected the need of resizing
+        (according to the resizing policy) allocates new bucket table and migrates the buckets stripe-by-stripe
+        locking only one stripe at a time. Other stripes stay available during the migration.
+        Each stripe refers to its own current bucket table, the old or the new one,
+        so an operation always sees a consistent table under the stripe lock.
+        All locks are acquired only for a short moment at the end of resizing to publish new table size.
+        If one thread is resizing the set, other threads don't wait for it and continue their operations.
+
+        The option may be used only with \p striped_set::striping mutex policy since the stripe mapping
+        <tt> j mod L </tt> must be unchanged during the resizing.
+
+        Default is \p false.
+    */
+    template <bool Enable>
+    struct incremental_resize
+    {
+        //@cond
+        template <class Base> struct pack: public Base
+        {
+            static bool const incremental_resize = Enable;
+        };
+        //@endcond
+    };
+
 }}} // namespace cds::intrusive::striped_set
 
 #endif // #define CDSLIB_INTRUSIVE_STRIPED_SET_RESIZING_POLICY_H
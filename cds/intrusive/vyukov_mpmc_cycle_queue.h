@@ -190,6 +190,33 @@ namespace cds { namespace intrusive {
             return base_class::dequeue( p ) ? p : nullptr;
         }
 
+        /// Enqueues the items of range <tt>[itFirst, itLast)</tt>
+        /**
+            The contiguous range of free cells is claimed by one CAS, see \p container::VyukovMPMCCycleQueue::enqueue_bulk().
+            Dereferencing of \p ForwardIterator should return \p value_type&.
+            Returns the number of items enqueued.
+
+            @note The intrusive queue stores pointers to the items passed.
+        */
+        template <typename ForwardIterator>
+        size_t enqueue_bulk( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            return base_class::do_enqueue_bulk( static_cast<size_t>( std::distance( itFirst, itLast )),
+                [&itFirst]( value_type *& dest ) { dest = &(*itFirst); ++itFirst; } );
+        }
+
+        /// Dequeues up to \p nMax items from queue
+        /**
+            The pointers to dequeued items are written to \p out.
+            \p Traits::disposer is not called.
+            Returns the number of items dequeued.
+        */
+        template <typename OutputIterator>
+        size_t dequeue_bulk( OutputIterator out, size_t nMax )
+        {
+            return base_class::dequeue_bulk( out, nMax );
+        }
+
         /// Synonym for \p enqueue()
         bool push( value_type& data )
         {
@@ -45,6 +45,7 @@
 
 #include <stdlib.h>
 #include <mutex>        // unique_lock
+#include <type_traits>
 #include <cds/init.h>
 #include <cds/memory/michael/options.h>
 #include <cds/memory/michael/bound_check.h>
@@ -62,6 +63,11 @@
 
 #include <boost/intrusive/list.hpp>
 
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
 namespace cds {
     /// Memory-related algorithms: allocators etc.
 namespace memory {
@@ -221,6 +227,201 @@ namespace michael {
         }
     };
 
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+    /// mmap-backed page heap
+    /**
+        The page heap reserves large regions of virtual memory by \p mmap and hands out pages from them.
+        The regions are aligned to 2M boundary and are advised to be backed by transparent huge pages
+        (\p MADV_HUGEPAGE) that reduces TLB misses for large data sets.
+        If \p HugeTLB is \p true, the heap tries to map the regions with \p MAP_HUGETLB first
+        and falls back to regular mapping if the system has no free huge pages.
+
+        Freed pages are kept in the free-list of \p FreeListCapacity pages like \ref page_cached_allocator does.
+        If the free-list is full, the whole system pages of the page are returned to the system by \p madvise(MADV_DONTNEED)
+        except its first system page that holds the link to the next page in the list of released pages.
+        To make it possible, the pages are carved from the region with the stride rounded up to the system page size,
+        so each page starts on a system page boundary and \p madvise() never touches the neighbour page.
+        Thus, the resident set size decreases after load spike.
+        The released pages are reused before a new page is carved from the region.
+        The memory mapped with \p MAP_HUGETLB cannot be released partially, \p madvise() fails for it
+        and the pages stay resident; after the first failure the heap does not call \p madvise() anymore.
+        The regions are unmapped only when the heap is destroyed.
+
+        Template parameters:
+            \li \p RegionSize - size of virtual memory region reserved at once, default is 32M.
+                If the page size is greater than \p RegionSize, the region contains exactly one page.
+            \li \p FreeListCapacity - capacity of free-list, default value is 64 page
+            \li \p HugeTLB - try to use explicit huge pages (\p MAP_HUGETLB), default is \p false
+
+        This class is one of available implementation of opt::page_heap option.
+        The class is available on Unix-like systems only.
+    */
+    template <size_t RegionSize = 32 * 1024 * 1024, size_t FreeListCapacity = 64, bool HugeTLB = false>
+    class mmap_page_allocator
+    {
+        //@cond
+        static CDS_CONSTEXPR const size_t c_nRegionAlignment = 2 * 1024 * 1024;
+
+        struct region {
+            region *    pNext;
+            char *      pBase;
+            size_t      nSize;
+        };
+
+        struct released_page {
+            released_page * pNext;
+        };
+
+        struct free_list_traits : public cds::container::vyukov_queue::traits
+        {
+            typedef opt::v::static_buffer<void *, FreeListCapacity> buffer;
+        };
+        typedef container::VyukovMPMCCycleQueue< void *, free_list_traits > free_list;
+        typedef std::unique_lock<cds::sync::spin> scoped_lock;
+
+        size_t const    m_nSysPageSize;
+        size_t const    m_nPageSize;
+        size_t const    m_nStride;          // m_nPageSize rounded up to system page size
+        size_t const    m_nRegionSize;
+        atomics::atomic<bool> m_bRelease;   // false if madvise() failed, for example, for MAP_HUGETLB
+        free_list       m_FreeList;         // hot pages
+
+        cds::sync::spin m_Lock;             // protects the fields below
+        region *        m_pRegions;
+        char *          m_pCur;             // next free page in current region
+        char *          m_pEnd;             // end of current region
+        released_page * m_pReleased;        // pages returned to the system
+        //@endcond
+
+    public:
+        /// Initializes heap
+        mmap_page_allocator(
+            size_t nPageSize    ///< page size in bytes
+        )
+            : m_nSysPageSize( static_cast<size_t>( sysconf( _SC_PAGESIZE )))
+            , m_nPageSize( nPageSize )
+            , m_nStride( ( nPageSize + m_nSysPageSize - 1 ) / m_nSysPageSize * m_nSysPageSize )
+            , m_nRegionSize( RegionSize < m_nStride ? m_nStride : RegionSize / m_nStride * m_nStride )
+            , m_bRelease( true )
+            , m_FreeList( FreeListCapacity )
+            , m_pRegions( nullptr )
+            , m_pCur( nullptr )
+            , m_pEnd( nullptr )
+            , m_pReleased( nullptr )
+        {}
+
+        //@cond
+        ~mmap_page_allocator()
+        {
+            region * p = m_pRegions;
+            while ( p ) {
+                region * pNext = p->pNext;
+                munmap( p->pBase, p->nSize );
+                ::free( p );
+                p = pNext;
+            }
+        }
+        //@endcond
+
+        /// Allocate new page
+        void * alloc()
+        {
+            void * pPage;
+            if ( m_FreeList.pop( pPage ))
+                return pPage;
+
+            scoped_lock al( m_Lock );
+            if ( m_pReleased ) {
+                released_page * p = m_pReleased;
+                m_pReleased = p->pNext;
+                return p;
+            }
+            if ( m_pCur == m_pEnd && !map_region() )
+                return nullptr;
+
+            pPage = m_pCur;
+            m_pCur += m_nStride;
+            return pPage;
+        }
+
+        /// Free page \p pPage
+        void free( void * pPage )
+        {
+            if ( !pPage || m_FreeList.push( pPage ))
+                return;
+
+            // The free-list is full - return the page to the system.
+            // The page is aligned on system page, so [pPage + sysPage, pPage + nLen + sysPage) consists
+            // of whole system pages that belong to the page only
+            size_t const nLen = m_nPageSize > m_nSysPageSize ? ( m_nPageSize - m_nSysPageSize ) / m_nSysPageSize * m_nSysPageSize : 0;
+            if ( nLen && m_bRelease.load( atomics::memory_order_relaxed )) {
+                assert( reinterpret_cast<uintptr_t>( pPage ) % m_nSysPageSize == 0 );
+                if ( madvise( reinterpret_cast<char *>( pPage ) + m_nSysPageSize, nLen, MADV_DONTNEED ) != 0 )
+                    m_bRelease.store( false, atomics::memory_order_relaxed );
+            }
+
+            released_page * p = reinterpret_cast<released_page *>( pPage );
+            scoped_lock al( m_Lock );
+            p->pNext = m_pReleased;
+            m_pReleased = p;
+        }
+
+    private:
+        //@cond
+        void * map( size_t nSize, int nFlags )
+        {
+            void * p = mmap( nullptr, nSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | nFlags, -1, 0 );
+            return p == MAP_FAILED ? nullptr : p;
+        }
+
+        bool map_region()
+        {
+            region * pRegion = reinterpret_cast<region *>( ::malloc( sizeof( region )));
+            if ( !pRegion )
+                return false;
+
+            char * pBase = nullptr;
+#       ifdef MAP_HUGETLB
+            if ( HugeTLB && m_nRegionSize % c_nRegionAlignment == 0 )
+                pBase = reinterpret_cast<char *>( map( m_nRegionSize, MAP_HUGETLB ));
+#       endif
+
+            if ( !pBase ) {
+                // Map more than needed and trim the region to 2M boundary
+                int nFlags = 0;
+#           ifdef MAP_NORESERVE
+                nFlags |= MAP_NORESERVE;
+#           endif
+                char * pMap = reinterpret_cast<char *>( map( m_nRegionSize + c_nRegionAlignment, nFlags ));
+                if ( !pMap ) {
+                    ::free( pRegion );
+                    return false;
+                }
+                pBase = reinterpret_cast<char *>( ( reinterpret_cast<uintptr_t>( pMap ) + c_nRegionAlignment - 1 ) & ~( c_nRegionAlignment - 1 ));
+                if ( pBase != pMap )
+                    munmap( pMap, pBase - pMap );
+                char * pEnd = pBase + m_nRegionSize;
+                if ( pEnd != pMap + m_nRegionSize + c_nRegionAlignment )
+                    munmap( pEnd, pMap + m_nRegionSize + c_nRegionAlignment - pEnd );
+
+#           ifdef MADV_HUGEPAGE
+                madvise( pBase, m_nRegionSize, MADV_HUGEPAGE );
+#           endif
+            }
+
+            pRegion->pBase = pBase;
+            pRegion->nSize = m_nRegionSize;
+            pRegion->pNext = m_pRegions;
+            m_pRegions = pRegion;
+
+            m_pCur = pBase;
+            m_pEnd = pBase + m_nRegionSize;
+            return true;
+        }
+        //@endcond
+    };
+#endif // #if CDS_OS_INTERFACE == CDS_OSI_UNIX
+
     /// Implementation of opt::sizeclass_selector option
     /**
         Default size-class selector can manage memory blocks up to 64K.
@@ -444,6 +645,324 @@ namespace michael {
         }
     };
 
+    //@cond
+    namespace details {
+        template <typename Tag>
+        struct lockfree_list_hook
+        {
+            atomics::atomic<lockfree_list_hook *> m_pNext;
+
+            lockfree_list_hook() CDS_NOEXCEPT
+                : m_pNext( nullptr )
+            {}
+        };
+
+        typedef lockfree_list_hook< free_list_tag >     free_list_lockfree_hook;
+        typedef lockfree_list_hook< partial_list_tag >  partial_list_lockfree_hook;
+
+        struct intrusive_lockfree_superblock_desc: public free_list_lockfree_hook, partial_list_lockfree_hook
+        {};
+
+        // Binary logarithm of the descriptor alignment: the low bits of an aligned descriptor address are zero
+        template <size_t N>
+        struct desc_align_bits {
+            static_assert( (N & (N - 1)) == 0, "Alignment must be power of two" );
+            static CDS_CONSTEXPR const unsigned int value = 1 + desc_align_bits< N / 2 >::value;
+        };
+        template <>
+        struct desc_align_bits<1> {
+            static CDS_CONSTEXPR const unsigned int value = 0;
+        };
+
+        // Treiber stack of superblock descriptors with ABA-tagged head.
+        // The descriptors are never returned to the system while the heap is alive,
+        // so a popping thread may safely read m_pNext of the node that has already been popped by another thread;
+        // the tag stored in the head makes the CAS fail in that case.
+        //
+        // If double-width CAS is available (CDS_DCAS_SUPPORT) the head is a {pointer, 64bit tag} pair.
+        // Otherwise the head is one 64bit word: the descriptor pointer is shifted right by log2(Alignment)
+        // (descriptors are allocated with \p Alignment) and the rest of the word is the tag.
+        // A descriptor whose address does not fit into the packed pointer bits (for example, a 57bit address
+        // on a 5-level paging system) is not asserted: it goes to the spin-locked stack instead.
+        template <class T, class Hook, size_t Alignment>
+        class lockfree_desc_stack
+        {
+        public:
+            typedef Hook item_hook;
+
+        protected:
+#ifdef CDS_DCAS_SUPPORT
+            typedef unsigned __int128 dcas_type;
+
+            // m_Head[0] - pointer to the top descriptor, m_Head[1] - tag
+            CDS_DATA_ALIGNMENT(16) uintptr_t m_Head[2];
+#else
+            typedef uint64_t tagged_ptr;
+#   if CDS_BUILD_BITS == 64
+            // 64bit platforms supported by libcds use 48 bits of user-space virtual address by default
+            static CDS_CONSTEXPR const unsigned int c_nAddressBits = 48;
+#   else
+            static CDS_CONSTEXPR const unsigned int c_nAddressBits = 32;
+#   endif
+            static CDS_CONSTEXPR const unsigned int c_nAlignBits = desc_align_bits< Alignment >::value;
+            static CDS_CONSTEXPR const unsigned int c_nPtrBits = c_nAddressBits - c_nAlignBits;
+            static CDS_CONSTEXPR const tagged_ptr c_nPtrMask = (tagged_ptr(1) << c_nPtrBits) - 1;
+
+            atomics::atomic<tagged_ptr>   m_Head;
+
+            // Descriptors whose address cannot be packed into the head
+            atomics::atomic<item_hook *>  m_pLockedHead;
+            cds::sync::spin               m_LockedAccess;
+#endif
+            atomics::atomic<size_t>     m_nSize;
+
+        protected:
+#ifdef CDS_DCAS_SUPPORT
+            static dcas_type make_dcas( item_hook * p, uintptr_t nTag ) CDS_NOEXCEPT
+            {
+                uintptr_t const val[2] = { reinterpret_cast<uintptr_t>( p ), nTag };
+                dcas_type d;
+                memcpy( &d, val, sizeof( d ));
+                return d;
+            }
+
+            // The halves are read separately, the CAS fails if the pair has been torn
+            dcas_type load_head( uintptr_t& nTag, item_hook *& pNode ) const CDS_NOEXCEPT
+            {
+                nTag = __atomic_load_n( &m_Head[1], __ATOMIC_ACQUIRE );
+                pNode = reinterpret_cast<item_hook *>( __atomic_load_n( &m_Head[0], __ATOMIC_ACQUIRE ));
+                return make_dcas( pNode, nTag );
+            }
+
+            bool cas_head( dcas_type expected, dcas_type desired ) CDS_NOEXCEPT
+            {
+                return __sync_bool_compare_and_swap( reinterpret_cast<dcas_type *>( m_Head ), expected, desired );
+            }
+#else
+            static bool packable( T * pDesc ) CDS_NOEXCEPT
+            {
+                uint64_t const nAddr = static_cast<uint64_t>( reinterpret_cast<uintptr_t>( pDesc ));
+                return ( nAddr & ( Alignment - 1 )) == 0 && ( nAddr >> c_nAddressBits ) == 0;
+            }
+            static tagged_ptr make_tagged( T * p, tagged_ptr nTag ) CDS_NOEXCEPT
+            {
+                return ( static_cast<tagged_ptr>( reinterpret_cast<uintptr_t>( p )) >> c_nAlignBits )
+                    | ( nTag << c_nPtrBits );
+            }
+            static T * get_ptr( tagged_ptr t ) CDS_NOEXCEPT
+            {
+                return reinterpret_cast<T *>( static_cast<uintptr_t>(( t & c_nPtrMask ) << c_nAlignBits ));
+            }
+            static tagged_ptr get_tag( tagged_ptr t ) CDS_NOEXCEPT
+            {
+                return t >> c_nPtrBits;
+            }
+
+            void push_locked( item_hook * pNode ) CDS_NOEXCEPT
+            {
+                std::unique_lock<cds::sync::spin> al( m_LockedAccess );
+                pNode->m_pNext.store( m_pLockedHead.load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                m_pLockedHead.store( pNode, atomics::memory_order_relaxed );
+            }
+
+            T * pop_locked() CDS_NOEXCEPT
+            {
+                if ( m_pLockedHead.load( atomics::memory_order_relaxed ) == nullptr )
+                    return nullptr;
+
+                std::unique_lock<cds::sync::spin> al( m_LockedAccess );
+                item_hook * pNode = m_pLockedHead.load( atomics::memory_order_relaxed );
+                if ( pNode )
+                    m_pLockedHead.store( pNode->m_pNext.load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                return static_cast<T *>( pNode );
+            }
+#endif
+
+        public:
+            lockfree_desc_stack() CDS_NOEXCEPT
+#ifdef CDS_DCAS_SUPPORT
+                : m_nSize( 0 )
+            {
+                m_Head[0] = m_Head[1] = 0;
+            }
+#else
+                : m_Head( 0 )
+                , m_pLockedHead( nullptr )
+                , m_nSize( 0 )
+            {}
+#endif
+
+            void push( T * pDesc ) CDS_NOEXCEPT
+            {
+                item_hook * pNode = static_cast<item_hook *>( pDesc );
+#ifdef CDS_DCAS_SUPPORT
+                uintptr_t nTag;
+                item_hook * pTop;
+                dcas_type cur;
+                do {
+                    cur = load_head( nTag, pTop );
+                    pNode->m_pNext.store( pTop, atomics::memory_order_relaxed );
+                    // The tag is incremented on push only: the head may come back to the same node only by push
+                } while ( !cas_head( cur, make_dcas( pNode, nTag + 1 )));
+#else
+                if ( packable( pDesc )) {
+                    tagged_ptr cur = m_Head.load( atomics::memory_order_relaxed );
+                    do {
+                        pNode->m_pNext.store( static_cast<item_hook *>( get_ptr( cur )), atomics::memory_order_relaxed );
+                        // The tag is incremented on push only: the head may come back to the same node only by push
+                    } while ( !m_Head.compare_exchange_weak( cur, make_tagged( pDesc, get_tag( cur ) + 1 ),
+                        atomics::memory_order_release, atomics::memory_order_relaxed ));
+                }
+                else
+                    push_locked( pNode );
+#endif
+                m_nSize.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+
+            T * pop() CDS_NOEXCEPT
+            {
+#ifdef CDS_DCAS_SUPPORT
+                uintptr_t nTag;
+                item_hook * pNode;
+                for ( dcas_type cur = load_head( nTag, pNode ); pNode; cur = load_head( nTag, pNode )) {
+                    item_hook * pNext = pNode->m_pNext.load( atomics::memory_order_relaxed );
+                    if ( cas_head( cur, make_dcas( pNext, nTag ))) {
+                        m_nSize.fetch_sub( 1, atomics::memory_order_relaxed );
+                        return static_cast<T *>( pNode );
+                    }
+                }
+                return nullptr;
+#else
+                tagged_ptr cur = m_Head.load( atomics::memory_order_acquire );
+                while ( get_ptr( cur )) {
+                    T * pDesc = get_ptr( cur );
+                    // Only packable descriptors are linked into the lock-free stack
+                    T * pNext = static_cast<T *>( static_cast<item_hook *>( pDesc )->m_pNext.load( atomics::memory_order_relaxed ));
+                    if ( m_Head.compare_exchange_weak( cur, make_tagged( pNext, get_tag( cur )),
+                        atomics::memory_order_acquire, atomics::memory_order_acquire ))
+                    {
+                        m_nSize.fetch_sub( 1, atomics::memory_order_relaxed );
+                        return pDesc;
+                    }
+                }
+
+                T * pDesc = pop_locked();
+                if ( pDesc )
+                    m_nSize.fetch_sub( 1, atomics::memory_order_relaxed );
+                return pDesc;
+#endif
+            }
+
+            size_t size() const CDS_NOEXCEPT
+            {
+                return m_nSize.load( atomics::memory_order_relaxed );
+            }
+        };
+    }
+    //@endcond
+
+    /// Lock-free list of free superblock descriptor
+    /**
+        This class is a implementation of \ref opt::free_list option.
+
+        The list is Treiber's stack with ABA-tagged head [2004 Michael].
+        If \p CDS_DCAS_SUPPORT is defined (on amd64 it requires \p -mcx16 compiler flag)
+        the head is a pointer and 64bit tag changed by double-width CAS.
+        Otherwise the pointer and the tag are packed into one 64bit word: the descriptor is
+        aligned on \p Alignment bytes, so its low log2(\p Alignment) bits widen the tag.
+        A descriptor with an address that cannot be packed is kept in the internal spin-locked list.
+        Unlike \ref free_list_locked, concurrent \p push() and \p pop() never block each other.
+
+        Template parameters:
+        - \p T - superblock descriptor type
+        - \p Alignment - alignment of superblock descriptors, the default is cache line size
+            as the heap allocates the descriptors
+    */
+    template <class T = details::intrusive_lockfree_superblock_desc, size_t Alignment = cds::c_nCacheLineSize>
+    class free_list_lockfree: public details::lockfree_desc_stack< T, details::free_list_lockfree_hook, Alignment >
+    {
+        //@cond
+        typedef details::lockfree_desc_stack< T, details::free_list_lockfree_hook, Alignment > base_class;
+        //@endcond
+    public:
+        typedef details::free_list_lockfree_hook item_hook; ///< Item hook
+
+        /// Rebinds to other item type \p T2
+        template <class T2>
+        struct rebind {
+            typedef free_list_lockfree<T2, Alignment>    other   ;   ///< rebind result
+        };
+
+    public:
+        /// Push superblock descriptor to free-list
+        void push( T * pDesc )
+        {
+            base_class::push( pDesc );
+        }
+
+        /// Pop superblock descriptor from free-list
+        T * pop()
+        {
+            return base_class::pop();
+        }
+
+        /// Returns current count of superblocks in free-list (approximate)
+        size_t size() const
+        {
+            return base_class::size();
+        }
+    };
+
+    /// Lock-free list of partial filled superblock descriptor
+    /**
+        This class is a implementation of \ref opt::partial_list option.
+
+        The list is Treiber's stack with ABA-tagged head like \ref free_list_lockfree.
+        An arbitrary element cannot be removed from the lock-free stack, so \p unlink() always returns \p false:
+        the superblock that has become empty stays in the list and is freed lazily
+        when the allocator pops it while searching a partial superblock, as it is proposed in [2004 Michael].
+    */
+    template <class T = details::intrusive_lockfree_superblock_desc, size_t Alignment = cds::c_nCacheLineSize>
+    class partial_list_lockfree: public details::lockfree_desc_stack< T, details::partial_list_lockfree_hook, Alignment >
+    {
+        //@cond
+        typedef details::lockfree_desc_stack< T, details::partial_list_lockfree_hook, Alignment > base_class;
+        //@endcond
+    public:
+        typedef details::partial_list_lockfree_hook item_hook; ///< Item hook
+
+        /// Rebinds to other item type \p T2
+        template <class T2>
+        struct rebind {
+            typedef partial_list_lockfree<T2, Alignment>    other   ;   ///< rebind result
+        };
+
+    public:
+        /// Push a superblock \p pDesc to the list
+        void push( T * pDesc )
+        {
+            base_class::push( pDesc );
+        }
+
+        /// Pop superblock from the list
+        T * pop()
+        {
+            return base_class::pop();
+        }
+
+        /// Removes \p pDesc descriptor from the list - not supported, always returns \p false
+        bool unlink( T * /*pDesc*/ )
+        {
+            return false;
+        }
+
+        /// Count of element in the list (approximate)
+        size_t size() const
+        {
+            return base_class::size();
+        }
+    };
+
     /// Summary processor heap statistics
     /**
         Summary heap statistics for use with Heap::summaryStat function.
@@ -623,14 +1142,15 @@ namespace michael {
         - \ref opt::aligned_heap - option setter for a heap used for internal aligned memory management.
             Default is \ref aligned_malloc_heap
         - \ref opt::page_heap - option setter for a heap used for page (superblock) allocation of 64K/1M size.
-            Default is \ref page_cached_allocator
+            Default is \ref page_cached_allocator, the page heap based on huge-page \p mmap regions
+            is \ref mmap_page_allocator
         - \ref opt::sizeclass_selector - option setter for a class used to select appropriate size-class
             for incoming allocation request.
             Default is \ref default_sizeclass_selector
         - \ref opt::free_list - option setter for a class to manage a list of free superblock descriptors
-            Default is \ref free_list_locked
+            Default is \ref free_list_locked, lock-free alternative is \ref free_list_lockfree
         - \ref opt::partial_list - option setter for a class to manage a list of partial filled superblocks
-            Default is \ref partial_list_locked
+            Default is \ref partial_list_locked, lock-free alternative is \ref partial_list_lockfree
         - \ref opt::procheap_stat - option setter for a class to gather internal statistics for memory allocation
             that is maintained by the heap.
             Default is \ref procheap_empty_stat
@@ -641,6 +1161,10 @@ namespace michael {
             Default is \ref os_allocated_empty
         - \ref opt::check_bounds - a bound checker.
             Default is no bound checker (cds::opt::none)
+        - \ref opt::numa_binding - bind superblocks of processor heap to the processor's NUMA node.
+            Default is \p false
+        - \ref opt::thread_cache - capacity of per-thread magazine of free blocks for each size class.
+            Default is 0 (no per-thread cache)
 
         \par Usage:
         The heap is the basic building block for your allocator or <tt> operator new</tt> implementation.
@@ -737,6 +1261,8 @@ namespace michael {
             typedef procheap_empty_stat         procheap_stat;
             typedef os_allocated_empty          os_allocated_stat;
             typedef cds::opt::none              check_bounds;
+            static CDS_CONSTEXPR const bool     numa_binding = false;
+            static CDS_CONSTEXPR const size_t   thread_cache = 0;
         };
         //@endcond
 
@@ -757,6 +1283,8 @@ namespace michael {
         typedef typename options::procheap_stat         procheap_stat       ;   ///< effective processor heap statistics
         typedef typename options::os_allocated_stat     os_allocated_stat   ;   ///< effective OS-allocated memory statistics
         typedef details::bound_checker_selector< typename options::check_bounds >    bound_checker   ;  ///< effective bound checker
+        static CDS_CONSTEXPR const bool c_bNumaBinding = options::numa_binding; ///< effective \ref opt::numa_binding value
+        static CDS_CONSTEXPR const size_t c_nThreadCacheCapacity = options::thread_cache; ///< effective \ref opt::thread_cache value
 
         // forward declarations
         //@cond
@@ -1178,15 +1706,61 @@ namespace michael {
             processor_heap *    arrProcHeap     ; ///< array of processor heap
             free_list           listSBDescFree  ; ///< List of free superblock descriptors
             page_heap *         pageHeaps       ; ///< array of page heap (one for each page size)
+            unsigned int        nNode           ; ///< NUMA node of the processor
 
             //@cond
             processor_desc()
                 : arrProcHeap( nullptr )
                 , pageHeaps( nullptr )
+                , nNode( 0 )
             {}
             //@endcond
         };
 
+        /// Per-thread magazine of free blocks of a size class
+        struct magazine
+        {
+            size_t          nCount  ;   ///< count of blocks in the magazine
+            block_header *  arrBlocks[ c_nThreadCacheCapacity ? c_nThreadCacheCapacity : 1 ]; ///< free blocks, the last is the hottest
+        };
+
+        /// Per-thread cache of the heap: the magazines for each size class
+        struct thread_magazines: public thread_cache_record
+        {
+            thread_magazines *  pNextInHeap     ; ///< next record of the heap
+            size_t              nMagazineCount  ; ///< size class count
+            magazine *          arrMagazine     ; ///< magazines, placed just after the record
+
+            //@cond
+            thread_magazines( Heap * pHeap, size_t nCount )
+                : thread_cache_record( pHeap )
+                , pNextInHeap( nullptr )
+                , nMagazineCount( nCount )
+                , arrMagazine( reinterpret_cast<magazine *>( this + 1 ))
+            {
+                for ( size_t i = 0; i < nCount; ++i )
+                    arrMagazine[i].nCount = 0;
+            }
+
+            virtual void release()
+            {
+                Heap * pHeap = static_cast<Heap *>( m_pOwner.load( atomics::memory_order_acquire ));
+                if ( pHeap )
+                    pHeap->release_thread_cache( this );
+                else {
+                    // The heap has been destroyed, the cached blocks are already freed
+                    destroy( this );
+                }
+            }
+
+            static void destroy( thread_magazines * p )
+            {
+                p->~thread_magazines();
+                cds::OS::aligned_free( p );
+            }
+            //@endcond
+        };
+
 
     protected:
         sys_topology        m_Topology           ;  ///< System topology
@@ -1195,8 +1769,13 @@ namespace michael {
         sizeclass_selector  m_SizeClassSelector  ;  ///< Size-class selector
         atomics::atomic<processor_desc *> *   m_arrProcDesc  ;  ///< array of pointers to the processor descriptors
         unsigned int        m_nProcessorCount    ;  ///< Processor count
+        bool                m_bNumaBinding       ;  ///< Superblocks are bound to NUMA node, see \ref opt::numa_binding
         bound_checker       m_BoundChecker       ;  ///< Bound checker
 
+        cds::sync::spin     m_ThreadCacheLock    ;  ///< Lock for \p m_pThreadCacheList
+        thread_magazines *  m_pThreadCacheList   ;  ///< List of per-thread caches, see \ref opt::thread_cache
+        bool                m_bThreadCacheOn     ;  ///< Per-thread caches are disabled when the heap is being destroyed
+
         os_allocated_stat   m_OSAllocStat        ;  ///< OS-allocated memory statistics
 
     protected:
@@ -1453,7 +2032,6 @@ namespace michael {
         /// Allocates new processor descriptor
         processor_desc * new_processor_desc( unsigned int nProcessorId )
         {
-            CDS_UNUSED( nProcessorId );
             processor_desc * pDesc;
             const size_t nPageHeapCount = m_SizeClassSelector.pageTypeCount();
 
@@ -1487,6 +2065,8 @@ namespace michael {
             CDS_TSAN_ANNOTATE_IGNORE_WRITES_BEGIN;
 
             pDesc = new( m_AlignedHeap.alloc( szTotal, c_nAlignment ) ) processor_desc;
+            if ( m_bNumaBinding )
+                pDesc->nNode = processor_node( nProcessorId, std::integral_constant<bool, c_bNumaBinding>() );
 
             pDesc->pageHeaps = reinterpret_cast<page_heap *>( pDesc + 1 );
             for ( size_t i = 0; i < nPageHeapCount; ++i )
@@ -1617,10 +2197,146 @@ namespace michael {
                 return (byte *) alloc( pProcHeap->pSizeClass->nSBSize );
             }
             else {
-                return (byte *) pProcHeap->pProcDesc->pageHeaps[pProcHeap->nPageIdx].alloc();
+                byte * pSB = (byte *) pProcHeap->pProcDesc->pageHeaps[pProcHeap->nPageIdx].alloc();
+                if ( pSB && m_bNumaBinding ) {
+                    bind_memory( pSB, pProcHeap->pSizeClass->nSBSize, pProcHeap->pProcDesc->nNode,
+                        std::integral_constant<bool, c_bNumaBinding>() );
+                }
+                return pSB;
             }
         }
 
+        // NUMA helpers, the topology is required to support NUMA interface only if opt::numa_binding is enabled
+        bool numa_available( std::true_type ) const
+        {
+            return m_Topology.node_count() > 1;
+        }
+        bool numa_available( std::false_type ) const
+        {
+            return false;
+        }
+        unsigned int processor_node( unsigned int nProcessorId, std::true_type ) const
+        {
+            return m_Topology.processor_node( nProcessorId );
+        }
+        unsigned int processor_node( unsigned int /*nProcessorId*/, std::false_type ) const
+        {
+            return 0;
+        }
+        void bind_memory( byte * pSB, size_t nSize, unsigned int nNode, std::true_type )
+        {
+            m_Topology.bind_memory( pSB, nSize, nNode );
+        }
+        void bind_memory( byte * /*pSB*/, size_t /*nSize*/, unsigned int /*nNode*/, std::false_type )
+        {}
+
+        // Per-thread cache helpers, see opt::thread_cache
+        typedef std::integral_constant<bool, (c_nThreadCacheCapacity > 0)> thread_cache_enabled;
+
+        /// Returns the cache of current thread, \p nullptr if the thread is not attached to libcds
+        thread_magazines * get_thread_cache()
+        {
+            if ( !m_bThreadCacheOn || !cds::threading::Manager::isThreadAttached() )
+                return nullptr;
+            cds::threading::ThreadData * pData = cds::threading::Manager::thread_data();
+            if ( pData->m_nAttachCount == 0 ) {
+                // The thread is being detached
+                return nullptr;
+            }
+
+            thread_cache_record * pRec = pData->m_HeapCache.find( this );
+            if ( pRec )
+                return static_cast<thread_magazines *>( pRec );
+
+            const size_t nCount = m_SizeClassSelector.size();
+            thread_magazines * pCache = new( cds::OS::aligned_malloc( sizeof(thread_magazines) + sizeof(magazine) * nCount, c_nAlignment ))
+                thread_magazines( this, nCount );
+            {
+                std::unique_lock<cds::sync::spin> al( m_ThreadCacheLock );
+                pCache->pNextInHeap = m_pThreadCacheList;
+                m_pThreadCacheList = pCache;
+            }
+            pData->m_HeapCache.link( pCache );
+            return pCache;
+        }
+
+        /// Returns cached blocks of \p pCache to the processor heaps and frees \p pCache
+        void release_thread_cache( thread_magazines * pCache )
+        {
+            {
+                std::unique_lock<cds::sync::spin> al( m_ThreadCacheLock );
+                thread_magazines * pPrev = nullptr;
+                for ( thread_magazines * p = m_pThreadCacheList; p; pPrev = p, p = p->pNextInHeap ) {
+                    if ( p == pCache ) {
+                        if ( pPrev )
+                            pPrev->pNextInHeap = p->pNextInHeap;
+                        else
+                            m_pThreadCacheList = p->pNextInHeap;
+                        break;
+                    }
+                }
+            }
+
+            for ( size_t i = 0; i < pCache->nMagazineCount; ++i ) {
+                magazine& mag = pCache->arrMagazine[i];
+                for ( size_t k = 0; k < mag.nCount; ++k )
+                    free_block( mag.arrBlocks[k] );
+                mag.nCount = 0;
+            }
+            thread_magazines::destroy( pCache );
+        }
+
+        block_header * alloc_from_thread_cache( typename sizeclass_selector::sizeclass_index nSizeClassIndex, std::true_type )
+        {
+            thread_magazines * pCache = get_thread_cache();
+            if ( pCache ) {
+                magazine& mag = pCache->arrMagazine[nSizeClassIndex];
+                if ( mag.nCount )
+                    return mag.arrBlocks[--mag.nCount];
+            }
+            return nullptr;
+        }
+        block_header * alloc_from_thread_cache( typename sizeclass_selector::sizeclass_index /*nSizeClassIndex*/, std::false_type )
+        {
+            return nullptr;
+        }
+
+        bool free_to_thread_cache( block_header * pBlock, std::true_type )
+        {
+            thread_magazines * pCache = get_thread_cache();
+            if ( !pCache )
+                return false;
+
+            processor_heap_base * pProcHeap = pBlock->desc()->pProcHeap;
+            magazine& mag = pCache->arrMagazine[ static_cast<processor_heap *>( pProcHeap ) - pProcHeap->pProcDesc->arrProcHeap ];
+            if ( mag.nCount == c_nThreadCacheCapacity ) {
+                // The magazine is full: return the coldest half to the processor heaps
+                const size_t nDrain = c_nThreadCacheCapacity - c_nThreadCacheCapacity / 2;
+                for ( size_t i = 0; i < nDrain; ++i )
+                    free_block( mag.arrBlocks[i] );
+                mag.nCount -= nDrain;
+                memmove( mag.arrBlocks, mag.arrBlocks + nDrain, sizeof(mag.arrBlocks[0]) * mag.nCount );
+            }
+            mag.arrBlocks[mag.nCount++] = pBlock;
+            return true;
+        }
+        bool free_to_thread_cache( block_header * /*pBlock*/, std::false_type )
+        {
+            return false;
+        }
+
+        /// Detaches per-thread caches from the heap being destroyed
+        void orphan_thread_caches()
+        {
+            // The destructor frees self-allocated pages by free(), they must not be cached
+            m_bThreadCacheOn = false;
+
+            std::unique_lock<cds::sync::spin> al( m_ThreadCacheLock );
+            for ( thread_magazines * p = m_pThreadCacheList; p; p = p->pNextInHeap )
+                p->m_pOwner.store( nullptr, atomics::memory_order_release );
+            m_pThreadCacheList = nullptr;
+        }
+
         /// Frees superblock descriptor and its page
         void free_superblock( superblock_desc * pDesc )
         {
@@ -1637,6 +2353,50 @@ namespace michael {
             pProcDesc->listSBDescFree.push( pDesc );
         }
 
+        /// Returns the block to its superblock
+        void free_block( block_header * pBlock )
+        {
+            superblock_desc * pDesc = pBlock->desc();
+            anchor_tag oldAnchor;
+            anchor_tag newAnchor;
+            processor_heap_base * pProcHeap = pDesc->pProcHeap;
+
+            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
+
+            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
+            do {
+                newAnchor = oldAnchor;
+                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
+                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
+                newAnchor.tag += 1;
+
+                assert( oldAnchor.state != SBSTATE_EMPTY );
+
+                if ( oldAnchor.state == SBSTATE_FULL )
+                    newAnchor.state = SBSTATE_PARTIAL;
+
+                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
+                    //pProcHeap = pDesc->pProcHeap;
+                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
+                    newAnchor.state = SBSTATE_EMPTY;
+                }
+                else
+                    newAnchor.count += 1;
+            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
+
+            pProcHeap->stat.incFreeCount();
+
+            if ( newAnchor.state == SBSTATE_EMPTY ) {
+                if ( pProcHeap->unlink_partial( pDesc ))
+                    free_superblock( pDesc );
+            }
+            else if (oldAnchor.state == SBSTATE_FULL ) {
+                assert( pProcHeap != nullptr );
+                pProcHeap->stat.decDescFull();
+                pProcHeap->add_partial( pDesc );
+            }
+        }
+
         /// Allocate memory block
         block_header * int_alloc(
             size_t nSize    ///< Size of memory block to allocate in bytes
@@ -1648,7 +2408,10 @@ namespace michael {
             }
             assert( nSizeClassIndex < m_SizeClassSelector.size() );
 
-            block_header * pBlock;
+            block_header * pBlock = alloc_from_thread_cache( nSizeClassIndex, thread_cache_enabled() );
+            if ( pBlock )
+                return pBlock;
+
             processor_heap * pProcHeap;
             while ( true ) {
                 pProcHeap = find_heap( nSizeClassIndex );
@@ -1673,11 +2436,14 @@ namespace michael {
     public:
         /// Heap constructor
         Heap()
+            : m_pThreadCacheList( nullptr )
+            , m_bThreadCacheOn( true )
         {
             // Explicit libcds initialization is needed since a static object may be constructed
             cds::Initialize();
 
             m_nProcessorCount = m_Topology.processor_count();
+            m_bNumaBinding = numa_available( std::integral_constant<bool, c_bNumaBinding>() );
             m_arrProcDesc = new( m_AlignedHeap.alloc(sizeof(processor_desc *) * m_nProcessorCount, c_nAlignment ))
                 atomics::atomic<processor_desc *>[ m_nProcessorCount ];
             memset( m_arrProcDesc, 0, sizeof(processor_desc *) * m_nProcessorCount )    ;   // ?? memset for atomic<>
@@ -1689,6 +2455,8 @@ namespace michael {
         */
         ~Heap()
         {
+            orphan_thread_caches();
+
             for ( unsigned int i = 0; i < m_nProcessorCount; ++i ) {
                 processor_desc * pDesc = m_arrProcDesc[i].load(atomics::memory_order_relaxed);
                 if ( pDesc )
@@ -1749,45 +2517,8 @@ namespace michael {
                 pDesc->nBlockSize
             );
 
-
-            anchor_tag oldAnchor;
-            anchor_tag newAnchor;
-            processor_heap_base * pProcHeap = pDesc->pProcHeap;
-
-            pProcHeap->stat.incDeallocatedBytes( pDesc->nBlockSize );
-
-            oldAnchor = pDesc->anchor.load(atomics::memory_order_acquire);
-            do {
-                newAnchor = oldAnchor;
-                reinterpret_cast<free_block_header *>( pBlock )->nNextFree = oldAnchor.avail;
-                newAnchor.avail = (reinterpret_cast<byte *>( pBlock ) - pDesc->pSB) / pDesc->nBlockSize;
-                newAnchor.tag += 1;
-
-                assert( oldAnchor.state != SBSTATE_EMPTY );
-
-                if ( oldAnchor.state == SBSTATE_FULL )
-                    newAnchor.state = SBSTATE_PARTIAL;
-
-                if ( oldAnchor.count == pDesc->nCapacity - 1 ) {
-                    //pProcHeap = pDesc->pProcHeap;
-                    //CDS_COMPILER_RW_BARRIER         ;   // instruction fence is needed?..
-                    newAnchor.state = SBSTATE_EMPTY;
-                }
-                else
-                    newAnchor.count += 1;
-            } while ( !pDesc->anchor.compare_exchange_strong( oldAnchor, newAnchor, atomics::memory_order_release, atomics::memory_order_relaxed ) );
-
-            pProcHeap->stat.incFreeCount();
-
-            if ( newAnchor.state == SBSTATE_EMPTY ) {
-                if ( pProcHeap->unlink_partial( pDesc ))
-                    free_superblock( pDesc );
-            }
-            else if (oldAnchor.state == SBSTATE_FULL ) {
-                assert( pProcHeap != nullptr );
-                pProcHeap->stat.decDescFull();
-                pProcHeap->add_partial( pDesc );
-            }
+            if ( !free_to_thread_cache( pBlock, thread_cache_enabled() ))
+                free_block( pBlock );
         }
 
         /// Reallocate memory block
@@ -112,6 +112,7 @@ namespace cds { namespace memory { namespace michael {
             Available \p HEAP implementations:
                 - page_allocator
                 - page_cached_allocator
+                - mmap_page_allocator (Unix-like systems only)
         */
         template <typename HEAP>
         struct page_heap {
@@ -146,6 +147,7 @@ namespace cds { namespace memory { namespace michael {
         /**
             Available \p Type implementations:
                 - free_list_locked
+                - free_list_lockfree
         */
         template <typename Type>
         struct free_list {
@@ -161,6 +163,7 @@ namespace cds { namespace memory { namespace michael {
         /**
             Available \p Type implementations:
                 - partial_list_locked
+                - partial_list_lockfree
         */
         template <typename Type>
         struct partial_list {
@@ -220,6 +223,53 @@ namespace cds { namespace memory { namespace michael {
             //@endcond
         };
 
+        /// Option setter for NUMA-local superblocks
+        /**
+            If \p Enable is \p true, each superblock obtained from the page heap is bound
+            to the NUMA node of the processor that owns the processor heap,
+            see \p sys_topology::bind_memory(). Thus, the memory of a processor heap
+            is placed on the processor's local node even if the page is reused from the page cache.
+            The binding is performed only if the system has more than one NUMA node.
+
+            The topology class specified by \ref sys_topology option should provide
+            \p node_count(), \p processor_node() and \p bind_memory() functions
+            if the option is enabled, see cds::OS::Linux::topology.
+
+            Default is \p false.
+        */
+        template <bool Enable>
+        struct numa_binding {
+            //@cond
+            template <class BASE> struct pack: public BASE
+            {
+                static CDS_CONSTEXPR const bool numa_binding = Enable;
+            };
+            //@endcond
+        };
+
+        /// Option setter for per-thread magazine cache
+        /**
+            If \p Capacity is not zero, each thread attached to \p libcds (see \ref cds_threading)
+            has its own cache of free blocks for each size class of the heap - the magazine that contains
+            up to \p Capacity blocks. The heap serves \p alloc() and \p free() from the magazine without
+            any atomic operation; if the magazine is full, a half of it is returned to the processor heaps,
+            and the whole magazine is flushed when the thread is detached.
+            The threads not attached to \p libcds use the processor heaps directly.
+
+            The heap must not be destroyed concurrently with detaching of the threads that have used it.
+
+            Default is 0 - the cache is disabled.
+        */
+        template <size_t Capacity>
+        struct thread_cache {
+            //@cond
+            template <class BASE> struct pack: public BASE
+            {
+                static CDS_CONSTEXPR const size_t thread_cache = Capacity;
+            };
+            //@endcond
+        };
+
         /// Option setter for bounds checking
         /**
             This option defines a strategy to check upper memory boundary of allocated blocks.
@@ -0,0 +1,126 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_TLS_H
+#define CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_TLS_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace memory { namespace michael {
+
+    /// Per-thread cache record of a heap
+    /** @headerfile cds/memory/michael/allocator.h
+        Each \p Heap instance with enabled \p opt::thread_cache option has its own record
+        for each thread that has allocated or freed a block.
+        The records are owned by the thread and are linked in \p thread_cache_list of \p cds::threading::ThreadData.
+    */
+    struct thread_cache_record
+    {
+        thread_cache_record *    m_pNextInThread ;   ///< Next record of the same thread
+        atomics::atomic<void *>  m_pOwner        ;   ///< Owner heap, \p nullptr if the heap has been destroyed
+
+        //@cond
+        explicit thread_cache_record( void * pOwner )
+            : m_pNextInThread( nullptr )
+            , m_pOwner( pOwner )
+        {}
+
+        virtual ~thread_cache_record()
+        {}
+        //@endcond
+
+        /// Returns cached blocks to the owner heap and frees the record
+        virtual void release() = 0;
+    };
+
+    /// List of heap cache records of a thread
+    /** @headerfile cds/memory/michael/allocator.h
+    */
+    class thread_cache_list
+    {
+        //@cond
+        thread_cache_record * m_pHead;
+        //@endcond
+    public:
+        //@cond
+        thread_cache_list()
+            : m_pHead( nullptr )
+        {}
+
+        ~thread_cache_list()
+        {
+            assert( m_pHead == nullptr );
+        }
+        //@endcond
+
+        /// Finds the record of heap \p pOwner
+        /**
+            The record found is moved to the head of the list since a thread usually works with one heap.
+        */
+        thread_cache_record * find( void * pOwner )
+        {
+            thread_cache_record * pPrev = nullptr;
+            for ( thread_cache_record * p = m_pHead; p; pPrev = p, p = p->m_pNextInThread ) {
+                if ( p->m_pOwner.load( atomics::memory_order_relaxed ) == pOwner ) {
+                    if ( pPrev ) {
+                        pPrev->m_pNextInThread = p->m_pNextInThread;
+                        p->m_pNextInThread = m_pHead;
+                        m_pHead = p;
+                    }
+                    return p;
+                }
+            }
+            return nullptr;
+        }
+
+        /// Links new record \p pRec to the list
+        void link( thread_cache_record * pRec )
+        {
+            assert( pRec->m_pNextInThread == nullptr );
+            pRec->m_pNextInThread = m_pHead;
+            m_pHead = pRec;
+        }
+
+        /// Releases all records of the list, called when the thread is detached
+        void release_all()
+        {
+            thread_cache_record * p = m_pHead;
+            m_pHead = nullptr;
+            while ( p ) {
+                thread_cache_record * pNext = p->m_pNextInThread;
+                p->release();
+                p = pNext;
+            }
+        }
+    };
+
+}}} // namespace cds::memory::michael
+
+#endif // #ifndef CDSLIB_MEMORY_MICHAEL_THREAD_CACHE_TLS_H
@@ -760,6 +760,18 @@ namespace cds { namespace opt {
                 return m_nCounter--;
             }
 
+            /// Adds \p n to the counter. Semantics: returns new value
+            counter_type operator +=( counter_type n )
+            {
+                return m_nCounter += n;
+            }
+
+            /// Subtracts \p n from the counter. Semantics: returns new value
+            counter_type operator -=( counter_type n )
+            {
+                return m_nCounter -= n;
+            }
+
             /// Preincrement
             counter_type operator ++()
             {
@@ -60,6 +60,33 @@ namespace cds { namespace OS { namespace details {
         {
             return current_processor();
         }
+
+        /// NUMA node count for the system
+        /**
+            NUMA topology is not supported for the OS, the system is considered as one node
+        */
+        static unsigned int node_count()
+        {
+            return 1;
+        }
+
+        /// Returns NUMA node id of processor \p nProcessor. Always returns 0
+        static unsigned int processor_node( unsigned int /*nProcessor*/ )
+        {
+            return 0;
+        }
+
+        /// Returns NUMA node id of current processor. Always returns 0
+        static unsigned int current_node()
+        {
+            return 0;
+        }
+
+        /// Sets preferred NUMA node for memory region. Not supported, always returns \p false
+        static bool bind_memory( void * /*pMemory*/, size_t /*nSize*/, unsigned int /*nNode*/ )
+        {
+            return false;
+        }
     };
 }}}  // namespace cds::OS::details
 //@endcond
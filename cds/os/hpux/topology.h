@@ -78,6 +78,43 @@ namespace cds { namespace OS {
                 return ::mpctl( MPC_GETCURRENTSPU, 0, 0 );
             }
 
+            /// NUMA node (locality domain) count for the system
+            /**
+                The value is the max locality domain id plus one
+            */
+            static unsigned int node_count()
+            {
+                unsigned int nCount = 1;
+                for ( size_t i = 0; i < s_nProcMapSize; ++i ) {
+                    if ( s_procMap[i].nNativeProcNo != -1 && s_procMap[i].nCell + 1 > nCount )
+                        nCount = s_procMap[i].nCell + 1;
+                }
+                return nCount;
+            }
+
+            /// Returns NUMA node (locality domain) of processor \p nProcessor
+            static unsigned int processor_node( unsigned int nProcessor )
+            {
+                for ( size_t i = 0; i < s_nProcMapSize; ++i ) {
+                    if ( s_procMap[i].nProcNo == nProcessor )
+                        return s_procMap[i].nCell;
+                }
+                return 0;
+            }
+
+            /// Returns NUMA node (locality domain) of current processor
+            static unsigned int current_node()
+            {
+                unsigned int nProc = native_current_processor();
+                return nProc < s_nProcMapSize ? s_procMap[ nProc ].nCell : 0;
+            }
+
+            /// Sets preferred NUMA node for memory region. Not supported, always returns \p false
+            static bool bind_memory( void * /*pMemory*/, size_t /*nSize*/, unsigned int /*nNode*/ )
+            {
+                return false;
+            }
+
             //@cond
             static void init();
             static void fini();
@@ -49,11 +49,19 @@ namespace cds { namespace OS {
         /**
             The implementation assumes that processor IDs are in numerical order
             from 0 to N - 1, where N - count of processor in the system
+
+            NUMA topology is read from \p /sys/devices/system/node, last-level cache sharing
+            is read from \p /sys/devices/system/cpu/cpuN/cache. If \p sysfs is not available,
+            the system is considered as one NUMA node and one cache group.
         */
         struct topology {
         private:
             //@cond
             static unsigned int     s_nProcessorCount;
+            static unsigned int     s_nNodeCount;
+            static unsigned int *   s_arrProcNode;
+            static unsigned int     s_nCacheGroupCount;
+            static unsigned int *   s_arrProcCacheGroup;
             //@endcond
         public:
 
@@ -105,6 +113,58 @@ namespace cds { namespace OS {
                 return current_processor();
             }
 
+            /// NUMA node count for the system
+            /**
+                The value is the max NUMA node id plus one, so a node id returned by \ref processor_node
+                is always less than \p node_count().
+            */
+            static unsigned int node_count()
+            {
+                return s_nNodeCount;
+            }
+
+            /// Returns NUMA node id of processor \p nProcessor
+            static unsigned int processor_node( unsigned int nProcessor )
+            {
+                return s_arrProcNode && nProcessor < s_nProcessorCount ? s_arrProcNode[ nProcessor ] : 0;
+            }
+
+            /// Returns NUMA node id of current processor
+            static unsigned int current_node()
+            {
+                return processor_node( current_processor() );
+            }
+
+            /// Returns count of processor groups sharing last-level cache
+            static unsigned int cache_group_count()
+            {
+                return s_nCacheGroupCount;
+            }
+
+            /// Returns last-level cache group of processor \p nProcessor
+            /**
+                Processors that share last-level cache have the same cache group in range <tt>[0, cache_group_count())</tt>
+            */
+            static unsigned int processor_cache_group( unsigned int nProcessor )
+            {
+                return s_arrProcCacheGroup && nProcessor < s_nProcessorCount ? s_arrProcCacheGroup[ nProcessor ] : 0;
+            }
+
+            /// Returns last-level cache group of current processor
+            static unsigned int current_cache_group()
+            {
+                return processor_cache_group( current_processor() );
+            }
+
+            /// Sets preferred NUMA node \p nNode for memory region [\p pMemory, \p pMemory + \p nSize)
+            /**
+                The function calls \p mbind() system call with \p MPOL_PREFERRED policy
+                and moves already allocated pages of the region to \p nNode.
+                Only whole pages inside the region are bound.
+                Returns \p false if the system has only one NUMA node or \p mbind() is failed.
+            */
+            static bool bind_memory( void * pMemory, size_t nSize, unsigned int nNode );
+
             //@cond
             static void init();
             static void fini();
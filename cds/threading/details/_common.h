@@ -33,10 +33,13 @@
 
 #include <cds/gc/impl/hp_decl.h>
 #include <cds/gc/impl/dhp_decl.h>
+#include <cds/gc/impl/ebr_decl.h>
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
+#include <cds/urcu/details/mb_decl.h>
 #include <cds/algo/elimination_tls.h>
+#include <cds/memory/michael/thread_cache_tls.h>
 
 namespace cds {
     /// Threading support
@@ -104,6 +107,9 @@ namespace cds {
 
             // Get cds::gc::DHP thread GC implementation for current thread;
             static gc::DHP::thread_gc_impl&   getDHPGC();
+
+            // Get cds::gc::EBR thread GC implementation for current thread;
+            static gc::EBR::thread_gc_impl&   getEBRGC();
         };
         \endcode
 
@@ -139,6 +145,7 @@ namespace cds {
             //@cond
             char CDS_DATA_ALIGNMENT(8) m_hpManagerPlaceholder[sizeof(cds::gc::HP::thread_gc_impl)];   ///< Michael's Hazard Pointer GC placeholder
             char CDS_DATA_ALIGNMENT(8) m_dhpManagerPlaceholder[sizeof(cds::gc::DHP::thread_gc_impl)]; ///< Dynamic Hazard Pointer GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_ebrManagerPlaceholder[sizeof(cds::gc::EBR::thread_gc_impl)]; ///< Epoch-based GC placeholder
 
             cds::urcu::details::thread_data< cds::urcu::general_instant_tag > *     m_pGPIRCU;
             cds::urcu::details::thread_data< cds::urcu::general_buffered_tag > *    m_pGPBRCU;
@@ -147,11 +154,16 @@ namespace cds {
             cds::urcu::details::thread_data< cds::urcu::signal_buffered_tag > *    m_pSHBRCU;
             cds::urcu::details::thread_data< cds::urcu::signal_threaded_tag > *    m_pSHTRCU;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+            cds::urcu::details::thread_data< cds::urcu::membarrier_buffered_tag > *    m_pMBBRCU;
+            cds::urcu::details::thread_data< cds::urcu::membarrier_threaded_tag > *    m_pMBTRCU;
+#endif
 
             //@endcond
 
             cds::gc::HP::thread_gc_impl  * m_hpManager     ;   ///< Michael's Hazard Pointer GC thread-specific data
             cds::gc::DHP::thread_gc_impl * m_dhpManager    ;   ///< Dynamic Hazard Pointer GC thread-specific data
+            cds::gc::EBR::thread_gc_impl * m_ebrManager    ;   ///< Epoch-based GC thread-specific data
 
             size_t  m_nFakeProcessorNumber  ;   ///< fake "current processor" number
 
@@ -162,6 +174,9 @@ namespace cds {
             /// Per-thread elimination record
             cds::algo::elimination::record   m_EliminationRec;
 
+            /// Per-thread caches of Michael's heaps, see \p cds::memory::michael::opt::thread_cache
+            cds::memory::michael::thread_cache_list m_HeapCache;
+
             //@cond
             static CDS_EXPORT_API atomics::atomic<size_t> s_nLastUsedProcNo;
             static CDS_EXPORT_API size_t                     s_nProcCount;
@@ -175,6 +190,10 @@ namespace cds {
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                 , m_pSHBRCU( nullptr )
                 , m_pSHTRCU( nullptr )
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                , m_pMBBRCU( nullptr )
+                , m_pMBTRCU( nullptr )
 #endif
                 , m_nFakeProcessorNumber( s_nLastUsedProcNo.fetch_add(1, atomics::memory_order_relaxed) % s_nProcCount )
                 , m_nAttachCount(0)
@@ -188,6 +207,11 @@ namespace cds {
                     m_dhpManager = new (m_dhpManagerPlaceholder) cds::gc::DHP::thread_gc_impl;
                 else
                     m_dhpManager = nullptr;
+
+                if ( cds::gc::EBR::isUsed() )
+                    m_ebrManager = new (m_ebrManagerPlaceholder) cds::gc::EBR::thread_gc_impl;
+                else
+                    m_ebrManager = nullptr;
             }
 
             ~ThreadData()
@@ -204,12 +228,22 @@ namespace cds {
                     m_dhpManager = nullptr;
                 }
 
+                if ( m_ebrManager ) {
+                    typedef cds::gc::EBR::thread_gc_impl ebr_thread_gc_impl;
+                    m_ebrManager->~ebr_thread_gc_impl();
+                    m_ebrManager = nullptr;
+                }
+
                 assert( m_pGPIRCU == nullptr );
                 assert( m_pGPBRCU == nullptr );
                 assert( m_pGPTRCU == nullptr );
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
                 assert( m_pSHBRCU == nullptr );
                 assert( m_pSHTRCU == nullptr );
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                assert( m_pMBBRCU == nullptr );
+                assert( m_pMBTRCU == nullptr );
 #endif
             }
 
@@ -220,6 +254,8 @@ namespace cds {
                         m_hpManager->init();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->init();
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->init();
 
                     if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() )
                         m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread();
@@ -232,6 +268,12 @@ namespace cds {
                         m_pSHBRCU = cds::urcu::details::singleton<cds::urcu::signal_buffered_tag>::attach_thread();
                     if ( cds::urcu::details::singleton<cds::urcu::signal_threaded_tag>::isUsed() )
                         m_pSHTRCU = cds::urcu::details::singleton<cds::urcu::signal_threaded_tag>::attach_thread();
+#endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                    if ( cds::urcu::details::singleton<cds::urcu::membarrier_buffered_tag>::isUsed() )
+                        m_pMBBRCU = cds::urcu::details::singleton<cds::urcu::membarrier_buffered_tag>::attach_thread();
+                    if ( cds::urcu::details::singleton<cds::urcu::membarrier_threaded_tag>::isUsed() )
+                        m_pMBTRCU = cds::urcu::details::singleton<cds::urcu::membarrier_threaded_tag>::attach_thread();
 #endif
                 }
             }
@@ -239,6 +281,8 @@ namespace cds {
             bool fini()
             {
                 if ( --m_nAttachCount == 0 ) {
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->fini();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->fini();
                     if ( cds::gc::HP::isUsed() )
@@ -266,6 +310,18 @@ namespace cds {
                         m_pSHTRCU = nullptr;
                     }
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+                    if ( cds::urcu::details::singleton<cds::urcu::membarrier_buffered_tag>::isUsed() ) {
+                        cds::urcu::details::singleton<cds::urcu::membarrier_buffered_tag>::detach_thread( m_pMBBRCU );
+                        m_pMBBRCU = nullptr;
+                    }
+                    if ( cds::urcu::details::singleton<cds::urcu::membarrier_threaded_tag>::isUsed() ) {
+                        cds::urcu::details::singleton<cds::urcu::membarrier_threaded_tag>::detach_thread( m_pMBTRCU );
+                        m_pMBTRCU = nullptr;
+                    }
+#endif
+                    // GC and RCU detaching may free memory to a heap, so the heap caches are released last
+                    m_HeapCache.release_all();
                     return true;
                 }
                 return false;
@@ -72,6 +72,19 @@ namespace cds { namespace threading {
         return Manager::getDHPGC();
     }
 
+    /// Get cds::gc::EBR thread GC implementation for current thread
+    /**
+        The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+        or if you did not use cds::gc::EBR.
+        To initialize cds::gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application,
+        see \ref cds_how_to_use "How to use libcds"
+    */
+    template <>
+    inline cds::gc::EBR::thread_gc_impl&   getGC<cds::gc::EBR>()
+    {
+        return Manager::getEBRGC();
+    }
+
     //@cond
     template<>
     inline cds::urcu::details::thread_data<cds::urcu::general_instant_tag> * getRCU<cds::urcu::general_instant_tag>()
@@ -102,6 +115,20 @@ namespace cds { namespace threading {
         return p ? p->m_pSHTRCU : nullptr;
     }
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::membarrier_buffered_tag> * getRCU<cds::urcu::membarrier_buffered_tag>()
+    {
+        ThreadData * p = Manager::thread_data();
+        return p ? p->m_pMBBRCU : nullptr;
+    }
+    template<>
+    inline cds::urcu::details::thread_data<cds::urcu::membarrier_threaded_tag> * getRCU<cds::urcu::membarrier_threaded_tag>()
+    {
+        ThreadData * p = Manager::thread_data();
+        return p ? p->m_pMBTRCU : nullptr;
+    }
+#endif
 
     static inline cds::algo::elimination::record& elimination_record()
     {
@@ -111,8 +111,14 @@ namespace cds {
           requiring only that the application give up one POSIX signal to %RCU update processing.
           The \p libcds contains several implementations if signal-handling %RCU: \ref signal_buffered,
           \ref signal_threaded.
+        - The membarrier-based %RCU has the same read-side overhead as signal-handling %RCU: the readers
+          use compiler-only barriers, and the updater forces the memory barrier on all running threads
+          of the process by Linux \p membarrier() system call instead of signal delivery.
+          The \p libcds contains two implementations of membarrier-based %RCU: \ref membarrier_buffered,
+          \ref membarrier_threaded.
 
     @note The signal-handled %RCU is defined only for UNIX-like systems, not for Windows.
+        The membarrier-based %RCU is defined only for Linux.
 
     @anchor cds_urcu_type
     <b>RCU implementation type</b>
@@ -123,6 +129,8 @@ namespace cds {
         - \ref general_threaded - general purpose RCU with special reclamation thread
         - \ref signal_buffered - signal-handling RCU with deferred (buffered) reclamation
         - \ref signal_threaded - signal-handling RCU with special reclamation thread
+        - \ref membarrier_buffered - membarrier-based RCU with deferred (buffered) reclamation
+        - \ref membarrier_threaded - membarrier-based RCU with special reclamation thread
 
         You cannot create an object of any of those classes directly.
         Instead, you should use wrapper classes.
@@ -142,6 +150,10 @@ namespace cds {
             include file <tt><cds/urcu/signal_buffered.h></tt>
         - \ref cds_urcu_signal_threaded_gc "gc<signal_threaded>" - signal-handling RCU with special reclamation thread
             include file <tt><cds/urcu/signal_threaded.h></tt>
+        - \ref cds_urcu_membarrier_buffered_gc "gc<membarrier_buffered>" - membarrier-based RCU with deferred (buffered) reclamation
+            include file <tt><cds/urcu/membarrier_buffered.h></tt>
+        - \ref cds_urcu_membarrier_threaded_gc "gc<membarrier_threaded>" - membarrier-based RCU with special reclamation thread
+            include file <tt><cds/urcu/membarrier_threaded.h></tt>
 
         Any RCU-related container in \p libcds expects that its \p RCU template parameter is one of those wrapper.
 
@@ -153,6 +165,8 @@ namespace cds {
         - \ref general_threaded_tag - for \ref general_threaded
         - \ref signal_buffered_tag - for \ref signal_buffered
         - \ref signal_threaded_tag - for \ref signal_threaded
+        - \ref membarrier_buffered_tag - for \ref membarrier_buffered
+        - \ref membarrier_threaded_tag - for \ref membarrier_threaded
 
     @anchor cds_urcu_performance
     <b>Performance</b>
@@ -233,6 +247,10 @@ namespace cds {
 
 #   if CDS_OS_INTERFACE == CDS_OSI_UNIX || defined(CDS_DOXYGEN_INVOKED)
 #       define CDS_URCU_SIGNAL_HANDLING_ENABLED 1
+#   endif
+
+#   if CDS_OS_TYPE == CDS_OS_LINUX || defined(CDS_DOXYGEN_INVOKED)
+#       define CDS_URCU_MEMBARRIER_ENABLED 1
 #   endif
 
         /// General-purpose URCU type
@@ -253,6 +271,16 @@ namespace cds {
         };
 #   endif
 
+#   ifdef CDS_URCU_MEMBARRIER_ENABLED
+        /// Membarrier-based URCU type
+        struct membarrier_rcu {
+            //@cond
+            static uint32_t const c_nControlBit = 0x80000000;
+            static uint32_t const c_nNestMask   = c_nControlBit - 1;
+            //@endcond
+        };
+#   endif
+
         /// Tag for general_instant URCU
         struct general_instant_tag: public general_purpose_rcu {
             typedef general_purpose_rcu     rcu_class ; ///< The URCU type
@@ -281,6 +309,18 @@ namespace cds {
         };
 #   endif
 
+#   ifdef CDS_URCU_MEMBARRIER_ENABLED
+        /// Tag for membarrier_buffered URCU
+        struct membarrier_buffered_tag: public membarrier_rcu {
+            typedef membarrier_rcu     rcu_class ; ///< The URCU type
+        };
+
+        /// Tag for membarrier_threaded URCU
+        struct membarrier_threaded_tag: public membarrier_rcu {
+            typedef membarrier_rcu     rcu_class ; ///< The URCU type
+        };
+#   endif
+
         ///@anchor cds_urcu_retired_ptr Retired pointer, i.e. pointer that ready for reclamation
         typedef cds::gc::details::retired_ptr   retired_ptr;
         using cds::gc::make_retired_ptr;
@@ -50,11 +50,48 @@ namespace cds { namespace urcu { namespace details {
     }
 
     CDS_GPURCU_DECLARE_THREAD_DATA( general_instant_tag );
-    CDS_GPURCU_DECLARE_THREAD_DATA( general_buffered_tag );
     CDS_GPURCU_DECLARE_THREAD_DATA( general_threaded_tag );
 
 #   undef CDS_GPURCU_DECLARE_THREAD_DATA
 
+    // Batch of retired pointers of general_buffered RCU
+    // The batch is filled by its owner thread without any synchronization,
+    // full batch is moved to the RCU singleton's pending list
+    struct gpb_retired_batch {
+        static CDS_CONSTEXPR size_t const c_nCapacity = 64;
+
+        gpb_retired_batch * m_pNext;
+        size_t              m_nSize;
+        retired_ptr         m_arr[c_nCapacity];
+
+        gpb_retired_batch()
+            : m_pNext( nullptr )
+            , m_nSize( 0 )
+        {}
+
+        bool push( retired_ptr const& p )
+        {
+            assert( m_nSize < c_nCapacity );
+            m_arr[ m_nSize++ ] = p;
+            return m_nSize >= c_nCapacity;
+        }
+
+        void free()
+        {
+            for ( size_t i = 0; i < m_nSize; ++i )
+                m_arr[i].free();
+            m_nSize = 0;
+        }
+    };
+
+    template <> struct thread_data<general_buffered_tag> {
+        atomics::atomic<uint32_t>        m_nAccessControl ;
+        thread_list_record< thread_data >   m_list ;
+        gpb_retired_batch *              m_pRetired ;   // thread-local batch, accessed by owner thread only
+        thread_data(): m_nAccessControl(0), m_pRetired( nullptr ) {}
+        ~thread_data() { assert( m_pRetired == nullptr ); }
+    };
+
     template <typename RCUtag>
     struct gp_singleton_instance
     {
@@ -162,6 +199,7 @@ namespace cds { namespace urcu { namespace details {
 
         void detach_thread( thread_record * pRec )
         {
+            on_thread_detach( pRec );
             m_ThreadList.retire( pRec );
         }
 
@@ -175,6 +213,10 @@ namespace cds { namespace urcu { namespace details {
 
         template <class Backoff>
         void flip_and_wait( Backoff& bkoff );
+
+        // Called when the thread owning \p pRec is detached, before the record is released
+        virtual void on_thread_detach( thread_record * /*pRec*/ )
+        {}
     };
 
 #   define CDS_GP_RCU_DECLARE_SINGLETON( tag_ ) \
@@ -35,6 +35,7 @@
 #include <limits>
 #include <cds/urcu/details/gp.h>
 #include <cds/algo/backoff_strategy.h>
+#include <cds/details/allocator.h>
 #include <cds/container/vyukov_mpmc_cycle_queue.h>
 
 namespace cds { namespace urcu {
@@ -43,13 +44,24 @@ namespace cds { namespace urcu {
     /**
         @headerfile cds/urcu/general_buffered.h
 
-        This URCU implementation contains an internal buffer where retired objects are
-        accumulated. When the buffer becomes full, the RCU \p synchronize function is called
+        This URCU implementation accumulates retired objects and frees them in batches.
+        When the number of accumulated objects reaches the RCU threshold, the RCU \p synchronize function is called
         that waits until all reader/updater threads end up their read-side critical sections,
-        i.e. until the RCU quiescent state will come. After that the buffer and all retired objects are freed.
+        i.e. until the RCU quiescent state will come. After that all accumulated objects are freed.
         This synchronization cycle may be called in any thread that calls \p retire_ptr function.
 
-        The \p Buffer contains items of \ref cds_urcu_retired_ptr "epoch_retired_ptr" type and it should support a queue interface with
+        Each attached thread collects its retired pointers in a thread-local batch without any synchronization.
+        The full batch is moved to the global lock-free list of pending batches by single CAS.
+        When the pending list reaches the RCU threshold, one of the retiring threads becomes a grace-period waiter:
+        it grabs the whole pending list, waits for the quiescent state and frees the list. Other retiring threads
+        do not wait for it, their batches are processed by the current or by the next waiter.
+        So, one grace period is amortized across all concurrently retiring threads.
+        The retiring thread waits for the grace-period waiter only if the pending list
+        grows twice beyond the threshold. Thread-local batch of a thread is moved to the pending list
+        when the thread is detached from libcds or calls \p synchronize().
+
+        The \p Buffer is used only for the pointers retired by the threads that are not attached to libcds.
+        It contains items of \ref cds_urcu_retired_ptr "epoch_retired_ptr" type and it should support a queue interface with
         three function:
         - <tt> bool push( retired_ptr& p ) </tt> - places the retired pointer \p p into queue. If the function
             returns \p false it means that the buffer is full and RCU synchronization cycle must be processed.
@@ -64,7 +76,8 @@ namespace cds { namespace urcu {
 
         Template arguments:
         - \p Buffer - buffer type. Default is \p cds::container::VyukovMPMCCycleQueue
-        - \p Lock - mutex type, default is \p std::mutex
+        - \p Lock - mutex type, default is \p std::mutex. The mutex is used to elect the grace-period waiter,
+            it must support \p try_lock()
         - \p Backoff - back-off schema, default is cds::backoff::Default
     */
     template <
@@ -91,6 +104,8 @@ namespace cds { namespace urcu {
     protected:
         //@cond
         typedef details::gp_singleton_instance< rcu_tag >    singleton_ptr;
+        typedef details::gpb_retired_batch                   retired_batch;
+        typedef cds::details::Allocator< retired_batch >     batch_allocator;
         //@endcond
 
     protected:
@@ -99,6 +114,9 @@ namespace cds { namespace urcu {
         atomics::atomic<uint64_t>  m_nCurEpoch;
         lock_type                  m_Lock;
         size_t const               m_nCapacity;
+
+        atomics::atomic<retired_batch *> m_pPending;      // list of full batches waiting for grace period
+        atomics::atomic<size_t>          m_nPendingCount; // retired pointer count in m_pPending
         //@endcond
 
     public:
@@ -119,11 +137,20 @@ namespace cds { namespace urcu {
             : m_Buffer( nBufferCapacity )
             , m_nCurEpoch(0)
             , m_nCapacity( nBufferCapacity )
+            , m_pPending( nullptr )
+            , m_nPendingCount( 0 )
         {}
 
         ~general_buffered()
         {
             clear_buffer( std::numeric_limits< uint64_t >::max());
+            free_batches( m_pPending.exchange( nullptr, atomics::memory_order_acquire ));
+
+            // No reader can exist at this point, so thread-local batches can be freed immediately
+            for ( thread_record * pRec = base_class::m_ThreadList.head( atomics::memory_order_acquire ); pRec; pRec = pRec->m_list.m_pNext ) {
+                free_batches( pRec->m_pRetired );
+                pRec->m_pRetired = nullptr;
+            }
         }
 
         void flip_and_wait()
@@ -159,6 +186,88 @@ namespace cds { namespace urcu {
             }
             return false;
         }
+
+        static void free_batches( retired_batch * pList )
+        {
+            batch_allocator al;
+            while ( pList ) {
+                retired_batch * pNext = pList->m_pNext;
+                pList->free();
+                al.Delete( pList );
+                pList = pNext;
+            }
+        }
+
+        void retire_local( thread_record * pRec, retired_ptr const& p )
+        {
+            retired_batch * pBatch = pRec->m_pRetired;
+            if ( !pBatch )
+                pRec->m_pRetired = pBatch = batch_allocator().New();
+
+            if ( pBatch->push( p )) {
+                // the batch is full
+                pRec->m_pRetired = nullptr;
+                if ( publish( pBatch ) >= capacity())
+                    try_synchronize();
+            }
+        }
+
+        // Moves the batch to the pending list, returns pending retired pointer count
+        size_t publish( retired_batch * pBatch )
+        {
+            // The counter is increased before pushing so it never underflows in process_pending()
+            size_t const nSize = pBatch->m_nSize;
+            size_t const nCount = m_nPendingCount.fetch_add( nSize, atomics::memory_order_relaxed ) + nSize;
+
+            retired_batch * pHead = m_pPending.load( atomics::memory_order_relaxed );
+            do {
+                pBatch->m_pNext = pHead;
+            } while ( !m_pPending.compare_exchange_weak( pHead, pBatch, atomics::memory_order_release, atomics::memory_order_relaxed ));
+            return nCount;
+        }
+
+        void try_synchronize()
+        {
+            if ( m_Lock.try_lock() ) {
+                std::unique_lock<lock_type> sl( m_Lock, std::adopt_lock );
+                process_pending( sl );
+            }
+            else if ( m_nPendingCount.load( atomics::memory_order_relaxed ) >= capacity() * 2 ) {
+                // The grace-period waiter cannot keep up with the retiring threads; help it
+                std::unique_lock<lock_type> sl( m_Lock );
+                if ( m_nPendingCount.load( atomics::memory_order_relaxed ) >= capacity() )
+                    process_pending( sl );
+            }
+        }
+
+        // The lock \p sl must be acquired, it is released before freeing
+        void process_pending( std::unique_lock<lock_type>& sl )
+        {
+            retired_batch * pList = m_pPending.exchange( nullptr, atomics::memory_order_acquire );
+            size_t nCount = 0;
+            for ( retired_batch * p = pList; p; p = p->m_pNext )
+                nCount += p->m_nSize;
+            m_nPendingCount.fetch_sub( nCount, atomics::memory_order_relaxed );
+
+            uint64_t nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
+            flip_and_wait();
+            flip_and_wait();
+            sl.unlock();
+
+            free_batches( pList );
+            clear_buffer( nEpoch );
+            atomics::atomic_thread_fence( atomics::memory_order_release );
+        }
+
+        virtual void on_thread_detach( thread_record * pRec )
+        {
+            retired_batch * pBatch = pRec->m_pRetired;
+            if ( pBatch ) {
+                pRec->m_pRetired = nullptr;
+                if ( publish( pBatch ) >= capacity())
+                    try_synchronize();
+            }
+        }
         //@endcond
 
     public:
@@ -187,25 +296,40 @@ namespace cds { namespace urcu {
     public:
         /// Retire \p p pointer
         /**
-            The method pushes \p p pointer to internal buffer.
-            When the buffer becomes full \ref synchronize function is called
-            to wait for the end of grace period and then to free all pointers from the buffer.
+            The method pushes \p p pointer to thread-local batch.
+            When the number of pending pointers reaches the threshold, \ref synchronize function is called
+            to wait for the end of grace period and then to free all pending pointers.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
-            if ( p.m_p )
-                push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
+            if ( p.m_p ) {
+                thread_record * pRec = cds::threading::getRCU< rcu_tag >();
+                if ( pRec )
+                    retire_local( pRec, p );
+                else
+                    push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
         template <typename ForwardIterator>
         void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
         {
-            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
-            while ( itFirst != itLast ) {
-                epoch_retired_ptr ep( *itFirst, nEpoch );
-                ++itFirst;
-                push_buffer( std::move(ep) );
+            thread_record * pRec = cds::threading::getRCU< rcu_tag >();
+            if ( pRec ) {
+                while ( itFirst != itLast ) {
+                    retired_ptr p( *itFirst );
+                    ++itFirst;
+                    retire_local( pRec, p );
+                }
+            }
+            else {
+                uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+                while ( itFirst != itLast ) {
+                    epoch_retired_ptr ep( *itFirst, nEpoch );
+                    ++itFirst;
+                    push_buffer( std::move(ep) );
+                }
             }
         }
 
@@ -213,39 +337,42 @@ namespace cds { namespace urcu {
         template <typename Func>
         void batch_retire( Func e )
         {
-            uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
-            for ( retired_ptr p{ e() }; p.m_p; ) {
-                epoch_retired_ptr ep( p, nEpoch );
-                p = e();
-                push_buffer( std::move(ep));
+            thread_record * pRec = cds::threading::getRCU< rcu_tag >();
+            if ( pRec ) {
+                for ( retired_ptr p{ e() }; p.m_p; ) {
+                    retired_ptr pCur( p );
+                    p = e();
+                    retire_local( pRec, pCur );
+                }
+            }
+            else {
+                uint64_t nEpoch = m_nCurEpoch.load( atomics::memory_order_relaxed );
+                for ( retired_ptr p{ e() }; p.m_p; ) {
+                    epoch_retired_ptr ep( p, nEpoch );
+                    p = e();
+                    push_buffer( std::move(ep));
+                }
             }
         }
 
         /// Wait to finish a grace period and then clear the buffer
+        /**
+            The function moves thread-local batch of current thread to the pending list,
+            waits for the grace period and frees all pending pointers.
+        */
         void synchronize()
         {
-            epoch_retired_ptr ep( retired_ptr(), m_nCurEpoch.load( atomics::memory_order_relaxed ));
-            synchronize( ep );
-        }
+            thread_record * pRec = cds::threading::getRCU< rcu_tag >();
+            if ( pRec && pRec->m_pRetired ) {
+                retired_batch * pBatch = pRec->m_pRetired;
+                pRec->m_pRetired = nullptr;
+                publish( pBatch );
+            }
 
-        //@cond
-        bool synchronize( epoch_retired_ptr& ep )
-        {
-            uint64_t nEpoch;
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
-            {
-                std::unique_lock<lock_type> sl( m_Lock );
-                if ( ep.m_p && m_Buffer.push( ep ) )
-                    return false;
-                nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
-                flip_and_wait();
-                flip_and_wait();
-            }
-            clear_buffer( nEpoch );
-            atomics::atomic_thread_fence( atomics::memory_order_release );
-            return true;
+            std::unique_lock<lock_type> sl( m_Lock );
+            process_pending( sl );
         }
-        //@endcond
 
         /// Returns internal buffer capacity
         size_t capacity() const
@@ -2,8 +2,10 @@ CDS_SOURCES= \
          src/hp_gc.cpp \
          src/init.cpp \
          src/dhp_gc.cpp \
+         src/ebr_gc.cpp \
          src/urcu_gp.cpp \
          src/urcu_sh.cpp \
+         src/urcu_mb.cpp \
          src/michael_heap.cpp \
          src/topology_hpux.cpp \
          src/topology_linux.cpp \
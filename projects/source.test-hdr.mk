@@ -1,6 +1,7 @@
 CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_michael_map_hp.cpp \
     tests/test-hdr/map/hdr_michael_map_dhp.cpp \
+    tests/test-hdr/map/hdr_michael_map_ebr.cpp \
     tests/test-hdr/map/hdr_michael_map_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_michael_map_rcu_gpb.cpp \
     tests/test-hdr/map/hdr_michael_map_rcu_gpt.cpp \
@@ -9,6 +10,7 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_michael_map_nogc.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_hp.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_dhp.cpp \
+    tests/test-hdr/map/hdr_michael_map_lazy_ebr.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_rcu_gpb.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_rcu_gpt.cpp \
@@ -17,6 +19,7 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_michael_map_lazy_nogc.cpp \
     tests/test-hdr/map/hdr_feldman_hashmap_hp.cpp \
     tests/test-hdr/map/hdr_feldman_hashmap_dhp.cpp \
+    tests/test-hdr/map/hdr_feldman_hashmap_ebr.cpp \
     tests/test-hdr/map/hdr_feldman_hashmap_rcu_gpb.cpp \
     tests/test-hdr/map/hdr_feldman_hashmap_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_feldman_hashmap_rcu_gpt.cpp \
@@ -32,14 +35,18 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_refinable_hashmap_slist.cpp \
     tests/test-hdr/map/hdr_skiplist_map_hp.cpp \
     tests/test-hdr/map/hdr_skiplist_map_dhp.cpp \
+    tests/test-hdr/map/hdr_skiplist_map_ebr.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_gpb.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_gpt.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_shb.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_sht.cpp \
+    tests/test-hdr/map/hdr_skiplist_map_rcu_mbb.cpp \
+    tests/test-hdr/map/hdr_skiplist_map_rcu_mbt.cpp \
     tests/test-hdr/map/hdr_skiplist_map_nogc.cpp \
     tests/test-hdr/map/hdr_splitlist_map_hp.cpp \
     tests/test-hdr/map/hdr_splitlist_map_dhp.cpp \
+    tests/test-hdr/map/hdr_splitlist_map_ebr.cpp \
     tests/test-hdr/map/hdr_splitlist_map_nogc.cpp \
     tests/test-hdr/map/hdr_splitlist_map_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_splitlist_map_rcu_gpb.cpp \
@@ -48,6 +55,7 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_splitlist_map_rcu_sht.cpp \
     tests/test-hdr/map/hdr_splitlist_map_lazy_hp.cpp \
     tests/test-hdr/map/hdr_splitlist_map_lazy_dhp.cpp \
+    tests/test-hdr/map/hdr_splitlist_map_lazy_ebr.cpp \
     tests/test-hdr/map/hdr_splitlist_map_lazy_nogc.cpp \
     tests/test-hdr/map/hdr_splitlist_map_lazy_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_splitlist_map_lazy_rcu_gpb.cpp \
@@ -69,6 +77,7 @@ CDS_TESTHDR_DEQUE := \
 
 CDS_TESTHDR_LIST := \
     tests/test-hdr/list/hdr_lazy_dhp.cpp \
+    tests/test-hdr/list/hdr_lazy_ebr.cpp \
     tests/test-hdr/list/hdr_lazy_hp.cpp \
     tests/test-hdr/list/hdr_lazy_nogc.cpp \
     tests/test-hdr/list/hdr_lazy_nogc_unord.cpp \
@@ -77,7 +86,10 @@ CDS_TESTHDR_LIST := \
     tests/test-hdr/list/hdr_lazy_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_lazy_rcu_shb.cpp \
     tests/test-hdr/list/hdr_lazy_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_lazy_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_lazy_rcu_mbt.cpp \
     tests/test-hdr/list/hdr_lazy_kv_dhp.cpp \
+    tests/test-hdr/list/hdr_lazy_kv_ebr.cpp \
     tests/test-hdr/list/hdr_lazy_kv_hp.cpp \
     tests/test-hdr/list/hdr_lazy_kv_nogc.cpp \
     tests/test-hdr/list/hdr_lazy_kv_nogc_unord.cpp \
@@ -86,7 +98,10 @@ CDS_TESTHDR_LIST := \
     tests/test-hdr/list/hdr_lazy_kv_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_lazy_kv_rcu_shb.cpp \
     tests/test-hdr/list/hdr_lazy_kv_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_lazy_kv_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_lazy_kv_rcu_mbt.cpp \
     tests/test-hdr/list/hdr_michael_dhp.cpp \
+    tests/test-hdr/list/hdr_michael_ebr.cpp \
     tests/test-hdr/list/hdr_michael_hp.cpp \
     tests/test-hdr/list/hdr_michael_nogc.cpp \
     tests/test-hdr/list/hdr_michael_rcu_gpi.cpp \
@@ -94,14 +109,19 @@ CDS_TESTHDR_LIST := \
     tests/test-hdr/list/hdr_michael_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_michael_rcu_shb.cpp \
     tests/test-hdr/list/hdr_michael_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_michael_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_michael_rcu_mbt.cpp \
     tests/test-hdr/list/hdr_michael_kv_dhp.cpp \
+    tests/test-hdr/list/hdr_michael_kv_ebr.cpp \
     tests/test-hdr/list/hdr_michael_kv_hp.cpp \
     tests/test-hdr/list/hdr_michael_kv_nogc.cpp \
     tests/test-hdr/list/hdr_michael_kv_rcu_gpi.cpp \
     tests/test-hdr/list/hdr_michael_kv_rcu_gpb.cpp \
     tests/test-hdr/list/hdr_michael_kv_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_michael_kv_rcu_shb.cpp \
-    tests/test-hdr/list/hdr_michael_kv_rcu_sht.cpp
+    tests/test-hdr/list/hdr_michael_kv_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_michael_kv_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_michael_kv_rcu_mbt.cpp
 
 CDS_TESTHDR_PQUEUE := \
     tests/test-hdr/priority_queue/hdr_intrusive_mspqueue_dyn.cpp \
@@ -111,6 +131,8 @@ CDS_TESTHDR_PQUEUE := \
     tests/test-hdr/priority_queue/hdr_fcpqueue_boost_stable_vector.cpp \
     tests/test-hdr/priority_queue/hdr_fcpqueue_deque.cpp \
     tests/test-hdr/priority_queue/hdr_fcpqueue_vector.cpp \
+    tests/test-hdr/priority_queue/hdr_skiplist_pqueue.cpp \
+    tests/test-hdr/priority_queue/hdr_multi_pqueue.cpp \
     tests/test-hdr/priority_queue/hdr_priority_queue_reg.cpp
 
 CDS_TESTHDR_QUEUE := \
@@ -122,6 +144,7 @@ CDS_TESTHDR_QUEUE := \
     tests/test-hdr/queue/hdr_intrusive_vyukovmpmc_cycle_queue.cpp \
     tests/test-hdr/queue/hdr_basketqueue_hp.cpp \
     tests/test-hdr/queue/hdr_basketqueue_dhp.cpp \
+    tests/test-hdr/queue/hdr_faa_array_queue.cpp \
     tests/test-hdr/queue/hdr_fcqueue.cpp \
     tests/test-hdr/queue/hdr_moirqueue_hp.cpp \
     tests/test-hdr/queue/hdr_moirqueue_dhp.cpp \
@@ -132,12 +155,14 @@ CDS_TESTHDR_QUEUE := \
     tests/test-hdr/queue/hdr_rwqueue.cpp \
     tests/test-hdr/queue/hdr_segmented_queue_hp.cpp \
     tests/test-hdr/queue/hdr_segmented_queue_dhp.cpp \
+    tests/test-hdr/queue/hdr_spsc_ring_queue.cpp \
     tests/test-hdr/queue/hdr_tsigas_cycle_queue.cpp \
     tests/test-hdr/queue/hdr_vyukov_mpmc_cyclic.cpp
 
 CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_intrusive_feldman_hashset_hp.cpp \
     tests/test-hdr/set/hdr_intrusive_feldman_hashset_dhp.cpp \
+    tests/test-hdr/set/hdr_intrusive_feldman_hashset_ebr.cpp \
     tests/test-hdr/set/hdr_intrusive_feldman_hashset_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_intrusive_feldman_hashset_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_intrusive_feldman_hashset_rcu_gpt.cpp \
@@ -153,11 +178,14 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_intrusive_refinable_hashset_uset.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_hp.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_dhp.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_ebr.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpt.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_shb.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_sht.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_rcu_mbb.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_rcu_mbt.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_nogc.cpp \
     tests/test-hdr/set/hdr_intrusive_striped_hashset_avlset.cpp \
     tests/test-hdr/set/hdr_intrusive_striped_hashset_list.cpp \
@@ -170,6 +198,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_intrusive_striped_set.cpp \
     tests/test-hdr/set/hdr_michael_set_hp.cpp \
     tests/test-hdr/set/hdr_michael_set_dhp.cpp \
+    tests/test-hdr/set/hdr_michael_set_ebr.cpp \
     tests/test-hdr/set/hdr_michael_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_michael_set_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_michael_set_rcu_gpt.cpp \
@@ -178,6 +207,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_michael_set_nogc.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_hp.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_dhp.cpp \
+    tests/test-hdr/set/hdr_michael_set_lazy_ebr.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_rcu_gpt.cpp \
@@ -186,6 +216,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_michael_set_lazy_nogc.cpp \
     tests/test-hdr/set/hdr_feldman_hashset_hp.cpp \
     tests/test-hdr/set/hdr_feldman_hashset_dhp.cpp \
+    tests/test-hdr/set/hdr_feldman_hashset_ebr.cpp \
     tests/test-hdr/set/hdr_feldman_hashset_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_feldman_hashset_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_feldman_hashset_rcu_gpt.cpp \
@@ -204,15 +235,19 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_refinable_hashset_vector.cpp \
     tests/test-hdr/set/hdr_skiplist_set_hp.cpp \
     tests/test-hdr/set/hdr_skiplist_set_dhp.cpp \
+    tests/test-hdr/set/hdr_skiplist_set_ebr.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_gpt.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_shb.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_sht.cpp \
+    tests/test-hdr/set/hdr_skiplist_set_rcu_mbb.cpp \
+    tests/test-hdr/set/hdr_skiplist_set_rcu_mbt.cpp \
     tests/test-hdr/set/hdr_skiplist_set_nogc.cpp \
     tests/test-hdr/set/hdr_splitlist_set_hp.cpp \
     tests/test-hdr/set/hdr_splitlist_set_nogc.cpp \
     tests/test-hdr/set/hdr_splitlist_set_dhp.cpp \
+    tests/test-hdr/set/hdr_splitlist_set_ebr.cpp \
     tests/test-hdr/set/hdr_splitlist_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_splitlist_set_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_splitlist_set_rcu_gpt.cpp \
@@ -221,6 +256,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_splitlist_set_lazy_hp.cpp \
     tests/test-hdr/set/hdr_splitlist_set_lazy_nogc.cpp \
     tests/test-hdr/set/hdr_splitlist_set_lazy_dhp.cpp \
+    tests/test-hdr/set/hdr_splitlist_set_lazy_ebr.cpp \
     tests/test-hdr/set/hdr_splitlist_set_lazy_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_splitlist_set_lazy_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_splitlist_set_lazy_rcu_gpt.cpp \
@@ -250,25 +286,34 @@ CDS_TESTHDR_TREE := \
     tests/test-hdr/tree/hdr_tree_reg.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_hp.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_dhp.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_ebr.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpb.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpi.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpt.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_shb.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_sht.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_mbb.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_mbt.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_hp.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_dhp.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_map_ebr.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_rcu_gpb.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_rcu_gpi.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_rcu_gpt.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_rcu_shb.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_map_rcu_sht.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_map_rcu_mbb.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_map_rcu_mbt.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_hp.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_dhp.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_set_ebr.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_rcu_gpb.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_rcu_gpi.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_rcu_gpt.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_rcu_shb.cpp \
     tests/test-hdr/tree/hdr_ellenbintree_set_rcu_sht.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_set_rcu_mbb.cpp \
+    tests/test-hdr/tree/hdr_ellenbintree_set_rcu_mbt.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_gpb.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_gpb_pool_monitor.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_gpi.cpp \
@@ -278,7 +323,11 @@ CDS_TESTHDR_TREE := \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_shb.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_shb_pool_monitor.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_sht.cpp \
+    tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_mbb.cpp \
+    tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_mbt.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_sht_pool_monitor.cpp \
+    tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_mbb_pool_monitor.cpp \
+    tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_mbt_pool_monitor.cpp \
     
 
 CDS_TESTHDR_MISC := \
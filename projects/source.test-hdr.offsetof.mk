@@ -9,6 +9,7 @@ CDS_TESTHDR_OFFSETOF_SET := \
     tests/test-hdr/set/hdr_intrusive_cuckoo_refinable_set.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_hp.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_dhp.cpp \
+    tests/test-hdr/set/hdr_intrusive_michael_set_ebr.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_nogc.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_gpb.cpp \
@@ -17,6 +18,7 @@ CDS_TESTHDR_OFFSETOF_SET := \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_sht.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_hp_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_dhp_lazy.cpp \
+    tests/test-hdr/set/hdr_intrusive_michael_set_ebr_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_nogc_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_gpi_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_gpb_lazy.cpp \
@@ -25,15 +27,19 @@ CDS_TESTHDR_OFFSETOF_SET := \
     tests/test-hdr/set/hdr_intrusive_michael_set_rcu_sht_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_hp_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_dhp_member.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_ebr_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpi_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpb_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_gpt_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_shb_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_rcu_sht_member.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_rcu_mbb_member.cpp \
+    tests/test-hdr/set/hdr_intrusive_skiplist_rcu_mbt_member.cpp \
     tests/test-hdr/set/hdr_intrusive_skiplist_nogc_member.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_hp.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_nogc.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_dhp.cpp \
+    tests/test-hdr/set/hdr_intrusive_splitlist_set_ebr.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpb.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpt.cpp \
@@ -42,6 +48,7 @@ CDS_TESTHDR_OFFSETOF_SET := \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_hp_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_nogc_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_dhp_lazy.cpp \
+    tests/test-hdr/set/hdr_intrusive_splitlist_set_ebr_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpb_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpi_lazy.cpp \
     tests/test-hdr/set/hdr_intrusive_splitlist_set_rcu_gpt_lazy.cpp \
@@ -50,6 +57,7 @@ CDS_TESTHDR_OFFSETOF_SET := \
 
 CDS_TESTHDR_OFFSETOF_LIST := \
     tests/test-hdr/list/hdr_intrusive_lazy_dhp.cpp \
+    tests/test-hdr/list/hdr_intrusive_lazy_ebr.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_hp.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_nogc.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_nogc_unord.cpp \
@@ -58,14 +66,19 @@ CDS_TESTHDR_OFFSETOF_LIST := \
     tests/test-hdr/list/hdr_intrusive_lazy_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_rcu_shb.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_intrusive_lazy_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_intrusive_lazy_rcu_mbt.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_dhp.cpp \
+    tests/test-hdr/list/hdr_intrusive_michael_ebr.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_hp.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_nogc.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_list_rcu_gpb.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_list_rcu_gpi.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_list_rcu_gpt.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_list_rcu_shb.cpp \
-    tests/test-hdr/list/hdr_intrusive_michael_list_rcu_sht.cpp
+    tests/test-hdr/list/hdr_intrusive_michael_list_rcu_sht.cpp \
+    tests/test-hdr/list/hdr_intrusive_michael_list_rcu_mbb.cpp \
+    tests/test-hdr/list/hdr_intrusive_michael_list_rcu_mbt.cpp
 
 CDS_TESTHDR_OFFSETOF_QUEUE := \
     tests/test-hdr/queue/hdr_intrusive_basketqueue_hp.cpp \
@@ -75,7 +88,8 @@ CDS_TESTHDR_OFFSETOF_QUEUE := \
     tests/test-hdr/queue/hdr_intrusive_msqueue_hp.cpp \
     tests/test-hdr/queue/hdr_intrusive_msqueue_dhp.cpp \
     tests/test-hdr/queue/hdr_intrusive_optimisticqueue_hp.cpp \
-    tests/test-hdr/queue/hdr_intrusive_optimisticqueue_dhp.cpp
+    tests/test-hdr/queue/hdr_intrusive_optimisticqueue_dhp.cpp \
+    tests/test-hdr/queue/hdr_intrusive_mpsc_queue.cpp
 
 CDS_TESTHDR_OFFSETOF_STACK := \
     tests/test-hdr/stack/hdr_intrusive_treiber_stack_hp.cpp \
@@ -86,11 +100,14 @@ CDS_TESTHDR_OFFSETOF_STACK := \
 CDS_TESTHDR_OFFSETOF_TREE := \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_hp_member.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_dhp_member.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_ebr_member.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpb_member.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpi_member.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_gpt_member.cpp \
     tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_shb_member.cpp \
-    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_sht_member.cpp
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_sht_member.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_mbb_member.cpp \
+    tests/test-hdr/tree/hdr_intrusive_ellen_bintree_rcu_mbt_member.cpp
 
 CDS_TESTHDR_OFFSETOF_SOURCES := \
 	$(CDS_TESTHDR_OFFSETOF_QUEUE) \
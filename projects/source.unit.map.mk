@@ -10,6 +10,9 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_find_int_split.cpp \
     tests/unit/map2/map_find_int_striped.cpp \
     tests/unit/map2/map_find_int_std.cpp \
+    tests/unit/map2/map_find_int_batch.cpp \
+    tests/unit/map2/map_find_int_batch_michael.cpp \
+    tests/unit/map2/map_find_int_batch_split.cpp \
     tests/unit/map2/map_find_string.cpp \
     tests/unit/map2/map_find_string_bronsonavltree.cpp \
     tests/unit/map2/map_find_string_cuckoo.cpp \
@@ -95,3 +98,6 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_delodd_feldmanhashmap.cpp \
     tests/unit/map2/map_delodd_skip.cpp \
     tests/unit/map2/map_delodd_split.cpp \
+    tests/unit/map2/map_range_scan.cpp \
+    tests/unit/map2/map_range_scan_bronsonavltree.cpp \
+    tests/unit/map2/map_range_scan_skip.cpp \
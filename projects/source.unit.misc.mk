@@ -5,4 +5,6 @@ CDSUNIT_MISC_SOURCES := \
     tests/unit/alloc/linux_scale.cpp \
     tests/unit/alloc/michael_allocator.cpp \
     tests/unit/alloc/random.cpp \
+    tests/unit/gc/dhp_retire.cpp \
+    tests/unit/gc/hp_scan.cpp \
     tests/unit/lock/spinlock.cpp
@@ -1,6 +1,7 @@
 
 CDSUNIT_QUEUE_SOURCES := \
     tests/unit/queue/bounded_queue_fulness.cpp \
+    tests/unit/queue/queue_bulk.cpp \
     tests/unit/queue/queue_pop.cpp \
     tests/unit/queue/queue_push.cpp \
     tests/unit/queue/queue_random.cpp \
@@ -33,3 +33,5 @@ CDSUNIT_SET_SOURCES := \
 	tests/unit/set2/set_delodd_feldmanhashset.cpp \
 	tests/unit/set2/set_delodd_skip.cpp \
 	tests/unit/set2/set_delodd_split.cpp \
+	tests/unit/set2/set_grow.cpp \
+	tests/unit/set2/set_grow_michael.cpp \
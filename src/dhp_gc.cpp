@@ -119,7 +119,8 @@ namespace cds { namespace gc { namespace dhp {
 
             typedef std::pair<item_type, item_type>     list_range;
 
-            list_range free_all()
+            template <typename Disposer>
+            list_range free_all( Disposer& disposer )
             {
                 item_type pTail = nullptr;
                 list_range ret = std::make_pair( pTail, pTail );
@@ -136,12 +137,12 @@ namespace cds { namespace gc { namespace dhp {
                         pTail = pBucket;
                         for (;;) {
                             item_type pNext = pTail->m_pNext.load( atomics::memory_order_relaxed );
-                            pTail->m_ptr.free();
+                            disposer( *pTail );
                             pTail->m_pNext.store( nullptr, atomics::memory_order_relaxed );
 
                             while ( pTail->m_pNextFree.load( atomics::memory_order_relaxed )) {
                                 pTail = pTail->m_pNextFree.load( atomics::memory_order_relaxed );
-                                pTail->m_ptr.free();
+                                disposer( *pTail );
                                 pTail->m_pNext.store( nullptr, atomics::memory_order_relaxed );
                             }
 
@@ -161,6 +162,59 @@ namespace cds { namespace gc { namespace dhp {
                 return ret;
             }
         };
+
+        // Frees retired pointers by batch disposer (if it is set) and gathers retire-to-free latency
+        class retired_disposer {
+            static CDS_CONSTEXPR const size_t c_nBatchSize = 64;
+
+            GarbageCollector::batch_disposer_func const m_pBatchDisposer;
+            uint64_t const  m_nNow;     // 0 if statistics is disabled
+
+            retired_ptr     m_arr[c_nBatchSize];
+            size_t          m_nSize;
+
+        public:
+            size_t          m_nFreedCount;
+            uint64_t        m_nLatencyTotal;
+            uint64_t        m_nLatencyMax;
+
+        public:
+            retired_disposer( GarbageCollector::batch_disposer_func pBatchDisposer, uint64_t nNow )
+                : m_pBatchDisposer( pBatchDisposer )
+                , m_nNow( nNow )
+                , m_nSize( 0 )
+                , m_nFreedCount( 0 )
+                , m_nLatencyTotal( 0 )
+                , m_nLatencyMax( 0 )
+            {}
+
+            void operator()( retired_ptr_node& node )
+            {
+                if ( m_nNow && node.m_nRetireTime ) {
+                    uint64_t const nLatency = m_nNow > node.m_nRetireTime ? m_nNow - node.m_nRetireTime : 0;
+                    ++m_nFreedCount;
+                    m_nLatencyTotal += nLatency;
+                    if ( nLatency > m_nLatencyMax )
+                        m_nLatencyMax = nLatency;
+                }
+
+                if ( m_pBatchDisposer ) {
+                    m_arr[ m_nSize++ ] = node.m_ptr;
+                    if ( m_nSize == c_nBatchSize )
+                        flush();
+                }
+                else
+                    node.m_ptr.free();
+            }
+
+            void flush()
+            {
+                if ( m_nSize ) {
+                    m_pBatchDisposer( m_arr, m_nSize );
+                    m_nSize = 0;
+                }
+            }
+        };
     }
 
     GarbageCollector * GarbageCollector::m_pManager = nullptr;
@@ -169,10 +223,11 @@ namespace cds { namespace gc { namespace dhp {
         size_t nLiberateThreshold
         , size_t nInitialThreadGuardCount
         , size_t nEpochCount
+        , size_t nRetiredBatchSize
     )
     {
         if ( !m_pManager ) {
-            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount );
+            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount, nRetiredBatchSize );
         }
     }
 
@@ -182,22 +237,68 @@ namespace cds { namespace gc { namespace dhp {
         m_pManager = nullptr;
     }
 
-    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount )
+    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount, size_t nRetiredBatchSize )
         : m_nLiberateThreshold( nLiberateThreshold ? nLiberateThreshold : 1024 )
         , m_nInitialThreadGuardCount( nInitialThreadGuardCount ? nInitialThreadGuardCount : 8 )
+        , m_nRetiredBatchSize( nRetiredBatchSize ? nRetiredBatchSize : 1 )
         , m_RetiredAllocator( static_cast<unsigned int>( nEpochCount ? nEpochCount : 16 ))
+        , m_pBatchList( nullptr )
+        , m_pBatchDisposer( nullptr )
         , m_bStatEnabled( false )
     {}
 
     GarbageCollector::~GarbageCollector()
     {
+        // Hand off the batches of the threads that are not detached yet
+        for ( details::retired_batch * pBatch = m_pBatchList.load( atomics::memory_order_acquire ); pBatch; pBatch = pBatch->m_pGlobalNext.load( atomics::memory_order_relaxed ))
+            flushBatch( *pBatch, false );
+
         scan();
+
+        details::retired_batch * pNext;
+        for ( details::retired_batch * pBatch = m_pBatchList.load( atomics::memory_order_relaxed ); pBatch; pBatch = pNext ) {
+            pNext = pBatch->m_pGlobalNext.load( atomics::memory_order_relaxed );
+            delete pBatch;
+        }
+    }
+
+    details::retired_batch * GarbageCollector::allocRetiredBatch()
+    {
+        // Try to reuse a batch of terminated thread
+        for ( details::retired_batch * pBatch = m_pBatchList.load( atomics::memory_order_acquire ); pBatch; pBatch = pBatch->m_pGlobalNext.load( atomics::memory_order_relaxed )) {
+            bool bBusy = false;
+            if ( !pBatch->m_bBusy.load( atomics::memory_order_relaxed )
+                && pBatch->m_bBusy.compare_exchange_strong( bBusy, true, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+            {
+                assert( pBatch->empty() );
+                return pBatch;
+            }
+        }
+
+        // The batch list is an accumulating list, so ABA problem is impossible for it
+        details::retired_batch * pBatch = new details::retired_batch;
+        details::retired_batch * pHead = m_pBatchList.load( atomics::memory_order_relaxed );
+        do {
+            pBatch->m_pGlobalNext.store( pHead, atomics::memory_order_relaxed );
+            // pHead is changed by compare_exchange_weak
+        } while ( !m_pBatchList.compare_exchange_weak( pHead, pBatch, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+        return pBatch;
+    }
+
+    void GarbageCollector::freeRetiredBatch( details::retired_batch * pBatch )
+    {
+        assert( pBatch != nullptr );
+        assert( pBatch->empty() );
+        pBatch->m_bBusy.store( false, atomics::memory_order_release );
     }
 
     void GarbageCollector::scan()
     {
         details::retired_ptr_buffer::privatize_result retiredList = m_RetiredBuffer.privatize();
         if ( retiredList.first ) {
+            if ( m_bStatEnabled )
+                m_stat.m_nScanCount.fetch_add( 1, atomics::memory_order_relaxed );
 
             size_t nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
             details::liberate_set set( beans::ceil2( retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ));
@@ -242,6 +343,7 @@ namespace cds { namespace gc { namespace dhp {
                             pBusyLast->m_pNext.store( p, atomics::memory_order_relaxed );
                             pBusyLast = p;
                             ++nBusyCount;
+                            p = p->m_pNextFree.load( atomics::memory_order_relaxed );
                         }
                     }
                 }
@@ -252,7 +354,20 @@ namespace cds { namespace gc { namespace dhp {
                 m_RetiredBuffer.push_list( pBusyFirst, pBusyLast, nBusyCount );
 
             // Free all retired pointers
-            details::liberate_set::list_range range = set.free_all();
+            details::liberate_set::list_range range;
+            {
+                details::retired_disposer disposer( m_pBatchDisposer.load( atomics::memory_order_acquire ), m_bStatEnabled ? timestamp() : 0 );
+                range = set.free_all( disposer );
+                disposer.flush();
+
+                if ( disposer.m_nFreedCount ) {
+                    m_stat.m_nFreedCount.fetch_add( disposer.m_nFreedCount, atomics::memory_order_relaxed );
+                    m_stat.m_nRetireToFreeTotal.fetch_add( disposer.m_nLatencyTotal, atomics::memory_order_relaxed );
+                    uint64_t nMax = m_stat.m_nRetireToFreeMax.load( atomics::memory_order_relaxed );
+                    while ( nMax < disposer.m_nLatencyMax
+                        && !m_stat.m_nRetireToFreeMax.compare_exchange_weak( nMax, disposer.m_nLatencyMax, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+                }
+            }
 
             m_RetiredAllocator.inc_epoch();
 
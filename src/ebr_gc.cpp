@@ -0,0 +1,222 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+// Epoch-based reclamation memory manager implementation
+
+#include <cds/gc/details/ebr.h>
+
+namespace cds { namespace gc { namespace ebr {
+
+    GarbageCollector * GarbageCollector::m_pManager = nullptr;
+
+    void CDS_STDCALL GarbageCollector::Construct( size_t nScanThreshold )
+    {
+        if ( !m_pManager ) {
+            m_pManager = new GarbageCollector( nScanThreshold );
+        }
+    }
+
+    void CDS_STDCALL GarbageCollector::Destruct()
+    {
+        delete m_pManager;
+        m_pManager = nullptr;
+    }
+
+    GarbageCollector::GarbageCollector( size_t nScanThreshold )
+        : m_nGlobalEpoch( 0 )
+        , m_pHead( nullptr )
+        , m_nScanThreshold( nScanThreshold ? nScanThreshold : 256 )
+        , m_bStatEnabled( false )
+    {}
+
+    GarbageCollector::~GarbageCollector()
+    {
+        // No thread may use the GC at this time, all retired pointers can be freed
+        details::thread_record * pNext;
+        for ( details::thread_record * pRec = m_pHead.load( atomics::memory_order_relaxed ); pRec; pRec = pNext ) {
+            pNext = pRec->m_pNext;
+
+            for ( details::epoch_retired_ptr& p : pRec->m_arrRetired )
+                p.m_ptr.free();
+            pRec->m_arrRetired.size( 0 );
+
+            delete pRec;
+        }
+    }
+
+    details::thread_record * GarbageCollector::alloc_thread_record()
+    {
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
+
+        // First try to reuse a record of detached or terminated thread
+        for ( details::thread_record * pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            cds::OS::ThreadId thId = pRec->m_idOwner.load( atomics::memory_order_relaxed );
+            if ( thId != nullThreadId && cds::OS::is_thread_alive( thId ))
+                continue;
+            if ( pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                // The owner may be terminated without detaching
+                pRec->m_nNesting = 0;
+                pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+                return pRec;
+            }
+        }
+
+        // No records available for reuse
+        // Allocate and push a new record
+        details::thread_record * pRec = new details::thread_record( m_nScanThreshold );
+        pRec->m_idOwner.store( curThreadId, atomics::memory_order_relaxed );
+
+        details::thread_record * pHead = m_pHead.load( atomics::memory_order_relaxed );
+        do {
+            pRec->m_pNext = pHead;
+        } while ( !m_pHead.compare_exchange_weak( pHead, pRec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+        if ( m_bStatEnabled )
+            m_stat.m_nRecordCount.fetch_add( 1, atomics::memory_order_relaxed );
+        return pRec;
+    }
+
+    void GarbageCollector::free_thread_record( details::thread_record * pRec )
+    {
+        assert( pRec != nullptr );
+        assert( pRec->m_idOwner.load( atomics::memory_order_relaxed ) == cds::OS::get_current_thread_id() );
+
+        pRec->m_nNesting = 0;
+        pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+
+        // The pointers that cannot be freed now will be freed by other threads in help_scan()
+        scan( *pRec );
+        pRec->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
+    }
+
+    bool GarbageCollector::try_advance()
+    {
+        uint64_t nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+
+        // Makes the unlinking performed before visible to the threads that will pin new epoch
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+        for ( details::thread_record * pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            uint64_t nRecEpoch = pRec->m_nEpoch.load( atomics::memory_order_acquire );
+            if ( (nRecEpoch & 1) && (nRecEpoch >> 1) != nEpoch )
+                return false;
+        }
+
+        if ( m_nGlobalEpoch.compare_exchange_strong( nEpoch, nEpoch + 1, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+            if ( m_bStatEnabled )
+                m_stat.m_nEpochAdvanceCount.fetch_add( 1, atomics::memory_order_relaxed );
+        }
+        return true;
+    }
+
+    size_t GarbageCollector::free_retired( details::thread_record& rec, uint64_t nEpoch )
+    {
+        // The pointer retired in epoch e is safe to free when the global epoch is e + 2 or more
+        details::retired_vector& arr = rec.m_arrRetired;
+        details::epoch_retired_ptr * pInsert = arr.begin();
+        for ( details::epoch_retired_ptr * it = arr.begin(), * itEnd = arr.end(); it != itEnd; ++it ) {
+            if ( it->m_nEpoch + 2 <= nEpoch )
+                it->m_ptr.free();
+            else
+                *pInsert++ = *it;
+        }
+
+        size_t const nFreed = arr.size() - static_cast<size_t>( pInsert - arr.begin());
+        arr.size( static_cast<size_t>( pInsert - arr.begin()));
+
+        if ( m_bStatEnabled )
+            m_stat.m_nFreedCount.fetch_add( nFreed, atomics::memory_order_relaxed );
+        return nFreed;
+    }
+
+    void GarbageCollector::help_scan( details::thread_record& rec, uint64_t nEpoch )
+    {
+        const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
+        const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
+
+        for ( details::thread_record * pRec = m_pHead.load( atomics::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            if ( pRec == &rec )
+                continue;
+
+            // Takes the record of detached or terminated thread for a while
+            cds::OS::ThreadId thId = pRec->m_idOwner.load( atomics::memory_order_relaxed );
+            if ( thId != nullThreadId && cds::OS::is_thread_alive( thId ))
+                continue;
+            if ( !pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                continue;
+
+            if ( thId != nullThreadId ) {
+                // The owner has been terminated without detaching, maybe with pinned epoch
+                pRec->m_nNesting = 0;
+                pRec->m_nEpoch.store( 0, atomics::memory_order_release );
+            }
+
+            if ( !pRec->m_arrRetired.empty()) {
+                size_t nFreed = free_retired( *pRec, nEpoch );
+                if ( m_bStatEnabled )
+                    m_stat.m_nHelpScanCount.fetch_add( nFreed, atomics::memory_order_relaxed );
+            }
+
+            pRec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
+        }
+    }
+
+    void GarbageCollector::scan( details::thread_record& rec )
+    {
+        if ( m_bStatEnabled )
+            m_stat.m_nScanCount.fetch_add( 1, atomics::memory_order_relaxed );
+
+        try_advance();
+        uint64_t const nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+
+        free_retired( rec, nEpoch );
+        help_scan( rec, nEpoch );
+
+        // If the epoch is stuck by a long-pinned thread, postpone next scan to avoid scanning on each retire
+        rec.m_nNextScan = rec.m_arrRetired.size() + m_nScanThreshold;
+    }
+
+    void GarbageCollector::force_dispose( details::thread_record& rec )
+    {
+        if ( m_bStatEnabled )
+            m_stat.m_nScanCount.fetch_add( 1, atomics::memory_order_relaxed );
+
+        // The pointers retired in current epoch e are safe to free in epoch e + 2
+        if ( try_advance())
+            try_advance();
+        uint64_t const nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+
+        free_retired( rec, nEpoch );
+        help_scan( rec, nEpoch );
+        rec.m_nNextScan = rec.m_arrRetired.size() + m_nScanThreshold;
+    }
+
+}}} // namespace cds::gc::ebr
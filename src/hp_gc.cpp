@@ -38,10 +38,18 @@
 */
 
 #include <cds/gc/details/hp.h>
+#include <cds/os/alloc_aligned.h>
+#include <cds/algo/int_algo.h>
 
 #include <algorithm>    // std::sort
+#include <vector>
 #include "hp_const.h"
 
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 && ( defined(__SSE2__) || CDS_COMPILER == CDS_COMPILER_MSVC )
+#   define CDS_HP_SCAN_SSE2
+#   include <emmintrin.h>
+#endif
+
 #define    CDS_HAZARDPTR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
 
 namespace cds { namespace gc {
@@ -52,6 +60,92 @@ namespace cds { namespace gc {
 
         GarbageCollector *    GarbageCollector::m_pHZPManager = nullptr;
 
+        namespace {
+            // batched_scan hash set: open addressing, the bucket is 4 hazard pointers.
+            // The bucket is 32 bytes for 64bit pointers, so two buckets fit in one cache line
+            static const size_t c_nScanBucketSize = 4;
+
+            // Count of retired pointers which hash buckets are prefetched at once
+            static const size_t c_nScanBatchSize = 8;
+
+            static inline size_t scan_hash( void * p, size_t nBucketMask )
+            {
+                // Fibonacci hashing; low bits of the pointer are zero because of alignment
+                uintptr_t h = reinterpret_cast<uintptr_t>( p ) >> 3;
+#if CDS_BUILD_BITS == 64
+                h *= static_cast<uintptr_t>( 0x9E3779B97F4A7C15ULL );
+                return static_cast<size_t>( h >> 32 ) & nBucketMask;
+#else
+                h *= static_cast<uintptr_t>( 0x9E3779B9U );
+                return static_cast<size_t>( h ^ ( h >> 16 )) & nBucketMask;
+#endif
+            }
+
+#ifdef CDS_HP_SCAN_SSE2
+            static inline __m128i scan_cmpeq64( __m128i a, __m128i b )
+            {
+                // SSE2 has no 64bit comparison: 64bit lane is equal if both its 32bit halves are equal
+                __m128i const eq = _mm_cmpeq_epi32( a, b );
+                return _mm_and_si128( eq, _mm_shuffle_epi32( eq, _MM_SHUFFLE( 2, 3, 0, 1 )));
+            }
+#endif
+
+            // Searches \p p in the bucket.
+            // Returns: 1 - p is found; 0 - the bucket has an empty slot, so p is not in the set;
+            // -1 - the bucket is full, the search should be continued in next bucket
+            static inline int scan_bucket_find( void * const * pBucket, void * p )
+            {
+#ifdef CDS_HP_SCAN_SSE2
+                __m128i const key = _mm_set1_epi64x( static_cast<long long>( reinterpret_cast<uintptr_t>( p )));
+                __m128i const zero = _mm_setzero_si128();
+                __m128i const lo = _mm_load_si128( reinterpret_cast<__m128i const *>( pBucket ));
+                __m128i const hi = _mm_load_si128( reinterpret_cast<__m128i const *>( pBucket ) + 1 );
+
+                if ( _mm_movemask_epi8( _mm_or_si128( scan_cmpeq64( lo, key ), scan_cmpeq64( hi, key ))))
+                    return 1;
+                if ( _mm_movemask_epi8( _mm_or_si128( scan_cmpeq64( lo, zero ), scan_cmpeq64( hi, zero ))))
+                    return 0;
+                return -1;
+#else
+                for ( size_t i = 0; i < c_nScanBucketSize; ++i ) {
+                    if ( pBucket[i] == p )
+                        return 1;
+                    if ( pBucket[i] == nullptr )
+                        return 0;
+                }
+                return -1;
+#endif
+            }
+
+            static inline bool scan_find( void * const * pSet, size_t nBucketMask, size_t nBucket, void * p )
+            {
+                for (;;) {
+                    int const nRes = scan_bucket_find( pSet + nBucket * c_nScanBucketSize, p );
+                    if ( nRes >= 0 )
+                        return nRes != 0;
+                    nBucket = ( nBucket + 1 ) & nBucketMask;
+                }
+            }
+
+            static inline void scan_insert( void ** pSet, size_t nBucketMask, void * p )
+            {
+                // The load factor of the set is not greater than 1/2, so the loop is finite
+                size_t nBucket = scan_hash( p, nBucketMask );
+                for (;;) {
+                    void ** pBucket = pSet + nBucket * c_nScanBucketSize;
+                    for ( size_t i = 0; i < c_nScanBucketSize; ++i ) {
+                        if ( pBucket[i] == p )
+                            return;
+                        if ( pBucket[i] == nullptr ) {
+                            pBucket[i] = p;
+                            return;
+                        }
+                    }
+                    nBucket = ( nBucket + 1 ) & nBucketMask;
+                }
+            }
+        } // namespace
+
         void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
         {
             if ( !m_pHZPManager ) {
@@ -76,24 +170,25 @@ namespace cds { namespace gc {
             size_t nMaxRetiredPtrCount,
             scan_type nScanType
         )
-            : m_pListHead( nullptr )
+            : m_nRecCount( 0 )
+            ,m_FreeList( 0 )
             ,m_bStatEnabled( false )
             ,m_nHazardPointerCount( nHazardPtrCount == 0 ? c_nHazardPointerPerThread : nHazardPtrCount )
             ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
             ,m_nMaxRetiredPtrCount( nMaxRetiredPtrCount > c_nMaxRetireNodeCount ? nMaxRetiredPtrCount : c_nMaxRetireNodeCount )
+            ,m_nChunkCapacity( cds::beans::ceil2( m_nMaxThreadCount ))
             ,m_nScanType( nScanType )
-        {}
+        {
+            for ( size_t i = 0; i < c_nMaxChunkCount; ++i )
+                m_arrChunk[i].store( nullptr, atomics::memory_order_relaxed );
+        }
 
         GarbageCollector::~GarbageCollector()
         {
             CDS_DEBUG_ONLY( const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId; )
             CDS_DEBUG_ONLY( const cds::OS::ThreadId mainThreadId = cds::OS::get_current_thread_id() ;)
 
-            hplist_node * pHead = m_pListHead.load( atomics::memory_order_relaxed );
-            m_pListHead.store( nullptr, atomics::memory_order_relaxed );
-
-            hplist_node * pNext = nullptr;
-            for ( hplist_node * hprec = pHead; hprec; hprec = pNext ) {
+            for_each_record( [&]( hplist_node * hprec ) {
                 assert( hprec->m_idOwner.load( atomics::memory_order_relaxed ) == nullThreadId
                     || hprec->m_idOwner.load( atomics::memory_order_relaxed ) == mainThreadId
                     || !cds::OS::is_thread_alive( hprec->m_idOwner.load( atomics::memory_order_relaxed ) )
@@ -106,25 +201,129 @@ namespace cds { namespace gc {
                     ++itRetired;
                 }
                 vect.clear();
-                pNext = hprec->m_pNextNode;
+                hprec->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_relaxed );
                 hprec->m_bFree.store( true, atomics::memory_order_relaxed );
                 DeleteHPRec( hprec );
+            }, false );
+
+            for ( size_t i = 0; i < c_nMaxChunkCount; ++i ) {
+                delete m_arrChunk[i].load( atomics::memory_order_relaxed );
+                m_arrChunk[i].store( nullptr, atomics::memory_order_relaxed );
             }
         }
 
-        inline GarbageCollector::hplist_node * GarbageCollector::NewHPRec()
+        inline GarbageCollector::hplist_node * GarbageCollector::NewHPRec( size_t nIndex )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_AllocNewHPRec )
-            return new hplist_node( *this );
+            return new hplist_node( *this, nIndex );
         }
 
         inline void GarbageCollector::DeleteHPRec( hplist_node * pNode )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeleteHPRec )
             assert( pNode->m_arrRetired.size() == 0 );
+            free_scan_buffer( pNode );
             delete pNode;
         }
 
+        inline size_t GarbageCollector::chunk_index( size_t nIndex, size_t& nOffset ) const
+        {
+            // Chunk k contains records [m_nChunkCapacity * (2**k - 1), m_nChunkCapacity * (2**(k+1) - 1))
+            size_t const nChunk = static_cast<size_t>( cds::bitop::MSBnz( nIndex / m_nChunkCapacity + 1 ));
+            nOffset = nIndex - m_nChunkCapacity * (( size_t(1) << nChunk ) - 1 );
+            return nChunk;
+        }
+
+        GarbageCollector::hprec_chunk * GarbageCollector::get_chunk( size_t nChunk )
+        {
+            assert( nChunk < c_nMaxChunkCount );
+            hprec_chunk * pChunk = m_arrChunk[nChunk].load( atomics::memory_order_acquire );
+            if ( !pChunk ) {
+                hprec_chunk * pNew = new hprec_chunk( m_nChunkCapacity << nChunk );
+                if ( m_arrChunk[nChunk].compare_exchange_strong( pChunk, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    pChunk = pNew;
+                else
+                    delete pNew;
+            }
+            return pChunk;
+        }
+
+        template <typename Func>
+        inline void GarbageCollector::for_each_record( Func f, bool bUsedOnly ) const
+        {
+            // The records allocated after reading m_nRecCount are skipped.
+            // It is safe for the scan only if the caller has issued a seq_cst fence before:
+            // then a thread attached after reading m_nRecCount cannot guard a pointer
+            // that has been retired before the scan
+            for_each_record( f, bUsedOnly, m_nRecCount.load( atomics::memory_order_acquire ));
+        }
+
+        template <typename Func>
+        inline void GarbageCollector::for_each_record( Func f, bool bUsedOnly, size_t nRecCount ) const
+        {
+            size_t nBase = 0;
+            for ( size_t nChunk = 0; nBase < nRecCount; ++nChunk ) {
+                size_t const nCapacity = m_nChunkCapacity << nChunk;
+                hprec_chunk * pChunk = m_arrChunk[nChunk].load( atomics::memory_order_acquire );
+
+                // pChunk may be nullptr if it is being allocated by another thread;
+                // next chunks can contain records, so we continue
+                if ( pChunk && ( !bUsedOnly || pChunk->m_nUsed.load( atomics::memory_order_acquire ) != 0 )) {
+                    size_t const nCount = nRecCount - nBase < nCapacity ? nRecCount - nBase : nCapacity;
+                    for ( size_t i = 0; i < nCount; ++i ) {
+                        hplist_node * pNode = pChunk->m_arrRec[i].load( atomics::memory_order_acquire );
+                        if ( pNode )
+                            f( pNode );
+                    }
+                }
+                nBase += nCapacity;
+            }
+        }
+
+        GarbageCollector::hplist_node * GarbageCollector::pop_free_record()
+        {
+            uint64_t nHead = m_FreeList.load( atomics::memory_order_acquire );
+            while ( static_cast<uint32_t>( nHead ) != 0 ) {
+                size_t nOffset;
+                size_t const nChunk = chunk_index( static_cast<uint32_t>( nHead ) - 1, nOffset );
+                hplist_node * pNode = m_arrChunk[nChunk].load( atomics::memory_order_acquire )->m_arrRec[nOffset].load( atomics::memory_order_acquire );
+
+                // pNode may be already popped by another thread; in this case the tag is changed and CAS fails
+                uint64_t const nNewHead = (( nHead >> 32 ) + 1 ) << 32 | pNode->m_nNextFree.load( atomics::memory_order_relaxed );
+                if ( m_FreeList.compare_exchange_weak( nHead, nNewHead, atomics::memory_order_acquire, atomics::memory_order_acquire ))
+                    return pNode;
+            }
+            return nullptr;
+        }
+
+        void GarbageCollector::push_free_record( hplist_node * pNode )
+        {
+            assert( pNode->m_nIndex < static_cast<uint32_t>( -1 ));
+            uint64_t nHead = m_FreeList.load( atomics::memory_order_relaxed );
+            uint64_t nNewHead;
+            do {
+                pNode->m_nNextFree.store( static_cast<uint32_t>( nHead ), atomics::memory_order_relaxed );
+                nNewHead = (( nHead >> 32 ) + 1 ) << 32 | static_cast<uint32_t>( pNode->m_nIndex + 1 );
+            } while ( !m_FreeList.compare_exchange_weak( nHead, nNewHead, atomics::memory_order_release, atomics::memory_order_relaxed ));
+        }
+
+        void GarbageCollector::set_free_flag( hplist_node * pNode, bool bFree )
+        {
+            // The caller owns pNode
+            if ( pNode->m_bFree.load( atomics::memory_order_relaxed ) != bFree ) {
+                size_t nOffset;
+                hprec_chunk * pChunk = m_arrChunk[ chunk_index( pNode->m_nIndex, nOffset ) ].load( atomics::memory_order_relaxed );
+                if ( bFree ) {
+                    pNode->m_bFree.store( true, atomics::memory_order_release );
+                    pChunk->m_nUsed.fetch_sub( 1, atomics::memory_order_release );
+                }
+                else {
+                    pChunk->m_nUsed.fetch_add( 1, atomics::memory_order_acq_rel );
+                    pNode->m_bFree.store( false, atomics::memory_order_release );
+                }
+            }
+        }
+
         details::hp_record * GarbageCollector::alloc_hp_record()
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_AllocHPRec )
@@ -133,25 +332,30 @@ namespace cds { namespace gc {
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
             const cds::OS::ThreadId curThreadId  = cds::OS::get_current_thread_id();
 
-            // First try to reuse a retired (non-active) HP record
-            for ( hprec = m_pListHead.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode ) {
+            // First try to reuse a released HP record
+            hprec = pop_free_record();
+            if ( hprec ) {
                 cds::OS::ThreadId thId = nullThreadId;
-                if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
-                    continue;
-                hprec->m_bFree.store( false, atomics::memory_order_release );
-                return hprec;
+                if ( hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                    set_free_flag( hprec, false );
+                    return hprec;
+                }
+
+                // The record is temporarily owned by HelpScan() of another thread.
+                // Return it to the free-list and allocate new one
+                push_free_record( hprec );
             }
 
             // No HP records available for reuse
-            // Allocate and push a new HP record
-            hprec = NewHPRec();
-            hprec->m_idOwner.store( curThreadId, atomics::memory_order_release );
-            hprec->m_bFree.store( false, atomics::memory_order_release );
+            // Allocate new HP record and publish it in HP record table
+            size_t const nIndex = m_nRecCount.fetch_add( 1, atomics::memory_order_acq_rel );
+            size_t nOffset;
+            hprec_chunk * pChunk = get_chunk( chunk_index( nIndex, nOffset ));
 
-            hplist_node * pOldHead = m_pListHead.load( atomics::memory_order_acquire );
-            do {
-                hprec->m_pNextNode = pOldHead;
-            } while ( !m_pListHead.compare_exchange_weak( pOldHead, hprec, atomics::memory_order_release, atomics::memory_order_relaxed ));
+            hprec = NewHPRec( nIndex );
+            hprec->m_idOwner.store( curThreadId, atomics::memory_order_relaxed );
+            set_free_flag( hprec, false );
+            pChunk->m_arrRec[nOffset].store( hprec, atomics::memory_order_release );
 
             return hprec;
         }
@@ -166,18 +370,17 @@ namespace cds { namespace gc {
             HelpScan( pRec );
             hplist_node * pNode = static_cast<hplist_node *>( pRec );
             pNode->m_idOwner.store( cds::OS::c_NullThreadId, atomics::memory_order_release );
+            push_free_record( pNode );
         }
 
         void GarbageCollector::detachAllThread()
         {
-            hplist_node * pNext = nullptr;
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
-            for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = pNext ) {
-                pNext = hprec->m_pNextNode;
+            for_each_record( [this, nullThreadId]( hplist_node * hprec ) {
                 if ( hprec->m_idOwner.load(atomics::memory_order_relaxed) != nullThreadId ) {
                     free_hp_record( hprec );
                 }
-            }
+            }, false );
         }
 
         void GarbageCollector::classic_scan( details::hp_record * pRec )
@@ -185,22 +388,22 @@ namespace cds { namespace gc {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
 
             std::vector< void * >   plist;
-            plist.reserve( m_nMaxThreadCount * m_nHazardPointerCount );
+            plist.reserve( m_nRecCount.load( atomics::memory_order_relaxed ) * m_nHazardPointerCount );
             assert( plist.size() == 0 );
 
-            // Stage 1: Scan HP list and insert non-null values in plist
+            // Stage 1: Scan HP record table and insert non-null values in plist
 
-            hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire);
-
-            while ( pNode ) {
+            // The fence pairs with the fence of guarding thread and orders
+            // reading of record count and chunk's m_nUsed after the retiring
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            for_each_record( [&]( hplist_node * pNode ) {
                 for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
                     pRec->sync();
                     void * hptr = pNode->m_hzp[i];
                     if ( hptr )
                         plist.push_back( hptr );
                 }
-                pNode = pNode->m_pNextNode;
-            }
+            }, true );
 
             // Sort plist to simplify search in
             std::sort( plist.begin(), plist.end() );
@@ -269,11 +472,12 @@ namespace cds { namespace gc {
             */
 
             // Search guarded pointers in retired array
-            hplist_node * pNode = m_pListHead.load( atomics::memory_order_acquire );
-
             {
                 details::retired_ptr dummyRetired;
-                while ( pNode ) {
+
+                // Order reading of record count and chunk's m_nUsed after the retiring, see classic_scan()
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                for_each_record( [&]( hplist_node * pNode ) {
                     if ( !pNode->m_bFree.load( atomics::memory_order_acquire ) ) {
                         for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
                             pRec->sync();
@@ -288,8 +492,7 @@ namespace cds { namespace gc {
                             }
                         }
                     }
-                    pNode = pNode->m_pNextNode;
-                }
+                }, true );
             }
 
             // Move all marked pointers to head of array
@@ -314,6 +517,99 @@ namespace cds { namespace gc {
             }
         }
 
+        void GarbageCollector::free_scan_buffer( hplist_node * pNode )
+        {
+            if ( pNode->m_pScanBuf ) {
+                cds::OS::aligned_free( pNode->m_pScanBuf );
+                pNode->m_pScanBuf = nullptr;
+                pNode->m_nScanBufCapacity = 0;
+            }
+        }
+
+        void GarbageCollector::batched_scan( details::hp_record * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
+
+            hplist_node * pThis = static_cast<hplist_node *>( pRec );
+
+            // Stage 1: prepare the hash set.
+            // HP records are never removed from the table while GC is alive,
+            // so we read the record count once and then scan the same records.
+            // One full fence for whole snapshot instead of synchronization for each hazard pointer;
+            // it must precede reading of the record count and chunk's m_nUsed, see classic_scan()
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            size_t const nRecCount = m_nRecCount.load( atomics::memory_order_acquire );
+
+            size_t nCapacity = cds::beans::ceil2( nRecCount * m_nHazardPointerCount * 2 );
+            if ( nCapacity < c_nScanBucketSize * 2 )
+                nCapacity = c_nScanBucketSize * 2;
+            if ( pThis->m_nScanBufCapacity < nCapacity ) {
+                free_scan_buffer( pThis );
+                pThis->m_pScanBuf = reinterpret_cast<void **>( cds::OS::aligned_malloc( sizeof( void * ) * nCapacity, c_nCacheLineSize ));
+                pThis->m_nScanBufCapacity = nCapacity;
+            }
+            else
+                nCapacity = pThis->m_nScanBufCapacity;
+
+            void ** const pSet = pThis->m_pScanBuf;
+            size_t const nBucketMask = nCapacity / c_nScanBucketSize - 1;
+            std::fill( pSet, pSet + nCapacity, nullptr );
+
+            // Stage 2: take the snapshot of hazard pointers of all active HP records.
+            size_t nHPCount = 0;
+            for_each_record( [&]( hplist_node * pNode ) {
+                if ( pNode->m_bFree.load( atomics::memory_order_acquire ))
+                    return;
+                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
+                    void * hptr = pNode->m_hzp[i].get( atomics::memory_order_acquire );
+                    if ( hptr ) {
+                        scan_insert( pSet, nBucketMask, hptr );
+                        ++nHPCount;
+                    }
+                }
+            }, true, nRecCount );
+
+            // Stage 3: search retired pointers in the snapshot batch by batch.
+            details::retired_vector& arrRetired = pRec->m_arrRetired;
+            details::retired_vector::iterator itRetired     = arrRetired.begin();
+            details::retired_vector::iterator itRetiredEnd  = arrRetired.end();
+            // arrRetired is not a std::vector!
+            // clear() is just set up item counter to 0, the items is not destroyed
+            arrRetired.clear();
+
+            size_t nDeferredCount = 0;
+            if ( nHPCount == 0 ) {
+                // No guarded pointers - free all
+                for ( ; itRetired != itRetiredEnd; ++itRetired )
+                    itRetired->free();
+            }
+            else {
+                size_t arrBucket[c_nScanBatchSize];
+                while ( itRetired != itRetiredEnd ) {
+                    size_t const nBatch = std::min( c_nScanBatchSize, static_cast<size_t>( itRetiredEnd - itRetired ));
+
+                    // Compute buckets and prefetch them before searching
+                    for ( size_t i = 0; i < nBatch; ++i ) {
+                        arrBucket[i] = scan_hash( itRetired[i].m_p, nBucketMask );
+                        CDS_PREFETCH( pSet + arrBucket[i] * c_nScanBucketSize );
+                    }
+
+                    // Note that arrRetired.push() cannot overwrite unprocessed items
+                    // since the size of arrRetired is not greater than the index of current item
+                    for ( size_t i = 0; i < nBatch; ++i, ++itRetired ) {
+                        if ( scan_find( pSet, nBucketMask, arrBucket[i], itRetired->m_p )) {
+                            arrRetired.push( *itRetired );
+                            ++nDeferredCount;
+                        }
+                        else
+                            itRetired->free();
+                    }
+                }
+            }
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferredCount )
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - arrRetired.begin()) - nDeferredCount )
+        }
+
         void GarbageCollector::HelpScan( details::hp_record * pThis )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_HelpScanCallCount )
@@ -322,24 +618,28 @@ namespace cds { namespace gc {
 
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
             const cds::OS::ThreadId curThreadId = cds::OS::get_current_thread_id();
-            for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+            for_each_record( [&]( hplist_node * hprec ) {
 
                 // If m_bFree == true then hprec->m_arrRetired is empty - we don't need to see it
                 if ( hprec->m_bFree.load(atomics::memory_order_acquire) )
-                    continue;
+                    return;
 
                 // Owns hprec if it is empty.
                 // Several threads may work concurrently so we use atomic technique only.
+                // If the owner of hprec is dead, hprec is not in the free-list, we will push it there
+                bool bAbandoned;
                 {
                     cds::OS::ThreadId curOwner = hprec->m_idOwner.load(atomics::memory_order_acquire);
                     if ( curOwner == nullThreadId || !cds::OS::is_thread_alive( curOwner )) {
+                        bAbandoned = curOwner != nullThreadId;
                         if ( !hprec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, atomics::memory_order_release, atomics::memory_order_relaxed ))
-                            continue;
+                            return;
                     }
                     else {
+                        bAbandoned = false;
                         curOwner = nullThreadId;
                         if ( !hprec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, atomics::memory_order_release, atomics::memory_order_relaxed ))
-                            continue;
+                            return;
                     }
                 }
 
@@ -372,11 +672,13 @@ namespace cds { namespace gc {
                 src.clear();
                 CDS_TSAN_ANNOTATE_IGNORE_WRITES_END;
 
-                hprec->m_bFree.store(true, atomics::memory_order_release);
+                set_free_flag( hprec, true );
                 hprec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
+                if ( bAbandoned )
+                    push_free_record( hprec );
 
                 Scan( pThis );
-            }
+            }, true );
         }
 
         GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
@@ -392,7 +694,7 @@ namespace cds { namespace gc {
                 stat.nTotalRetiredPtrCount   =
                 stat.nRetiredPtrInFreeHPRecs = 0;
 
-            for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+            for_each_record( [&stat]( hplist_node * hprec ) {
                 ++stat.nHPRecAllocated;
                 stat.nTotalRetiredPtrCount += hprec->m_arrRetired.size();
 
@@ -404,7 +706,7 @@ namespace cds { namespace gc {
                     // Used HP record
                     ++stat.nHPRecUsed;
                 }
-            }
+            }, false );
 
             // Events
             stat.evcAllocHPRec   = m_Stat.m_AllocHPRec;
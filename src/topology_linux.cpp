@@ -33,11 +33,133 @@
 #if CDS_OS_TYPE == CDS_OS_LINUX
 
 #include <unistd.h>
+#include <sys/syscall.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <fstream>
 
 namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
 
     unsigned int topology::s_nProcessorCount = 0;
+    unsigned int topology::s_nNodeCount = 1;
+    unsigned int * topology::s_arrProcNode = nullptr;
+    unsigned int topology::s_nCacheGroupCount = 1;
+    unsigned int * topology::s_arrProcCacheGroup = nullptr;
+
+    // We cannot use operator new or std containers in the code below
+    // since the initialization phase may be called from
+    // our overloaded operator new that based on cds::michael::Heap
+    namespace {
+        static size_t const c_nLineSize = 4096;
+
+        // Reads the first line of the file
+        bool read_line( char const * pszPath, char * pBuf )
+        {
+            FILE * f = ::fopen( pszPath, "r" );
+            if ( !f )
+                return false;
+            bool bOk = ::fgets( pBuf, static_cast<int>( c_nLineSize ), f ) != nullptr;
+            ::fclose( f );
+            return bOk && pBuf[0] != '\0';
+        }
+
+        // Calls f(n) for each number of sysfs list like "0-3,8,10-11"
+        template <typename Func>
+        void for_each_in_list( char const * psz, Func f )
+        {
+            while ( *psz ) {
+                char * pEnd;
+                unsigned long nFirst = ::strtoul( psz, &pEnd, 10 );
+                if ( pEnd == psz )
+                    break;
+                unsigned long nLast = nFirst;
+                psz = pEnd;
+                if ( *psz == '-' ) {
+                    nLast = ::strtoul( psz + 1, &pEnd, 10 );
+                    if ( pEnd == psz + 1 )
+                        break;
+                    psz = pEnd;
+                }
+                for ( unsigned long i = nFirst; i <= nLast; ++i )
+                    f( static_cast<unsigned int>( i ));
+                if ( *psz != ',' )
+                    break;
+                ++psz;
+            }
+        }
+
+        // Reads NUMA node of each processor; returns node count (max node id + 1)
+        unsigned int read_numa_nodes( unsigned int * arrProcNode, unsigned int nProcCount )
+        {
+            char szNodes[c_nLineSize];
+            if ( !read_line( "/sys/devices/system/node/online", szNodes ))
+                return 1;
+
+            unsigned int nNodeCount = 1;
+            for_each_in_list( szNodes, [&]( unsigned int nNode ) {
+                char szPath[128];
+                char szCpus[c_nLineSize];
+                ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/node/node%u/cpulist", nNode );
+                if ( !read_line( szPath, szCpus ))
+                    return;
+
+                for_each_in_list( szCpus, [&]( unsigned int nCpu ) {
+                    if ( nCpu < nProcCount )
+                        arrProcNode[ nCpu ] = nNode;
+                });
+                if ( nNode + 1 > nNodeCount )
+                    nNodeCount = nNode + 1;
+            });
+            return nNodeCount;
+        }
+
+        // Reads last-level cache sharing of each processor; returns cache group count
+        unsigned int read_cache_groups( unsigned int * arrProcGroup, unsigned int nProcCount )
+        {
+            unsigned int const c_nNoGroup = static_cast<unsigned int>( -1 );
+
+            // The group is identified by min processor id sharing the cache (group key)
+            unsigned int * arrKeyToGroup = reinterpret_cast<unsigned int *>( ::malloc( sizeof(unsigned int) * nProcCount ));
+            if ( !arrKeyToGroup )
+                return 1;
+            for ( unsigned int i = 0; i < nProcCount; ++i )
+                arrKeyToGroup[i] = c_nNoGroup;
+
+            unsigned int nGroupCount = 0;
+            char szPath[128];
+            char szLine[c_nLineSize];
+            for ( unsigned int nCpu = 0; nCpu < nProcCount; ++nCpu ) {
+                unsigned long nMaxLevel = 0;
+                unsigned int nKey = nCpu;
+
+                for ( unsigned int nIndex = 0; ; ++nIndex ) {
+                    ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", nCpu, nIndex );
+                    if ( !read_line( szPath, szLine ))
+                        break;
+                    unsigned long nLevel = ::strtoul( szLine, nullptr, 10 );
+                    if ( nLevel < nMaxLevel )
+                        continue;
+
+                    ::snprintf( szPath, sizeof(szPath), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", nCpu, nIndex );
+                    if ( read_line( szPath, szLine )) {
+                        unsigned int nMin = c_nNoGroup;
+                        for_each_in_list( szLine, [&nMin]( unsigned int n ) { if ( n < nMin ) nMin = n; } );
+                        if ( nMin < nProcCount ) {
+                            nMaxLevel = nLevel;
+                            nKey = nMin;
+                        }
+                    }
+                }
+
+                if ( arrKeyToGroup[ nKey ] == c_nNoGroup )
+                    arrKeyToGroup[ nKey ] = nGroupCount++;
+                arrProcGroup[ nCpu ] = arrKeyToGroup[ nKey ];
+            }
+
+            ::free( arrKeyToGroup );
+            return nGroupCount ? nGroupCount : 1;
+        }
+    } // namespace
 
     void topology::init()
     {
@@ -64,10 +186,57 @@ namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
                 s_nProcessorCount = 1;
             }
          }
+         if ( s_nProcessorCount == 0 )
+             s_nProcessorCount = 1;
+
+         s_arrProcNode = reinterpret_cast<unsigned int *>( ::calloc( s_nProcessorCount, sizeof(unsigned int)));
+         s_arrProcCacheGroup = reinterpret_cast<unsigned int *>( ::calloc( s_nProcessorCount, sizeof(unsigned int)));
+         if ( s_arrProcNode )
+             s_nNodeCount = read_numa_nodes( s_arrProcNode, s_nProcessorCount );
+         if ( s_arrProcCacheGroup )
+             s_nCacheGroupCount = read_cache_groups( s_arrProcCacheGroup, s_nProcessorCount );
     }
 
     void topology::fini()
-    {}
+    {
+        ::free( s_arrProcNode );
+        s_arrProcNode = nullptr;
+        ::free( s_arrProcCacheGroup );
+        s_arrProcCacheGroup = nullptr;
+        s_nNodeCount = 1;
+        s_nCacheGroupCount = 1;
+    }
+
+    bool topology::bind_memory( void * pMemory, size_t nSize, unsigned int nNode )
+    {
+#   ifdef __NR_mbind
+        // Values from linux/mempolicy.h
+        static int const c_MPOL_PREFERRED = 1;
+        static unsigned int const c_MPOL_MF_MOVE = 1 << 1;
+        static unsigned int const c_nBitsPerWord = sizeof(unsigned long) * 8;
+        static unsigned int const c_nMaskSize = 16;   // up to 1024 nodes
+
+        if ( s_nNodeCount < 2 || nNode >= s_nNodeCount || nNode >= c_nMaskSize * c_nBitsPerWord )
+            return false;
+
+        uintptr_t const nPageSize = static_cast<uintptr_t>( ::sysconf( _SC_PAGESIZE ));
+        uintptr_t const nStart = ( reinterpret_cast<uintptr_t>( pMemory ) + nPageSize - 1 ) & ~( nPageSize - 1 );
+        uintptr_t const nEnd = ( reinterpret_cast<uintptr_t>( pMemory ) + nSize ) & ~( nPageSize - 1 );
+        if ( nStart >= nEnd )
+            return false;
+
+        unsigned long nodeMask[c_nMaskSize] = { 0 };
+        nodeMask[ nNode / c_nBitsPerWord ] = 1UL << ( nNode % c_nBitsPerWord );
+
+        return ::syscall( __NR_mbind, nStart, nEnd - nStart, c_MPOL_PREFERRED,
+            nodeMask, static_cast<unsigned long>( c_nMaskSize * c_nBitsPerWord ), c_MPOL_MF_MOVE ) == 0;
+#   else
+        CDS_UNUSED( pMemory );
+        CDS_UNUSED( nSize );
+        CDS_UNUSED( nNode );
+        return false;
+#   endif
+    }
 }}} // namespace cds::OS::Linux
 
 #endif  // #if CDS_OS_TYPE == CDS_OS_LINUX
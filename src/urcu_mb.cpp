@@ -0,0 +1,97 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include <cds/urcu/details/mb.h>
+
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+#include <unistd.h>
+#include <sys/syscall.h>
+
+namespace cds { namespace urcu { namespace details {
+
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_buffered_tag >::s_pRCU = nullptr;
+    template<> CDS_EXPORT_API singleton_vtbl * mb_singleton_instance< membarrier_threaded_tag >::s_pRCU = nullptr;
+
+    bool sys_membarrier::s_bEnabled = false;
+    int  sys_membarrier::s_nCommand = 0;
+
+    namespace {
+        // Commands of membarrier() system call, see linux/membarrier.h
+        // The header may be absent in old kernel headers, so the values are defined here
+        enum {
+            membarrier_cmd_query = 0,
+            membarrier_cmd_shared = 1,
+            membarrier_cmd_private_expedited = 8,
+            membarrier_cmd_register_private_expedited = 16
+        };
+
+        inline int call_membarrier( int cmd )
+        {
+#   ifdef __NR_membarrier
+            return static_cast<int>( syscall( __NR_membarrier, cmd, 0 ));
+#   else
+            CDS_UNUSED( cmd );
+            return -1;
+#   endif
+        }
+    } // namespace
+
+    bool sys_membarrier::init()
+    {
+        if ( s_bEnabled )
+            return true;
+
+        int const nCmdMask = call_membarrier( membarrier_cmd_query );
+        if ( nCmdMask > 0 ) {
+            if ( ( nCmdMask & membarrier_cmd_private_expedited )
+              && ( nCmdMask & membarrier_cmd_register_private_expedited )
+              && call_membarrier( membarrier_cmd_register_private_expedited ) == 0 )
+            {
+                s_nCommand = membarrier_cmd_private_expedited;
+                s_bEnabled = true;
+            }
+            else if ( nCmdMask & membarrier_cmd_shared ) {
+                s_nCommand = membarrier_cmd_shared;
+                s_bEnabled = true;
+            }
+        }
+        return s_bEnabled;
+    }
+
+    void sys_membarrier::barrier()
+    {
+        atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+        if ( s_bEnabled )
+            call_membarrier( s_nCommand );
+    }
+
+}}} // namespace cds::urcu::details
+
+#endif //#ifdef CDS_URCU_MEMBARRIER_ENABLED
@@ -57,11 +57,14 @@
 #include <cds/init.h>
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
+#include <cds/gc/ebr.h>
 #include <cds/urcu/general_instant.h>
 #include <cds/urcu/general_buffered.h>
 #include <cds/urcu/general_threaded.h>
 #include <cds/urcu/signal_buffered.h>
 #include <cds/urcu/signal_threaded.h>
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/urcu/membarrier_threaded.h>
 #include <cds/os/topology.h>
 
 #include "stdio.h"
@@ -411,6 +414,8 @@ int main(int argc, char** argv)
       size_t dhp_liberateThreshold;
       size_t dhp_initialThreadGuardCount;
       size_t dhp_epochCount;
+      size_t dhp_retiredBatchSize;
+      size_t ebr_scanThreshold;
       {
         CppUnitMini::TestCfg& cfg = CppUnitMini::TestCase::m_Cfg.get( "General" );
         nHazardPtrCount = cfg.getULong( "hazard_pointer_count", 0 );
@@ -418,11 +423,14 @@ int main(int argc, char** argv)
         dhp_liberateThreshold = cfg.getSizeT( "dhp_liberate_threshold", 1024 );
         dhp_initialThreadGuardCount = cfg.getSizeT( "dhp_init_guard_count", 8 );
         dhp_epochCount = cfg.getSizeT( "dhp_epoch_count", 16 );
+        dhp_retiredBatchSize = cfg.getSizeT( "dhp_retired_batch_size", 64 );
+        ebr_scanThreshold = cfg.getSizeT( "ebr_scan_threshold", 256 );
       }
 
       // Safe reclamation schemes
       cds::gc::HP hzpGC( nHazardPtrCount );
-      cds::gc::DHP dhpGC( dhp_liberateThreshold, dhp_initialThreadGuardCount, dhp_epochCount );
+      cds::gc::DHP dhpGC( dhp_liberateThreshold, dhp_initialThreadGuardCount, dhp_epochCount, dhp_retiredBatchSize );
+      cds::gc::EBR ebrGC( ebr_scanThreshold );
 
       // RCU varieties
       typedef cds::urcu::gc< cds::urcu::general_instant<> >    rcu_gpi;
@@ -442,6 +450,14 @@ int main(int argc, char** argv)
       rcu_sht   shtRCU( 256, SIGUSR2 );
 #endif
 
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+      typedef cds::urcu::gc< cds::urcu::membarrier_buffered<> >    rcu_mbb;
+      rcu_mbb   mbbRCU;
+
+      typedef cds::urcu::gc< cds::urcu::membarrier_threaded<> >    rcu_mbt;
+      rcu_mbt   mbtRCU;
+#endif
+
       // System topology
       {
           std::cout
@@ -457,6 +473,8 @@ int main(int argc, char** argv)
             hzpGC.setScanType( cds::gc::HP::scan_type::inplace );
         else if ( strHZPScanStrategy == "classic" )
             hzpGC.setScanType( cds::gc::HP::scan_type::classic );
+        else if ( strHZPScanStrategy == "batched" )
+            hzpGC.setScanType( cds::gc::HP::scan_type::batched );
         else {
             std::cout << "Error value of HZP_scan_strategy in General section of test config\n";
         }
@@ -468,6 +486,9 @@ int main(int argc, char** argv)
         case cds::gc::HP::scan_type::classic:
             std::cout << "Use classic scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
+        case cds::gc::HP::scan_type::batched:
+            std::cout << "Use batched scan strategy for Hazard Pointer memory reclamation algorithm\n";
+            break;
         default:
             std::cout << "ERROR: use unknown scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
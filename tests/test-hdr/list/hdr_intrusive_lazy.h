@@ -936,6 +936,15 @@ namespace ordlist {
         void DHP_member_cmpmix();
         void DHP_member_ic();
 
+        void EBR_base_cmp();
+        void EBR_base_less();
+        void EBR_base_cmpmix();
+        void EBR_base_ic();
+        void EBR_member_cmp();
+        void EBR_member_less();
+        void EBR_member_cmpmix();
+        void EBR_member_ic();
+
         void RCU_GPI_base_cmp();
         void RCU_GPI_base_less();
         void RCU_GPI_base_cmpmix();
@@ -981,6 +990,24 @@ namespace ordlist {
         void RCU_SHT_member_cmpmix();
         void RCU_SHT_member_ic();
 
+        void RCU_MBB_base_cmp();
+        void RCU_MBB_base_less();
+        void RCU_MBB_base_cmpmix();
+        void RCU_MBB_base_ic();
+        void RCU_MBB_member_cmp();
+        void RCU_MBB_member_less();
+        void RCU_MBB_member_cmpmix();
+        void RCU_MBB_member_ic();
+
+        void RCU_MBT_base_cmp();
+        void RCU_MBT_base_less();
+        void RCU_MBT_base_cmpmix();
+        void RCU_MBT_base_ic();
+        void RCU_MBT_member_cmp();
+        void RCU_MBT_member_less();
+        void RCU_MBT_member_cmpmix();
+        void RCU_MBT_member_ic();
+
         void nogc_base_cmp();
         void nogc_base_less();
         void nogc_base_cmpmix();
@@ -1021,6 +1048,14 @@ namespace ordlist {
             CPPUNIT_TEST(DHP_member_less)
             CPPUNIT_TEST(DHP_member_cmpmix)
             CPPUNIT_TEST(DHP_member_ic)
+            CPPUNIT_TEST(EBR_base_cmp)
+            CPPUNIT_TEST(EBR_base_less)
+            CPPUNIT_TEST(EBR_base_cmpmix)
+            CPPUNIT_TEST(EBR_base_ic)
+            CPPUNIT_TEST(EBR_member_cmp)
+            CPPUNIT_TEST(EBR_member_less)
+            CPPUNIT_TEST(EBR_member_cmpmix)
+            CPPUNIT_TEST(EBR_member_ic)
 
             CPPUNIT_TEST(RCU_GPI_base_cmp)
             CPPUNIT_TEST(RCU_GPI_base_less)
@@ -1067,6 +1102,24 @@ namespace ordlist {
             CPPUNIT_TEST(RCU_SHT_member_cmpmix)
             CPPUNIT_TEST(RCU_SHT_member_ic)
 
+            CPPUNIT_TEST(RCU_MBB_base_cmp)
+            CPPUNIT_TEST(RCU_MBB_base_less)
+            CPPUNIT_TEST(RCU_MBB_base_cmpmix)
+            CPPUNIT_TEST(RCU_MBB_base_ic)
+            CPPUNIT_TEST(RCU_MBB_member_cmp)
+            CPPUNIT_TEST(RCU_MBB_member_less)
+            CPPUNIT_TEST(RCU_MBB_member_cmpmix)
+            CPPUNIT_TEST(RCU_MBB_member_ic)
+
+            CPPUNIT_TEST(RCU_MBT_base_cmp)
+            CPPUNIT_TEST(RCU_MBT_base_less)
+            CPPUNIT_TEST(RCU_MBT_base_cmpmix)
+            CPPUNIT_TEST(RCU_MBT_base_ic)
+            CPPUNIT_TEST(RCU_MBT_member_cmp)
+            CPPUNIT_TEST(RCU_MBT_member_less)
+            CPPUNIT_TEST(RCU_MBT_member_cmpmix)
+            CPPUNIT_TEST(RCU_MBT_member_ic)
+
             CPPUNIT_TEST(nogc_base_cmp)
             CPPUNIT_TEST(nogc_base_less)
             CPPUNIT_TEST(nogc_base_cmpmix)
@@ -870,6 +870,11 @@ namespace ordlist {
         void DHP_cmpmix();
         void DHP_ic();
 
+        void EBR_cmp();
+        void EBR_less();
+        void EBR_cmpmix();
+        void EBR_ic();
+
         void RCU_GPI_cmp();
         void RCU_GPI_less();
         void RCU_GPI_cmpmix();
@@ -895,6 +900,16 @@ namespace ordlist {
         void RCU_SHT_cmpmix();
         void RCU_SHT_ic();
 
+        void RCU_MBB_cmp();
+        void RCU_MBB_less();
+        void RCU_MBB_cmpmix();
+        void RCU_MBB_ic();
+
+        void RCU_MBT_cmp();
+        void RCU_MBT_less();
+        void RCU_MBT_cmpmix();
+        void RCU_MBT_ic();
+
         void NOGC_cmp();
         void NOGC_less();
         void NOGC_cmpmix();
@@ -916,6 +931,10 @@ namespace ordlist {
             CPPUNIT_TEST(DHP_less)
             CPPUNIT_TEST(DHP_cmpmix)
             CPPUNIT_TEST(DHP_ic)
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
 
             CPPUNIT_TEST(RCU_GPI_cmp)
             CPPUNIT_TEST(RCU_GPI_less)
@@ -942,6 +961,16 @@ namespace ordlist {
             CPPUNIT_TEST(RCU_SHT_cmpmix)
             CPPUNIT_TEST(RCU_SHT_ic)
 
+            CPPUNIT_TEST(RCU_MBB_cmp)
+            CPPUNIT_TEST(RCU_MBB_less)
+            CPPUNIT_TEST(RCU_MBB_cmpmix)
+            CPPUNIT_TEST(RCU_MBB_ic)
+
+            CPPUNIT_TEST(RCU_MBT_cmp)
+            CPPUNIT_TEST(RCU_MBT_less)
+            CPPUNIT_TEST(RCU_MBT_cmpmix)
+            CPPUNIT_TEST(RCU_MBT_ic)
+
             CPPUNIT_TEST(NOGC_cmp)
             CPPUNIT_TEST(NOGC_less)
             CPPUNIT_TEST(NOGC_cmpmix)
@@ -0,0 +1,147 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "list/hdr_lazy.h"
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/container/lazy_list_rcu.h>
+
+namespace ordlist {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    namespace {
+        typedef cds::urcu::gc< cds::urcu::membarrier_buffered<> >    rcu_type;
+
+        struct RCU_MBB_cmp_traits : public cc::lazy_list::traits
+        {
+            typedef LazyListTestHeader::cmp<LazyListTestHeader::item>   compare;
+        };
+    }
+#endif
+    void LazyListTestHeader::RCU_MBB_cmp()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        // traits-based version
+        typedef cc::LazyList< rcu_type, item, RCU_MBB_cmp_traits > list;
+        test_rcu< list >();
+
+        // option-based version
+
+        typedef cc::LazyList< rcu_type, item,
+            cc::lazy_list::make_traits<
+                cc::opt::compare< cmp<item> >
+            >::type
+        > opt_list;
+        test_rcu< opt_list >();
+#endif
+    }
+
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    namespace {
+        struct RCU_MBB_less_traits : public cc::lazy_list::traits
+        {
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>   less;
+        };
+    }
+#endif
+    void LazyListTestHeader::RCU_MBB_less()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        // traits-based version
+        typedef cc::LazyList< rcu_type, item, RCU_MBB_less_traits > list;
+        test_rcu< list >();
+
+        // option-based version
+
+        typedef cc::LazyList< rcu_type, item,
+            cc::lazy_list::make_traits<
+                cc::opt::less< lt<item> >
+            >::type
+        > opt_list;
+        test_rcu< opt_list >();
+#endif
+    }
+
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    namespace {
+        struct RCU_MBB_cmpmix_traits: public cc::lazy_list::traits
+        {
+            typedef LazyListTestHeader::cmp<LazyListTestHeader::item>   compare;
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>  less;
+        };
+    }
+#endif
+    void LazyListTestHeader::RCU_MBB_cmpmix()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        // traits-based version
+        typedef cc::LazyList< rcu_type, item, RCU_MBB_cmpmix_traits > list;
+        test_rcu< list >();
+
+        // option-based version
+
+        typedef cc::LazyList< rcu_type, item,
+            cc::lazy_list::make_traits<
+                cc::opt::compare< cmp<item> >
+                ,cc::opt::less< lt<item> >
+            >::type
+        > opt_list;
+        test_rcu< opt_list >();
+#endif
+    }
+
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    namespace {
+        struct RCU_MBB_ic_traits: public cc::lazy_list::traits
+        {
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>   less;
+            typedef cds::atomicity::item_counter item_counter;
+        };
+    }
+#endif
+    void LazyListTestHeader::RCU_MBB_ic()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        // traits-based version
+        typedef cc::LazyList< rcu_type, item, RCU_MBB_ic_traits > list;
+        test_rcu< list >();
+
+        // option-based version
+
+        typedef cc::LazyList< rcu_type, item,
+            cc::lazy_list::make_traits<
+                cc::opt::less< lt<item> >
+                ,cc::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > opt_list;
+        test_rcu< opt_list >();
+#endif
+    }
+
+}   // namespace ordlist
+
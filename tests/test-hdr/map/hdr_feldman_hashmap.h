@@ -662,6 +662,19 @@ namespace map {
         void dhp_hash128_4_3();
         void dhp_hash128_4_3_stat();
 
+        void ebr_nohash();
+        void ebr_nohash_stat();
+        void ebr_nohash_5_3();
+        void ebr_nohash_5_3_stat();
+        void ebr_stdhash();
+        void ebr_stdhash_stat();
+        void ebr_stdhash_5_3();
+        void ebr_stdhash_5_3_stat();
+        void ebr_hash128();
+        void ebr_hash128_stat();
+        void ebr_hash128_4_3();
+        void ebr_hash128_4_3_stat();
+
         void rcu_gpb_nohash();
         void rcu_gpb_nohash_stat();
         void rcu_gpb_nohash_5_3();
@@ -753,6 +766,18 @@ namespace map {
             CPPUNIT_TEST(dhp_hash128_stat)
             CPPUNIT_TEST(dhp_hash128_4_3)
             CPPUNIT_TEST(dhp_hash128_4_3_stat)
+            CPPUNIT_TEST(ebr_nohash)
+            CPPUNIT_TEST(ebr_nohash_stat)
+            CPPUNIT_TEST(ebr_nohash_5_3)
+            CPPUNIT_TEST(ebr_nohash_5_3_stat)
+            CPPUNIT_TEST(ebr_stdhash)
+            CPPUNIT_TEST(ebr_stdhash_stat)
+            CPPUNIT_TEST(ebr_stdhash_5_3)
+            CPPUNIT_TEST(ebr_stdhash_5_3_stat)
+            CPPUNIT_TEST(ebr_hash128)
+            CPPUNIT_TEST(ebr_hash128_stat)
+            CPPUNIT_TEST(ebr_hash128_4_3)
+            CPPUNIT_TEST(ebr_hash128_4_3_stat)
 
             CPPUNIT_TEST(rcu_gpb_nohash)
             CPPUNIT_TEST(rcu_gpb_nohash_stat)
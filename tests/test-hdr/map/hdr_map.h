@@ -290,6 +290,105 @@ namespace map {
             test_iter<Map>();
         }
 
+        template <class Map>
+        void test_expandable()
+        {
+            Map m( 4, 2 );
+            size_t const nInitBucketCount = m.bucket_count();
+
+            static int const nLimit = 1000;
+            int arr[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arr[i] = i;
+            shuffle( arr, arr + nLimit );
+
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( m.insert( arr[i], arr[i] ));
+            CPPUNIT_CHECK( check_size( m, nLimit ));
+            CPPUNIT_CHECK( m.bucket_count() > nInitBucketCount );
+            CPPUNIT_CHECK( m.statistics().m_nResizeStart.get() > 0 );
+
+            for ( int i = 0; i < nLimit; ++i ) {
+                CPPUNIT_CHECK( m.contains( i ));
+                CPPUNIT_CHECK( m.find( i, []( pair_type& item ) { CPPUNIT_ASSERT_CURRENT( item.first == item.second.m_val ); } ));
+            }
+            CPPUNIT_CHECK( m.statistics().m_nResizeStart.get() == m.statistics().m_nResizeComplete.get() );
+
+            // All buckets are migrated, the iterator visits each item
+            int nCount = 0;
+            for ( typename Map::iterator it = m.begin(); it != m.end(); ++it )
+                ++nCount;
+            CPPUNIT_CHECK( nCount == nLimit );
+
+            // Right after growth some buckets are not migrated yet, the iterator must visit their items too
+            {
+                Map m2( 16, 1 );
+                for ( int i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( m2.insert( arr[i], arr[i] ));
+                CPPUNIT_CHECK( m2.statistics().m_nResizeStart.get() > 0 );
+
+                int nIterCount = 0;
+                for ( typename Map::iterator it = m2.begin(); it != m2.end(); ++it )
+                    ++nIterCount;
+                CPPUNIT_CHECK_EX( nIterCount == nLimit, "iterated " << nIterCount << " of " << nLimit );
+                CPPUNIT_CHECK( check_size( m2, nLimit ));
+            }
+
+            for ( int i = 0; i < nLimit; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( m.contains( i ) == ( i % 2 != 0 ));
+            CPPUNIT_CHECK( check_size( m, nLimit / 2 ));
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+            CPPUNIT_CHECK( check_size( m, 0 ));
+        }
+
+        template <class Map>
+        void test_batch()
+        {
+            Map m( 100, 4 );
+
+            static int const nLimit = 1000;
+            int arrKeys[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys[i] = i;
+            shuffle( arrKeys, arrKeys + nLimit );
+            bool arrResult[nLimit * 2];
+
+            CPPUNIT_CHECK( m.insert_batch( arrKeys, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            // the first half of the keys is already in the map
+            CPPUNIT_CHECK( m.insert_batch( arrKeys, nLimit, arrResult ) == nLimit - nLimit / 2 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i >= nLimit / 2 ));
+            CPPUNIT_CHECK( check_size( m, nLimit ));
+
+            int arrFind[nLimit * 2];
+            for ( int i = 0; i < nLimit * 2; ++i )
+                arrFind[i] = i;
+            CPPUNIT_CHECK( m.find_batch( arrFind, nLimit * 2, arrResult ) == nLimit );
+            for ( int i = 0; i < nLimit * 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i < nLimit ));
+            CPPUNIT_CHECK( m.find_batch( arrFind + nLimit / 2, nLimit ) == nLimit / 2 );
+
+            int arrErase[nLimit / 2];
+            for ( int i = 0; i < nLimit / 2; ++i )
+                arrErase[i] = i * 2;
+            CPPUNIT_CHECK( m.erase_batch( arrErase, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_CHECK( m.erase_batch( arrErase, nLimit / 2 ) == 0 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( m.contains( i ) == ( i % 2 != 0 ));
+            CPPUNIT_CHECK( check_size( m, nLimit / 2 ));
+
+            m.clear();
+            CPPUNIT_CHECK( m.empty() );
+        }
+
         template <class Map>
         void test_rcu()
         {
@@ -983,6 +1082,10 @@ namespace map {
         void Michael_DHP_less();
         void Michael_DHP_cmpmix();
 
+        void Michael_EBR_cmp();
+        void Michael_EBR_less();
+        void Michael_EBR_cmpmix();
+
         void Michael_RCU_GPI_cmp();
         void Michael_RCU_GPI_less();
         void Michael_RCU_GPI_cmpmix();
@@ -1015,6 +1118,10 @@ namespace map {
         void Lazy_DHP_less();
         void Lazy_DHP_cmpmix();
 
+        void Lazy_EBR_cmp();
+        void Lazy_EBR_less();
+        void Lazy_EBR_cmpmix();
+
         void Lazy_RCU_GPI_cmp();
         void Lazy_RCU_GPI_less();
         void Lazy_RCU_GPI_cmpmix();
@@ -1050,6 +1157,11 @@ namespace map {
         void Split_DHP_cmpmix();
         void Split_DHP_cmpmix_stat();
 
+        void Split_EBR_cmp();
+        void Split_EBR_less();
+        void Split_EBR_cmpmix();
+        void Split_EBR_cmpmix_stat();
+
         void Split_RCU_GPI_cmp();
         void Split_RCU_GPI_less();
         void Split_RCU_GPI_cmpmix();
@@ -1090,6 +1202,11 @@ namespace map {
         void Split_Lazy_DHP_cmpmix();
         void Split_Lazy_DHP_cmpmix_stat();
 
+        void Split_Lazy_EBR_cmp();
+        void Split_Lazy_EBR_less();
+        void Split_Lazy_EBR_cmpmix();
+        void Split_Lazy_EBR_cmpmix_stat();
+
         void Split_Lazy_RCU_GPI_cmp();
         void Split_Lazy_RCU_GPI_less();
         void Split_Lazy_RCU_GPI_cmpmix();
@@ -1128,6 +1245,9 @@ namespace map {
             CPPUNIT_TEST(Michael_DHP_cmp)
             CPPUNIT_TEST(Michael_DHP_less)
             CPPUNIT_TEST(Michael_DHP_cmpmix)
+            CPPUNIT_TEST(Michael_EBR_cmp)
+            CPPUNIT_TEST(Michael_EBR_less)
+            CPPUNIT_TEST(Michael_EBR_cmpmix)
 
             CPPUNIT_TEST(Michael_RCU_GPI_cmp)
             CPPUNIT_TEST(Michael_RCU_GPI_less)
@@ -1160,6 +1280,9 @@ namespace map {
             CPPUNIT_TEST(Lazy_DHP_cmp)
             CPPUNIT_TEST(Lazy_DHP_less)
             CPPUNIT_TEST(Lazy_DHP_cmpmix)
+            CPPUNIT_TEST(Lazy_EBR_cmp)
+            CPPUNIT_TEST(Lazy_EBR_less)
+            CPPUNIT_TEST(Lazy_EBR_cmpmix)
 
             CPPUNIT_TEST(Lazy_RCU_GPI_cmp)
             CPPUNIT_TEST(Lazy_RCU_GPI_less)
@@ -1195,6 +1318,10 @@ namespace map {
             CPPUNIT_TEST(Split_DHP_less)
             CPPUNIT_TEST(Split_DHP_cmpmix)
             CPPUNIT_TEST( Split_DHP_cmpmix_stat )
+            CPPUNIT_TEST(Split_EBR_cmp)
+            CPPUNIT_TEST(Split_EBR_less)
+            CPPUNIT_TEST(Split_EBR_cmpmix)
+            CPPUNIT_TEST( Split_EBR_cmpmix_stat )
 
             CPPUNIT_TEST(Split_RCU_GPI_cmp)
             CPPUNIT_TEST(Split_RCU_GPI_less)
@@ -1235,6 +1362,10 @@ namespace map {
             CPPUNIT_TEST(Split_Lazy_DHP_less)
             CPPUNIT_TEST(Split_Lazy_DHP_cmpmix)
             CPPUNIT_TEST( Split_Lazy_DHP_cmpmix_stat )
+            CPPUNIT_TEST(Split_Lazy_EBR_cmp)
+            CPPUNIT_TEST(Split_Lazy_EBR_less)
+            CPPUNIT_TEST(Split_Lazy_EBR_cmpmix)
+            CPPUNIT_TEST( Split_Lazy_EBR_cmpmix_stat )
 
             CPPUNIT_TEST(Split_Lazy_RCU_GPI_cmp)
             CPPUNIT_TEST(Split_Lazy_RCU_GPI_less)
@@ -73,6 +73,19 @@ namespace map {
             >::type
         > opt_map;
         test_int< opt_map >();
+
+        // expandable bucket table
+        typedef cc::MichaelHashMap< cds::gc::HP, list,
+            cc::michael_map::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::michael_map::dynamic_bucket_table< true >
+                ,cc::opt::stat< cc::michael_map::stat<> >
+            >::type
+        > dyn_map;
+        test_int< dyn_map >();
+        test_expandable< dyn_map >();
+        test_batch< map >();
+        test_batch< dyn_map >();
     }
 
     void HashMapHdrTest::Michael_HP_less()
@@ -460,6 +460,31 @@ namespace map {
         void SkipList_DHP_michaelalloc_cmp_stat();
         void SkipList_DHP_michaelalloc_cmpless_stat();
 
+        void SkipList_EBR_less();
+        void SkipList_EBR_cmp();
+        void SkipList_EBR_cmpless();
+        void SkipList_EBR_less_stat();
+        void SkipList_EBR_cmp_stat();
+        void SkipList_EBR_cmpless_stat();
+        void SkipList_EBR_xorshift_less();
+        void SkipList_EBR_xorshift_cmp();
+        void SkipList_EBR_xorshift_cmpless();
+        void SkipList_EBR_xorshift_less_stat();
+        void SkipList_EBR_xorshift_cmp_stat();
+        void SkipList_EBR_xorshift_cmpless_stat();
+        void SkipList_EBR_turbopas_less();
+        void SkipList_EBR_turbopas_cmp();
+        void SkipList_EBR_turbopas_cmpless();
+        void SkipList_EBR_turbopas_less_stat();
+        void SkipList_EBR_turbopas_cmp_stat();
+        void SkipList_EBR_turbopas_cmpless_stat();
+        void SkipList_EBR_michaelalloc_less();
+        void SkipList_EBR_michaelalloc_cmp();
+        void SkipList_EBR_michaelalloc_cmpless();
+        void SkipList_EBR_michaelalloc_less_stat();
+        void SkipList_EBR_michaelalloc_cmp_stat();
+        void SkipList_EBR_michaelalloc_cmpless_stat();
+
         void SkipList_NOGC_less();
         void SkipList_NOGC_cmp();
         void SkipList_NOGC_cmpless();
@@ -535,6 +560,30 @@ namespace map {
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_less)
+            CPPUNIT_TEST(SkipList_EBR_cmp)
+            CPPUNIT_TEST(SkipList_EBR_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_less)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmp)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_less)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmp)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_less)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmp)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmpless_stat)
 
             CPPUNIT_TEST(SkipList_NOGC_less)
             CPPUNIT_TEST(SkipList_NOGC_cmp)
@@ -411,6 +411,56 @@ namespace map {
         void SkipList_RCU_SHT_michaelalloc_cmp_stat();
         void SkipList_RCU_SHT_michaelalloc_cmpless_stat();
 
+        void SkipList_RCU_MBB_less();
+        void SkipList_RCU_MBB_cmp();
+        void SkipList_RCU_MBB_cmpless();
+        void SkipList_RCU_MBB_less_stat();
+        void SkipList_RCU_MBB_cmp_stat();
+        void SkipList_RCU_MBB_cmpless_stat();
+        void SkipList_RCU_MBB_xorshift_less();
+        void SkipList_RCU_MBB_xorshift_cmp();
+        void SkipList_RCU_MBB_xorshift_cmpless();
+        void SkipList_RCU_MBB_xorshift_less_stat();
+        void SkipList_RCU_MBB_xorshift_cmp_stat();
+        void SkipList_RCU_MBB_xorshift_cmpless_stat();
+        void SkipList_RCU_MBB_turbopas_less();
+        void SkipList_RCU_MBB_turbopas_cmp();
+        void SkipList_RCU_MBB_turbopas_cmpless();
+        void SkipList_RCU_MBB_turbopas_less_stat();
+        void SkipList_RCU_MBB_turbopas_cmp_stat();
+        void SkipList_RCU_MBB_turbopas_cmpless_stat();
+        void SkipList_RCU_MBB_michaelalloc_less();
+        void SkipList_RCU_MBB_michaelalloc_cmp();
+        void SkipList_RCU_MBB_michaelalloc_cmpless();
+        void SkipList_RCU_MBB_michaelalloc_less_stat();
+        void SkipList_RCU_MBB_michaelalloc_cmp_stat();
+        void SkipList_RCU_MBB_michaelalloc_cmpless_stat();
+
+        void SkipList_RCU_MBT_less();
+        void SkipList_RCU_MBT_cmp();
+        void SkipList_RCU_MBT_cmpless();
+        void SkipList_RCU_MBT_less_stat();
+        void SkipList_RCU_MBT_cmp_stat();
+        void SkipList_RCU_MBT_cmpless_stat();
+        void SkipList_RCU_MBT_xorshift_less();
+        void SkipList_RCU_MBT_xorshift_cmp();
+        void SkipList_RCU_MBT_xorshift_cmpless();
+        void SkipList_RCU_MBT_xorshift_less_stat();
+        void SkipList_RCU_MBT_xorshift_cmp_stat();
+        void SkipList_RCU_MBT_xorshift_cmpless_stat();
+        void SkipList_RCU_MBT_turbopas_less();
+        void SkipList_RCU_MBT_turbopas_cmp();
+        void SkipList_RCU_MBT_turbopas_cmpless();
+        void SkipList_RCU_MBT_turbopas_less_stat();
+        void SkipList_RCU_MBT_turbopas_cmp_stat();
+        void SkipList_RCU_MBT_turbopas_cmpless_stat();
+        void SkipList_RCU_MBT_michaelalloc_less();
+        void SkipList_RCU_MBT_michaelalloc_cmp();
+        void SkipList_RCU_MBT_michaelalloc_cmpless();
+        void SkipList_RCU_MBT_michaelalloc_less_stat();
+        void SkipList_RCU_MBT_michaelalloc_cmp_stat();
+        void SkipList_RCU_MBT_michaelalloc_cmpless_stat();
+
         CPPUNIT_TEST_SUITE(SkipListMapRCUHdrTest)
             CPPUNIT_TEST(SkipList_RCU_GPI_less)
             CPPUNIT_TEST(SkipList_RCU_GPI_cmp)
@@ -537,6 +587,56 @@ namespace map {
             CPPUNIT_TEST(SkipList_RCU_SHT_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_RCU_SHT_michaelalloc_cmpless_stat)
 
+            CPPUNIT_TEST(SkipList_RCU_MBB_less)
+            CPPUNIT_TEST(SkipList_RCU_MBB_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBB_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBB_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_less)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_xorshift_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_less)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_turbopas_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_less)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBB_michaelalloc_cmpless_stat)
+
+            CPPUNIT_TEST(SkipList_RCU_MBT_less)
+            CPPUNIT_TEST(SkipList_RCU_MBT_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBT_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBT_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_less)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_xorshift_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_less)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_turbopas_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_less)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_cmp)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_cmpless)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_less_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_cmp_stat)
+            CPPUNIT_TEST(SkipList_RCU_MBT_michaelalloc_cmpless_stat)
+
         CPPUNIT_TEST_SUITE_END()
 
     };
@@ -107,6 +107,8 @@ namespace map {
             >::type
         > opt_map;
         test_int< opt_map >();
+        test_batch< map_type >();
+        test_batch< opt_map >();
     }
 
     void HashMapHdrTest::Split_HP_less()
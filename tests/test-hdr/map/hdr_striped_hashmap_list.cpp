@@ -122,6 +122,16 @@ namespace map {
         >   map_less_resizing_sbt16;
         test_striped2< map_less_resizing_sbt16 >();
 
+        // Incremental resizing
+        CPPUNIT_MESSAGE( "incremental_resize, load_factor_resizing<2>");
+        typedef cc::StripedMap< sequence_t
+            , co::hash< hash_int >
+            , co::less< less >
+            , co::resizing_policy< cc::striped_set::load_factor_resizing<2> >
+            , cc::striped_set::incremental_resize< true >
+        >   map_less_incremental_lf;
+        test_striped2< map_less_incremental_lf >();
+
         // Copy policy
         CPPUNIT_MESSAGE( "copy_item");
         typedef cc::StripedMap< sequence_t
@@ -169,6 +169,50 @@ namespace misc {
             CPPUNIT_ASSERT( s_nConstructCount == s_nDestructCount );
         }
 
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+        void test_mmap_page_release()
+        {
+            // The page size of Michael's heap is not a multiple of system page size
+            size_t const nPageSize = 64 * 1024 - 32;
+            size_t const nPageCount = 256;
+            typedef cds::memory::michael::mmap_page_allocator< 4 * 1024 * 1024, 2 > page_heap;
+
+            page_heap heap( nPageSize );
+            char * arrPages[nPageCount];
+            for ( size_t i = 0; i < nPageCount; ++i ) {
+                arrPages[i] = reinterpret_cast<char *>( heap.alloc() );
+                CPPUNIT_ASSERT( arrPages[i] != nullptr );
+                memset( arrPages[i], 0xAB, nPageSize );
+            }
+
+            // Free even pages: the free-list is small, so most of them are released by madvise()
+            for ( size_t i = 0; i < nPageCount; i += 2 )
+                heap.free( arrPages[i] );
+
+            // The neighbours must not be changed
+            for ( size_t i = 1; i < nPageCount; i += 2 ) {
+                for ( size_t k = 0; k < nPageSize; ++k ) {
+                    if ( static_cast<unsigned char>( arrPages[i][k] ) != 0xAB ) {
+                        CPPUNIT_MSG( "Page " << i << " is corrupted at offset " << k );
+                        CPPUNIT_ASSERT( false );
+                        break;
+                    }
+                }
+            }
+
+            // The pages that do not fit into the free-list are returned to the system
+            size_t const nSysPageSize = static_cast<size_t>( sysconf( _SC_PAGESIZE ));
+            size_t nReleased = 0;
+            for ( size_t i = 0; i < nPageCount; i += 2 ) {
+                if ( arrPages[i][nSysPageSize] == 0 )
+                    ++nReleased;
+            }
+            CPPUNIT_CHECK_EX( nReleased >= nPageCount / 2 - 2, "released=" << nReleased );
+
+            for ( size_t i = 1; i < nPageCount; i += 2 )
+                heap.free( arrPages[i] );
+        }
+#endif
 
         void setUpParams( const CppUnitMini::TestCfg& cfg )
         {
@@ -186,6 +230,9 @@ namespace misc {
 
         CPPUNIT_TEST_SUITE(Allocator_test);
             CPPUNIT_TEST(test_array)
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+            CPPUNIT_TEST(test_mmap_page_release)
+#endif
             CPPUNIT_TEST(alloc_free_michael)
             CPPUNIT_TEST(alloc_free_std)
             CPPUNIT_TEST(alloc_all_free_all_michael)
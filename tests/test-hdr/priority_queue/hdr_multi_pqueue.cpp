@@ -0,0 +1,72 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "priority_queue/hdr_pqueue.h"
+#include <cds/container/multi_priority_queue.h>
+#include <mutex>
+
+namespace priority_queue {
+
+    void PQueueHdrTest::MultiPQueue()
+    {
+        typedef cds::container::MultiPriorityQueue< PQueueHdrTest::value_type,
+            cds::container::multi_priority_queue::make_traits<
+                cds::opt::less< PQueueHdrTest::less >
+            >::type
+        > pqueue;
+
+        test_multi_pqueue<pqueue>();
+    }
+
+    void PQueueHdrTest::MultiPQueue_cmp_stat()
+    {
+        typedef cds::container::MultiPriorityQueue< PQueueHdrTest::value_type,
+            cds::container::multi_priority_queue::make_traits<
+                cds::opt::compare< PQueueHdrTest::compare >
+                ,cds::opt::stat< cds::container::multi_priority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        test_multi_pqueue<pqueue>();
+    }
+
+    void PQueueHdrTest::MultiPQueue_mutex()
+    {
+        typedef cds::container::MultiPriorityQueue< PQueueHdrTest::value_type,
+            cds::container::multi_priority_queue::make_traits<
+                cds::opt::less< PQueueHdrTest::less >
+                ,cds::opt::lock_type< std::mutex >
+            >::type
+        > pqueue;
+
+        test_multi_pqueue<pqueue>();
+    }
+
+} // namespace priority_queue
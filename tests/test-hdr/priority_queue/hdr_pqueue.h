@@ -35,6 +35,7 @@
 #include "size_check.h"
 #include <algorithm>
 #include <functional>   // ref
+#include <vector>
 
 namespace priority_queue {
 
@@ -332,6 +333,174 @@ namespace priority_queue {
             CPPUNIT_ASSERT( pq.size() == 0 );
         }
 
+        template <class PQueue>
+        void test_skiplist_pqueue()
+        {
+            PQueue pq;
+            test_unbounded_with( pq );
+        }
+
+        template <class PQueue>
+        void test_multi_pqueue()
+        {
+            // The queue with one shard is an exact priority queue
+            {
+                PQueue pq( 1 );
+                CPPUNIT_ASSERT( pq.shard_count() == 1 );
+                test_unbounded_with( pq );
+            }
+
+            // Relaxed queue: the pop order is unspecified but each item must be popped exactly once
+            {
+                PQueue pq( 16 );
+                CPPUNIT_ASSERT( pq.shard_count() == 16 );
+
+                data_array<value_type> arr( c_nCapacity );
+                for ( value_type * p = arr.begin(); p != arr.end(); ++p ) {
+                    CPPUNIT_ASSERT( pq.push( *p ));
+                }
+                CPPUNIT_ASSERT( !pq.empty() );
+                CPPUNIT_ASSERT( pq.size() == c_nCapacity );
+
+                std::vector<key_type> popped;
+                popped.reserve( c_nCapacity );
+                value_type kv(0);
+                while ( pq.pop( kv ))
+                    popped.push_back( kv.k );
+                CPPUNIT_ASSERT( pq.empty() );
+                CPPUNIT_ASSERT( pq.size() == 0 );
+                CPPUNIT_ASSERT( popped.size() == c_nCapacity );
+
+                std::sort( popped.begin(), popped.end() );
+                for ( size_t i = 0; i < popped.size(); ++i ) {
+                    CPPUNIT_CHECK_EX( popped[i] == c_nMinValue + key_type(i), "Expected=" << c_nMinValue + key_type(i) << ", current=" << popped[i] );
+                }
+
+                // clear_with test
+                for ( value_type * p = arr.begin(); p != arr.end(); ++p ) {
+                    CPPUNIT_ASSERT( pq.emplace( p->k, p->v ));
+                }
+                CPPUNIT_ASSERT( pq.size() == c_nCapacity );
+
+                pqueue::disposer disp;
+                pq.clear_with( std::ref(disp) );
+                CPPUNIT_ASSERT( pq.empty() );
+                CPPUNIT_ASSERT( pq.size() == 0 );
+                CPPUNIT_ASSERT( disp.m_nCallCount == c_nCapacity );
+                CPPUNIT_ASSERT( !pq.pop( kv ));
+            }
+        }
+
+        template <class PQueue>
+        void test_unbounded_with( PQueue& pq )
+        {
+            data_array<value_type> arr( c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast  = pFirst + c_nCapacity;
+
+            CPPUNIT_ASSERT( pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == 0 );
+
+            size_t nSize = 0;
+
+            // Push test
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                switch ( pq.size() & 3 ) {
+                    case 0:
+                        CPPUNIT_ASSERT( pq.push_with( [p]( value_type& dest ) { dest = *p; } ));
+                        break;
+                    case 1:
+                        CPPUNIT_ASSERT( pq.emplace( p->k, p->v ));
+                        break;
+                    case 2:
+                        CPPUNIT_ASSERT( pq.emplace( std::make_pair( p->k, p->v ) ));
+                        break;
+                    default:
+                        CPPUNIT_ASSERT( pq.push( *p ));
+                }
+                CPPUNIT_ASSERT( !pq.empty() );
+                CPPUNIT_ASSERT( pq.size() == ++nSize );
+            }
+
+            // The queue is unbounded
+            CPPUNIT_ASSERT( pq.size() == c_nCapacity );
+
+            // Pop test
+            key_type nPrev = c_nMinValue + key_type(c_nCapacity) - 1;
+            value_type kv(0);
+            key_type   key;
+            CPPUNIT_ASSERT( pq.pop(kv) );
+            CPPUNIT_CHECK_EX( kv.k == nPrev, "Expected=" << nPrev << ", current=" << kv.k );
+
+            CPPUNIT_ASSERT( pq.size() == c_nCapacity - 1 );
+            CPPUNIT_ASSERT( !pq.empty() );
+
+            nSize = pq.size();
+            while ( pq.size() > 1 ) {
+                if ( pq.size() & 1 ) {
+                    CPPUNIT_ASSERT( pq.pop(kv) );
+                    CPPUNIT_CHECK_EX( kv.k == nPrev - 1, "Expected=" << nPrev - 1 << ", current=" << kv.k );
+                    nPrev = kv.k;
+                }
+                else {
+                    CPPUNIT_ASSERT( pq.pop_with( [&key]( value_type& src ) { key = src.k;  } ) );
+                    CPPUNIT_CHECK_EX( key == nPrev - 1, "Expected=" << nPrev - 1 << ", current=" << key );
+                    nPrev = key;
+                }
+
+                --nSize;
+                CPPUNIT_ASSERT( pq.size() == nSize );
+            }
+
+            CPPUNIT_ASSERT( !pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == 1 );
+
+            CPPUNIT_ASSERT( pq.pop(kv) );
+            CPPUNIT_CHECK_EX( kv.k == c_nMinValue, "Expected=" << c_nMinValue << ", current=" << kv.k );
+
+            CPPUNIT_ASSERT( pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == 0 );
+            CPPUNIT_ASSERT( !pq.pop(kv) );
+
+            // Items with equal priority
+            for ( int i = 0; i < 10; ++i ) {
+                CPPUNIT_ASSERT( pq.push( value_type( 1, i )));
+                CPPUNIT_ASSERT( pq.push( value_type( 2, i )));
+            }
+            CPPUNIT_ASSERT( pq.size() == 20 );
+            for ( int i = 0; i < 20; ++i ) {
+                CPPUNIT_ASSERT( pq.pop(kv) );
+                CPPUNIT_CHECK_EX( kv.k == (i < 10 ? 2 : 1), "i=" << i << ", current=" << kv.k );
+            }
+            CPPUNIT_ASSERT( pq.empty() );
+
+            // Clear test
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                CPPUNIT_ASSERT( pq.push( *p ));
+            }
+            CPPUNIT_ASSERT( !pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == c_nCapacity );
+
+            pq.clear();
+            CPPUNIT_ASSERT( pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == 0 );
+
+            // clear_with test
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                CPPUNIT_ASSERT( pq.push( *p ));
+            }
+            CPPUNIT_ASSERT( !pq.empty() );
+            CPPUNIT_ASSERT( pq.size() == c_nCapacity );
+
+            {
+                pqueue::disposer disp;
+                pq.clear_with( std::ref(disp) );
+                CPPUNIT_ASSERT( pq.empty() );
+                CPPUNIT_ASSERT( pq.size() == 0 );
+                CPPUNIT_ASSERT( disp.m_nCallCount == c_nCapacity );
+            }
+        }
+
     public:
         void MSPQueue_st();
         void MSPQueue_st_cmp();
@@ -355,6 +524,17 @@ namespace priority_queue {
         void FCPQueue_stablevector();
         void FCPQueue_stablevector_stat();
 
+        void SkipListPQueue_HP();
+        void SkipListPQueue_HP_cmp_stat();
+        void SkipListPQueue_DHP();
+        void SkipListPQueue_DHP_xorshift();
+        void SkipListPQueue_RCU_GPB();
+        void SkipListPQueue_RCU_GPI_stat();
+
+        void MultiPQueue();
+        void MultiPQueue_cmp_stat();
+        void MultiPQueue_mutex();
+
         CPPUNIT_TEST_SUITE(PQueueHdrTest)
             CPPUNIT_TEST(MSPQueue_st)
             CPPUNIT_TEST(MSPQueue_st_cmp)
@@ -377,6 +557,17 @@ namespace priority_queue {
             CPPUNIT_TEST(FCPQueue_boost_deque_stat)
             CPPUNIT_TEST(FCPQueue_stablevector)
             CPPUNIT_TEST(FCPQueue_stablevector_stat)
+
+            CPPUNIT_TEST(SkipListPQueue_HP)
+            CPPUNIT_TEST(SkipListPQueue_HP_cmp_stat)
+            CPPUNIT_TEST(SkipListPQueue_DHP)
+            CPPUNIT_TEST(SkipListPQueue_DHP_xorshift)
+            CPPUNIT_TEST(SkipListPQueue_RCU_GPB)
+            CPPUNIT_TEST(SkipListPQueue_RCU_GPI_stat)
+
+            CPPUNIT_TEST(MultiPQueue)
+            CPPUNIT_TEST(MultiPQueue_cmp_stat)
+            CPPUNIT_TEST(MultiPQueue_mutex)
         CPPUNIT_TEST_SUITE_END()
     };
 
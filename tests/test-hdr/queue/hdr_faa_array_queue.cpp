@@ -0,0 +1,145 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/faa_array_queue.h>
+
+#include "queue/hdr_queue.h"
+
+namespace queue {
+
+    void HdrTestQueue::FAAArrayQueue_HP()
+    {
+        typedef cds::container::FAAArrayQueue< cds::gc::HP, int > test_queue;
+        test_faa_array_queue< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_HP_Counted()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::HP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::opt::item_counter < cds::atomicity::item_counter >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue_ic< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_HP_seqcst()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::HP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::opt::memory_model < cds::opt::v::sequential_consistent >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_HP_small_stat()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::HP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::container::faa_array_queue::segment_size< 4 >
+                , cds::opt::item_counter < cds::atomicity::item_counter >
+                , cds::opt::stat< cds::container::faa_array_queue::stat<> >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue_ic< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_HP_nopad()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::HP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::container::faa_array_queue::segment_size< 16 >
+                , cds::opt::padding < cds::opt::no_special_padding >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_DHP()
+    {
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, int > test_queue;
+        test_faa_array_queue< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_DHP_Counted()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::DHP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::opt::item_counter < cds::atomicity::item_counter >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue_ic< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_DHP_seqcst()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::DHP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::opt::memory_model < cds::opt::v::sequential_consistent >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_DHP_small_stat()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::DHP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::container::faa_array_queue::segment_size< 4 >
+                , cds::opt::item_counter < cds::atomicity::item_counter >
+                , cds::opt::stat< cds::container::faa_array_queue::stat<> >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue_ic< test_queue >();
+    }
+
+    void HdrTestQueue::FAAArrayQueue_DHP_nopad()
+    {
+        typedef cds::container::FAAArrayQueue < cds::gc::DHP, int,
+            typename cds::container::faa_array_queue::make_traits <
+                cds::container::faa_array_queue::segment_size< 16 >
+                , cds::opt::padding < cds::opt::no_special_padding >
+            > ::type
+        > test_queue;
+
+        test_faa_array_queue< test_queue >();
+    }
+
+} // namespace queue
@@ -0,0 +1,123 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "hdr_intrusive_msqueue.h"
+#include <cds/intrusive/mpsc_queue.h>
+
+namespace queue {
+
+#define TEST(X)     void IntrusiveQueueHeaderTest::test_##X() { test2<X>(); }
+
+    namespace {
+        typedef IntrusiveQueueHeaderTest::base_hook_item< ci::mpsc_queue::node<> > base_item_type;
+        typedef IntrusiveQueueHeaderTest::member_hook_item< ci::mpsc_queue::node<> > member_item_type;
+
+        typedef ci::MPSCQueue< base_item_type,
+            typename ci::mpsc_queue::make_traits<
+                ci::opt::disposer< IntrusiveQueueHeaderTest::faked_disposer >
+            >::type
+        > MPSCQueue_default;
+
+        // item counter
+        typedef ci::MPSCQueue< base_item_type,
+            typename ci::mpsc_queue::make_traits<
+                ci::opt::hook< ci::mpsc_queue::base_hook<> >
+                ,ci::opt::disposer< IntrusiveQueueHeaderTest::faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > MPSCQueue_base_ic;
+
+        // member hook
+        typedef ci::MPSCQueue< member_item_type,
+            typename ci::mpsc_queue::make_traits<
+                ci::opt::hook<
+                    ci::mpsc_queue::member_hook< offsetof( member_item_type, hMember ) >
+                >
+                ,ci::opt::disposer< IntrusiveQueueHeaderTest::faked_disposer >
+            >::type
+        > MPSCQueue_member;
+
+        // member hook + stat + seq_cst
+        typedef ci::MPSCQueue< member_item_type,
+            typename ci::mpsc_queue::make_traits<
+                ci::opt::hook<
+                    ci::mpsc_queue::member_hook< offsetof( member_item_type, hMember ) >
+                >
+                ,ci::opt::disposer< IntrusiveQueueHeaderTest::faked_disposer >
+                ,co::stat< ci::mpsc_queue::stat<> >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        > MPSCQueue_member_stat;
+
+        // no padding
+        typedef ci::MPSCQueue< base_item_type,
+            typename ci::mpsc_queue::make_traits<
+                ci::opt::disposer< IntrusiveQueueHeaderTest::faked_disposer >
+                ,co::padding< co::no_special_padding >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > MPSCQueue_base_noalign;
+    }
+
+    TEST(MPSCQueue_default)
+    TEST(MPSCQueue_base_ic)
+    TEST(MPSCQueue_member)
+    TEST(MPSCQueue_base_noalign)
+
+    void IntrusiveQueueHeaderTest::test_MPSCQueue_member_stat()
+    {
+        typedef MPSCQueue_member_stat queue_type;
+        test2<queue_type>();
+
+        // The stub node is enqueued each time the last item is dequeued
+        queue_type q;
+        member_item_type arr[10];
+        for ( int nPass = 0; nPass < 3; ++nPass ) {
+            for ( int i = 0; i < 10; ++i ) {
+                arr[i].nVal = i;
+                CPPUNIT_ASSERT( q.push( arr[i] ));
+            }
+            for ( int i = 0; i < 10; ++i ) {
+                member_item_type * p = q.pop();
+                CPPUNIT_ASSERT( p == arr + i );
+            }
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.pop() == nullptr );
+        }
+
+        queue_type::stat const& s = q.statistics();
+        CPPUNIT_CHECK( s.m_EnqueueCount.get() == 30 );
+        CPPUNIT_CHECK( s.m_DequeueCount.get() == 30 );
+        CPPUNIT_CHECK( s.m_EmptyDequeue.get() == 3 );
+        CPPUNIT_CHECK( s.m_StubEnqueue.get() == 3 );
+        CPPUNIT_CHECK( s.m_DequeueRace.get() == 0 );
+    }
+
+} // namespace queue
@@ -141,6 +141,44 @@ namespace queue {
             CPPUNIT_CHECK( v3.nDisposeCount == 1 );
         }
 
+        // Test for enqueue_bulk/dequeue_bulk of MSQueue and derivatives
+        template <class Queue>
+        void test_bulk()
+        {
+            typedef typename Queue::value_type value_type;
+            value_type arr[10];
+            for ( int i = 0; i < 10; ++i )
+                arr[i].nVal = i;
+
+            {
+                Queue q;
+                value_type * out[10];
+
+                CPPUNIT_ASSERT( q.enqueue_bulk( arr, arr ) == 0 );
+                CPPUNIT_ASSERT( q.empty() );
+                CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 0 );
+
+                CPPUNIT_ASSERT( q.enqueue_bulk( arr, arr + 10 ) == 10 );
+                CPPUNIT_ASSERT( !q.empty() );
+
+                CPPUNIT_ASSERT( q.dequeue_bulk( out, 4 ) == 4 );
+                for ( int i = 0; i < 4; ++i )
+                    CPPUNIT_CHECK_EX( out[i]->nVal == i, "expected=" << i << ", popped=" << out[i]->nVal );
+                CPPUNIT_ASSERT( !q.empty() );
+
+                CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 6 );
+                for ( int i = 0; i < 6; ++i )
+                    CPPUNIT_CHECK_EX( out[i]->nVal == i + 4, "expected=" << i + 4 << ", popped=" << out[i]->nVal );
+                CPPUNIT_ASSERT( q.empty() );
+                CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 0 );
+                CPPUNIT_ASSERT( q.pop() == nullptr );
+            }
+
+            Queue::gc::scan();
+            for ( int i = 0; i < 10; ++i )
+                CPPUNIT_CHECK_EX( arr[i].nDisposeCount == 1, "i=" << i << ", dispose count=" << arr[i].nDisposeCount );
+        }
+
         // Test for BasketQueue and derivatives
         template <class Queue>
         void test_basket()
@@ -228,6 +266,36 @@ namespace queue {
         }
 
         // Test for a queue in what dequeued item should be manually disposed
+        // Test for enqueue_bulk/dequeue_bulk of bounded queues
+        template <class Queue>
+        void test2_bulk()
+        {
+            typedef typename Queue::value_type value_type;
+            value_type arr[10];
+            for ( int i = 0; i < 10; ++i )
+                arr[i].nVal = i;
+
+            Queue q;
+            value_type * out[10];
+
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr, arr ) == 0 );
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 0 );
+
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr, arr + 10 ) == 10 );
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 4 ) == 4 );
+            for ( int i = 0; i < 4; ++i )
+                CPPUNIT_CHECK( out[i] == &arr[i] );
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 6 );
+            for ( int i = 0; i < 6; ++i )
+                CPPUNIT_CHECK( out[i] == &arr[i + 4] );
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 10 ) == 0 );
+
+            for ( int i = 0; i < 10; ++i )
+                CPPUNIT_CHECK( arr[i].nDisposeCount == 0 );
+        }
+
         template <class Queue>
         void test2()
         {
@@ -421,6 +489,12 @@ namespace queue {
         void test_VyukovMPMCCycleQueue_dyn();
         void test_VyukovMPMCCycleQueue_dyn_ic();
 
+        void test_MPSCQueue_default();
+        void test_MPSCQueue_base_ic();
+        void test_MPSCQueue_member();
+        void test_MPSCQueue_member_stat();
+        void test_MPSCQueue_base_noalign();
+
         CPPUNIT_TEST_SUITE(IntrusiveQueueHeaderTest)
             CPPUNIT_TEST(test_MSQueue_HP_default)
             CPPUNIT_TEST(test_MSQueue_HP_default_ic)
@@ -544,6 +618,12 @@ namespace queue {
             CPPUNIT_TEST(test_VyukovMPMCCycleQueue_dyn);
             CPPUNIT_TEST(test_VyukovMPMCCycleQueue_dyn_ic);
 
+            CPPUNIT_TEST(test_MPSCQueue_default)
+            CPPUNIT_TEST(test_MPSCQueue_base_ic)
+            CPPUNIT_TEST(test_MPSCQueue_member)
+            CPPUNIT_TEST(test_MPSCQueue_member_stat)
+            CPPUNIT_TEST(test_MPSCQueue_base_noalign)
+
         CPPUNIT_TEST_SUITE_END()
     };
 }   // namespace queue
@@ -35,7 +35,7 @@
 
 namespace queue {
 
-#define TEST(X) void IntrusiveQueueHeaderTest::test_##X() { test<X>(); }
+#define TEST(X) void IntrusiveQueueHeaderTest::test_##X() { test<X>(); test_bulk<X>(); }
 
     namespace {
         typedef IntrusiveQueueHeaderTest::base_hook_item< ci::msqueue::node<cds::gc::HP > > base_item_type;
@@ -33,7 +33,7 @@
 
 namespace queue {
 
-#define TEST(X)     void IntrusiveQueueHeaderTest::test_##X() { test2<X>(); }
+#define TEST(X)     void IntrusiveQueueHeaderTest::test_##X() { test2<X>(); test2_bulk<X>(); }
 
     namespace {
         struct item {
@@ -146,4 +146,19 @@ namespace queue {
         > test_queue;
         test_ic< test_queue >();
     }
+
+    void HdrTestQueue::MSQueue_HP_bulk()
+    {
+        typedef cds::container::MSQueue < cds::gc::HP, int,
+            typename cds::container::msqueue::make_traits <
+                cds::opt::item_counter< cds::atomicity::item_counter >
+                , cds::opt::stat< cds::container::msqueue::stat<> >
+            > ::type
+        > test_queue;
+
+        test_queue q;
+        test_bulk( q );
+        CPPUNIT_CHECK( q.statistics().m_EnqueueBulkCount.get() == 3 );
+        CPPUNIT_CHECK( q.statistics().m_EnqueueCount.get() == 121 );
+    }
 }   // namespace queue
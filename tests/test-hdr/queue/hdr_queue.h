@@ -33,6 +33,8 @@
 
 #include "cppunit/cppunit_proxy.h"
 #include <cds/details/defs.h>
+#include <vector>
+#include <iterator>
 
 namespace queue {
 
@@ -274,6 +276,146 @@ namespace queue {
             CPPUNIT_CHECK( q.size() == nCapacity );
         }
 
+        template <class Queue>
+        void test_segmented_fifo( Queue& q )
+        {
+            // Enough items to span several segments
+            int const nCount = 1000;
+
+            CPPUNIT_ASSERT( q.empty() );
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( q.push( i ));
+                CPPUNIT_ASSERT( !q.empty() );
+            }
+            for ( int i = 0; i < nCount; ++i ) {
+                int n = -1;
+                CPPUNIT_ASSERT( q.pop( n ));
+                CPPUNIT_CHECK_EX( n == i, "expected=" << i << ", popped=" << n );
+            }
+            CPPUNIT_ASSERT( q.empty() );
+
+            int n = -1;
+            CPPUNIT_ASSERT( !q.pop( n ));
+            CPPUNIT_ASSERT( n == -1 );
+
+            // Interleaved push/pop: the head segment is drained while the tail segment is filled
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( q.push( i * 2 ));
+                CPPUNIT_ASSERT( q.push( i * 2 + 1 ));
+                CPPUNIT_ASSERT( q.pop( n ));
+                CPPUNIT_CHECK_EX( n == i, "expected=" << i << ", popped=" << n );
+            }
+            CPPUNIT_ASSERT( !q.empty() );
+            CPPUNIT_ASSERT( q.pop( n ));
+            CPPUNIT_CHECK_EX( n == nCount, "expected=" << nCount << ", popped=" << n );
+
+            q.clear();
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( !q.pop( n ));
+        }
+
+        template <class Queue>
+        void test_faa_array_queue()
+        {
+            Queue   q;
+            test_with( q );
+            test_emplace( q );
+            test_segmented_fifo( q );
+        }
+
+        template <class Queue>
+        void test_faa_array_queue_ic()
+        {
+            Queue   q;
+            test_ic_with( q );
+            test_emplace_ic( q );
+            test_segmented_fifo( q );
+            CPPUNIT_ASSERT( q.size() == 0 );
+        }
+
+        // q must have item counter
+        template <class Queue>
+        void test_bulk( Queue& q )
+        {
+            std::vector<int> arr( 100 );
+            for ( size_t i = 0; i < arr.size(); ++i )
+                arr[i] = static_cast<int>( i );
+
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.begin() ) == 0 );
+            CPPUNIT_ASSERT( q.empty() );
+
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.end() ) == arr.size() );
+            CPPUNIT_ASSERT( !q.empty() );
+            CPPUNIT_ASSERT( q.size() == arr.size() );
+            CPPUNIT_ASSERT( q.push( 100 ));
+
+            std::vector<int> res;
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), 30 ) == 30 );
+            CPPUNIT_ASSERT( q.size() == 71 );
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), 1000 ) == 71 );
+            CPPUNIT_ASSERT( res.size() == 101 );
+            for ( size_t i = 0; i < res.size(); ++i )
+                CPPUNIT_CHECK_EX( res[i] == static_cast<int>( i ), "expected=" << i << ", popped=" << res[i] );
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.size() == 0 );
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), 10 ) == 0 );
+
+            // Bulk and single operations are interleaved
+            int n = -1;
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.begin() + 10 ) == 10 );
+            CPPUNIT_ASSERT( q.push( 10 ));
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin() + 11, arr.begin() + 20 ) == 9 );
+            CPPUNIT_ASSERT( q.pop( n ));
+            CPPUNIT_CHECK( n == 0 );
+
+            int out[25];
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 15 ) == 15 );
+            for ( int i = 0; i < 15; ++i )
+                CPPUNIT_CHECK_EX( out[i] == i + 1, "expected=" << i + 1 << ", popped=" << out[i] );
+            CPPUNIT_ASSERT( q.size() == 4 );
+            CPPUNIT_ASSERT( q.dequeue_bulk( out, 25 ) == 4 );
+            for ( int i = 0; i < 4; ++i )
+                CPPUNIT_CHECK_EX( out[i] == i + 16, "expected=" << i + 16 << ", popped=" << out[i] );
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( !q.pop( n ));
+        }
+
+        // q must have item counter
+        template <class Queue>
+        void test_bounded_bulk( Queue& q )
+        {
+            size_t const nCapacity = q.capacity();
+            std::vector<int> arr( nCapacity + 10 );
+            for ( size_t i = 0; i < arr.size(); ++i )
+                arr[i] = static_cast<int>( i );
+
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.begin() ) == 0 );
+
+            // Only nCapacity items fit
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.end() ) == nCapacity );
+            CPPUNIT_ASSERT( q.size() == nCapacity );
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin(), arr.end() ) == 0 );
+            CPPUNIT_ASSERT( !q.push( -1 ));
+
+            std::vector<int> res;
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), 5 ) == 5 );
+            CPPUNIT_ASSERT( q.size() == nCapacity - 5 );
+
+            // The cells are wrapped around the buffer end
+            CPPUNIT_ASSERT( q.enqueue_bulk( arr.begin() + nCapacity, arr.end() ) == 5 );
+            CPPUNIT_ASSERT( q.size() == nCapacity );
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), nCapacity * 2 ) == nCapacity );
+            CPPUNIT_ASSERT( res.size() == nCapacity + 5 );
+            for ( size_t i = 0; i < res.size(); ++i )
+                CPPUNIT_CHECK_EX( res[i] == static_cast<int>( i ), "expected=" << i << ", popped=" << res[i] );
+
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.size() == 0 );
+            CPPUNIT_ASSERT( q.dequeue_bulk( std::back_inserter( res ), 10 ) == 0 );
+        }
+
     public:
         void MSQueue_HP();
         void MSQueue_HP_relax();
@@ -285,6 +427,7 @@ namespace queue {
         void MSQueue_HP_Counted_seqcst();
         void MSQueue_HP_Counted_relax_align();
         void MSQueue_HP_Counted_seqcst_align();
+        void MSQueue_HP_bulk();
 
         void MSQueue_DHP();
         void MSQueue_DHP_relax();
@@ -296,6 +439,7 @@ namespace queue {
         void MSQueue_DHP_Counted_seqcst();
         void MSQueue_DHP_Counted_relax_align();
         void MSQueue_DHP_Counted_seqcst_align();
+        void MSQueue_DHP_bulk();
 
         void MoirQueue_HP();
         void MoirQueue_HP_relax();
@@ -307,6 +451,7 @@ namespace queue {
         void MoirQueue_HP_Counted_seqcst();
         void MoirQueue_HP_Counted_relax_align();
         void MoirQueue_HP_Counted_seqcst_align();
+        void MoirQueue_HP_bulk();
 
         void MoirQueue_DHP();
         void MoirQueue_DHP_relax();
@@ -318,6 +463,7 @@ namespace queue {
         void MoirQueue_DHP_Counted_seqcst();
         void MoirQueue_DHP_Counted_relax_align();
         void MoirQueue_DHP_Counted_seqcst_align();
+        void MoirQueue_DHP_bulk();
 
         void OptimisticQueue_HP();
         void OptimisticQueue_HP_relax();
@@ -363,6 +509,18 @@ namespace queue {
         void BasketQueue_DHP_Counted_relax_align();
         void BasketQueue_DHP_Counted_seqcst_align();
 
+        void FAAArrayQueue_HP();
+        void FAAArrayQueue_HP_Counted();
+        void FAAArrayQueue_HP_seqcst();
+        void FAAArrayQueue_HP_small_stat();
+        void FAAArrayQueue_HP_nopad();
+
+        void FAAArrayQueue_DHP();
+        void FAAArrayQueue_DHP_Counted();
+        void FAAArrayQueue_DHP_seqcst();
+        void FAAArrayQueue_DHP_small_stat();
+        void FAAArrayQueue_DHP_nopad();
+
         void RWQueue_default();
         void RWQueue_mutex();
         void RWQueue_ic();
@@ -378,6 +536,13 @@ namespace queue {
         void VyukovMPMCCycleQueue_static_ic();
         void VyukovMPMCCycleQueue_dyn();
         void VyukovMPMCCycleQueue_dyn_ic();
+        void VyukovMPMCCycleQueue_bulk();
+
+        void SPSCRingQueue_static();
+        void SPSCRingQueue_static_ic();
+        void SPSCRingQueue_dyn();
+        void SPSCRingQueue_dyn_ic();
+        void SPSCRingQueue_stat();
 
         CPPUNIT_TEST_SUITE( HdrTestQueue )
             CPPUNIT_TEST(MSQueue_HP);
@@ -390,6 +555,7 @@ namespace queue {
             CPPUNIT_TEST(MSQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(MSQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(MSQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(MSQueue_HP_bulk);
 
             CPPUNIT_TEST(MSQueue_DHP);
             CPPUNIT_TEST(MSQueue_DHP_relax);
@@ -401,6 +567,7 @@ namespace queue {
             CPPUNIT_TEST(MSQueue_DHP_Counted_seqcst);
             CPPUNIT_TEST(MSQueue_DHP_Counted_relax_align);
             CPPUNIT_TEST(MSQueue_DHP_Counted_seqcst_align);
+            CPPUNIT_TEST(MSQueue_DHP_bulk);
 
             CPPUNIT_TEST(MoirQueue_HP);
             CPPUNIT_TEST(MoirQueue_HP_relax);
@@ -412,6 +579,7 @@ namespace queue {
             CPPUNIT_TEST(MoirQueue_HP_Counted_seqcst);
             CPPUNIT_TEST(MoirQueue_HP_Counted_relax_align);
             CPPUNIT_TEST(MoirQueue_HP_Counted_seqcst_align);
+            CPPUNIT_TEST(MoirQueue_HP_bulk);
 
             CPPUNIT_TEST(MoirQueue_DHP);
             CPPUNIT_TEST(MoirQueue_DHP_relax);
@@ -423,6 +591,7 @@ namespace queue {
             CPPUNIT_TEST(MoirQueue_DHP_Counted_seqcst);
             CPPUNIT_TEST(MoirQueue_DHP_Counted_relax_align);
             CPPUNIT_TEST(MoirQueue_DHP_Counted_seqcst_align);
+            CPPUNIT_TEST(MoirQueue_DHP_bulk);
 
             CPPUNIT_TEST(OptimisticQueue_HP);
             CPPUNIT_TEST(OptimisticQueue_HP_relax);
@@ -468,6 +637,18 @@ namespace queue {
             CPPUNIT_TEST(BasketQueue_DHP_Counted_relax_align);
             CPPUNIT_TEST(BasketQueue_DHP_Counted_seqcst_align);
 
+            CPPUNIT_TEST(FAAArrayQueue_HP);
+            CPPUNIT_TEST(FAAArrayQueue_HP_Counted);
+            CPPUNIT_TEST(FAAArrayQueue_HP_seqcst);
+            CPPUNIT_TEST(FAAArrayQueue_HP_small_stat);
+            CPPUNIT_TEST(FAAArrayQueue_HP_nopad);
+
+            CPPUNIT_TEST(FAAArrayQueue_DHP);
+            CPPUNIT_TEST(FAAArrayQueue_DHP_Counted);
+            CPPUNIT_TEST(FAAArrayQueue_DHP_seqcst);
+            CPPUNIT_TEST(FAAArrayQueue_DHP_small_stat);
+            CPPUNIT_TEST(FAAArrayQueue_DHP_nopad);
+
             CPPUNIT_TEST( TsigasCycleQueue_static )
             CPPUNIT_TEST( TsigasCycleQueue_static_ic )
             CPPUNIT_TEST( TsigasCycleQueue_dyn )
@@ -477,6 +658,13 @@ namespace queue {
             CPPUNIT_TEST( VyukovMPMCCycleQueue_static_ic )
             CPPUNIT_TEST( VyukovMPMCCycleQueue_dyn )
             CPPUNIT_TEST( VyukovMPMCCycleQueue_dyn_ic )
+            CPPUNIT_TEST( VyukovMPMCCycleQueue_bulk )
+
+            CPPUNIT_TEST( SPSCRingQueue_static )
+            CPPUNIT_TEST( SPSCRingQueue_static_ic )
+            CPPUNIT_TEST( SPSCRingQueue_dyn )
+            CPPUNIT_TEST( SPSCRingQueue_dyn_ic )
+            CPPUNIT_TEST( SPSCRingQueue_stat )
 
             CPPUNIT_TEST( RWQueue_default)
             CPPUNIT_TEST( RWQueue_mutex )
@@ -0,0 +1,139 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include <cds/container/spsc_ring_queue.h>
+
+#include "queue/hdr_queue.h"
+
+namespace queue {
+    namespace{
+        struct traits_SPSCRingQueue_static : public cds::container::spsc_ring_queue::traits
+        {
+            typedef cds::opt::v::static_buffer<int, 1024> buffer;
+        };
+        struct traits_SPSCRingQueue_static_ic : public traits_SPSCRingQueue_static
+        {
+            typedef cds::atomicity::item_counter item_counter;
+        };
+    }
+    void HdrTestQueue::SPSCRingQueue_static()
+    {
+        typedef cds::container::SPSCRingQueue< int, traits_SPSCRingQueue_static > queue_type;
+
+        test_bounded_no_ic< queue_type >();
+    }
+
+    void HdrTestQueue::SPSCRingQueue_static_ic()
+    {
+        typedef cds::container::SPSCRingQueue< int, traits_SPSCRingQueue_static_ic > queue_type;
+        test_bounded_ic< queue_type >();
+    }
+
+    void HdrTestQueue::SPSCRingQueue_dyn()
+    {
+        class queue_type : public cds::container::SPSCRingQueue < int >
+        {
+            typedef cds::container::SPSCRingQueue < int > base_class;
+        public:
+            queue_type() : base_class( 1024 ) {}
+        };
+        test_bounded_no_ic< queue_type >();
+    }
+
+    void HdrTestQueue::SPSCRingQueue_dyn_ic()
+    {
+        typedef cds::container::SPSCRingQueue < int,
+            typename cds::container::spsc_ring_queue::make_traits <
+                cds::opt::item_counter < cds::atomicity::item_counter >
+            > ::type
+        > base_queue;
+
+        class queue_type : public base_queue
+        {
+        public:
+            queue_type() : base_queue( 1024 ) {}
+        };
+        test_bounded_ic< queue_type >();
+    }
+
+    void HdrTestQueue::SPSCRingQueue_stat()
+    {
+        typedef cds::container::SPSCRingQueue < int,
+            typename cds::container::spsc_ring_queue::make_traits <
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< int > >
+                , cds::opt::item_counter < cds::atomicity::item_counter >
+                , cds::opt::stat< cds::container::spsc_ring_queue::stat<> >
+            > ::type
+        > queue_type;
+
+        // Small buffer: the positions wrap around many times
+        queue_type q( 4 );
+        CPPUNIT_ASSERT( q.capacity() == 4 );
+
+        int n = 0;
+        for ( int nPass = 0; nPass < 100; ++nPass ) {
+            for ( int i = 0; i < 3; ++i )
+                CPPUNIT_ASSERT( q.push( nPass * 3 + i ));
+            CPPUNIT_ASSERT( q.size() == 3 );
+
+            int * p = q.front();
+            CPPUNIT_ASSERT( p != nullptr );
+            CPPUNIT_ASSERT( *p == nPass * 3 );
+            for ( int i = 0; i < 3; ++i ) {
+                CPPUNIT_ASSERT( q.pop( n ));
+                CPPUNIT_ASSERT( n == nPass * 3 + i );
+            }
+            CPPUNIT_ASSERT( q.empty() );
+            CPPUNIT_ASSERT( q.front() == nullptr );
+        }
+
+        // Fill up the queue
+        for ( int i = 0; i < 4; ++i )
+            CPPUNIT_ASSERT( q.push( i ));
+        CPPUNIT_ASSERT( !q.push( 4 ));
+        CPPUNIT_ASSERT( q.pop_front() );
+        CPPUNIT_ASSERT( q.push( 4 ));
+        q.clear();
+        CPPUNIT_ASSERT( q.empty() );
+        CPPUNIT_ASSERT( q.size() == 0 );
+        CPPUNIT_ASSERT( !q.pop( n ));
+
+        queue_type::stat const& s = q.statistics();
+        CPPUNIT_CHECK( s.m_EnqueueCount.get() == 305 );
+        CPPUNIT_CHECK( s.m_DequeueCount.get() == 305 );
+        CPPUNIT_CHECK( s.m_FullEnqueue.get() == 1 );
+        CPPUNIT_CHECK( s.m_EmptyDequeue.get() == 2 );
+
+        // The cached positions are reloaded only when the queue looks full/empty
+        CPPUNIT_CHECK( s.m_HeadReload.get() < s.m_EnqueueCount.get() );
+        CPPUNIT_CHECK( s.m_TailReload.get() < s.m_DequeueCount.get() );
+    }
+
+} // namespace queue
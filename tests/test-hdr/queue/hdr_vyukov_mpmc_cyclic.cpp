@@ -87,4 +87,19 @@ namespace queue {
         test_bounded_ic< queue_type >();
     }
 
+    void HdrTestQueue::VyukovMPMCCycleQueue_bulk()
+    {
+        typedef cds::container::VyukovMPMCCycleQueue < int,
+            typename cds::container::vyukov_queue::make_traits <
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< int > >
+                , cds::opt::item_counter < cds::atomicity::item_counter >
+            > ::type
+        > queue_type;
+
+        // test_bulk() leaves the positions near the end of the buffer, so test_bounded_bulk() wraps around it
+        queue_type q( 128 );
+        test_bulk( q );
+        test_bounded_bulk( q );
+    }
+
 }
@@ -30,6 +30,7 @@
 
 #include "set/hdr_cuckoo_set.h"
 #include <cds/container/cuckoo_set.h>
+#include <cds/gc/ebr.h>
 
 namespace set {
 
@@ -43,6 +44,7 @@ namespace set {
         typedef cc::CuckooSet< item, set_traits > set_t;
 
         test_int<set_t, equal< item > >();
+        test_batch<set_t>();
     }
 
     void CuckooSetHdrTest::Cuckoo_Striped_list_unord_storehash()
@@ -87,6 +89,7 @@ namespace set {
         > set_t;
 
         test_int<set_t, less< item > >();
+        test_batch<set_t>();
     }
 
     void CuckooSetHdrTest::Cuckoo_Striped_list_less()
@@ -352,6 +355,7 @@ namespace set {
         > set_t;
 
         test_int<set_t, equal< item > >();
+        test_batch<set_t>();
     }
 
     void CuckooSetHdrTest::Cuckoo_Refinable_list_unord_storehash()
@@ -653,6 +657,67 @@ namespace set {
         test_int<set_t, less<item> >();
     }
 
+    void CuckooSetHdrTest::Cuckoo_Striped_fpvector_unord()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::equal_to< equal< item > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::fingerprint_vector<8> >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+        test_batch<set_t>();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Striped_fpvector_unord_storehash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::striping<> >
+                ,co::equal_to< equal< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::fingerprint_vector<4> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Striped_vector_unord_optread()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::equal_to< equal< item > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,cc::cuckoo::optimistic_read< true >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+        test_batch<set_t>();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_fpvector_less_optread()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::refinable<> >
+                ,co::less< less< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::fingerprint_vector<8> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::optimistic_read< true >
+                ,cc::cuckoo::reclaim_policy< cc::cuckoo::epoch_reclaim< cds::gc::EBR > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
 } // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::CuckooSetHdrTest);
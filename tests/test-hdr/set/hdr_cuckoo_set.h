@@ -539,6 +539,49 @@ namespace set {
             CPPUNIT_MSG( "   Duration=" << timer.duration() );
         }
 
+        template <class Set>
+        void test_batch()
+        {
+            Set s( 32, 4, 3 );
+
+            static int const nLimit = 1000;
+            int arrKeys[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys[i] = i;
+            shuffle( arrKeys, arrKeys + nLimit );
+            bool arrResult[nLimit * 2];
+
+            // the set is resized while inserting
+            CPPUNIT_CHECK( s.insert_batch( arrKeys, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_CHECK( s.insert_batch( arrKeys, nLimit, arrResult ) == nLimit - nLimit / 2 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i >= nLimit / 2 ));
+            CPPUNIT_CHECK( check_size( s, nLimit ));
+
+            int arrFind[nLimit * 2];
+            for ( int i = 0; i < nLimit * 2; ++i )
+                arrFind[i] = i;
+            CPPUNIT_CHECK( s.find_batch( arrFind, nLimit * 2, arrResult ) == nLimit );
+            for ( int i = 0; i < nLimit * 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i < nLimit ));
+
+            int arrErase[nLimit / 2];
+            for ( int i = 0; i < nLimit / 2; ++i )
+                arrErase[i] = i * 2;
+            CPPUNIT_CHECK( s.erase_batch( arrErase, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_CHECK( s.erase_batch( arrErase, nLimit / 2 ) == 0 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( s.contains( i ) == ( i % 2 != 0 ));
+            CPPUNIT_CHECK( check_size( s, nLimit / 2 ));
+
+            s.clear();
+            CPPUNIT_CHECK( s.empty() );
+        }
+
     public:
         void Cuckoo_Striped_list_unord();
         void Cuckoo_Striped_list_unord_storehash();
@@ -584,6 +627,12 @@ namespace set {
         void Cuckoo_Refinable_vector_less_cmp_eq();
         void Cuckoo_Refinable_vector_less_cmp_eq_storehash();
 
+        void Cuckoo_Striped_fpvector_unord();
+        void Cuckoo_Striped_fpvector_unord_storehash();
+
+        void Cuckoo_Striped_vector_unord_optread();
+        void Cuckoo_Refinable_fpvector_less_optread();
+
         CPPUNIT_TEST_SUITE(CuckooSetHdrTest)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord_storehash)
@@ -628,6 +677,12 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq_storehash)
+
+            CPPUNIT_TEST( Cuckoo_Striped_fpvector_unord)
+            CPPUNIT_TEST( Cuckoo_Striped_fpvector_unord_storehash)
+
+            CPPUNIT_TEST( Cuckoo_Striped_vector_unord_optread)
+            CPPUNIT_TEST( Cuckoo_Refinable_fpvector_less_optread)
         CPPUNIT_TEST_SUITE_END()
     };
 
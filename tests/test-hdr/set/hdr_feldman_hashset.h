@@ -32,6 +32,7 @@
 #define CDSTEST_HDR_FELDMAN_HASHSET_H
 
 #include "cppunit/cppunit_proxy.h"
+#include <vector>
 
 // forward declaration
 namespace cds {
@@ -432,6 +433,55 @@ namespace set {
             CPPUNIT_MSG( s.statistics() );
         }
 
+        template <typename Set, typename Hasher>
+        void test_batch( size_t nHeadBits, size_t nArrayBits )
+        {
+            typedef typename Set::hash_type hash_type;
+            typedef Arg<hash_type> arg_type;
+
+            Hasher hasher;
+            static size_t const capacity = 1000;
+
+            std::vector< arg_type > arrArg;
+            std::vector< hash_type > arrHash;
+            for ( size_t i = 0; i < capacity; ++i ) {
+                arrArg.push_back( arg_type( i, hasher( i )));
+                arrHash.push_back( hasher( i ));
+            }
+            bool arrResult[capacity];
+
+            Set s( nHeadBits, nArrayBits );
+            CPPUNIT_ASSERT( s.insert_batch( arrArg.data(), capacity / 2, arrResult ) == capacity / 2 );
+            for ( size_t i = 0; i < capacity / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_ASSERT( s.size() == capacity / 2 );
+
+            // the first half is already in the set
+            CPPUNIT_ASSERT( s.insert_batch( arrArg.data(), capacity, arrResult ) == capacity - capacity / 2 );
+            for ( size_t i = 0; i < capacity; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i >= capacity / 2 ));
+            CPPUNIT_ASSERT( s.size() == capacity );
+
+            CPPUNIT_ASSERT( s.find_batch( arrHash.data(), capacity, arrResult ) == capacity );
+            for ( size_t i = 0; i < capacity; ++i ) {
+                CPPUNIT_CHECK( arrResult[i] );
+                CPPUNIT_CHECK( s.contains( arrHash[i] ));
+            }
+
+            CPPUNIT_ASSERT( s.erase_batch( arrHash.data(), capacity / 2, arrResult ) == capacity / 2 );
+            for ( size_t i = 0; i < capacity / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_ASSERT( s.erase_batch( arrHash.data(), capacity / 2 ) == 0 );
+            CPPUNIT_ASSERT( s.size() == capacity - capacity / 2 );
+
+            CPPUNIT_ASSERT( s.find_batch( arrHash.data(), capacity, arrResult ) == capacity - capacity / 2 );
+            for ( size_t i = 0; i < capacity; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i >= capacity / 2 ));
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+        }
+
         template <typename Set, typename Hasher>
         void test_rcu(size_t nHeadBits, size_t nArrayBits)
         {
@@ -707,6 +757,19 @@ namespace set {
         void dhp_hash128_4_3();
         void dhp_hash128_4_3_stat();
 
+        void ebr_nohash();
+        void ebr_nohash_stat();
+        void ebr_nohash_5_3();
+        void ebr_nohash_5_3_stat();
+        void ebr_stdhash();
+        void ebr_stdhash_stat();
+        void ebr_stdhash_5_3();
+        void ebr_stdhash_5_3_stat();
+        void ebr_hash128();
+        void ebr_hash128_stat();
+        void ebr_hash128_4_3();
+        void ebr_hash128_4_3_stat();
+
         void rcu_gpi_nohash();
         void rcu_gpi_nohash_stat();
         void rcu_gpi_nohash_5_3();
@@ -798,6 +861,18 @@ namespace set {
             CPPUNIT_TEST(dhp_hash128_stat)
             CPPUNIT_TEST(dhp_hash128_4_3)
             CPPUNIT_TEST(dhp_hash128_4_3_stat)
+            CPPUNIT_TEST(ebr_nohash)
+            CPPUNIT_TEST(ebr_nohash_stat)
+            CPPUNIT_TEST(ebr_nohash_5_3)
+            CPPUNIT_TEST(ebr_nohash_5_3_stat)
+            CPPUNIT_TEST(ebr_stdhash)
+            CPPUNIT_TEST(ebr_stdhash_stat)
+            CPPUNIT_TEST(ebr_stdhash_5_3)
+            CPPUNIT_TEST(ebr_stdhash_5_3_stat)
+            CPPUNIT_TEST(ebr_hash128)
+            CPPUNIT_TEST(ebr_hash128_stat)
+            CPPUNIT_TEST(ebr_hash128_4_3)
+            CPPUNIT_TEST(ebr_hash128_4_3_stat)
 
             CPPUNIT_TEST(rcu_gpi_nohash)
             CPPUNIT_TEST(rcu_gpi_nohash_stat)
@@ -57,6 +57,8 @@ namespace set {
             >::type
         > set_type2;
         test_hp<set_type2, nohash<key_type>>(4, 2);
+
+        test_batch<set_type, nohash<key_type>>(4, 2);
     }
 
     void FeldmanHashSetHdrTest::hp_stdhash()
@@ -103,6 +105,8 @@ namespace set {
             >::type
         > set_type2;
         test_hp<set_type2, hash128::make>(4, 2);
+
+        test_batch<set_type, hash128::make>(4, 2);
     }
 
     void FeldmanHashSetHdrTest::hp_nohash_stat()
@@ -30,6 +30,7 @@
 
 #include "set/hdr_intrusive_cuckoo_set.h"
 #include <cds/intrusive/cuckoo_set.h>
+#include <cds/gc/ebr.h>
 
 #include "set/intrusive_cuckoo_set_common.h"
 #include "../unit/print_cuckoo_stat.h"
@@ -671,4 +672,41 @@ namespace set {
         test_cuckoo<set_type>();
     }
 
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_fpvector_basehook_equal()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_fpvector_basehook_equal_optread()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,ci::cuckoo::optimistic_read< true >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
 }   // namespace set
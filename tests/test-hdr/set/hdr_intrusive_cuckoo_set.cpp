@@ -30,6 +30,7 @@
 
 #include "set/hdr_intrusive_cuckoo_set.h"
 #include <cds/intrusive/cuckoo_set.h>
+#include <cds/gc/ebr.h>
 
 #include "set/intrusive_cuckoo_set_common.h"
 #include "../unit/print_cuckoo_stat.h"
@@ -634,6 +635,114 @@ namespace set {
         test_cuckoo<set_type>();
     }
 
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_fpvector_basehook_equal()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_fpvector_basehook_sort_cmp()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_fpvector_basehook_equal_storehash()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<16>, 2 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::hash_array_size >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_fpvector_memberhook_equal()
+    {
+        typedef ci::cuckoo::node< ci::cuckoo::fingerprint_vector<32>, 0 > node_type;
+        typedef IntrusiveCuckooSetHdrTest::member_item< node_type >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof(item_type, hMember),
+                    ci::cuckoo::probeset_type< node_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_vector_basehook_equal_optread()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,ci::cuckoo::optimistic_read< true >
+                ,co::stat< ci::cuckoo::stat >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_fpvector_basehook_sort_cmp_optread()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::fingerprint_vector<8>, 2 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::hash_array_size >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,ci::cuckoo::optimistic_read< true >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
 }   // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::IntrusiveCuckooSetHdrTest);
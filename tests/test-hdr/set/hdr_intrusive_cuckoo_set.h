@@ -599,6 +599,18 @@ namespace set {
         void Cuckoo_refinable_list_memberhook_sort_cmpmix_storehash();
         void Cuckoo_refinable_vector_memberhook_sort_cmpmix_storehash();
 
+        // fingerprint vector probeset
+        void Cuckoo_striped_fpvector_basehook_equal();
+        void Cuckoo_striped_fpvector_basehook_sort_cmp();
+        void Cuckoo_striped_fpvector_basehook_equal_storehash();
+        void Cuckoo_striped_fpvector_memberhook_equal();
+        void Cuckoo_refinable_fpvector_basehook_equal();
+
+        // optimistic read
+        void Cuckoo_striped_vector_basehook_equal_optread();
+        void Cuckoo_striped_fpvector_basehook_sort_cmp_optread();
+        void Cuckoo_refinable_fpvector_basehook_equal_optread();
+
         CPPUNIT_TEST_SUITE(IntrusiveCuckooSetHdrTest)
             // ***********************************************************
             // Cuckoo hashing (striped)
@@ -680,6 +692,18 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_refinable_list_memberhook_sort_cmpmix_storehash)
             CPPUNIT_TEST( Cuckoo_refinable_vector_memberhook_sort_cmpmix_storehash)
 
+            // fingerprint vector probeset
+            CPPUNIT_TEST( Cuckoo_striped_fpvector_basehook_equal)
+            CPPUNIT_TEST( Cuckoo_striped_fpvector_basehook_sort_cmp)
+            CPPUNIT_TEST( Cuckoo_striped_fpvector_basehook_equal_storehash)
+            CPPUNIT_TEST( Cuckoo_striped_fpvector_memberhook_equal)
+            CPPUNIT_TEST( Cuckoo_refinable_fpvector_basehook_equal)
+
+            // optimistic read
+            CPPUNIT_TEST( Cuckoo_striped_vector_basehook_equal_optread)
+            CPPUNIT_TEST( Cuckoo_striped_fpvector_basehook_sort_cmp_optread)
+            CPPUNIT_TEST( Cuckoo_refinable_fpvector_basehook_equal_optread)
+
         CPPUNIT_TEST_SUITE_END()
     };
 } // namespace set
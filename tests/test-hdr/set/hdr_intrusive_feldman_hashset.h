@@ -32,6 +32,7 @@
 #define CDSTEST_HDR_INTRUSIVE_FELDMAN_HASHSET_H
 
 #include "cppunit/cppunit_proxy.h"
+#include <cds/intrusive/details/feldman_hashset_base.h>
 
 // forward declaration
 namespace cds {
@@ -137,6 +138,28 @@ namespace set {
         };
 
 
+        template <typename Set>
+        void check_compact( Set& s )
+        {
+            ci::feldman_hashset::memory_statistics before;
+            s.get_memory_statistics( before );
+            CPPUNIT_ASSERT( before.data_cell_count == s.size());
+            CPPUNIT_ASSERT( before.array_node_count == before.array_cell_count + 1 );
+
+            size_t const nFreed = s.compact();
+            CPPUNIT_ASSERT( nFreed == before.compactable_node_count );
+
+            ci::feldman_hashset::memory_statistics after;
+            s.get_memory_statistics( after );
+            CPPUNIT_ASSERT( after.data_cell_count == s.size());
+            CPPUNIT_ASSERT( after.compactable_node_count == 0 );
+            CPPUNIT_ASSERT( after.compactable_memory_size == 0 );
+            CPPUNIT_ASSERT( after.array_node_count + nFreed == before.array_node_count );
+            CPPUNIT_ASSERT( after.memory_size + before.compactable_memory_size == before.memory_size );
+            if ( s.empty())
+                CPPUNIT_ASSERT( after.array_node_count == 1 );
+        }
+
         template <typename Set, typename Hash>
         void test_hp( size_t nHeadBits, size_t nArrayBits )
         {
@@ -240,6 +263,9 @@ namespace set {
                 CPPUNIT_ASSERT( el.nDisposeCount == 1 );
             }
 
+            // compact() test: all array nodes except the head are freed
+            check_compact( s );
+
             // new hash values
             for ( auto& el : arrValue )
                 el.hash = hasher( el.hash );
@@ -262,6 +288,14 @@ namespace set {
             for ( auto& el : arrValue )
                 el.nDisposeCount = 0;
 
+            // compact() test: unlink a half of items
+            for ( size_t i = 0; i < arrCapacity; i += 2 )
+                CPPUNIT_ASSERT( s.unlink( arrValue[i] ));
+            CPPUNIT_ASSERT( s.size() == arrCapacity / 2 );
+            check_compact( s );
+            for ( size_t i = 0; i < arrCapacity; ++i )
+                CPPUNIT_ASSERT( s.contains( arrValue[i].hash ) == ( i % 2 != 0 ));
+
             s.clear();
             CPPUNIT_ASSERT(s.size() == 0 );
             Set::gc::force_dispose();
@@ -502,6 +536,9 @@ namespace set {
                 CPPUNIT_ASSERT(el.nDisposeCount == 1);
             }
 
+            // compact() test: all array nodes except the head are freed
+            check_compact(s);
+
             // new hash values
             for (auto& el : arrValue)
                 el.hash = hasher(el.hash);
@@ -524,6 +561,14 @@ namespace set {
             for (auto& el : arrValue)
                 el.nDisposeCount = 0;
 
+            // compact() test: unlink a half of items
+            for (size_t i = 0; i < arrCapacity; i += 2)
+                CPPUNIT_ASSERT(s.unlink(arrValue[i]));
+            CPPUNIT_ASSERT(s.size() == arrCapacity / 2);
+            check_compact(s);
+            for (size_t i = 0; i < arrCapacity; ++i)
+                CPPUNIT_ASSERT(s.contains(arrValue[i].hash) == (i % 2 != 0));
+
             s.clear();
             CPPUNIT_ASSERT(s.size() == 0);
             Set::gc::force_dispose();
@@ -652,6 +697,19 @@ namespace set {
         void dhp_hash128_4_3();
         void dhp_hash128_4_3_stat();
 
+        void ebr_nohash();
+        void ebr_nohash_stat();
+        void ebr_nohash_5_3();
+        void ebr_nohash_5_3_stat();
+        void ebr_stdhash();
+        void ebr_stdhash_stat();
+        void ebr_stdhash_5_3();
+        void ebr_stdhash_5_3_stat();
+        void ebr_hash128();
+        void ebr_hash128_stat();
+        void ebr_hash128_4_3();
+        void ebr_hash128_4_3_stat();
+
         void rcu_gpi_nohash();
         void rcu_gpi_nohash_stat();
         void rcu_gpi_nohash_5_3();
@@ -743,6 +801,18 @@ namespace set {
             CPPUNIT_TEST(dhp_hash128_stat)
             CPPUNIT_TEST(dhp_hash128_4_3)
             CPPUNIT_TEST(dhp_hash128_4_3_stat)
+            CPPUNIT_TEST(ebr_nohash)
+            CPPUNIT_TEST(ebr_nohash_stat)
+            CPPUNIT_TEST(ebr_nohash_5_3)
+            CPPUNIT_TEST(ebr_nohash_5_3_stat)
+            CPPUNIT_TEST(ebr_stdhash)
+            CPPUNIT_TEST(ebr_stdhash_stat)
+            CPPUNIT_TEST(ebr_stdhash_5_3)
+            CPPUNIT_TEST(ebr_stdhash_5_3_stat)
+            CPPUNIT_TEST(ebr_hash128)
+            CPPUNIT_TEST(ebr_hash128_stat)
+            CPPUNIT_TEST(ebr_hash128_4_3)
+            CPPUNIT_TEST(ebr_hash128_4_3_stat)
 
             CPPUNIT_TEST(rcu_gpi_nohash)
             CPPUNIT_TEST(rcu_gpi_nohash_stat)
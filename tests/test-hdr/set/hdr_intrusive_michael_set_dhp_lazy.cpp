@@ -53,6 +53,17 @@ namespace set {
         > set;
 
         test_int<set>();
+
+        // expandable bucket table
+        typedef ci::MichaelHashSet< cds::gc::DHP, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+                ,ci::michael_set::dynamic_bucket_table< true >
+                ,co::stat< ci::michael_set::stat<> >
+            >::type
+        > dyn_set;
+        test_int<dyn_set>();
+        test_expandable<dyn_set>();
     }
 
     void IntrusiveHashSetHdrTest::DHP_base_less_lazy()
@@ -0,0 +1,188 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_intrusive_set.h"
+#include <cds/intrusive/lazy_list_ebr.h>
+#include <cds/intrusive/michael_set.h>
+
+namespace set {
+
+    void IntrusiveHashSetHdrTest::EBR_base_cmp_lazy()
+    {
+        typedef base_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+            >::type
+        > set;
+
+        test_int<set>();
+
+        // expandable bucket table
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+                ,ci::michael_set::dynamic_bucket_table< true >
+                ,co::stat< ci::michael_set::stat<> >
+            >::type
+        > dyn_set;
+        test_int<dyn_set>();
+        test_expandable<dyn_set>();
+    }
+
+    void IntrusiveHashSetHdrTest::EBR_base_less_lazy()
+    {
+        typedef base_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+            >::type
+        > set;
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::EBR_base_cmpmix_lazy()
+    {
+        typedef base_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set;
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::EBR_member_cmp_lazy()
+    {
+        typedef member_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+            >::type
+        > set;
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::EBR_member_less_lazy()
+    {
+        typedef member_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+            >::type
+        > set;
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::EBR_member_cmpmix_lazy()
+    {
+        typedef member_int_item< ci::lazy_list::node<cds::gc::EBR> > item;
+        typedef ci::LazyList< cds::gc::EBR
+            ,item
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    bucket_type;
+
+        typedef ci::MichaelHashSet< cds::gc::EBR, bucket_type,
+            ci::michael_set::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set;
+
+        test_int<set>();
+    }
+
+
+} // namespace set
@@ -599,6 +599,79 @@ namespace set {
             }
         }
 
+        template <class Set>
+        void test_expandable()
+        {
+            typedef typename Set::value_type value_type;
+
+            static size_t const nLimit = 1024;
+            value_type arrItems[nLimit];
+            int arr[nLimit];
+            for ( size_t i = 0; i < nLimit; ++i )
+                arr[i] = (int) i;
+            shuffle( arr, arr + nLimit );
+            for ( size_t i = 0; i < nLimit; ++i ) {
+                arrItems[i].nKey = arr[i];
+                arrItems[i].nVal = arr[i] * 2;
+            }
+
+            {
+                Set s( 4, 2 );
+                size_t const nInitBucketCount = s.bucket_count();
+
+                for ( size_t i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( s.insert( arrItems[i] ));
+                CPPUNIT_CHECK( check_size( s, nLimit ));
+                CPPUNIT_CHECK( s.bucket_count() > nInitBucketCount );
+                CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() > 0 );
+
+                for ( size_t i = 0; i < nLimit; ++i ) {
+                    int const nKey = (int) i;
+                    CPPUNIT_CHECK( s.contains( nKey ));
+                    CPPUNIT_CHECK( s.find( nKey, []( value_type& item, int key ) { CPPUNIT_ASSERT_CURRENT( item.nVal == key * 2 ); } ));
+                }
+                CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() == s.statistics().m_nResizeComplete.get() );
+
+                // All buckets are migrated, the iterator visits each item
+                size_t nCount = 0;
+                for ( typename Set::iterator it = s.begin(); it != s.end(); ++it )
+                    ++nCount;
+                CPPUNIT_CHECK( nCount == nLimit );
+
+                for ( size_t i = 0; i < nLimit; i += 2 )
+                    CPPUNIT_ASSERT( s.erase( (int) i ));
+                for ( size_t i = 0; i < nLimit; ++i )
+                    CPPUNIT_CHECK( s.contains( (int) i ) == ( i % 2 != 0 ));
+                CPPUNIT_CHECK( check_size( s, nLimit / 2 ));
+
+                s.clear();
+                CPPUNIT_CHECK( s.empty() );
+                CPPUNIT_CHECK( check_size( s, 0 ));
+            }
+
+            // Right after growth some buckets are not migrated yet, the iterator must visit their items too
+            value_type arrItems2[nLimit];
+            for ( size_t i = 0; i < nLimit; ++i ) {
+                arrItems2[i].nKey = arr[i];
+                arrItems2[i].nVal = arr[i] * 2;
+            }
+            {
+                Set s( 16, 1 );
+                for ( size_t i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( s.insert( arrItems2[i] ));
+                CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() > 0 );
+
+                size_t nCount = 0;
+                for ( typename Set::iterator it = s.begin(); it != s.end(); ++it )
+                    ++nCount;
+                CPPUNIT_CHECK_EX( nCount == nLimit, "iterated " << nCount << " of " << nLimit );
+                CPPUNIT_CHECK( check_size( s, nLimit ));
+
+                s.clear();
+            }
+            Set::gc::force_dispose();
+        }
+
         template <class Set>
         void test_iter()
         {
@@ -1276,6 +1349,13 @@ namespace set {
         void DHP_member_less();
         void DHP_member_cmpmix();
 
+        void EBR_base_cmp();
+        void EBR_base_less();
+        void EBR_base_cmpmix();
+        void EBR_member_cmp();
+        void EBR_member_less();
+        void EBR_member_cmpmix();
+
         void RCU_GPI_base_cmp();
         void RCU_GPI_base_less();
         void RCU_GPI_base_cmpmix();
@@ -1333,6 +1413,13 @@ namespace set {
         void DHP_member_less_lazy();
         void DHP_member_cmpmix_lazy();
 
+        void EBR_base_cmp_lazy();
+        void EBR_base_less_lazy();
+        void EBR_base_cmpmix_lazy();
+        void EBR_member_cmp_lazy();
+        void EBR_member_less_lazy();
+        void EBR_member_cmpmix_lazy();
+
         void RCU_GPI_base_cmp_lazy();
         void RCU_GPI_base_less_lazy();
         void RCU_GPI_base_cmpmix_lazy();
@@ -1410,6 +1497,23 @@ namespace set {
         void split_st_DHP_member_cmpmix();
         void split_st_DHP_member_cmpmix_stat();
 
+        void split_dyn_EBR_base_cmp();
+        void split_dyn_EBR_base_less();
+        void split_dyn_EBR_base_cmpmix();
+        void split_dyn_EBR_base_cmpmix_stat();
+        void split_dyn_EBR_member_cmp();
+        void split_dyn_EBR_member_less();
+        void split_dyn_EBR_member_cmpmix();
+        void split_dyn_EBR_member_cmpmix_stat();
+        void split_st_EBR_base_cmp();
+        void split_st_EBR_base_less();
+        void split_st_EBR_base_cmpmix();
+        void split_st_EBR_base_cmpmix_stat();
+        void split_st_EBR_member_cmp();
+        void split_st_EBR_member_less();
+        void split_st_EBR_member_cmpmix();
+        void split_st_EBR_member_cmpmix_stat();
+
         void split_dyn_RCU_GPI_base_cmp();
         void split_dyn_RCU_GPI_base_less();
         void split_dyn_RCU_GPI_base_cmpmix();
@@ -1548,6 +1652,23 @@ namespace set {
         void split_st_DHP_member_cmpmix_lazy();
         void split_st_DHP_member_cmpmix_stat_lazy();
 
+        void split_dyn_EBR_base_cmp_lazy();
+        void split_dyn_EBR_base_less_lazy();
+        void split_dyn_EBR_base_cmpmix_lazy();
+        void split_dyn_EBR_base_cmpmix_stat_lazy();
+        void split_dyn_EBR_member_cmp_lazy();
+        void split_dyn_EBR_member_less_lazy();
+        void split_dyn_EBR_member_cmpmix_lazy();
+        void split_dyn_EBR_member_cmpmix_stat_lazy();
+        void split_st_EBR_base_cmp_lazy();
+        void split_st_EBR_base_less_lazy();
+        void split_st_EBR_base_cmpmix_lazy();
+        void split_st_EBR_base_cmpmix_stat_lazy();
+        void split_st_EBR_member_cmp_lazy();
+        void split_st_EBR_member_less_lazy();
+        void split_st_EBR_member_cmpmix_lazy();
+        void split_st_EBR_member_cmpmix_stat_lazy();
+
         void split_dyn_RCU_GPI_base_cmp_lazy();
         void split_dyn_RCU_GPI_base_less_lazy();
         void split_dyn_RCU_GPI_base_cmpmix_lazy();
@@ -1664,6 +1785,12 @@ namespace set {
             CPPUNIT_TEST(DHP_member_cmp)
             CPPUNIT_TEST(DHP_member_less)
             CPPUNIT_TEST(DHP_member_cmpmix)
+            CPPUNIT_TEST(EBR_base_cmp)
+            CPPUNIT_TEST(EBR_base_less)
+            CPPUNIT_TEST(EBR_base_cmpmix)
+            CPPUNIT_TEST(EBR_member_cmp)
+            CPPUNIT_TEST(EBR_member_less)
+            CPPUNIT_TEST(EBR_member_cmpmix)
 
             CPPUNIT_TEST(RCU_GPI_base_cmp)
             CPPUNIT_TEST(RCU_GPI_base_less)
@@ -1720,6 +1847,12 @@ namespace set {
             CPPUNIT_TEST(DHP_member_cmp_lazy)
             CPPUNIT_TEST(DHP_member_less_lazy)
             CPPUNIT_TEST(DHP_member_cmpmix_lazy)
+            CPPUNIT_TEST(EBR_base_cmp_lazy)
+            CPPUNIT_TEST(EBR_base_less_lazy)
+            CPPUNIT_TEST(EBR_base_cmpmix_lazy)
+            CPPUNIT_TEST(EBR_member_cmp_lazy)
+            CPPUNIT_TEST(EBR_member_less_lazy)
+            CPPUNIT_TEST(EBR_member_cmpmix_lazy)
 
             CPPUNIT_TEST(RCU_GPI_base_cmp_lazy)
             CPPUNIT_TEST(RCU_GPI_base_less_lazy)
@@ -1796,6 +1929,22 @@ namespace set {
             CPPUNIT_TEST(split_st_DHP_member_less)
             CPPUNIT_TEST(split_st_DHP_member_cmpmix)
             CPPUNIT_TEST( split_st_DHP_member_cmpmix_stat )
+            CPPUNIT_TEST(split_dyn_EBR_base_cmp)
+            CPPUNIT_TEST(split_dyn_EBR_base_less)
+            CPPUNIT_TEST(split_dyn_EBR_base_cmpmix)
+            CPPUNIT_TEST( split_dyn_EBR_base_cmpmix_stat )
+            CPPUNIT_TEST( split_dyn_EBR_member_cmp )
+            CPPUNIT_TEST(split_dyn_EBR_member_less)
+            CPPUNIT_TEST(split_dyn_EBR_member_cmpmix)
+            CPPUNIT_TEST( split_dyn_EBR_member_cmpmix_stat )
+            CPPUNIT_TEST( split_st_EBR_base_cmp )
+            CPPUNIT_TEST(split_st_EBR_base_less)
+            CPPUNIT_TEST(split_st_EBR_base_cmpmix)
+            CPPUNIT_TEST( split_st_EBR_base_cmpmix_stat )
+            CPPUNIT_TEST( split_st_EBR_member_cmp )
+            CPPUNIT_TEST(split_st_EBR_member_less)
+            CPPUNIT_TEST(split_st_EBR_member_cmpmix)
+            CPPUNIT_TEST( split_st_EBR_member_cmpmix_stat )
 
             CPPUNIT_TEST(split_dyn_RCU_GPI_base_cmp)
             CPPUNIT_TEST(split_dyn_RCU_GPI_base_less)
@@ -1932,6 +2081,22 @@ namespace set {
             CPPUNIT_TEST(split_st_DHP_member_less_lazy)
             CPPUNIT_TEST(split_st_DHP_member_cmpmix_lazy)
             CPPUNIT_TEST( split_st_DHP_member_cmpmix_stat_lazy )
+            CPPUNIT_TEST(split_dyn_EBR_base_cmp_lazy)
+            CPPUNIT_TEST(split_dyn_EBR_base_less_lazy)
+            CPPUNIT_TEST(split_dyn_EBR_base_cmpmix_lazy)
+            CPPUNIT_TEST( split_dyn_EBR_base_cmpmix_stat_lazy )
+            CPPUNIT_TEST( split_dyn_EBR_member_cmp_lazy )
+            CPPUNIT_TEST(split_dyn_EBR_member_less_lazy)
+            CPPUNIT_TEST(split_dyn_EBR_member_cmpmix_lazy)
+            CPPUNIT_TEST( split_dyn_EBR_member_cmpmix_stat_lazy )
+            CPPUNIT_TEST( split_st_EBR_base_cmp_lazy )
+            CPPUNIT_TEST(split_st_EBR_base_less_lazy)
+            CPPUNIT_TEST(split_st_EBR_base_cmpmix_lazy)
+            CPPUNIT_TEST( split_st_EBR_base_cmpmix_stat_lazy )
+            CPPUNIT_TEST( split_st_EBR_member_cmp_lazy )
+            CPPUNIT_TEST(split_st_EBR_member_less_lazy)
+            CPPUNIT_TEST(split_st_EBR_member_cmpmix_lazy)
+            CPPUNIT_TEST( split_st_EBR_member_cmpmix_stat_lazy )
 
             CPPUNIT_TEST(split_dyn_RCU_GPI_base_cmp_lazy)
             CPPUNIT_TEST(split_dyn_RCU_GPI_base_less_lazy)
@@ -0,0 +1,355 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_intrusive_skiplist_set.h"
+
+#include <cds/intrusive/skip_list_ebr.h>
+#include "map/print_skiplist_stat.h"
+
+namespace set {
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmp()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::compare< cmp<item> >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmp_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::stat< ci::skip_list::stat<> >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::stat< ci::skip_list::stat<> >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::compare< cmp<item> >
+                ,co::stat< ci::skip_list::stat<> >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmp_xorshift()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less_xorshift()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix_xorshift()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+        void IntrusiveSkipListSet::skiplist_ebr_base_cmp_xorshift_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+                ,co::stat< ci::skip_list::stat<> >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less_xorshift_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+                ,co::stat< ci::skip_list::stat<> >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix_xorshift_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::compare< cmp<item> >
+                ,ci::skip_list::random_level_generator< ci::skip_list::xorshift >
+                ,co::stat< ci::skip_list::stat<> >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+
+    //*********
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmp_pascal()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less_pascal()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix_pascal()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+        void IntrusiveSkipListSet::skiplist_ebr_base_cmp_pascal_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+                ,co::stat< ci::skip_list::stat<> >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_less_pascal_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+                ,co::stat< ci::skip_list::stat<> >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+    void IntrusiveSkipListSet::skiplist_ebr_base_cmpmix_pascal_stat()
+    {
+        typedef base_int_item< ci::skip_list::node< cds::gc::EBR> > item;
+
+        typedef ci::SkipListSet< cds::gc::EBR, item,
+            ci::skip_list::make_traits<
+                ci::opt::hook< ci::skip_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+                ,co::compare< cmp<item> >
+                ,ci::skip_list::random_level_generator< ci::skip_list::turbo_pascal >
+                ,co::stat< ci::skip_list::stat<> >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        >   set_type;
+
+        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >();
+    }
+
+}   // namespace set
@@ -635,6 +635,45 @@ namespace set {
         void skiplist_dhp_member_less_pascal_stat();
         void skiplist_dhp_member_cmpmix_pascal_stat();
 
+        // Skip-list - gc::EBR
+        void skiplist_ebr_base_cmp();
+        void skiplist_ebr_base_less();
+        void skiplist_ebr_base_cmpmix();
+        void skiplist_ebr_base_cmp_stat();
+        void skiplist_ebr_base_less_stat();
+        void skiplist_ebr_base_cmpmix_stat();
+        void skiplist_ebr_base_cmp_xorshift();
+        void skiplist_ebr_base_less_xorshift();
+        void skiplist_ebr_base_cmpmix_xorshift();
+        void skiplist_ebr_base_cmp_xorshift_stat();
+        void skiplist_ebr_base_less_xorshift_stat();
+        void skiplist_ebr_base_cmpmix_xorshift_stat();
+        void skiplist_ebr_base_cmp_pascal();
+        void skiplist_ebr_base_less_pascal();
+        void skiplist_ebr_base_cmpmix_pascal();
+        void skiplist_ebr_base_cmp_pascal_stat();
+        void skiplist_ebr_base_less_pascal_stat();
+        void skiplist_ebr_base_cmpmix_pascal_stat();
+
+        void skiplist_ebr_member_cmp();
+        void skiplist_ebr_member_less();
+        void skiplist_ebr_member_cmpmix();
+        void skiplist_ebr_member_cmp_stat();
+        void skiplist_ebr_member_less_stat();
+        void skiplist_ebr_member_cmpmix_stat();
+        void skiplist_ebr_member_cmp_xorshift();
+        void skiplist_ebr_member_less_xorshift();
+        void skiplist_ebr_member_cmpmix_xorshift();
+        void skiplist_ebr_member_cmp_xorshift_stat();
+        void skiplist_ebr_member_less_xorshift_stat();
+        void skiplist_ebr_member_cmpmix_xorshift_stat();
+        void skiplist_ebr_member_cmp_pascal();
+        void skiplist_ebr_member_less_pascal();
+        void skiplist_ebr_member_cmpmix_pascal();
+        void skiplist_ebr_member_cmp_pascal_stat();
+        void skiplist_ebr_member_less_pascal_stat();
+        void skiplist_ebr_member_cmpmix_pascal_stat();
+
         // Skip-list - gc::nogc
         void skiplist_nogc_base_cmp();
         void skiplist_nogc_base_less();
@@ -751,6 +790,44 @@ namespace set {
             CPPUNIT_TEST(skiplist_dhp_member_less_pascal_stat)
             CPPUNIT_TEST(skiplist_dhp_member_cmpmix_pascal_stat)
 
+            CPPUNIT_TEST(skiplist_ebr_base_cmp)
+            CPPUNIT_TEST(skiplist_ebr_base_less)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_less_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_less_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_pascal_stat)
+
+            CPPUNIT_TEST(skiplist_ebr_member_cmp)
+            CPPUNIT_TEST(skiplist_ebr_member_less)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_less_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_less_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_pascal_stat)
+
             CPPUNIT_TEST(skiplist_nogc_base_cmp)
             CPPUNIT_TEST(skiplist_nogc_base_less)
             CPPUNIT_TEST(skiplist_nogc_base_cmpmix)
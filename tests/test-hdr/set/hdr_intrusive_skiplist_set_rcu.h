@@ -622,6 +622,84 @@ namespace set {
         void skiplist_rcu_sht_member_less_pascal_stat();
         void skiplist_rcu_sht_member_cmpmix_pascal_stat();
 
+        // membarrier_buffered
+        void skiplist_rcu_mbb_base_cmp();
+        void skiplist_rcu_mbb_base_less();
+        void skiplist_rcu_mbb_base_cmpmix();
+        void skiplist_rcu_mbb_base_cmp_stat();
+        void skiplist_rcu_mbb_base_less_stat();
+        void skiplist_rcu_mbb_base_cmpmix_stat();
+        void skiplist_rcu_mbb_base_cmp_xorshift();
+        void skiplist_rcu_mbb_base_less_xorshift();
+        void skiplist_rcu_mbb_base_cmpmix_xorshift();
+        void skiplist_rcu_mbb_base_cmp_xorshift_stat();
+        void skiplist_rcu_mbb_base_less_xorshift_stat();
+        void skiplist_rcu_mbb_base_cmpmix_xorshift_stat();
+        void skiplist_rcu_mbb_base_cmp_pascal();
+        void skiplist_rcu_mbb_base_less_pascal();
+        void skiplist_rcu_mbb_base_cmpmix_pascal();
+        void skiplist_rcu_mbb_base_cmp_pascal_stat();
+        void skiplist_rcu_mbb_base_less_pascal_stat();
+        void skiplist_rcu_mbb_base_cmpmix_pascal_stat();
+
+        void skiplist_rcu_mbb_member_cmp();
+        void skiplist_rcu_mbb_member_less();
+        void skiplist_rcu_mbb_member_cmpmix();
+        void skiplist_rcu_mbb_member_cmp_stat();
+        void skiplist_rcu_mbb_member_less_stat();
+        void skiplist_rcu_mbb_member_cmpmix_stat();
+        void skiplist_rcu_mbb_member_cmp_xorshift();
+        void skiplist_rcu_mbb_member_less_xorshift();
+        void skiplist_rcu_mbb_member_cmpmix_xorshift();
+        void skiplist_rcu_mbb_member_cmp_xorshift_stat();
+        void skiplist_rcu_mbb_member_less_xorshift_stat();
+        void skiplist_rcu_mbb_member_cmpmix_xorshift_stat();
+        void skiplist_rcu_mbb_member_cmp_pascal();
+        void skiplist_rcu_mbb_member_less_pascal();
+        void skiplist_rcu_mbb_member_cmpmix_pascal();
+        void skiplist_rcu_mbb_member_cmp_pascal_stat();
+        void skiplist_rcu_mbb_member_less_pascal_stat();
+        void skiplist_rcu_mbb_member_cmpmix_pascal_stat();
+
+        // membarrier_threaded
+        void skiplist_rcu_mbt_base_cmp();
+        void skiplist_rcu_mbt_base_less();
+        void skiplist_rcu_mbt_base_cmpmix();
+        void skiplist_rcu_mbt_base_cmp_stat();
+        void skiplist_rcu_mbt_base_less_stat();
+        void skiplist_rcu_mbt_base_cmpmix_stat();
+        void skiplist_rcu_mbt_base_cmp_xorshift();
+        void skiplist_rcu_mbt_base_less_xorshift();
+        void skiplist_rcu_mbt_base_cmpmix_xorshift();
+        void skiplist_rcu_mbt_base_cmp_xorshift_stat();
+        void skiplist_rcu_mbt_base_less_xorshift_stat();
+        void skiplist_rcu_mbt_base_cmpmix_xorshift_stat();
+        void skiplist_rcu_mbt_base_cmp_pascal();
+        void skiplist_rcu_mbt_base_less_pascal();
+        void skiplist_rcu_mbt_base_cmpmix_pascal();
+        void skiplist_rcu_mbt_base_cmp_pascal_stat();
+        void skiplist_rcu_mbt_base_less_pascal_stat();
+        void skiplist_rcu_mbt_base_cmpmix_pascal_stat();
+
+        void skiplist_rcu_mbt_member_cmp();
+        void skiplist_rcu_mbt_member_less();
+        void skiplist_rcu_mbt_member_cmpmix();
+        void skiplist_rcu_mbt_member_cmp_stat();
+        void skiplist_rcu_mbt_member_less_stat();
+        void skiplist_rcu_mbt_member_cmpmix_stat();
+        void skiplist_rcu_mbt_member_cmp_xorshift();
+        void skiplist_rcu_mbt_member_less_xorshift();
+        void skiplist_rcu_mbt_member_cmpmix_xorshift();
+        void skiplist_rcu_mbt_member_cmp_xorshift_stat();
+        void skiplist_rcu_mbt_member_less_xorshift_stat();
+        void skiplist_rcu_mbt_member_cmpmix_xorshift_stat();
+        void skiplist_rcu_mbt_member_cmp_pascal();
+        void skiplist_rcu_mbt_member_less_pascal();
+        void skiplist_rcu_mbt_member_cmpmix_pascal();
+        void skiplist_rcu_mbt_member_cmp_pascal_stat();
+        void skiplist_rcu_mbt_member_less_pascal_stat();
+        void skiplist_rcu_mbt_member_cmpmix_pascal_stat();
+
         CPPUNIT_TEST_SUITE(IntrusiveSkipListSetRCU)
             CPPUNIT_TEST(skiplist_rcu_gpi_base_cmp)
             CPPUNIT_TEST(skiplist_rcu_gpi_base_less)
@@ -817,6 +895,83 @@ namespace set {
             CPPUNIT_TEST(skiplist_rcu_sht_member_less_pascal_stat)
             CPPUNIT_TEST(skiplist_rcu_sht_member_cmpmix_pascal_stat)
 
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_base_cmpmix_pascal_stat)
+
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbb_member_cmpmix_pascal_stat)
+
+            //
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_base_cmpmix_pascal_stat)
+
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_rcu_mbt_member_cmpmix_pascal_stat)
+
         CPPUNIT_TEST_SUITE_END()
     };
 } // namespace set
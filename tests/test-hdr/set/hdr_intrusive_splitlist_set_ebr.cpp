@@ -0,0 +1,452 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_intrusive_set.h"
+#include <cds/intrusive/michael_list_ebr.h>
+#include <cds/intrusive/split_list.h>
+
+namespace set {
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_base_cmp()
+    {
+        typedef base_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<true>
+                ,co::memory_model<co::v::relaxed_ordering>
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_base_less()
+    {
+        typedef base_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::memory_model<co::v::sequential_consistent>
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_base_cmpmix()
+    {
+        typedef base_int_item< ci::split_list::node<ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<true>
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_base_cmpmix_stat()
+    {
+        typedef base_int_item< ci::split_list::node<ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<true>
+                ,co::stat< ci::split_list::stat<> >
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_member_cmp()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_member_less()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::memory_model<co::v::relaxed_ordering>
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_member_cmpmix()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,co::memory_model<co::v::sequential_consistent>
+            >::type
+        > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_dyn_EBR_member_cmpmix_stat()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        struct list_traits : public ci::michael_list::traits
+        {
+            typedef ci::michael_list::member_hook< offsetof( item, hMember ), co::gc<cds::gc::EBR> > hook;
+            typedef cmp<item> compare;
+            typedef IntrusiveHashSetHdrTest::less<item> less;
+            typedef faked_disposer disposer;
+        };
+        typedef ci::MichaelList< cds::gc::EBR, item, list_traits > ord_list;
+
+        struct set_traits : public ci::split_list::traits {
+            typedef hash_int hash;
+            typedef simple_item_counter item_counter;
+            typedef co::v::sequential_consistent memory_model;
+            typedef ci::split_list::stat<> stat;
+        };
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list, set_traits > set;
+        static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
+
+        test_int<set>();
+    }
+
+
+    // Static bucket table
+    void IntrusiveHashSetHdrTest::split_st_EBR_base_cmp()
+    {
+        typedef base_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,co::memory_model<co::v::relaxed_ordering>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_base_less()
+    {
+        typedef base_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,co::memory_model<co::v::sequential_consistent>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_base_cmpmix()
+    {
+        typedef base_int_item< ci::split_list::node<ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<false>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_base_cmpmix_stat()
+    {
+        typedef base_int_item< ci::split_list::node<ci::michael_list::node<cds::gc::EBR> > > item;
+        struct list_traits :
+            public ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< co::gc<cds::gc::EBR> > >
+                ,co::less< less<item> >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        {};
+        typedef ci::MichaelList< cds::gc::EBR, item, list_traits > ord_list;
+
+        struct set_traits :
+            public ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,co::stat< ci::split_list::stat<> >
+            >::type
+        {};
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list, set_traits > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_member_cmp()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,co::memory_model<co::v::relaxed_ordering>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_member_less()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                ci::split_list::dynamic_bucket_table<false>
+                ,co::hash< hash_int >
+                ,co::memory_model<co::v::sequential_consistent>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_member_cmpmix()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<false>
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+    void IntrusiveHashSetHdrTest::split_st_EBR_member_cmpmix_stat()
+    {
+        typedef member_int_item< ci::split_list::node< ci::michael_list::node<cds::gc::EBR> > > item;
+        typedef ci::MichaelList< cds::gc::EBR
+            ,item
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::member_hook<
+                    offsetof( item, hMember ),
+                    co::gc<cds::gc::EBR>
+                > >
+                ,co::compare< cmp<item> >
+                ,co::less< less<item> >
+                ,ci::opt::disposer< faked_disposer >
+            >::type
+        >    ord_list;
+
+        typedef ci::SplitListSet< cds::gc::EBR, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< simple_item_counter >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,co::stat< ci::split_list::stat<> >
+            >::type
+        > set;
+        static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
+
+        test_int<set>();
+    }
+
+
+} // namespace set
@@ -56,6 +56,18 @@ namespace set {
         static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
 
         test_int<set>();
+
+        // dummy nodes are allocated from slabs
+        typedef ci::SplitListSet< cds::gc::HP, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<true>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > slab_set;
+        static_assert( slab_set::traits::dummy_node_slab, "Set has no dummy node slab" );
+
+        test_int<slab_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_base_less()
@@ -79,6 +91,18 @@ namespace set {
         static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
 
         test_int<set>();
+
+        // bucket table without capacity limit
+        typedef ci::SplitListSet< cds::gc::HP, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::unbounded_bucket_table<true>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > unbounded_set;
+        static_assert( unbounded_set::traits::unbounded_bucket_table, "Set has bounded bucket table" );
+
+        test_int<unbounded_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_base_cmpmix()
@@ -258,6 +282,18 @@ namespace set {
         static_assert( !set::traits::dynamic_bucket_table, "Set has dynamic bucket table" );
 
         test_int<set>();
+
+        // dummy nodes are allocated from slabs
+        typedef ci::SplitListSet< cds::gc::HP, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<false>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > slab_set;
+        static_assert( slab_set::traits::dummy_node_slab, "Set has no dummy node slab" );
+
+        test_int<slab_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_base_less()
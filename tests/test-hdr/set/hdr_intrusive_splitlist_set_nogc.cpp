@@ -55,6 +55,18 @@ namespace set {
         > set;
 
         test_int_nogc<set>();
+
+        // dummy nodes are allocated from slabs
+        typedef ci::SplitListSet< cds::gc::nogc, bucket_type,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<true>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > slab_set;
+        static_assert( slab_set::traits::dummy_node_slab, "Set has no dummy node slab" );
+
+        test_int_nogc<slab_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_nogc_base_less()
@@ -78,6 +90,18 @@ namespace set {
         > set;
 
         test_int_nogc<set>();
+
+        // bucket table without capacity limit
+        typedef ci::SplitListSet< cds::gc::nogc, bucket_type,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::unbounded_bucket_table<true>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > unbounded_set;
+        static_assert( unbounded_set::traits::unbounded_bucket_table, "Set has bounded bucket table" );
+
+        test_int_nogc<unbounded_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_nogc_base_cmpmix()
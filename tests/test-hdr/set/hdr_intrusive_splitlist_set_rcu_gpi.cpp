@@ -60,6 +60,18 @@ namespace set {
         static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
 
         test_rcu_int_michael_list<set>();
+
+        // dummy nodes are allocated from slabs
+        typedef ci::SplitListSet< rcu_type, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::dynamic_bucket_table<true>
+                ,ci::split_list::dummy_node_slab<true>
+            >::type
+        > slab_set;
+        static_assert( slab_set::traits::dummy_node_slab, "Set has no dummy node slab" );
+
+        test_rcu_int_michael_list<slab_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_RCU_GPI_base_less()
@@ -83,6 +95,17 @@ namespace set {
         static_assert( set::traits::dynamic_bucket_table, "Set has static bucket table" );
 
         test_rcu_int_michael_list<set>();
+
+        // bucket table without capacity limit
+        typedef ci::SplitListSet< rcu_type, ord_list,
+            ci::split_list::make_traits<
+                co::hash< hash_int >
+                ,ci::split_list::unbounded_bucket_table<true>
+            >::type
+        > unbounded_set;
+        static_assert( unbounded_set::traits::unbounded_bucket_table, "Set has bounded bucket table" );
+
+        test_rcu_int_michael_list<unbounded_set>();
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_RCU_GPI_base_cmpmix()
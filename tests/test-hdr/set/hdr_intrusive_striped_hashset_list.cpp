@@ -210,6 +210,41 @@ namespace set {
         test_with( s );
     }
 
+    void IntrusiveStripedSetHdrTest::Striped_list_basehook_incremental()
+    {
+        typedef ci::StripedSet<
+            bi::list<base_item_type>
+            ,co::hash< IntrusiveStripedSetHdrTest::hash_int >
+            ,co::less< IntrusiveStripedSetHdrTest::less<base_item_type> >
+            ,co::compare< IntrusiveStripedSetHdrTest::cmp<base_item_type> >
+            ,co::resizing_policy< ci::striped_set::load_factor_resizing<2> >
+            ,ci::striped_set::incremental_resize< true >
+        > set_type;
+
+        static_assert( set_type::c_bIncrementalResize, "incremental_resize option error" );
+
+        test<set_type>();
+    }
+
+    void IntrusiveStripedSetHdrTest::Striped_list_memberhook_bucket_threshold_incremental()
+    {
+        typedef ci::StripedSet<
+            bi::list<
+            member_item_type
+            , bi::member_hook< member_item_type, bi::list_member_hook<>, &member_item_type::hMember>
+            >
+            ,co::hash< IntrusiveStripedSetHdrTest::hash_int >
+            ,co::less< IntrusiveStripedSetHdrTest::less<member_item_type> >
+            ,co::mutex_policy< ci::striped_set::striping< cds::sync::spin > >
+            ,co::resizing_policy< ci::striped_set::single_bucket_size_threshold<0> >
+            ,ci::striped_set::incremental_resize< true >
+        > set_type;
+
+        set_type s( 16, ci::striped_set::single_bucket_size_threshold<0>(4) );
+        test_with( s );
+        CPPUNIT_CHECK( s.bucket_count() > 16 );
+    }
+
 } // namespace set
 
 
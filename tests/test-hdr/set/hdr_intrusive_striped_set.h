@@ -561,6 +561,8 @@ namespace set {
         void Striped_list_memberhook_cmpmix();
         void Striped_list_memberhook_bucket_threshold();
         void Striped_list_memberhook_bucket_threshold_rt();
+        void Striped_list_basehook_incremental();
+        void Striped_list_memberhook_bucket_threshold_incremental();
 
         void Striped_slist_basehook_cmp();
         void Striped_slist_basehook_less();
@@ -696,6 +698,8 @@ namespace set {
             CPPUNIT_TEST( Striped_list_memberhook_cmpmix)
             CPPUNIT_TEST( Striped_list_memberhook_bucket_threshold)
             CPPUNIT_TEST( Striped_list_memberhook_bucket_threshold_rt)
+            CPPUNIT_TEST( Striped_list_basehook_incremental)
+            CPPUNIT_TEST( Striped_list_memberhook_bucket_threshold_incremental)
 
             CPPUNIT_TEST( Striped_slist_basehook_cmp)
             CPPUNIT_TEST( Striped_slist_basehook_less)
@@ -0,0 +1,130 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_set.h"
+#include <cds/container/michael_list_ebr.h>
+#include <cds/container/michael_set.h>
+
+namespace set {
+
+    namespace {
+        struct set_traits: public cc::michael_set::traits
+        {
+            typedef HashSetHdrTest::hash_int            hash;
+            typedef HashSetHdrTest::simple_item_counter item_counter;
+        };
+
+        struct EBR_cmp_traits: public cc::michael_list::traits
+        {
+            typedef HashSetHdrTest::cmp<HashSetHdrTest::item>   compare;
+        };
+
+        struct EBR_less_traits: public cc::michael_list::traits
+        {
+            typedef HashSetHdrTest::less<HashSetHdrTest::item>   less;
+        };
+
+        struct EBR_cmpmix_traits: public cc::michael_list::traits
+        {
+            typedef HashSetHdrTest::cmp<HashSetHdrTest::item>   compare;
+            typedef HashSetHdrTest::less<HashSetHdrTest::item>   less;
+        };
+    }
+
+    void HashSetHdrTest::Michael_EBR_cmp()
+    {
+        typedef cc::MichaelList< cds::gc::EBR, item, EBR_cmp_traits > list;
+
+        // traits-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list, set_traits > set;
+        test_int< set >();
+
+        // option-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+            >::type
+        > opt_set;
+        test_int< opt_set >();
+
+        // expandable bucket table
+        typedef cc::MichaelHashSet< cds::gc::EBR, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::michael_set::dynamic_bucket_table< true >
+                ,cc::opt::stat< cc::michael_set::stat<> >
+            >::type
+        > dyn_set;
+        test_int< dyn_set >();
+        test_expandable< dyn_set >();
+        test_expandable_clear< dyn_set >();
+        test_batch< set >();
+        test_batch< dyn_set >();
+    }
+
+    void HashSetHdrTest::Michael_EBR_less()
+    {
+        typedef cc::MichaelList< cds::gc::EBR, item, EBR_less_traits > list;
+
+        // traits-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list, set_traits > set;
+        test_int< set >();
+
+        // option-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+            >::type
+        > opt_set;
+        test_int< opt_set >();
+    }
+
+    void HashSetHdrTest::Michael_EBR_cmpmix()
+    {
+        typedef cc::MichaelList< cds::gc::EBR, item, EBR_cmpmix_traits > list;
+
+        // traits-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list, set_traits > set;
+        test_int< set >();
+
+        // option-based version
+        typedef cc::MichaelHashSet< cds::gc::EBR, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+            >::type
+        > opt_set;
+        test_int< opt_set >();
+    }
+
+
+} // namespace set
@@ -74,6 +74,20 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+
+        // expandable bucket table
+        typedef cc::MichaelHashSet< cds::gc::HP, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::michael_set::dynamic_bucket_table< true >
+                ,cc::opt::stat< cc::michael_set::stat<> >
+            >::type
+        > dyn_set;
+        test_int< dyn_set >();
+        test_expandable< dyn_set >();
+        test_expandable_clear< dyn_set >();
+        test_batch< set >();
+        test_batch< dyn_set >();
     }
 
     void HashSetHdrTest::Michael_HP_less()
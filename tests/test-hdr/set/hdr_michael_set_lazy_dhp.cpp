@@ -74,6 +74,18 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+
+        // expandable bucket table
+        typedef cc::MichaelHashSet< cds::gc::DHP, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::michael_set::dynamic_bucket_table< true >
+                ,cc::opt::stat< cc::michael_set::stat<> >
+            >::type
+        > dyn_set;
+        test_int< dyn_set >();
+        test_expandable< dyn_set >();
+        test_expandable_clear< dyn_set >();
     }
 
     void HashSetHdrTest::Lazy_DHP_less()
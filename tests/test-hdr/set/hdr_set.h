@@ -36,7 +36,9 @@
 
 #include <cds/opt/hash.h>
 #include <cds/os/timer.h>
+#include <cds/threading/model.h>
 #include <functional>   // ref
+#include <thread>
 
 // forward namespace declaration
 namespace cds {
@@ -441,6 +443,144 @@ namespace set {
             test_iter<Set>();
         }
 
+        template <class Set>
+        void test_expandable()
+        {
+            Set s( 4, 2 );
+            size_t const nInitBucketCount = s.bucket_count();
+
+            static int const nLimit = 1000;
+            int arr[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arr[i] = i;
+            shuffle( arr, arr + nLimit );
+
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( s.insert( arr[i] ));
+            CPPUNIT_CHECK( check_size( s, nLimit ));
+            CPPUNIT_CHECK( s.bucket_count() > nInitBucketCount );
+            CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() > 0 );
+
+            for ( int i = 0; i < nLimit; ++i ) {
+                CPPUNIT_CHECK( s.contains( i ));
+                CPPUNIT_CHECK( s.find( i, []( item& i, int key ) { CPPUNIT_ASSERT_CURRENT( i.nKey == key ); } ));
+            }
+            CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() == s.statistics().m_nResizeComplete.get() );
+
+            // All buckets are migrated, the iterator visits each item
+            int nCount = 0;
+            for ( typename Set::iterator it = s.begin(); it != s.end(); ++it )
+                ++nCount;
+            CPPUNIT_CHECK( nCount == nLimit );
+
+            // Right after growth some buckets are not migrated yet, the iterator must visit their items too
+            {
+                Set s2( 16, 1 );
+                for ( int i = 0; i < nLimit; ++i )
+                    CPPUNIT_ASSERT( s2.insert( arr[i] ));
+                CPPUNIT_CHECK( s2.statistics().m_nResizeStart.get() > 0 );
+
+                int nIterCount = 0;
+                for ( typename Set::iterator it = s2.begin(); it != s2.end(); ++it )
+                    ++nIterCount;
+                CPPUNIT_CHECK_EX( nIterCount == nLimit, "iterated " << nIterCount << " of " << nLimit );
+                CPPUNIT_CHECK( check_size( s2, nLimit ));
+            }
+
+            for ( int i = 0; i < nLimit; i += 2 )
+                CPPUNIT_ASSERT( s.erase( i ));
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( s.contains( i ) == ( i % 2 != 0 ));
+            CPPUNIT_CHECK( check_size( s, nLimit / 2 ));
+
+            s.clear();
+            CPPUNIT_CHECK( s.empty() );
+            CPPUNIT_CHECK( check_size( s, 0 ));
+        }
+
+        // clear() runs concurrently with the bucket migration
+        template <class Set>
+        void test_expandable_clear()
+        {
+            Set s( 4, 2 );
+
+            static int const nLimit = 10000;
+            static int const nPassCount = 20;
+            for ( int nPass = 0; nPass < nPassCount; ++nPass ) {
+                std::thread inserter( [&s]() {
+                    cds::threading::Manager::attachThread();
+                    for ( int i = 0; i < nLimit; ++i )
+                        s.insert( i );
+                    cds::threading::Manager::detachThread();
+                });
+                for ( int i = 0; i < 10; ++i )
+                    s.clear();
+                inserter.join();
+            }
+            CPPUNIT_CHECK( s.statistics().m_nResizeStart.get() > 0 );
+
+            s.clear();
+            CPPUNIT_CHECK( s.empty() );
+            int nCount = 0;
+            for ( typename Set::iterator it = s.begin(); it != s.end(); ++it )
+                ++nCount;
+            CPPUNIT_CHECK( nCount == 0 );
+
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( s.insert( i ));
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( s.contains( i ));
+            CPPUNIT_CHECK( check_size( s, nLimit ));
+        }
+
+        template <class Set>
+        void test_batch()
+        {
+            Set s( 100, 4 );
+
+            static int const nLimit = 1000;
+            int arrKeys[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys[i] = i;
+            shuffle( arrKeys, arrKeys + nLimit );
+            bool arrResult[nLimit * 2];
+
+            CPPUNIT_CHECK( s.insert_batch( arrKeys, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_CHECK( check_size( s, nLimit / 2 ));
+
+            // the first half of the keys is already in the set
+            CPPUNIT_CHECK( s.insert_batch( arrKeys, nLimit, arrResult ) == nLimit - nLimit / 2 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i >= nLimit / 2 ));
+            CPPUNIT_CHECK( check_size( s, nLimit ));
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( s.contains( i ));
+
+            int arrFind[nLimit * 2];
+            for ( int i = 0; i < nLimit * 2; ++i )
+                arrFind[i] = i;
+            CPPUNIT_CHECK( s.find_batch( arrFind, nLimit * 2, arrResult ) == nLimit );
+            for ( int i = 0; i < nLimit * 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] == ( i < nLimit ));
+            CPPUNIT_CHECK( s.find_batch( arrFind + nLimit / 2, nLimit ) == nLimit / 2 );
+
+            int arrErase[nLimit / 2];
+            for ( int i = 0; i < nLimit / 2; ++i )
+                arrErase[i] = i * 2;
+            CPPUNIT_CHECK( s.erase_batch( arrErase, nLimit / 2, arrResult ) == nLimit / 2 );
+            for ( int i = 0; i < nLimit / 2; ++i )
+                CPPUNIT_CHECK( arrResult[i] );
+            CPPUNIT_CHECK( s.erase_batch( arrErase, nLimit / 2 ) == 0 );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_CHECK( s.contains( i ) == ( i % 2 != 0 ));
+            CPPUNIT_CHECK( check_size( s, nLimit / 2 ));
+
+            s.clear();
+            CPPUNIT_CHECK( s.empty() );
+        }
+
         template <class Set>
         void test_int_rcu()
         {
@@ -1139,6 +1279,10 @@ namespace set {
         void Michael_DHP_less();
         void Michael_DHP_cmpmix();
 
+        void Michael_EBR_cmp();
+        void Michael_EBR_less();
+        void Michael_EBR_cmpmix();
+
         void Michael_RCU_GPI_cmp();
         void Michael_RCU_GPI_less();
         void Michael_RCU_GPI_cmpmix();
@@ -1171,6 +1315,10 @@ namespace set {
         void Lazy_DHP_less();
         void Lazy_DHP_cmpmix();
 
+        void Lazy_EBR_cmp();
+        void Lazy_EBR_less();
+        void Lazy_EBR_cmpmix();
+
         void Lazy_RCU_GPI_cmp();
         void Lazy_RCU_GPI_less();
         void Lazy_RCU_GPI_cmpmix();
@@ -1206,6 +1354,11 @@ namespace set {
         void Split_DHP_cmpmix();
         void Split_DHP_cmpmix_stat();
 
+        void Split_EBR_cmp();
+        void Split_EBR_less();
+        void Split_EBR_cmpmix();
+        void Split_EBR_cmpmix_stat();
+
         void Split_RCU_GPI_cmp();
         void Split_RCU_GPI_less();
         void Split_RCU_GPI_cmpmix();
@@ -1247,6 +1400,11 @@ namespace set {
         void Split_Lazy_DHP_cmpmix();
         void Split_Lazy_DHP_cmpmix_stat();
 
+        void Split_Lazy_EBR_cmp();
+        void Split_Lazy_EBR_less();
+        void Split_Lazy_EBR_cmpmix();
+        void Split_Lazy_EBR_cmpmix_stat();
+
         void Split_Lazy_RCU_GPI_cmp();
         void Split_Lazy_RCU_GPI_less();
         void Split_Lazy_RCU_GPI_cmpmix();
@@ -1285,6 +1443,9 @@ namespace set {
             CPPUNIT_TEST(Michael_DHP_cmp)
             CPPUNIT_TEST(Michael_DHP_less)
             CPPUNIT_TEST(Michael_DHP_cmpmix)
+            CPPUNIT_TEST(Michael_EBR_cmp)
+            CPPUNIT_TEST(Michael_EBR_less)
+            CPPUNIT_TEST(Michael_EBR_cmpmix)
 
             CPPUNIT_TEST(Michael_RCU_GPI_cmp)
             CPPUNIT_TEST(Michael_RCU_GPI_less)
@@ -1317,6 +1478,9 @@ namespace set {
             CPPUNIT_TEST(Lazy_DHP_cmp)
             CPPUNIT_TEST(Lazy_DHP_less)
             CPPUNIT_TEST(Lazy_DHP_cmpmix)
+            CPPUNIT_TEST(Lazy_EBR_cmp)
+            CPPUNIT_TEST(Lazy_EBR_less)
+            CPPUNIT_TEST(Lazy_EBR_cmpmix)
 
             CPPUNIT_TEST(Lazy_RCU_GPI_cmp)
             CPPUNIT_TEST(Lazy_RCU_GPI_less)
@@ -1352,6 +1516,10 @@ namespace set {
             CPPUNIT_TEST(Split_DHP_less)
             CPPUNIT_TEST(Split_DHP_cmpmix)
             CPPUNIT_TEST( Split_DHP_cmpmix_stat )
+            CPPUNIT_TEST(Split_EBR_cmp)
+            CPPUNIT_TEST(Split_EBR_less)
+            CPPUNIT_TEST(Split_EBR_cmpmix)
+            CPPUNIT_TEST( Split_EBR_cmpmix_stat )
 
             CPPUNIT_TEST(Split_RCU_GPI_cmp)
             CPPUNIT_TEST(Split_RCU_GPI_less)
@@ -1392,6 +1560,10 @@ namespace set {
             CPPUNIT_TEST(Split_Lazy_DHP_less)
             CPPUNIT_TEST(Split_Lazy_DHP_cmpmix)
             CPPUNIT_TEST( Split_Lazy_DHP_cmpmix_stat )
+            CPPUNIT_TEST(Split_Lazy_EBR_cmp)
+            CPPUNIT_TEST(Split_Lazy_EBR_less)
+            CPPUNIT_TEST(Split_Lazy_EBR_cmpmix)
+            CPPUNIT_TEST( Split_Lazy_EBR_cmpmix_stat )
 
             CPPUNIT_TEST(Split_Lazy_RCU_GPI_cmp)
             CPPUNIT_TEST(Split_Lazy_RCU_GPI_less)
@@ -0,0 +1,396 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_skiplist_set_rcu.h"
+
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/container/skip_list_set_rcu.h>
+
+#include "unit/michael_alloc.h"
+#include "map/print_skiplist_stat.h"
+
+namespace set {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    namespace {
+        typedef cds::urcu::gc< cds::urcu::membarrier_buffered<> > rcu_type;
+    }
+#endif
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_less()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_cmp()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+            co::compare< cmp<item > >
+            ,co::item_counter< simple_item_counter >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_cmpless()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+            co::less< less<item > >
+            ,co::compare< cmp<item > >
+            ,co::item_counter< simple_item_counter >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_less_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_cmp_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_cmpless_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_less()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_cmp()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_cmpless()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_less_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_cmp_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_xorshift_cmpless_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_less()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_cmp()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_cmpless()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_less_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_cmp_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_turbopas_cmpless_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_less()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_cmp()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_cmpless()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_less_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_cmp_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+    void SkipListSetRCUHdrTest::SkipList_RCU_MBB_michaelalloc_cmpless_stat()
+    {
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef cc::SkipListSet< rcu_type, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set;
+        test< set, misc::print_skiplist_stat<set::stat> >();
+#endif
+    }
+
+} // namespace set
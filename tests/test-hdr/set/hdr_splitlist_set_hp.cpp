@@ -105,6 +105,25 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+        test_batch< set >();
+        test_batch< opt_set >();
+
+        // bucket table without capacity limit
+        typedef cc::SplitListSet< cds::gc::HP, item,
+            cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::split_list::unbounded_bucket_table< true >
+                ,cc::split_list::ordered_list_traits<
+                    cc::michael_list::make_traits<
+                        cc::opt::compare< cmp<item> >
+                    >::type
+                >
+            >::type
+        > unbounded_set;
+        test_int< unbounded_set >();
+        test_batch< unbounded_set >();
     }
 
     void HashSetHdrTest::Split_HP_less()
@@ -130,6 +149,22 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+
+        // dummy nodes are allocated from slabs
+        typedef cc::SplitListSet< cds::gc::HP, item,
+            cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::split_list::dummy_node_slab< true >
+                ,cc::split_list::ordered_list_traits<
+                    cc::michael_list::make_traits<
+                        cc::opt::less< less<item> >
+                    >::type
+                >
+            >::type
+        > slab_set;
+        test_int< slab_set >();
     }
 
     void HashSetHdrTest::Split_HP_cmpmix()
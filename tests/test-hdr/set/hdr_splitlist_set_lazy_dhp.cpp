@@ -105,6 +105,8 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+        test_batch< set >();
+        test_batch< opt_set >();
     }
 
     void HashSetHdrTest::Split_Lazy_DHP_less()
@@ -130,6 +132,23 @@ namespace set {
             >::type
         > opt_set;
         test_int< opt_set >();
+
+        // dummy nodes are allocated from slabs
+        typedef cc::SplitListSet< cds::gc::DHP, item,
+            cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,cc::split_list::dummy_node_slab< true >
+                ,cc::split_list::ordered_list_traits<
+                    cc::lazy_list::make_traits<
+                        cc::opt::less< less<item> >
+                    >::type
+                >
+            >::type
+        > slab_set;
+        test_int< slab_set >();
     }
 
     void HashSetHdrTest::Split_Lazy_DHP_cmpmix()
@@ -124,6 +124,29 @@ namespace set {
         >   set_less_resizing_sbt6;
         test_striped2< set_less_resizing_sbt6 >();
 
+        // Incremental resizing
+        CPPUNIT_MESSAGE( "incremental_resize, load_factor_resizing<2>");
+        typedef cc::StripedSet< sequence_t
+            , co::hash< hash_int >
+            , co::less< less<item> >
+            , co::resizing_policy< cc::striped_set::load_factor_resizing<2> >
+            , cc::striped_set::incremental_resize< true >
+        >   set_less_incremental_lf;
+        test_striped2< set_less_incremental_lf >();
+
+        CPPUNIT_MESSAGE( "incremental_resize, single_bucket_size_threshold<0>(4)");
+        {
+            typedef cc::StripedSet< sequence_t
+                , co::hash< hash_int >
+                , co::less< less<item> >
+                , co::mutex_policy< cc::striped_set::striping< cds::sync::spin> >
+                , co::resizing_policy< cc::striped_set::single_bucket_size_threshold<0> >
+                , cc::striped_set::incremental_resize< true >
+            >   set_less_incremental_sbt;
+            set_less_incremental_sbt s( 16, cc::striped_set::single_bucket_size_threshold<0>(4) );
+            test_striped_with(s);
+        }
+
         // Copy policy
         CPPUNIT_MESSAGE( "copy_item");
         typedef cc::StripedSet< sequence_t
@@ -500,6 +500,43 @@ namespace tree {
                 CPPUNIT_CHECK_EX( xp->nVal == keys[i] * c_nStep, "Expected value=" << keys[i] * c_nStep << " real=" << xp->nVal );
             }
             CPPUNIT_ASSERT(s.empty());
+
+            // for_each_in_range, count_in_range
+            for ( int i = 0; i < static_cast<int>(sizeof(keys) / sizeof(keys[0])); ++i )
+                CPPUNIT_ASSERT( s.emplace( keys[i], keys[i] * c_nStep ));
+            CPPUNIT_CHECK( s.check_consistency( check_functor() ));
+
+            keyPrev = 99;
+            nCount = s.for_each_in_range( 100, 199, [this, &keyPrev]( key_type const& k, value_type& v ) {
+                CPPUNIT_CHECK_EX( k == keyPrev + 1, "Expected=" << keyPrev + 1 << " real=" << k );
+                CPPUNIT_CHECK_EX( v.nVal == k * c_nStep, "Expected value=" << k * c_nStep << " real=" << v.nVal );
+                keyPrev = k;
+            });
+            CPPUNIT_CHECK_EX( nCount == 100, "count=" << nCount );
+            CPPUNIT_CHECK_EX( keyPrev == 199, "last key=" << keyPrev );
+
+            nCount = s.for_each_in_range_with( wrapped_int( 990 ), wrapped_int( 5000 ), wrapped_less(),
+                [this]( key_type const& k, value_type& ) { CPPUNIT_CHECK( k >= 990 ); } );
+            CPPUNIT_CHECK_EX( nCount == 10, "count=" << nCount );
+
+            CPPUNIT_CHECK( s.count_in_range( -10, 9 ) == 10 );
+            CPPUNIT_CHECK( s.count_in_range( 0, 999 ) == sizeof(keys) / sizeof(keys[0]) );
+            CPPUNIT_CHECK( s.count_in_range( 500, 400 ) == 0 );
+            CPPUNIT_CHECK( s.count_in_range( 1000, 2000 ) == 0 );
+            CPPUNIT_CHECK( s.count_in_range_with( wrapped_int( 10 ), wrapped_int( 19 ), wrapped_less()) == 10 );
+
+            // erase odd keys, the tree has routing nodes now
+            for ( int i = 1; i < static_cast<int>(sizeof(keys) / sizeof(keys[0])); i += 2 )
+                CPPUNIT_ASSERT( s.erase( i ));
+            CPPUNIT_CHECK( s.count_in_range( 0, 999 ) == sizeof(keys) / sizeof(keys[0]) / 2 );
+            keyPrev = -2;
+            nCount = s.for_each_in_range( 0, 999, [this, &keyPrev]( key_type const& k, value_type& ) {
+                CPPUNIT_CHECK_EX( k == keyPrev + 2, "Expected=" << keyPrev + 2 << " real=" << k );
+                keyPrev = k;
+            });
+            CPPUNIT_CHECK( nCount == sizeof(keys) / sizeof(keys[0]) / 2 );
+            s.clear();
+            CPPUNIT_ASSERT(s.empty());
         }
 
         template <class Set, class PrintStat>
@@ -608,6 +645,42 @@ namespace tree {
         void BronsonAVLTree_rcu_sht_pool_monitor_less_relaxed_insert();
         void BronsonAVLTree_rcu_sht_pool_monitor_less_relaxed_insert_stat();
 
+        void BronsonAVLTree_rcu_mbb_less();
+        void BronsonAVLTree_rcu_mbb_less_stat();
+        void BronsonAVLTree_rcu_mbb_cmp();
+        void BronsonAVLTree_rcu_mbb_cmp_stat();
+        void BronsonAVLTree_rcu_mbb_cmpless();
+        void BronsonAVLTree_rcu_mbb_less_ic();
+        void BronsonAVLTree_rcu_mbb_cmp_ic();
+        void BronsonAVLTree_rcu_mbb_cmp_ic_stat();
+        void BronsonAVLTree_rcu_mbb_cmp_ic_stat_yield();
+        void BronsonAVLTree_rcu_mbb_less_relaxed_insert();
+        void BronsonAVLTree_rcu_mbb_less_relaxed_insert_stat();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_less();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_less_stat();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_cmp_ic_stat();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_cmp_ic_stat_yield();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_less_relaxed_insert();
+        void BronsonAVLTree_rcu_mbb_pool_monitor_less_relaxed_insert_stat();
+
+        void BronsonAVLTree_rcu_mbt_less();
+        void BronsonAVLTree_rcu_mbt_less_stat();
+        void BronsonAVLTree_rcu_mbt_cmp();
+        void BronsonAVLTree_rcu_mbt_cmp_stat();
+        void BronsonAVLTree_rcu_mbt_cmpless();
+        void BronsonAVLTree_rcu_mbt_less_ic();
+        void BronsonAVLTree_rcu_mbt_cmp_ic();
+        void BronsonAVLTree_rcu_mbt_cmp_ic_stat();
+        void BronsonAVLTree_rcu_mbt_cmp_ic_stat_yield();
+        void BronsonAVLTree_rcu_mbt_less_relaxed_insert();
+        void BronsonAVLTree_rcu_mbt_less_relaxed_insert_stat();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_less();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_less_stat();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_cmp_ic_stat();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_cmp_ic_stat_yield();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_less_relaxed_insert();
+        void BronsonAVLTree_rcu_mbt_pool_monitor_less_relaxed_insert_stat();
+
         CPPUNIT_TEST_SUITE( BronsonAVLTreeHdrTest )
             CPPUNIT_TEST( BronsonAVLTree_rcu_gpi_less )
             CPPUNIT_TEST( BronsonAVLTree_rcu_gpi_less_stat )
@@ -699,6 +772,42 @@ namespace tree {
             CPPUNIT_TEST( BronsonAVLTree_rcu_sht_pool_monitor_less_relaxed_insert )
             CPPUNIT_TEST( BronsonAVLTree_rcu_sht_pool_monitor_less_relaxed_insert_stat )
 
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_less )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_less_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmp )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmp_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmpless )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_less_ic )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmp_ic )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmp_ic_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_cmp_ic_stat_yield )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_less_relaxed_insert )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_less_relaxed_insert_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_less )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_less_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_cmp_ic_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_cmp_ic_stat_yield )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_less_relaxed_insert )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbb_pool_monitor_less_relaxed_insert_stat )
+
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_less )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_less_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmp )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmp_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmpless )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_less_ic )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmp_ic )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmp_ic_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_cmp_ic_stat_yield )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_less_relaxed_insert )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_less_relaxed_insert_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_less )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_less_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_cmp_ic_stat )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_cmp_ic_stat_yield )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_less_relaxed_insert )
+            CPPUNIT_TEST( BronsonAVLTree_rcu_mbt_pool_monitor_less_relaxed_insert_stat )
+
         CPPUNIT_TEST_SUITE_END()
     };
 } // namespace tree
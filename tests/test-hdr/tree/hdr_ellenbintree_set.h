@@ -715,6 +715,17 @@ namespace tree {
         void EllenBinTree_dhp_less_pool();
         void EllenBinTree_dhp_less_pool_ic_stat();
 
+        void EllenBinTree_ebr_less();
+        void EllenBinTree_ebr_cmp();
+        void EllenBinTree_ebr_cmpless();
+        void EllenBinTree_ebr_less_ic();
+        void EllenBinTree_ebr_cmp_ic();
+        void EllenBinTree_ebr_less_stat();
+        void EllenBinTree_ebr_cmp_ic_stat();
+        void EllenBinTree_ebr_cmp_ic_stat_yield();
+        void EllenBinTree_ebr_less_pool();
+        void EllenBinTree_ebr_less_pool_ic_stat();
+
         void EllenBinTree_rcu_gpi_less();
         void EllenBinTree_rcu_gpi_cmp();
         void EllenBinTree_rcu_gpi_cmpless();
@@ -770,6 +781,28 @@ namespace tree {
         void EllenBinTree_rcu_sht_less_pool();
         void EllenBinTree_rcu_sht_less_pool_ic_stat();
 
+        void EllenBinTree_rcu_mbb_less();
+        void EllenBinTree_rcu_mbb_cmp();
+        void EllenBinTree_rcu_mbb_cmpless();
+        void EllenBinTree_rcu_mbb_less_ic();
+        void EllenBinTree_rcu_mbb_cmp_ic();
+        void EllenBinTree_rcu_mbb_less_stat();
+        void EllenBinTree_rcu_mbb_cmp_ic_stat();
+        void EllenBinTree_rcu_mbb_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbb_less_pool();
+        void EllenBinTree_rcu_mbb_less_pool_ic_stat();
+
+        void EllenBinTree_rcu_mbt_less();
+        void EllenBinTree_rcu_mbt_cmp();
+        void EllenBinTree_rcu_mbt_cmpless();
+        void EllenBinTree_rcu_mbt_less_ic();
+        void EllenBinTree_rcu_mbt_cmp_ic();
+        void EllenBinTree_rcu_mbt_less_stat();
+        void EllenBinTree_rcu_mbt_cmp_ic_stat();
+        void EllenBinTree_rcu_mbt_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbt_less_pool();
+        void EllenBinTree_rcu_mbt_less_pool_ic_stat();
+
         CPPUNIT_TEST_SUITE(EllenBinTreeSetHdrTest)
             CPPUNIT_TEST(EllenBinTree_hp_less)
             CPPUNIT_TEST(EllenBinTree_hp_cmp)
@@ -792,6 +825,16 @@ namespace tree {
             CPPUNIT_TEST( EllenBinTree_dhp_cmp_ic_stat_yield )
             CPPUNIT_TEST( EllenBinTree_dhp_less_pool )
             CPPUNIT_TEST(EllenBinTree_dhp_less_pool_ic_stat)
+            CPPUNIT_TEST(EllenBinTree_ebr_less)
+            CPPUNIT_TEST(EllenBinTree_ebr_cmp)
+            CPPUNIT_TEST(EllenBinTree_ebr_less_stat)
+            CPPUNIT_TEST(EllenBinTree_ebr_cmpless)
+            CPPUNIT_TEST(EllenBinTree_ebr_less_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_ebr_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_ebr_less_pool )
+            CPPUNIT_TEST(EllenBinTree_ebr_less_pool_ic_stat)
 
             CPPUNIT_TEST(EllenBinTree_rcu_gpi_less)
             CPPUNIT_TEST(EllenBinTree_rcu_gpi_cmp)
@@ -848,6 +891,28 @@ namespace tree {
             CPPUNIT_TEST( EllenBinTree_rcu_sht_less_pool )
             CPPUNIT_TEST(EllenBinTree_rcu_sht_less_pool_ic_stat)
 
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_less_pool_ic_stat)
+
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_less_pool_ic_stat)
+
         CPPUNIT_TEST_SUITE_END()
     };
 } // namespace tree
@@ -1009,6 +1009,28 @@ namespace tree {
         void EllenBinTree_dhp_member_less_pool();
         void EllenBinTree_dhp_member_less_pool_ic_stat();
 
+        void EllenBinTree_ebr_base_less();
+        void EllenBinTree_ebr_base_cmp();
+        void EllenBinTree_ebr_base_cmpless();
+        void EllenBinTree_ebr_base_less_ic();
+        void EllenBinTree_ebr_base_cmp_ic();
+        void EllenBinTree_ebr_base_less_stat();
+        void EllenBinTree_ebr_base_cmp_ic_stat();
+        void EllenBinTree_ebr_base_cmp_ic_stat_yield();
+        void EllenBinTree_ebr_base_less_pool();
+        void EllenBinTree_ebr_base_less_pool_ic_stat();
+
+        void EllenBinTree_ebr_member_less();
+        void EllenBinTree_ebr_member_cmp();
+        void EllenBinTree_ebr_member_cmpless();
+        void EllenBinTree_ebr_member_less_ic();
+        void EllenBinTree_ebr_member_cmp_ic();
+        void EllenBinTree_ebr_member_less_stat();
+        void EllenBinTree_ebr_member_cmp_ic_stat();
+        void EllenBinTree_ebr_member_cmp_ic_stat_yield();
+        void EllenBinTree_ebr_member_less_pool();
+        void EllenBinTree_ebr_member_less_pool_ic_stat();
+
         void EllenBinTree_rcu_gpi_base_less();
         void EllenBinTree_rcu_gpi_base_cmp();
         void EllenBinTree_rcu_gpi_base_cmpless();
@@ -1119,6 +1141,50 @@ namespace tree {
         void EllenBinTree_rcu_sht_member_less_pool();
         void EllenBinTree_rcu_sht_member_less_pool_ic_stat();
 
+        void EllenBinTree_rcu_mbb_base_less();
+        void EllenBinTree_rcu_mbb_base_cmp();
+        void EllenBinTree_rcu_mbb_base_cmpless();
+        void EllenBinTree_rcu_mbb_base_less_ic();
+        void EllenBinTree_rcu_mbb_base_cmp_ic();
+        void EllenBinTree_rcu_mbb_base_less_stat();
+        void EllenBinTree_rcu_mbb_base_cmp_ic_stat();
+        void EllenBinTree_rcu_mbb_base_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbb_base_less_pool();
+        void EllenBinTree_rcu_mbb_base_less_pool_ic_stat();
+
+        void EllenBinTree_rcu_mbb_member_less();
+        void EllenBinTree_rcu_mbb_member_cmp();
+        void EllenBinTree_rcu_mbb_member_cmpless();
+        void EllenBinTree_rcu_mbb_member_less_ic();
+        void EllenBinTree_rcu_mbb_member_cmp_ic();
+        void EllenBinTree_rcu_mbb_member_less_stat();
+        void EllenBinTree_rcu_mbb_member_cmp_ic_stat();
+        void EllenBinTree_rcu_mbb_member_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbb_member_less_pool();
+        void EllenBinTree_rcu_mbb_member_less_pool_ic_stat();
+
+        void EllenBinTree_rcu_mbt_base_less();
+        void EllenBinTree_rcu_mbt_base_cmp();
+        void EllenBinTree_rcu_mbt_base_cmpless();
+        void EllenBinTree_rcu_mbt_base_less_ic();
+        void EllenBinTree_rcu_mbt_base_cmp_ic();
+        void EllenBinTree_rcu_mbt_base_less_stat();
+        void EllenBinTree_rcu_mbt_base_cmp_ic_stat();
+        void EllenBinTree_rcu_mbt_base_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbt_base_less_pool();
+        void EllenBinTree_rcu_mbt_base_less_pool_ic_stat();
+
+        void EllenBinTree_rcu_mbt_member_less();
+        void EllenBinTree_rcu_mbt_member_cmp();
+        void EllenBinTree_rcu_mbt_member_cmpless();
+        void EllenBinTree_rcu_mbt_member_less_ic();
+        void EllenBinTree_rcu_mbt_member_cmp_ic();
+        void EllenBinTree_rcu_mbt_member_less_stat();
+        void EllenBinTree_rcu_mbt_member_cmp_ic_stat();
+        void EllenBinTree_rcu_mbt_member_cmp_ic_stat_yield();
+        void EllenBinTree_rcu_mbt_member_less_pool();
+        void EllenBinTree_rcu_mbt_member_less_pool_ic_stat();
+
         CPPUNIT_TEST_SUITE(IntrusiveBinTreeHdrTest)
             CPPUNIT_TEST(EllenBinTree_hp_base_less)
             CPPUNIT_TEST(EllenBinTree_hp_base_cmp)
@@ -1164,6 +1230,28 @@ namespace tree {
             CPPUNIT_TEST( EllenBinTree_dhp_member_less_pool )
             CPPUNIT_TEST(EllenBinTree_dhp_member_less_pool_ic_stat)
 
+            CPPUNIT_TEST(EllenBinTree_ebr_base_less)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_cmp)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_less_stat)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_cmpless)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_less_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_base_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_ebr_base_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_ebr_base_less_pool )
+            CPPUNIT_TEST(EllenBinTree_ebr_base_less_pool_ic_stat)
+
+            CPPUNIT_TEST(EllenBinTree_ebr_member_less)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_cmp)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_less_stat)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_cmpless)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_less_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_ebr_member_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_ebr_member_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_ebr_member_less_pool )
+            CPPUNIT_TEST(EllenBinTree_ebr_member_less_pool_ic_stat)
+
             CPPUNIT_TEST(EllenBinTree_rcu_gpi_base_less)
             CPPUNIT_TEST(EllenBinTree_rcu_gpi_base_cmp)
             CPPUNIT_TEST(EllenBinTree_rcu_gpi_base_less_stat)
@@ -1274,6 +1362,50 @@ namespace tree {
             CPPUNIT_TEST( EllenBinTree_rcu_sht_member_less_pool )
             CPPUNIT_TEST(EllenBinTree_rcu_sht_member_less_pool_ic_stat)
 
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_base_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_base_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_base_less_pool_ic_stat)
+
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_member_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbb_member_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbb_member_less_pool_ic_stat)
+
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_base_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_base_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_base_less_pool_ic_stat)
+
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_less)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_cmp)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_less_stat)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_cmpless)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_less_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_cmp_ic)
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_cmp_ic_stat)
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_member_cmp_ic_stat_yield )
+            CPPUNIT_TEST( EllenBinTree_rcu_mbt_member_less_pool )
+            CPPUNIT_TEST(EllenBinTree_rcu_mbt_member_less_pool_ic_stat)
+
         CPPUNIT_TEST_SUITE_END()
     };
 } // namespace tree
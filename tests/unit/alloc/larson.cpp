@@ -206,6 +206,12 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<int> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<int> )
+        TEST_ALLOC_STAT( michael_heap_lockfree_stat, MichaelHeap_LockFreeStat<int> )
+        TEST_ALLOC_STAT( michael_heap_thread_cache_stat, MichaelHeap_ThreadCacheStat<int> )
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+        TEST_ALLOC_STAT( michael_heap_mmap_stat, MichaelHeap_MmapStat<int> )
+#endif
+        TEST_ALLOC_STAT( michael_heap_numa_stat, MichaelHeap_NumaStat<int> )
         TEST_ALLOC( std_alloc,              std_allocator<int> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -215,6 +221,12 @@ namespace memory {
         CPPUNIT_TEST_SUITE( Larson )
             CPPUNIT_TEST( michael_heap_stat )
             CPPUNIT_TEST( michael_heap_nostat )
+            CPPUNIT_TEST( michael_heap_lockfree_stat )
+            CPPUNIT_TEST( michael_heap_thread_cache_stat )
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+            CPPUNIT_TEST( michael_heap_mmap_stat )
+#endif
+            CPPUNIT_TEST( michael_heap_numa_stat )
             CPPUNIT_TEST( std_alloc )
 
             CPPUNIT_TEST( system_aligned_alloc )
@@ -162,6 +162,11 @@ namespace memory {
 
         TEST_ALLOC_STAT( michael_heap_stat,      MichaelHeap_Stat<char> )
         TEST_ALLOC( michael_heap_nostat,    MichaelHeap_NoStat<char> )
+        TEST_ALLOC_STAT( michael_heap_lockfree_stat, MichaelHeap_LockFreeStat<char> )
+        TEST_ALLOC_STAT( michael_heap_thread_cache_stat, MichaelHeap_ThreadCacheStat<char> )
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+        TEST_ALLOC_STAT( michael_heap_mmap_stat, MichaelHeap_MmapStat<char> )
+#endif
         TEST_ALLOC( std_alloc,              std_allocator<char> )
 
         TEST_ALLOC_STAT( michael_alignheap_stat,     t_MichaelAlignHeap_Stat )
@@ -170,6 +175,11 @@ namespace memory {
 
         CPPUNIT_TEST_SUITE( Linux_Scale )
             CPPUNIT_TEST( michael_heap_nostat )
+            CPPUNIT_TEST( michael_heap_lockfree_stat )
+            CPPUNIT_TEST( michael_heap_thread_cache_stat )
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+            CPPUNIT_TEST( michael_heap_mmap_stat )
+#endif
             CPPUNIT_TEST( michael_heap_stat )
             CPPUNIT_TEST( std_alloc )
 
@@ -33,4 +33,10 @@
 namespace memory {
     t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    t_MichaelHeap_NumaStat s_MichaelHeap_NumaStat;
+    t_MichaelHeap_LockFreeStat s_MichaelHeap_LockFreeStat;
+    t_MichaelHeap_ThreadCacheStat s_MichaelHeap_ThreadCacheStat;
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+    t_MichaelHeap_MmapStat s_MichaelHeap_MmapStat;
+#endif
 }
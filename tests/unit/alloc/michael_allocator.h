@@ -46,10 +46,47 @@ namespace memory {
         ma::opt::check_bounds<ma::debug_bound_checking>
     >  t_MichaelHeap_Stat;
 
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::numa_binding<true>
+    >  t_MichaelHeap_NumaStat;
+
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::free_list<ma::free_list_lockfree<> >,
+        ma::opt::partial_list<ma::partial_list_lockfree<> >
+    >  t_MichaelHeap_LockFreeStat;
+
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::thread_cache<32>
+    >  t_MichaelHeap_ThreadCacheStat;
+
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+    typedef ma::Heap<
+        ma::opt::procheap_stat<ma::procheap_atomic_stat >,
+        ma::opt::os_allocated_stat<ma::os_allocated_atomic >,
+        ma::opt::check_bounds<ma::debug_bound_checking>,
+        ma::opt::page_heap< ma::mmap_page_allocator<> >
+    >  t_MichaelHeap_MmapStat;
+#endif
+
     typedef ma::summary_stat            summary_stat;
 
     extern t_MichaelHeap_NoStat  s_MichaelHeap_NoStat;
     extern t_MichaelHeap_Stat    s_MichaelHeap_Stat;
+    extern t_MichaelHeap_NumaStat s_MichaelHeap_NumaStat;
+    extern t_MichaelHeap_LockFreeStat s_MichaelHeap_LockFreeStat;
+    extern t_MichaelHeap_ThreadCacheStat s_MichaelHeap_ThreadCacheStat;
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+    extern t_MichaelHeap_MmapStat s_MichaelHeap_MmapStat;
+#endif
 
     template <typename T>
     class MichaelHeap_NoStat
@@ -118,6 +155,116 @@ namespace memory {
         }
     };
 
+    template <typename T>
+    class MichaelHeap_NumaStat
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_NumaStat.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_NumaStat.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_NumaStat.summaryStat(s);
+        }
+    };
+
+    template <typename T>
+    class MichaelHeap_LockFreeStat
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_LockFreeStat.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_LockFreeStat.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_LockFreeStat.summaryStat(s);
+        }
+    };
+
+    template <typename T>
+    class MichaelHeap_ThreadCacheStat
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_ThreadCacheStat.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_ThreadCacheStat.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_ThreadCacheStat.summaryStat(s);
+        }
+    };
+
+#if CDS_OS_INTERFACE == CDS_OSI_UNIX
+    template <typename T>
+    class MichaelHeap_MmapStat
+    {
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+
+        enum {
+            alignment = 1
+        };
+
+        pointer allocate( size_t nSize, const void * /*pHint*/ )
+        {
+            return reinterpret_cast<pointer>( s_MichaelHeap_MmapStat.alloc( sizeof(T) * nSize ) );
+        }
+
+        void deallocate( pointer p, size_t /*nCount*/ )
+        {
+            s_MichaelHeap_MmapStat.free( p );
+        }
+
+        static void stat(summary_stat& s)
+        {
+            s_MichaelHeap_MmapStat.summaryStat(s);
+        }
+    };
+#endif
+
     template <typename T, size_t ALIGN>
     class MichaelAlignHeap_NoStat
     {
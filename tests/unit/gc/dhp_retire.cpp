@@ -0,0 +1,229 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+
+#include <cds/gc/dhp.h>
+
+// DHP retire stress test: thread-local batches of retired pointers, batch disposer
+namespace gc {
+
+    namespace {
+        static size_t s_nThreadCount = 8;
+        static size_t s_nPassCount = 1000000;   // retire count per thread
+        static size_t s_nSlotCount = 1024;      // size of shared array
+
+        static const unsigned int c_nAlive = 0xA11FE;
+        static const unsigned int c_nDead  = 0xDEAD;
+
+        struct node {
+            atomics::atomic<unsigned int> nMagic;
+
+            node()
+                : nMagic( c_nAlive )
+            {}
+        };
+
+        static atomics::atomic<size_t> s_nDisposedCount;
+        static atomics::atomic<size_t> s_nBatchCount;
+
+        struct node_disposer {
+            void operator()( node * p )
+            {
+                p->nMagic.store( c_nDead, atomics::memory_order_relaxed );
+                delete p;
+                s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+
+        void batch_disposer( cds::gc::details::retired_ptr * arr, size_t nCount )
+        {
+            s_nBatchCount.fetch_add( 1, atomics::memory_order_relaxed );
+            for ( size_t i = 0; i < nCount; ++i )
+                arr[i].free();
+        }
+    }
+
+    class DHP_Retire: public CppUnitMini::TestCase
+    {
+        typedef atomics::atomic<node *> slot_type;
+
+        class Thread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Thread( *this );
+            }
+        public:
+            slot_type *         m_arrSlot;
+            double              m_fTime;
+            size_t              m_nBadNode;
+
+        public:
+            Thread( CppUnitMini::ThreadPool& pool, slot_type * arrSlot )
+                : CppUnitMini::TestThread( pool )
+                , m_arrSlot( arrSlot )
+            {}
+            Thread( Thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_arrSlot( src.m_arrSlot )
+            {}
+
+            DHP_Retire&  getTest()
+            {
+                return reinterpret_cast<DHP_Retire&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                m_nBadNode = 0;
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo * 2654435761U + 1 );
+                cds::gc::DHP::Guard guard;
+
+                m_fTime = m_Timer.duration();
+
+                for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                    // xorshift
+                    nRand ^= nRand << 13;
+                    nRand ^= nRand >> 17;
+                    nRand ^= nRand << 5;
+
+                    node * pGuarded = guard.protect( m_arrSlot[ nRand % s_nSlotCount ] );
+                    if ( pGuarded->nMagic.load( atomics::memory_order_relaxed ) != c_nAlive )
+                        ++m_nBadNode;
+
+                    // Replace another random slot and retire old node
+                    node * pOld = m_arrSlot[ (nRand >> 8) % s_nSlotCount ].exchange( new node, atomics::memory_order_acq_rel );
+                    cds::gc::DHP::retire<node_disposer>( pOld );
+                }
+
+                m_fTime = m_Timer.duration() - m_fTime;
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 8 );
+            s_nPassCount = cfg.getULong("PassCount", 1000000 );
+            s_nSlotCount = cfg.getULong("SlotCount", 1024 );
+            if ( s_nSlotCount == 0 )
+                s_nSlotCount = 1;
+        }
+
+        void test( bool bBatchDisposer )
+        {
+            typedef cds::gc::dhp::GarbageCollector gc_impl;
+
+            bool const bStatEnabled = gc_impl::instance().enableStatistics( true );
+            gc_impl::InternalState statBefore;
+            gc_impl::instance().getInternalState( statBefore );
+
+            cds::gc::DHP::batch_disposer_func const pOldDisposer = cds::gc::DHP::set_batch_disposer( bBatchDisposer ? batch_disposer : nullptr );
+
+            slot_type * arrSlot = new slot_type[ s_nSlotCount ];
+            for ( size_t i = 0; i < s_nSlotCount; ++i )
+                arrSlot[i].store( new node, atomics::memory_order_relaxed );
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+            s_nBatchCount.store( 0, atomics::memory_order_relaxed );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Thread( pool, arrSlot ), s_nThreadCount );
+
+            CPPUNIT_MSG( "   DHP thread count=" << s_nThreadCount
+                << ", retire per thread=" << s_nPassCount
+                << ", batch disposer=" << (bBatchDisposer ? "yes" : "no")
+                << "...");
+            pool.run();
+
+            double fTime = 0;
+            size_t nBadNode = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread * pThread = static_cast<Thread *>( *it );
+                fTime += pThread->m_fTime;
+                nBadNode += pThread->m_nBadNode;
+            }
+            CPPUNIT_MSG( "     Duration=" << ( fTime / s_nThreadCount ));
+            CPPUNIT_CHECK_EX( nBadNode == 0, "Access to reclaimed node count=" << nBadNode );
+
+            // All threads are detached, their batches have been handed off to GC
+            cds::gc::DHP::scan();
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load() == s_nThreadCount * s_nPassCount,
+                "Expected disposed=" << s_nThreadCount * s_nPassCount << ", real=" << s_nDisposedCount.load() );
+            if ( bBatchDisposer )
+                CPPUNIT_CHECK( s_nBatchCount.load() > 0 );
+
+            gc_impl::InternalState stat;
+            gc_impl::instance().getInternalState( stat );
+            size_t const nFreed = stat.m_nFreedCount - statBefore.m_nFreedCount;
+            CPPUNIT_MSG( "     scan count=" << stat.m_nScanCount - statBefore.m_nScanCount
+                << ", batch hand-off count=" << stat.m_nBatchCount - statBefore.m_nBatchCount
+                << ", batch disposer calls=" << s_nBatchCount.load() );
+            CPPUNIT_MSG( "     retire-to-free latency: avg="
+                << ( nFreed ? double( stat.m_nRetireToFreeTotal - statBefore.m_nRetireToFreeTotal ) / nFreed : 0.0 ) / 1000
+                << " us, max=" << stat.m_nRetireToFreeMax / 1000 << " us" );
+            CPPUNIT_CHECK_EX( nFreed >= s_nThreadCount * s_nPassCount,
+                "Expected freed=" << s_nThreadCount * s_nPassCount << ", statistics=" << nFreed );
+
+            for ( size_t i = 0; i < s_nSlotCount; ++i )
+                delete arrSlot[i].load( atomics::memory_order_relaxed );
+            delete [] arrSlot;
+
+            cds::gc::DHP::set_batch_disposer( pOldDisposer );
+            gc_impl::instance().enableStatistics( bStatEnabled );
+        }
+
+        void retire()
+        {
+            test( false );
+        }
+
+        void batch_dispose()
+        {
+            test( true );
+        }
+
+        CPPUNIT_TEST_SUITE(DHP_Retire)
+            CPPUNIT_TEST(retire)
+            CPPUNIT_TEST(batch_dispose)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc::DHP_Retire);
@@ -0,0 +1,229 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+
+#include <cds/gc/hp.h>
+#include <algorithm>  // std::min
+
+// Hazard Pointer scan strategy stress test
+namespace gc {
+
+#define TEST_CASE( N, S )   void N() { test( cds::gc::HP::scan_type::S, #S, s_nThreadCount, s_nPassCount ); }
+
+    namespace {
+        static size_t s_nThreadCount = 8;
+        static size_t s_nPassCount = 1000000;   // retire count per thread
+        static size_t s_nSlotCount = 1024;      // size of shared array
+        static size_t s_nReattachCount = 10;    // how many times each thread detaches and attaches again
+
+        static const unsigned int c_nAlive = 0xA11FE;
+        static const unsigned int c_nDead  = 0xDEAD;
+
+        struct node {
+            atomics::atomic<unsigned int> nMagic;
+
+            node()
+                : nMagic( c_nAlive )
+            {}
+        };
+
+        static atomics::atomic<size_t> s_nDisposedCount;
+
+        struct node_disposer {
+            void operator()( node * p )
+            {
+                p->nMagic.store( c_nDead, atomics::memory_order_relaxed );
+                delete p;
+                s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+            }
+        };
+    }
+
+    class HP_Scan: public CppUnitMini::TestCase
+    {
+        // Count of hazard pointers used by each thread
+        static CDS_CONSTEXPR const size_t c_nGuardCount = 16;
+
+        typedef atomics::atomic<node *> slot_type;
+
+        class Thread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Thread( *this );
+            }
+        public:
+            slot_type *         m_arrSlot;
+            size_t              m_nPassCount;
+            double              m_fTime;
+            size_t              m_nBadNode;
+
+        public:
+            Thread( CppUnitMini::ThreadPool& pool, slot_type * arrSlot, size_t nPassCount )
+                : CppUnitMini::TestThread( pool )
+                , m_arrSlot( arrSlot )
+                , m_nPassCount( nPassCount )
+            {}
+            Thread( Thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_arrSlot( src.m_arrSlot )
+                , m_nPassCount( src.m_nPassCount )
+            {}
+
+            HP_Scan&  getTest()
+            {
+                return reinterpret_cast<HP_Scan&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                typedef cds::gc::HP::GuardArray< c_nGuardCount > guard_array;
+
+                m_nBadNode = 0;
+                unsigned int nRand = static_cast<unsigned int>( m_nThreadNo * 2654435761U + 1 );
+                size_t const nRoundLength = m_nPassCount / ( s_nReattachCount + 1 ) + 1;
+
+                m_fTime = m_Timer.duration();
+
+                for ( size_t nPass = 0; nPass < m_nPassCount; ) {
+                    if ( nPass > 0 ) {
+                        // Release HP record and get another one (maybe, from other thread)
+                        cds::threading::Manager::detachThread();
+                        cds::threading::Manager::attachThread();
+                    }
+
+                    guard_array guards;
+                    for ( size_t nEnd = std::min( nPass + nRoundLength, m_nPassCount ); nPass < nEnd; ++nPass ) {
+                        // xorshift
+                        nRand ^= nRand << 13;
+                        nRand ^= nRand >> 17;
+                        nRand ^= nRand << 5;
+
+                        // Protect a random slot, so each thread keeps all its hazard pointers busy
+                        node * pGuarded = guards.protect( nPass % c_nGuardCount, m_arrSlot[ nRand % s_nSlotCount ] );
+                        if ( pGuarded->nMagic.load( atomics::memory_order_relaxed ) != c_nAlive )
+                            ++m_nBadNode;
+
+                        // Replace another random slot and retire old node
+                        node * pOld = m_arrSlot[ (nRand >> 8) % s_nSlotCount ].exchange( new node, atomics::memory_order_acq_rel );
+                        cds::gc::HP::retire<node_disposer>( pOld );
+                    }
+                }
+
+                m_fTime = m_Timer.duration() - m_fTime;
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 8 );
+            s_nPassCount = cfg.getULong("PassCount", 1000000 );
+            s_nSlotCount = cfg.getULong("SlotCount", 1024 );
+            if ( s_nSlotCount == 0 )
+                s_nSlotCount = 1;
+            s_nReattachCount = cfg.getULong("ReattachCount", 10 );
+        }
+
+        void test( cds::gc::HP::scan_type nScanType, char const * pszScanType, size_t nThreadCount, size_t nPassCount )
+        {
+            cds::gc::HP::check_available_guards( c_nGuardCount );
+
+            cds::gc::HP::scan_type const nOldScanType = cds::gc::HP::getScanType();
+            cds::gc::HP::setScanType( nScanType );
+
+            slot_type * arrSlot = new slot_type[ s_nSlotCount ];
+            for ( size_t i = 0; i < s_nSlotCount; ++i )
+                arrSlot[i].store( new node, atomics::memory_order_relaxed );
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Thread( pool, arrSlot, nPassCount ), nThreadCount );
+
+            CPPUNIT_MSG( "   HP scan=" << pszScanType
+                << ", thread count=" << nThreadCount
+                << ", retire per thread=" << nPassCount
+                << ", reattach count=" << s_nReattachCount
+                << ", hazard ptr per thread=" << c_nGuardCount
+                << "...");
+            pool.run();
+
+            double fTime = 0;
+            size_t nBadNode = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread * pThread = static_cast<Thread *>( *it );
+                fTime += pThread->m_fTime;
+                nBadNode += pThread->m_nBadNode;
+            }
+            CPPUNIT_MSG( "     Duration=" << ( fTime / nThreadCount ));
+            CPPUNIT_CHECK_EX( nBadNode == 0, "Access to reclaimed node count=" << nBadNode );
+
+            // All threads are detached, the main thread picks up remaining retired pointers
+            cds::gc::HP::force_dispose();
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load() == nThreadCount * nPassCount,
+                "Expected disposed=" << nThreadCount * nPassCount << ", real=" << s_nDisposedCount.load() );
+
+            for ( size_t i = 0; i < s_nSlotCount; ++i )
+                delete arrSlot[i].load( atomics::memory_order_relaxed );
+            delete [] arrSlot;
+
+            cds::gc::HP::setScanType( nOldScanType );
+        }
+
+        TEST_CASE( classic, classic )
+        TEST_CASE( inplace, inplace )
+        TEST_CASE( batched, batched )
+
+        // HP thread count is not a limit: the threads exceed it, HP record table grows
+        void thread_overflow()
+        {
+            test( cds::gc::HP::getScanType(), "default", cds::gc::HP::max_thread_count() * 2 + 1, s_nPassCount / 10 );
+        }
+
+        CPPUNIT_TEST_SUITE(HP_Scan)
+            CPPUNIT_TEST(classic)
+            CPPUNIT_TEST(inplace)
+            CPPUNIT_TEST(batched)
+            CPPUNIT_TEST(thread_overflow)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc::HP_Scan);
@@ -80,12 +80,34 @@
 #   define CDSUNIT_TEST_MichaelMap_RCU_signal
 #endif
 
+#undef CDSUNIT_DECLARE_MichaelMap_RCU_membarrier
+#undef CDSUNIT_TEST_MichaelMap_RCU_membarrier
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+#   define CDSUNIT_DECLARE_MichaelMap_RCU_membarrier \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_MBB_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_MBB_less_michaelAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_MBT_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_MBT_less_michaelAlloc)
+
+#   define CDSUNIT_TEST_MichaelMap_RCU_membarrier \
+    CPPUNIT_TEST(MichaelMap_RCU_MBB_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_RCU_MBB_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_RCU_MBT_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_RCU_MBT_less_michaelAlloc)
+
+#else
+#   define CDSUNIT_DECLARE_MichaelMap_RCU_membarrier
+#   define CDSUNIT_TEST_MichaelMap_RCU_membarrier
+#endif
+
 #undef CDSUNIT_DECLARE_MichaelMap
 #define CDSUNIT_DECLARE_MichaelMap  \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_HP_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_HP_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_DHP_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_DHP_less_michaelAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_EBR_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_EBR_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPI_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPI_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -102,7 +124,8 @@
     TEST_CASE(tag_MichaelHashMap, MichaelMap_Lazy_RCU_GPB_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_Lazy_RCU_GPT_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_Lazy_RCU_GPT_less_michaelAlloc)\
-    CDSUNIT_DECLARE_MichaelMap_RCU_signal
+    CDSUNIT_DECLARE_MichaelMap_RCU_signal \
+    CDSUNIT_DECLARE_MichaelMap_RCU_membarrier
 
 #undef  CDSUNIT_TEST_MichaelMap
 #define CDSUNIT_TEST_MichaelMap  \
@@ -110,6 +133,8 @@
     CPPUNIT_TEST(MichaelMap_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -126,7 +151,8 @@
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPB_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPT_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPT_less_michaelAlloc)\
-    CDSUNIT_TEST_MichaelMap_RCU_signal
+    CDSUNIT_TEST_MichaelMap_RCU_signal \
+    CDSUNIT_TEST_MichaelMap_RCU_membarrier
 
 #undef  CDSUNIT_DECLARE_MichaelMap_nogc
 #define CDSUNIT_DECLARE_MichaelMap_nogc  \
@@ -144,6 +170,21 @@
     CPPUNIT_TEST(MichaelMap_Lazy_NOGC_unord_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_NOGC_less_michaelAlloc) \
 
+// MichaelMap with batch operations (HP/DHP only)
+#undef  CDSUNIT_DECLARE_MichaelMap_batch
+#define CDSUNIT_DECLARE_MichaelMap_batch  \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_HP_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_DHP_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_Lazy_HP_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_Lazy_DHP_cmp_stdAlloc)
+
+#undef  CDSUNIT_TEST_MichaelMap_batch
+#define CDSUNIT_TEST_MichaelMap_batch  \
+    CPPUNIT_TEST(MichaelMap_HP_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_DHP_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_HP_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_DHP_cmp_stdAlloc)
+
 
 // **************************************************************************************
 // SplitListMap
@@ -352,6 +393,21 @@
     CPPUNIT_TEST(SplitList_Lazy_NOGC_dyn_less)\
     CPPUNIT_TEST(SplitList_Lazy_NOGC_st_less)
 
+// SplitListMap with batch operations (HP/DHP only)
+#undef  CDSUNIT_DECLARE_SplitList_batch
+#define CDSUNIT_DECLARE_SplitList_batch  \
+    TEST_CASE(tag_SplitListMap, SplitList_Michael_HP_dyn_cmp)\
+    TEST_CASE(tag_SplitListMap, SplitList_Michael_DHP_st_cmp)\
+    TEST_CASE(tag_SplitListMap, SplitList_Lazy_HP_st_cmp)\
+    TEST_CASE(tag_SplitListMap, SplitList_Lazy_DHP_dyn_cmp)
+
+#undef  CDSUNIT_TEST_SplitList_batch
+#define CDSUNIT_TEST_SplitList_batch  \
+    CPPUNIT_TEST(SplitList_Michael_HP_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_DHP_st_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_HP_st_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_DHP_dyn_cmp)
+
 
 // **************************************************************************************
 // SkipListMap
@@ -382,6 +438,32 @@
 #   define CDSUNIT_TEST_SkipListMap_RCU_signal
 #endif
 
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+#   define CDSUNIT_DECLARE_SkipListMap_RCU_membarrier \
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbb_less_pascal)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbb_cmp_pascal_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbb_less_xorshift)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbb_cmp_xorshift_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbt_less_pascal)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbt_cmp_pascal_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbt_less_xorshift)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_rcu_mbt_cmp_xorshift_stat)
+
+#   define CDSUNIT_TEST_SkipListMap_RCU_membarrier \
+    CPPUNIT_TEST(SkipListMap_rcu_mbb_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbb_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbb_less_xorshift)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbt_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbt_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbt_less_xorshift)\
+    CPPUNIT_TEST(SkipListMap_rcu_mbt_cmp_xorshift_stat)
+
+#else
+#   define CDSUNIT_DECLARE_SkipListMap_RCU_membarrier
+#   define CDSUNIT_TEST_SkipListMap_RCU_membarrier
+#endif
+
 #define CDSUNIT_DECLARE_SkipListMap \
     TEST_CASE(tag_SkipListMap, SkipListMap_hp_less_pascal)\
     TEST_CASE(tag_SkipListMap, SkipListMap_hp_cmp_pascal_stat)\
@@ -391,6 +473,10 @@
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_cmp_pascal_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_less_xorshift)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_cmp_xorshift_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_less_pascal)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_cmp_pascal_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_less_xorshift)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_cmp_xorshift_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_less_pascal)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_cmp_pascal_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_less_xorshift)\
@@ -403,7 +489,8 @@
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpt_cmp_pascal_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpt_less_xorshift)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpt_cmp_xorshift_stat)\
-    CDSUNIT_DECLARE_SkipListMap_RCU_signal
+    CDSUNIT_DECLARE_SkipListMap_RCU_signal\
+    CDSUNIT_DECLARE_SkipListMap_RCU_membarrier
 
 #define CDSUNIT_TEST_SkipListMap \
     CPPUNIT_TEST(SkipListMap_hp_less_pascal)\
@@ -414,6 +501,10 @@
     CPPUNIT_TEST(SkipListMap_dhp_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_dhp_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_dhp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_xorshift)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_xorshift_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_xorshift)\
@@ -426,7 +517,8 @@
     CPPUNIT_TEST(SkipListMap_rcu_gpt_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpt_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_rcu_gpt_cmp_xorshift_stat)\
-    CDSUNIT_TEST_SkipListMap_RCU_signal
+    CDSUNIT_TEST_SkipListMap_RCU_signal\
+    CDSUNIT_TEST_SkipListMap_RCU_membarrier
 
 #define CDSUNIT_DECLARE_SkipListMap_nogc \
     TEST_CASE(tag_SkipListMap, SkipListMap_nogc_less_pascal)\
@@ -725,7 +817,13 @@
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_list_unord_storehash)\
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_list_ord_storehash)\
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_unord_storehash)\
-    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_ord_storehash)
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_ord_storehash)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_fpvector_unord)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_fpvector_unord_stat)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_fpvector_unord_storehash)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_fpvector_unord)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_fpvector_unord_stat)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_fpvector_unord_storehash)
 
 #define CDSUNIT_TEST_CuckooMap \
     CPPUNIT_TEST(CuckooStripedMap_list_unord)\
@@ -751,7 +849,30 @@
     CPPUNIT_TEST(CuckooRefinableMap_vector_unord_storehash)\
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord)\
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord_stat)\
-    CPPUNIT_TEST(CuckooRefinableMap_vector_ord_storehash)
+    CPPUNIT_TEST(CuckooRefinableMap_vector_ord_storehash)\
+    CPPUNIT_TEST(CuckooStripedMap_fpvector_unord)\
+    CPPUNIT_TEST(CuckooStripedMap_fpvector_unord_stat)\
+    CPPUNIT_TEST(CuckooStripedMap_fpvector_unord_storehash)\
+    CPPUNIT_TEST(CuckooRefinableMap_fpvector_unord)\
+    CPPUNIT_TEST(CuckooRefinableMap_fpvector_unord_stat)\
+    CPPUNIT_TEST(CuckooRefinableMap_fpvector_unord_storehash)
+
+// CuckooMap with optimistic reads, for read-only tests
+#define CDSUNIT_DECLARE_CuckooMap_optread \
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_vector_unord_optread)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_fpvector_unord_optread)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_unord_optread)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_fpvector_unord_optread)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_vector_unord_optread_default)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_unord_optread_default)
+
+#define CDSUNIT_TEST_CuckooMap_optread \
+    CPPUNIT_TEST(CuckooStripedMap_vector_unord_optread)\
+    CPPUNIT_TEST(CuckooStripedMap_fpvector_unord_optread)\
+    CPPUNIT_TEST(CuckooRefinableMap_vector_unord_optread)\
+    CPPUNIT_TEST(CuckooRefinableMap_fpvector_unord_optread)\
+    CPPUNIT_TEST(CuckooStripedMap_vector_unord_optread_default)\
+    CPPUNIT_TEST(CuckooRefinableMap_vector_unord_optread_default)
 
 
 // **************************************************************************************
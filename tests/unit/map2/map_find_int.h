@@ -259,6 +259,7 @@ namespace map2 {
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
+        CDSUNIT_DECLARE_CuckooMap_optread
         CDSUNIT_DECLARE_StdMap
         CDSUNIT_DECLARE_StdMap_NoLock
 
@@ -273,6 +274,7 @@ namespace map2 {
             CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_FeldmanHashMap
             CDSUNIT_TEST_CuckooMap
+            CDSUNIT_TEST_CuckooMap_optread
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_StdMap
@@ -0,0 +1,240 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map2/map_type.h"
+#include "cppunit/thread.h"
+
+#include <vector>
+#include <memory>
+
+namespace map2 {
+
+#define TEST_CASE(TAG, X)  void X();
+
+    // Batch find test for map<int>
+    // Each thread searches the same key sequence twice per pass: key by key by contains(),
+    // and by find_batch() for chunks of BatchSize keys. The test reports the lookup
+    // throughput of both modes; on large maps the batch mode hides the bucket miss latency.
+    class Map_find_int_batch: public CppUnitMini::TestCase
+    {
+    public:
+        size_t c_nThreadCount = 8;     // thread count
+        size_t c_nMapSize = 10000000;  // count of searching keys
+        size_t c_nPercentExists = 50;  // percent of existing keys in searching sequence
+        size_t c_nPassCount = 2;
+        size_t c_nBatchSize = 256;     // count of keys passed to one find_batch() call
+        size_t c_nLoadFactor = 2;
+        bool   c_bPrintGCState = true;
+
+    private:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        std::vector<key_type>   m_arrKey;
+        std::vector<char>       m_arrExists;
+        size_t                  m_nRealMapSize;
+
+        void generateSequence();
+
+        template <class Map>
+        class TestThread: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new TestThread( *this );
+            }
+        public:
+            size_t  m_nSingleSuccess;
+            size_t  m_nSingleFailed;
+            size_t  m_nBatchSuccess;
+            size_t  m_nBatchFailed;
+            double  m_dSingleTime;
+            double  m_dBatchTime;
+
+        public:
+            TestThread( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            TestThread( TestThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_find_int_batch&  getTest()
+            {
+                return reinterpret_cast<Map_find_int_batch&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                std::vector<key_type> const& arrKey = getTest().m_arrKey;
+                std::vector<char> const& arrExists = getTest().m_arrExists;
+                size_t const nPassCount = getTest().c_nPassCount;
+                size_t const nBatchSize = getTest().c_nBatchSize;
+                size_t const nSize = arrKey.size();
+                std::unique_ptr<bool[]> arrResult( new bool[nBatchSize] );
+
+                m_nSingleSuccess =
+                    m_nSingleFailed =
+                    m_nBatchSuccess =
+                    m_nBatchFailed = 0;
+                m_dSingleTime =
+                    m_dBatchTime = 0;
+
+                Map& rMap = m_Map;
+                cds::OS::Timer timer;
+                for ( size_t nPass = 0; nPass < nPassCount; ++nPass ) {
+                    timer.reset();
+                    for ( size_t i = 0; i < nSize; ++i ) {
+                        if ( rMap.contains( arrKey[i] ) == ( arrExists[i] != 0 ))
+                            ++m_nSingleSuccess;
+                        else
+                            ++m_nSingleFailed;
+                    }
+                    m_dSingleTime += timer.duration();
+
+                    timer.reset();
+                    for ( size_t nStart = 0; nStart < nSize; nStart += nBatchSize ) {
+                        size_t const nCount = std::min( nBatchSize, nSize - nStart );
+                        size_t nFound = rMap.find_batch( &arrKey[nStart], nCount, arrResult.get());
+
+                        size_t nExpected = 0;
+                        for ( size_t i = 0; i < nCount; ++i ) {
+                            if ( arrResult[i] == ( arrExists[nStart + i] != 0 ))
+                                ++m_nBatchSuccess;
+                            else
+                                ++m_nBatchFailed;
+                            if ( arrResult[i] )
+                                ++nExpected;
+                        }
+                        if ( nFound != nExpected )
+                            ++m_nBatchFailed;
+                    }
+                    m_dBatchTime += timer.duration();
+                }
+            }
+        };
+
+    protected:
+
+        template <class Map>
+        void find_int_batch_test( Map& testMap )
+        {
+            typedef TestThread<Map>     Thread;
+            cds::OS::Timer    timer;
+
+            // Fill the map
+            {
+                std::vector<key_type> arrInsert;
+                arrInsert.reserve( m_nRealMapSize );
+                for ( size_t i = 0; i < m_arrKey.size(); ++i ) {
+                    if ( m_arrExists[i] )
+                        arrInsert.push_back( m_arrKey[i] );
+                }
+                CPPUNIT_MSG( "  Fill map with " << arrInsert.size() << " items by insert_batch()...");
+                timer.reset();
+                CPPUNIT_ASSERT( testMap.insert_batch( &arrInsert[0], arrInsert.size()) == arrInsert.size());
+                CPPUNIT_MSG( "   Duration=" << timer.duration() );
+            }
+
+            CPPUNIT_MSG( "  Searching...");
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Thread( pool, testMap ), c_nThreadCount );
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+            size_t nSingleSuccess = 0;
+            size_t nSingleFailed = 0;
+            size_t nBatchSuccess = 0;
+            size_t nBatchFailed = 0;
+            double dSingleTime = 0;
+            double dBatchTime = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread * pThread = static_cast<Thread *>( *it );
+                nSingleSuccess += pThread->m_nSingleSuccess;
+                nSingleFailed += pThread->m_nSingleFailed;
+                nBatchSuccess += pThread->m_nBatchSuccess;
+                nBatchFailed += pThread->m_nBatchFailed;
+                dSingleTime += pThread->m_dSingleTime;
+                dBatchTime += pThread->m_dBatchTime;
+            }
+
+            // thread time is summed, so the speed is keys per thread-second
+            size_t const nLookups = m_arrKey.size() * c_nPassCount * c_nThreadCount;
+            CPPUNIT_MSG( "  Totals (success/failed): \n\t"
+                << "      Single find=" << nSingleSuccess << '/' << nSingleFailed << "\n\t"
+                << "       Batch find=" << nBatchSuccess << '/' << nBatchFailed << "\n\t"
+                << "     Single speed=" << static_cast<size_t>( nLookups / dSingleTime ) << " key/sec per thread\n\t"
+                << "      Batch speed=" << static_cast<size_t>( nLookups / dBatchTime ) << " key/sec per thread\n\t"
+                << "   Batch speed-up=" << dSingleTime / dBatchTime
+                );
+
+            CPPUNIT_CHECK( nSingleFailed == 0 );
+            CPPUNIT_CHECK( nSingleSuccess == nLookups );
+            CPPUNIT_CHECK( nBatchFailed == 0 );
+            CPPUNIT_CHECK( nBatchSuccess == nLookups );
+
+            check_before_cleanup( testMap );
+
+            testMap.clear();
+            additional_check( testMap );
+            print_stat( testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void run_test()
+        {
+            CPPUNIT_MSG( "Load factor=" << c_nLoadFactor << " batch size=" << c_nBatchSize );
+            Map testMap( *this );
+            find_int_batch_test( testMap );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg );
+
+    public:
+#   include "map2/map_defs.h"
+        CDSUNIT_DECLARE_MichaelMap_batch
+        CDSUNIT_DECLARE_SplitList_batch
+
+        CPPUNIT_TEST_SUITE(Map_find_int_batch)
+            CDSUNIT_TEST_MichaelMap_batch
+            CDSUNIT_TEST_SplitList_batch
+        CPPUNIT_TEST_SUITE_END();
+    };
+} // namespace map2
@@ -288,6 +288,7 @@ namespace map2 {
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
+        CDSUNIT_DECLARE_CuckooMap_optread
         CDSUNIT_DECLARE_StdMap
 
         CPPUNIT_TEST_SUITE(Map_InsDelFind)
@@ -299,6 +300,7 @@ namespace map2 {
             CDSUNIT_TEST_FeldmanHashMap_fixed
             CDSUNIT_TEST_FeldmanHashMap_city
             CDSUNIT_TEST_CuckooMap
+            CDSUNIT_TEST_CuckooMap_optread
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_StdMap
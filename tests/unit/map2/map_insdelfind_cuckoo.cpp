@@ -37,4 +37,5 @@
 
 namespace map2 {
     CDSUNIT_DECLARE_CuckooMap
+    CDSUNIT_DECLARE_CuckooMap_optread
 } // namespace map2
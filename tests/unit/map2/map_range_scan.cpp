@@ -0,0 +1,52 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map2/map_range_scan.h"
+
+namespace map2 {
+    CPPUNIT_TEST_SUITE_REGISTRATION( Map_RangeScan );
+
+    void Map_RangeScan::setUpParams( const CppUnitMini::TestCfg& cfg )
+    {
+        c_nMapSize = cfg.getSizeT("MapSize", c_nMapSize );
+        c_nInsThreadCount = cfg.getSizeT("InsThreadCount", c_nInsThreadCount );
+        c_nScanThreadCount = cfg.getSizeT("ScanThreadCount", c_nScanThreadCount );
+        c_nScanLength = cfg.getSizeT("ScanLength", c_nScanLength );
+        c_nDuration = cfg.getUInt("Duration", c_nDuration );
+        c_bPrintGCState = cfg.getBool("PrintGCStateFlag", c_bPrintGCState );
+
+        if ( c_nInsThreadCount == 0 )
+            c_nInsThreadCount = std::thread::hardware_concurrency();
+        if ( c_nScanThreadCount == 0 )
+            c_nScanThreadCount = std::thread::hardware_concurrency();
+        if ( c_nScanLength == 0 )
+            c_nScanLength = 1;
+    }
+} // namespace map2
@@ -0,0 +1,343 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map2/map_type.h"
+#include "cppunit/thread.h"
+#include <vector>
+
+namespace map2 {
+
+#define TEST_CASE(TAG, X)  void X();
+
+    // Range scan under concurrent modification
+    // The map is filled by even keys that are never deleted.
+    // Modifier threads insert and delete odd keys, scanner threads call for_each_in_range()
+    // for random ranges and check that the keys are ascending, lie in the range,
+    // and that all even keys of the range are visited.
+    class Map_RangeScan: public CppUnitMini::TestCase
+    {
+    public:
+        size_t  c_nMapSize = 100000;        // count of even (persistent) keys
+        size_t  c_nInsThreadCount = 4;      // count of modifier threads
+        size_t  c_nScanThreadCount = 4;     // count of scanner threads
+        size_t  c_nScanLength = 100;        // count of even keys in each scanned range
+        unsigned int c_nDuration = 15;      // test duration, seconds
+        bool    c_bPrintGCState = true;
+
+        size_t  c_nLoadFactor = 2;  // current load factor, not used
+
+    protected:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        template <class Map>
+        class Modifier: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual Modifier *    clone()
+            {
+                return new Modifier( *this );
+            }
+        public:
+            size_t  m_nInsertSuccess;
+            size_t  m_nInsertFailed;
+            size_t  m_nDeleteSuccess;
+            size_t  m_nDeleteFailed;
+
+        public:
+            Modifier( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Modifier( Modifier& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_RangeScan&  getTest()
+            {
+                return reinterpret_cast<Map_RangeScan&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Map& rMap = m_Map;
+
+                m_nInsertSuccess =
+                    m_nInsertFailed =
+                    m_nDeleteSuccess =
+                    m_nDeleteFailed = 0;
+
+                size_t const nMapSize = getTest().c_nMapSize;
+                size_t nRand = m_nThreadNo + 1;
+                bool bInsert = true;
+                while ( !time_elapsed() ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    size_t const nKey = ( nRand % nMapSize ) * 2 + 1;
+                    if ( bInsert ) {
+                        if ( rMap.insert( nKey, nKey ))
+                            ++m_nInsertSuccess;
+                        else
+                            ++m_nInsertFailed;
+                    }
+                    else {
+                        if ( rMap.erase( nKey ))
+                            ++m_nDeleteSuccess;
+                        else
+                            ++m_nDeleteFailed;
+                    }
+                    bInsert = !bInsert;
+                }
+            }
+        };
+
+        struct scan_result
+        {
+            key_type const  lo;
+            key_type const  hi;
+            key_type        nPrev;
+            bool            bFirst;
+            size_t          nEven;
+            size_t          nOrderViolation;
+
+            scan_result( key_type l, key_type h )
+                : lo( l )
+                , hi( h )
+                , nPrev( 0 )
+                , bFirst( true )
+                , nEven( 0 )
+                , nOrderViolation( 0 )
+            {}
+
+            void visit( key_type k )
+            {
+                if ( k < lo || k > hi || ( !bFirst && k <= nPrev ))
+                    ++nOrderViolation;
+                if ( k % 2 == 0 )
+                    ++nEven;
+                nPrev = k;
+                bFirst = false;
+            }
+        };
+
+        struct scan_functor
+        {
+            scan_result& m_res;
+
+            explicit scan_functor( scan_result& res )
+                : m_res( res )
+            {}
+
+            // SkipListMap
+            template <typename Pair>
+            void operator()( Pair& item )
+            {
+                m_res.visit( item.first );
+            }
+
+            // BronsonAVLTreeMap
+            void operator()( key_type const& key, value_type& /*val*/ )
+            {
+                m_res.visit( key );
+            }
+        };
+
+        template <class Map>
+        class Scanner: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual Scanner *    clone()
+            {
+                return new Scanner( *this );
+            }
+        public:
+            size_t  m_nScanCount;
+            size_t  m_nVisited;
+            size_t  m_nOrderViolation;
+            size_t  m_nMissedItems;
+
+        public:
+            Scanner( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Scanner( Scanner& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_RangeScan&  getTest()
+            {
+                return reinterpret_cast<Map_RangeScan&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Map& rMap = m_Map;
+
+                m_nScanCount =
+                    m_nVisited =
+                    m_nOrderViolation =
+                    m_nMissedItems = 0;
+
+                size_t const nMapSize = getTest().c_nMapSize;
+                size_t const nScanLength = std::min( getTest().c_nScanLength, nMapSize );
+                size_t nRand = m_nThreadNo + 1;
+
+                while ( !time_elapsed() ) {
+                    nRand = cds::bitop::RandXorShift( nRand );
+                    size_t const nFirst = nRand % ( nMapSize - nScanLength + 1 );
+                    key_type const lo = nFirst * 2;
+                    key_type const hi = ( nFirst + nScanLength - 1 ) * 2;
+
+                    scan_result res( lo, hi );
+                    size_t nCount = rMap.for_each_in_range( lo, hi, scan_functor( res ));
+
+                    ++m_nScanCount;
+                    m_nVisited += nCount;
+                    m_nOrderViolation += res.nOrderViolation;
+                    if ( res.nEven != nScanLength )
+                        ++m_nMissedItems;
+                }
+            }
+        };
+
+    protected:
+        template <class Map>
+        void do_test( Map& testMap )
+        {
+            typedef Modifier<Map>   modifier_thread;
+            typedef Scanner<Map>    scanner_thread;
+            cds::OS::Timer    timer;
+
+            // fill map - only even keys
+            {
+                std::vector<size_t> arr;
+                arr.reserve( c_nMapSize );
+                for ( size_t i = 0; i < c_nMapSize; ++i )
+                    arr.push_back( i * 2 );
+                shuffle( arr.begin(), arr.end() );
+                for ( size_t i = 0; i < c_nMapSize; ++i )
+                    testMap.insert( arr[i], arr[i] );
+            }
+            CPPUNIT_MSG( "   Insert " << c_nMapSize << " items time (single-threaded)=" << timer.duration() );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new modifier_thread( pool, testMap ), c_nInsThreadCount );
+            pool.add( new scanner_thread( pool, testMap ), c_nScanThreadCount );
+            pool.run( c_nDuration );
+
+            size_t nInsertSuccess = 0;
+            size_t nInsertFailed = 0;
+            size_t nDeleteSuccess = 0;
+            size_t nDeleteFailed = 0;
+            size_t nScanCount = 0;
+            size_t nVisited = 0;
+            size_t nOrderViolation = 0;
+            size_t nMissedItems = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                modifier_thread * pModifier = dynamic_cast<modifier_thread *>( *it );
+                if ( pModifier ) {
+                    nInsertSuccess += pModifier->m_nInsertSuccess;
+                    nInsertFailed += pModifier->m_nInsertFailed;
+                    nDeleteSuccess += pModifier->m_nDeleteSuccess;
+                    nDeleteFailed += pModifier->m_nDeleteFailed;
+                }
+                else {
+                    scanner_thread * pScanner = static_cast<scanner_thread *>( *it );
+                    nScanCount += pScanner->m_nScanCount;
+                    nVisited += pScanner->m_nVisited;
+                    nOrderViolation += pScanner->m_nOrderViolation;
+                    nMissedItems += pScanner->m_nMissedItems;
+                }
+            }
+
+            CPPUNIT_MSG( "  Totals (success/failed): \n\t"
+                      << "      Insert=" << nInsertSuccess << '/' << nInsertFailed << "\n\t"
+                      << "      Delete=" << nDeleteSuccess << '/' << nDeleteFailed << "\n\t"
+                      << "       Scans=" << nScanCount << ", visited items=" << nVisited << "\n\t"
+                      << "  Scan speed=" << nScanCount / c_nDuration << " scan/sec, "
+                                         << nVisited / c_nDuration << " item/sec\n\t"
+                      << "    Modify speed=" << (nInsertSuccess + nDeleteSuccess) / c_nDuration << " modify/sec\n\t"
+                      << "      Map size=" << testMap.size()
+                );
+
+            CPPUNIT_CHECK_EX( nOrderViolation == 0, "order violations=" << nOrderViolation );
+            CPPUNIT_CHECK_EX( nMissedItems == 0, "scans with missed items=" << nMissedItems );
+
+            check_before_cleanup( testMap );
+
+            CPPUNIT_MSG( "  Clear map (single-threaded)..." );
+            timer.reset();
+            testMap.clear();
+            CPPUNIT_MSG( "   Duration=" << timer.duration() );
+            CPPUNIT_CHECK_EX( testMap.empty(), "size=" << ((long long) testMap.size()) );
+
+            additional_check( testMap );
+            print_stat( testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void run_test()
+        {
+            CPPUNIT_MSG( "Modifier thread count=" << c_nInsThreadCount
+                << " scanner thread count=" << c_nScanThreadCount
+                << " map size=" << c_nMapSize
+                << " scan length=" << c_nScanLength
+                << " duration=" << c_nDuration << "s"
+                );
+
+            Map testMap( *this );
+            do_test( testMap );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg );
+
+#   include "map2/map_defs.h"
+        CDSUNIT_DECLARE_SkipListMap
+        CDSUNIT_DECLARE_BronsonAVLTreeMap
+
+        CPPUNIT_TEST_SUITE(Map_RangeScan)
+            CDSUNIT_TEST_SkipListMap
+            CDSUNIT_TEST_BronsonAVLTreeMap
+        CPPUNIT_TEST_SUITE_END();
+    };
+} // namespace map2
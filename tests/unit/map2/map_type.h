@@ -36,6 +36,8 @@
 #include <cds/urcu/general_threaded.h>
 #include <cds/urcu/signal_buffered.h>
 #include <cds/urcu/signal_threaded.h>
+#include <cds/urcu/membarrier_buffered.h>
+#include <cds/urcu/membarrier_threaded.h>
 
 #include <cds/sync/spinlock.h>
 #include <cds/opt/hash.h>
@@ -54,6 +56,10 @@ namespace map2 {
     typedef cds::urcu::gc< cds::urcu::signal_buffered<> >  rcu_shb;
     typedef cds::urcu::gc< cds::urcu::signal_threaded<> >  rcu_sht;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+    typedef cds::urcu::gc< cds::urcu::membarrier_buffered<> >  rcu_mbb;
+    typedef cds::urcu::gc< cds::urcu::membarrier_threaded<> >  rcu_mbt;
+#endif
 
     template <typename Key>
     struct cmp {
@@ -33,6 +33,7 @@
 
 #include "map2/map_type.h"
 #include <cds/container/cuckoo_map.h>
+#include <cds/gc/ebr.h>
 #include "print_cuckoo_stat.h"
 
 namespace map2 {
@@ -186,6 +187,55 @@ namespace map2 {
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_ord_storehash>> CuckooStripedMap_vector_ord_storehash;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_ord_storehash>> CuckooRefinableMap_vector_ord_storehash;
 
+        struct traits_CuckooMap_fpvector_unord :
+            public cc::cuckoo::make_traits <
+                cc::cuckoo::probeset_type< cc::cuckoo::fingerprint_vector<4> >
+                , co::equal_to< equal_to >
+                , co::hash< std::tuple< hash, hash2 > >
+            >::type
+        {};
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_fpvector_unord>> CuckooStripedMap_fpvector_unord;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_fpvector_unord>> CuckooRefinableMap_fpvector_unord;
+
+        struct traits_CuckooMap_fpvector_unord_stat : public traits_CuckooMap_fpvector_unord
+        {
+            typedef cc::cuckoo::stat stat;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_fpvector_unord_stat>> CuckooStripedMap_fpvector_unord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_fpvector_unord_stat>> CuckooRefinableMap_fpvector_unord_stat;
+
+        struct traits_CuckooMap_fpvector_unord_storehash : public traits_CuckooMap_fpvector_unord
+        {
+            static CDS_CONSTEXPR const bool store_hash = true;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_fpvector_unord_storehash>> CuckooStripedMap_fpvector_unord_storehash;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_fpvector_unord_storehash>> CuckooRefinableMap_fpvector_unord_storehash;
+
+        // optimistic reads; erased nodes are retired via EBR
+        struct traits_CuckooMap_vector_unord_optread : public traits_CuckooMap_vector_unord
+        {
+            static CDS_CONSTEXPR const bool optimistic_read = true;
+            typedef cc::cuckoo::epoch_reclaim< cds::gc::EBR > reclaim_policy;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_unord_optread>> CuckooStripedMap_vector_unord_optread;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_unord_optread>> CuckooRefinableMap_vector_unord_optread;
+
+        struct traits_CuckooMap_fpvector_unord_optread : public traits_CuckooMap_fpvector_unord
+        {
+            static CDS_CONSTEXPR const bool optimistic_read = true;
+            typedef cc::cuckoo::epoch_reclaim< cds::gc::EBR > reclaim_policy;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_fpvector_unord_optread>> CuckooStripedMap_fpvector_unord_optread;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_fpvector_unord_optread>> CuckooRefinableMap_fpvector_unord_optread;
+
+        // optimistic reads with default reclamation policy, that is, epoch_reclaim< cds::gc::EBR >
+        struct traits_CuckooMap_vector_unord_optread_default : public traits_CuckooMap_vector_unord
+        {
+            static CDS_CONSTEXPR const bool optimistic_read = true;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_unord_optread_default>> CuckooStripedMap_vector_unord_optread_default;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_unord_optread_default>> CuckooRefinableMap_vector_unord_optread_default;
+
     };
 
     template <typename K, typename T, typename Traits >
@@ -194,6 +194,10 @@ namespace map2 {
         std::vector< cds::intrusive::feldman_hashset::level_statistics > level_stat;
         m.get_level_statistics( level_stat );
         CPPUNIT_MSG( level_stat );
+
+        cds::intrusive::feldman_hashset::memory_statistics mem_stat;
+        m.get_memory_statistics( mem_stat );
+        CPPUNIT_MSG( mem_stat );
     }
 
 }   // namespace map2
@@ -35,6 +35,7 @@
 
 #include <cds/container/skip_list_map_hp.h>
 #include <cds/container/skip_list_map_dhp.h>
+#include <cds/container/skip_list_map_ebr.h>
 #include <cds/container/skip_list_map_rcu.h>
 #include <cds/container/skip_list_map_nogc.h>
 
@@ -75,6 +76,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_hp_less_pascal;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_dhp_less_pascal;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_ebr_less_pascal;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_nogc_less_pascal;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_gpi_less_pascal;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_gpb_less_pascal;
@@ -83,6 +85,10 @@ namespace map2 {
         typedef SkipListMap< rcu_shb, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_shb_less_pascal;
         typedef SkipListMap< rcu_sht, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_sht_less_pascal;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef SkipListMap< rcu_mbb, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_mbb_less_pascal;
+        typedef SkipListMap< rcu_mbt, Key, Value, traits_SkipListMap_less_pascal > SkipListMap_rcu_mbt_less_pascal;
+#endif
 
         class traits_SkipListMap_less_pascal_seqcst: public cc::skip_list::make_traits <
                 co::less< less >
@@ -93,6 +99,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_hp_less_pascal_seqcst;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_dhp_less_pascal_seqcst;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_ebr_less_pascal_seqcst;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_nogc_less_pascal_seqcst;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_rcu_gpi_less_pascal_seqcst;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_less_pascal_seqcst > SkipListMap_rcu_gpb_less_pascal_seqcst;
@@ -111,6 +118,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_hp_less_pascal_stat;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_dhp_less_pascal_stat;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_ebr_less_pascal_stat;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_nogc_less_pascal_stat;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_rcu_gpi_less_pascal_stat;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_less_pascal_stat > SkipListMap_rcu_gpb_less_pascal_stat;
@@ -128,6 +136,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_hp_cmp_pascal;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_dhp_cmp_pascal;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_ebr_cmp_pascal;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_nogc_cmp_pascal;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_rcu_gpi_cmp_pascal;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_cmp_pascal > SkipListMap_rcu_gpb_cmp_pascal;
@@ -146,6 +155,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_hp_cmp_pascal_stat;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_dhp_cmp_pascal_stat;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_ebr_cmp_pascal_stat;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_nogc_cmp_pascal_stat;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_gpi_cmp_pascal_stat;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_gpb_cmp_pascal_stat;
@@ -154,6 +164,10 @@ namespace map2 {
         typedef SkipListMap< rcu_shb, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_shb_cmp_pascal_stat;
         typedef SkipListMap< rcu_sht, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_sht_cmp_pascal_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef SkipListMap< rcu_mbb, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_mbb_cmp_pascal_stat;
+        typedef SkipListMap< rcu_mbt, Key, Value, traits_SkipListMap_cmp_pascal_stat > SkipListMap_rcu_mbt_cmp_pascal_stat;
+#endif
 
         class traits_SkipListMap_less_xorshift: public cc::skip_list::make_traits <
                 co::less< less >
@@ -163,6 +177,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_hp_less_xorshift;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_dhp_less_xorshift;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_ebr_less_xorshift;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_nogc_less_xorshift;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_gpi_less_xorshift;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_gpb_less_xorshift;
@@ -171,6 +186,10 @@ namespace map2 {
         typedef SkipListMap< rcu_shb, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_shb_less_xorshift;
         typedef SkipListMap< rcu_sht, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_sht_less_xorshift;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef SkipListMap< rcu_mbb, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_mbb_less_xorshift;
+        typedef SkipListMap< rcu_mbt, Key, Value, traits_SkipListMap_less_xorshift > SkipListMap_rcu_mbt_less_xorshift;
+#endif
 
         class traits_SkipListMap_less_xorshift_stat: public cc::skip_list::make_traits <
                 co::less< less >
@@ -181,6 +200,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_hp_less_xorshift_stat;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_dhp_less_xorshift_stat;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_ebr_less_xorshift_stat;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_nogc_less_xorshift_stat;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_rcu_gpi_less_xorshift_stat;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_less_xorshift_stat > SkipListMap_rcu_gpb_less_xorshift_stat;
@@ -198,6 +218,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_hp_cmp_xorshift;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_dhp_cmp_xorshift;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_ebr_cmp_xorshift;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_nogc_cmp_xorshift;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_rcu_gpi_cmp_xorshift;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_cmp_xorshift > SkipListMap_rcu_gpb_cmp_xorshift;
@@ -216,6 +237,7 @@ namespace map2 {
         {};
         typedef SkipListMap< cds::gc::HP, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_hp_cmp_xorshift_stat;
         typedef SkipListMap< cds::gc::DHP, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_dhp_cmp_xorshift_stat;
+        typedef SkipListMap< cds::gc::EBR, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_ebr_cmp_xorshift_stat;
         typedef SkipListMap< cds::gc::nogc, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_nogc_cmp_xorshift_stat;
         typedef SkipListMap< rcu_gpi, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_gpi_cmp_xorshift_stat;
         typedef SkipListMap< rcu_gpb, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_gpb_cmp_xorshift_stat;
@@ -224,6 +246,10 @@ namespace map2 {
         typedef SkipListMap< rcu_shb, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_shb_cmp_xorshift_stat;
         typedef SkipListMap< rcu_sht, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_sht_cmp_xorshift_stat;
 #endif
+#ifdef CDS_URCU_MEMBARRIER_ENABLED
+        typedef SkipListMap< rcu_mbb, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_mbb_cmp_xorshift_stat;
+        typedef SkipListMap< rcu_mbt, Key, Value, traits_SkipListMap_cmp_xorshift_stat > SkipListMap_rcu_mbt_cmp_xorshift_stat;
+#endif
 
     };
 
@@ -173,6 +173,36 @@
     CPPUNIT_TEST(SkipList_RCU_gpt_min)  \
     CDSUNIT_TEST_SkipList_RCU_signal
 
+// SkipListPriorityQueue
+#define CDSUNIT_DECLARE_SkipListPriorityQueue       \
+    TEST_CASE(SkipListPriorityQueue_HP_less)        \
+    TEST_CASE(SkipListPriorityQueue_HP_less_stat)   \
+    TEST_CASE(SkipListPriorityQueue_HP_cmp_xorshift) \
+    TEST_CASE(SkipListPriorityQueue_DHP_less)       \
+    TEST_CASE(SkipListPriorityQueue_DHP_less_stat)  \
+    TEST_CASE(SkipListPriorityQueue_RCU_gpi_less)   \
+    TEST_CASE(SkipListPriorityQueue_RCU_gpb_less)   \
+    TEST_CASE(SkipListPriorityQueue_RCU_gpt_less)
+#define CDSUNIT_TEST_SkipListPriorityQueue          \
+    CPPUNIT_TEST(SkipListPriorityQueue_HP_less)     \
+    CPPUNIT_TEST(SkipListPriorityQueue_HP_less_stat) \
+    CPPUNIT_TEST(SkipListPriorityQueue_HP_cmp_xorshift) \
+    CPPUNIT_TEST(SkipListPriorityQueue_DHP_less)    \
+    CPPUNIT_TEST(SkipListPriorityQueue_DHP_less_stat) \
+    CPPUNIT_TEST(SkipListPriorityQueue_RCU_gpi_less) \
+    CPPUNIT_TEST(SkipListPriorityQueue_RCU_gpb_less) \
+    CPPUNIT_TEST(SkipListPriorityQueue_RCU_gpt_less)
+
+// MultiPriorityQueue
+#define CDSUNIT_DECLARE_MultiPriorityQueue  \
+    TEST_CASE(MultiPQueue_less)             \
+    TEST_CASE(MultiPQueue_less_stat)        \
+    TEST_CASE(MultiPQueue_less_mutex)
+#define CDSUNIT_TEST_MultiPriorityQueue     \
+    CPPUNIT_TEST(MultiPQueue_less)          \
+    CPPUNIT_TEST(MultiPQueue_less_stat)     \
+    CPPUNIT_TEST(MultiPQueue_less_mutex)
+
 // FCPriorityQueue
 #define CDSUNIT_DECLARE_FCPriorityQueue \
     TEST_CASE(FCPQueue_vector)          \
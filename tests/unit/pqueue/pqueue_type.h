@@ -33,6 +33,8 @@
 
 #include <cds/container/mspriority_queue.h>
 #include <cds/container/fcpriority_queue.h>
+#include <cds/container/skip_list_priority_queue.h>
+#include <cds/container/multi_priority_queue.h>
 
 #include "pqueue/std_pqueue.h"
 #include "pqueue/ellen_bintree_pqueue.h"
@@ -269,6 +271,52 @@ namespace pqueue {
         typedef SkipListPQueue< rcu_sht, Value, traits_SkipList_min_stat, false > SkipList_RCU_sht_min_stat;
 #endif
 
+        // SkipListPriorityQueue
+        struct traits_SkipListPriorityQueue_less :
+            public cc::skip_list_priority_queue::make_traits<
+                co::less< std::less<Value> >
+            >::type
+        {};
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, Value, traits_SkipListPriorityQueue_less > SkipListPriorityQueue_HP_less;
+        typedef cc::SkipListPriorityQueue< cds::gc::DHP, Value, traits_SkipListPriorityQueue_less > SkipListPriorityQueue_DHP_less;
+        typedef cc::SkipListPriorityQueue< rcu_gpi, Value, traits_SkipListPriorityQueue_less > SkipListPriorityQueue_RCU_gpi_less;
+        typedef cc::SkipListPriorityQueue< rcu_gpb, Value, traits_SkipListPriorityQueue_less > SkipListPriorityQueue_RCU_gpb_less;
+        typedef cc::SkipListPriorityQueue< rcu_gpt, Value, traits_SkipListPriorityQueue_less > SkipListPriorityQueue_RCU_gpt_less;
+
+        struct traits_SkipListPriorityQueue_less_stat :
+            public cc::skip_list_priority_queue::make_traits<
+                co::less< std::less<Value> >
+                ,co::stat< cc::skip_list::stat<> >
+            >::type
+        {};
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, Value, traits_SkipListPriorityQueue_less_stat > SkipListPriorityQueue_HP_less_stat;
+        typedef cc::SkipListPriorityQueue< cds::gc::DHP, Value, traits_SkipListPriorityQueue_less_stat > SkipListPriorityQueue_DHP_less_stat;
+
+        struct traits_SkipListPriorityQueue_cmp_xorshift :
+            public cc::skip_list_priority_queue::make_traits<
+                co::compare< cmp >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        {};
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, Value, traits_SkipListPriorityQueue_cmp_xorshift > SkipListPriorityQueue_HP_cmp_xorshift;
+
+
+        // MultiPriorityQueue
+        typedef cc::MultiPriorityQueue< Value > MultiPQueue_less;
+
+        struct traits_MultiPQueue_less_stat :
+            public cc::multi_priority_queue::make_traits <
+                cds::opt::stat< cc::multi_priority_queue::stat<> >
+            >::type
+        {};
+        typedef cc::MultiPriorityQueue< Value, traits_MultiPQueue_less_stat > MultiPQueue_less_stat;
+
+        struct traits_MultiPQueue_less_mutex :
+            public cc::multi_priority_queue::make_traits <
+                cds::opt::lock_type< std::mutex >
+            >::type
+        {};
+        typedef cc::MultiPriorityQueue< Value, traits_MultiPQueue_less_mutex > MultiPQueue_less_mutex;
 
         // FCPriorityQueue
         struct traits_FCPQueue_stat : public
@@ -328,6 +376,22 @@ namespace pqueue {
 
 namespace std {
 
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::multi_priority_queue::empty_stat const& )
+    {
+        return o;
+    }
+
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::multi_priority_queue::stat<> const& s )
+    {
+        return o << "\tStatistics:\n"
+            << "\t              Push: " << s.m_nPush.get()          << "\n"
+            << "\t               Pop: " << s.m_nPop.get()           << "\n"
+            << "\t        Failed pop: " << s.m_nFailedPop.get()     << "\n"
+            << "\t    Push contended: " << s.m_nPushContended.get() << "\n"
+            << "\t     Pop contended: " << s.m_nPopContended.get()  << "\n"
+            << "\t          Pop scan: " << s.m_nPopScan.get()       << "\n";
+    }
+
     static inline std::ostream& operator <<( std::ostream& o, cds::container::fcpqueue::empty_stat const& )
     {
         return o;
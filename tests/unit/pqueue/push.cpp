@@ -209,6 +209,7 @@ namespace pqueue {
         CDSUNIT_DECLARE_MSPriorityQueue
         CDSUNIT_DECLARE_EllenBinTree
         CDSUNIT_DECLARE_SkipList
+        CDSUNIT_DECLARE_SkipListPriorityQueue
         CDSUNIT_DECLARE_FCPriorityQueue
         CDSUNIT_DECLARE_StdPQueue
 
@@ -216,6 +217,7 @@ namespace pqueue {
             CDSUNIT_TEST_MSPriorityQueue
             CDSUNIT_TEST_EllenBinTree
             CDSUNIT_TEST_SkipList
+            CDSUNIT_TEST_SkipListPriorityQueue
             CDSUNIT_TEST_FCPriorityQueue
             CDUNIT_TEST_StdPQueue
         CPPUNIT_TEST_SUITE_END();
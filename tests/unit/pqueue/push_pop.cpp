@@ -44,6 +44,7 @@ namespace pqueue {
         static size_t s_nPushThreadCount = 4;
         static size_t s_nPopThreadCount = 4;
         static size_t s_nQueueSize = 2000000;
+        static bool   s_bRankError = false;
     }
 } // namespace pqueue
 
@@ -65,6 +66,7 @@ namespace pqueue {
 
             typedef std::vector<size_t> array_type;
             array_type          m_arr;
+            array_type          m_arrTicket;    // push tickets for rank error metric, m_arrTicket[i] is the ticket of m_arr[i]
 
         public:
             Pusher( CppUnitMini::ThreadPool& pool, PQueue& q )
@@ -94,9 +96,20 @@ namespace pqueue {
             {
                 m_nPushError = 0;
 
-                for ( array_type::const_iterator it = m_arr.begin(); it != m_arr.end(); ++it ) {
-                    if ( !m_Queue.push( SimpleValue( *it ) ))
-                        ++m_nPushError;
+                if ( s_bRankError ) {
+                    // The ticket is taken before push, so the item cannot be popped before its push ticket
+                    m_arrTicket.reserve( m_arr.size() );
+                    for ( array_type::const_iterator it = m_arr.begin(); it != m_arr.end(); ++it ) {
+                        m_arrTicket.push_back( getTest().next_ticket() );
+                        if ( !m_Queue.push( SimpleValue( *it ) ))
+                            ++m_nPushError;
+                    }
+                }
+                else {
+                    for ( array_type::const_iterator it = m_arr.begin(); it != m_arr.end(); ++it ) {
+                        if ( !m_Queue.push( SimpleValue( *it ) ))
+                            ++m_nPushError;
+                    }
                 }
 
                 getTest().end_pusher();
@@ -123,8 +136,8 @@ namespace pqueue {
             size_t              m_nPopSuccess;
             size_t              m_nPopFailed;
 
-            typedef std::vector<size_t> array_type;
-            array_type          m_arr;
+            typedef std::vector< std::pair<size_t, size_t> > array_type;
+            array_type          m_arrPopped;    // (ticket, key) of popped items for rank error metric
 
         public:
             Popper( CppUnitMini::ThreadPool& pool, PQueue& q )
@@ -156,9 +169,14 @@ namespace pqueue {
                 m_nPopFailed = 0;
 
                 SimpleValue val;
+                bool const bRankError = s_bRankError;
                 while ( getTest().pushing() || !m_Queue.empty() ) {
-                    if ( m_Queue.pop( val ))
+                    if ( m_Queue.pop( val )) {
                         ++m_nPopSuccess;
+                        // The ticket is taken after pop, so the pop ticket is greater than the push ticket of the item
+                        if ( bRankError )
+                            m_arrPopped.push_back( std::make_pair( getTest().next_ticket(), val.key ));
+                    }
                     else
                         ++m_nPopFailed;
                 }
@@ -175,6 +193,97 @@ namespace pqueue {
             return m_nPusherCount.load( atomics::memory_order_relaxed ) != 0;
         }
 
+        atomics::atomic<size_t>  m_nTicket;
+        size_t next_ticket()
+        {
+            return m_nTicket.fetch_add( 1, atomics::memory_order_acq_rel );
+        }
+
+        // Fenwick tree over item keys, counts the items in the queue
+        class key_counter
+        {
+            std::vector<size_t> m_Tree;
+        public:
+            key_counter( size_t nSize )
+                : m_Tree( nSize + 1, 0 )
+            {}
+
+            void insert( size_t nKey )
+            {
+                for ( size_t i = nKey + 1; i < m_Tree.size(); i += i & (0 - i) )
+                    ++m_Tree[i];
+            }
+
+            void erase( size_t nKey )
+            {
+                for ( size_t i = nKey + 1; i < m_Tree.size(); i += i & (0 - i) )
+                    --m_Tree[i];
+            }
+
+            // count of items with key <= nKey
+            size_t count( size_t nKey ) const
+            {
+                size_t n = 0;
+                for ( size_t i = nKey + 1; i > 0; i -= i & (0 - i) )
+                    n += m_Tree[i];
+                return n;
+            }
+        };
+
+        // Replays the pushes and pops in ticket order and computes the rank error of each pop:
+        // the number of items with higher priority that are in the queue at the moment of pop
+        template <class PQueue>
+        void analyze_rank_error( CppUnitMini::ThreadPool& pool )
+        {
+            size_t const nTicketCount = m_nTicket.load( atomics::memory_order_relaxed );
+            static size_t const c_nNoEvent = ~size_t(0);
+            std::vector<size_t> arrPush( nTicketCount, c_nNoEvent );
+            std::vector<size_t> arrPop( nTicketCount, c_nNoEvent );
+
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Popper<PQueue> * pPopper = dynamic_cast<Popper<PQueue> *>(*it);
+                if ( pPopper ) {
+                    for ( auto const& ev : pPopper->m_arrPopped )
+                        arrPop[ ev.first ] = ev.second;
+                }
+                else {
+                    Pusher<PQueue> * pPusher = static_cast<Pusher<PQueue> *>(*it);
+                    for ( size_t i = 0; i < pPusher->m_arrTicket.size(); ++i )
+                        arrPush[ pPusher->m_arrTicket[i] ] = pPusher->m_arr[i];
+                }
+            }
+
+            key_counter keys( s_nQueueSize );
+            size_t nItemCount = 0;
+            size_t nPopCount = 0;
+            unsigned long long nTotalError = 0;
+            size_t nMaxError = 0;
+            size_t nExactPop = 0;
+            for ( size_t nTicket = 0; nTicket < nTicketCount; ++nTicket ) {
+                if ( arrPush[nTicket] != c_nNoEvent ) {
+                    keys.insert( arrPush[nTicket] );
+                    ++nItemCount;
+                }
+                else if ( arrPop[nTicket] != c_nNoEvent ) {
+                    size_t const nKey = arrPop[nTicket];
+                    size_t const nRank = nItemCount - keys.count( nKey );
+                    keys.erase( nKey );
+                    --nItemCount;
+
+                    ++nPopCount;
+                    nTotalError += nRank;
+                    if ( nRank == 0 )
+                        ++nExactPop;
+                    if ( nRank > nMaxError )
+                        nMaxError = nRank;
+                }
+            }
+
+            CPPUNIT_MSG( "   Rank error: avg=" << ( nPopCount ? double( nTotalError ) / nPopCount : 0.0 )
+                << ", max=" << nMaxError
+                << ", exact pop=" << nExactPop << " of " << nPopCount );
+        }
+
     protected:
         template <class PQueue>
         void test()
@@ -207,6 +316,7 @@ namespace pqueue {
 
             pool.add( new Popper<PQueue>( pool, testQueue ), s_nPopThreadCount );
 
+            m_nTicket.store( 0, atomics::memory_order_relaxed );
             m_nPusherCount.store( s_nPushThreadCount, atomics::memory_order_release );
             CPPUNIT_MSG( "   push thread count=" << s_nPushThreadCount << " pop thread count=" << s_nPopThreadCount
                 << ", item count=" << nThreadItemCount * s_nPushThreadCount << " ..." );
@@ -234,6 +344,9 @@ namespace pqueue {
             CPPUNIT_CHECK( nTotalPopped == nThreadItemCount * s_nPushThreadCount );
             CPPUNIT_CHECK( nPushFailed == 0 );
 
+            if ( s_bRankError )
+                analyze_rank_error<PQueue>( pool );
+
             check_statistics( testQueue.statistics() );
             CPPUNIT_MSG( testQueue.statistics() );
         }
@@ -242,6 +355,7 @@ namespace pqueue {
             s_nPushThreadCount = cfg.getULong("PushThreadCount", (unsigned long) s_nPushThreadCount );
             s_nPopThreadCount = cfg.getULong("PopThreadCount", (unsigned long) s_nPopThreadCount );
             s_nQueueSize = cfg.getULong("QueueSize", (unsigned long) s_nQueueSize );
+            s_bRankError = cfg.getBool("RankError", s_bRankError );
         }
 
     protected:
@@ -249,6 +363,8 @@ namespace pqueue {
         CDSUNIT_DECLARE_MSPriorityQueue
         CDSUNIT_DECLARE_EllenBinTree
         CDSUNIT_DECLARE_SkipList
+        CDSUNIT_DECLARE_SkipListPriorityQueue
+        CDSUNIT_DECLARE_MultiPriorityQueue
         CDSUNIT_DECLARE_FCPriorityQueue
         CDSUNIT_DECLARE_StdPQueue
 
@@ -256,6 +372,8 @@ namespace pqueue {
             CDSUNIT_TEST_MSPriorityQueue
             CDSUNIT_TEST_EllenBinTree
             CDSUNIT_TEST_SkipList
+            CDSUNIT_TEST_SkipListPriorityQueue
+            CDSUNIT_TEST_MultiPriorityQueue
             CDSUNIT_TEST_FCPriorityQueue
             CDUNIT_TEST_StdPQueue
         CPPUNIT_TEST_SUITE_END();
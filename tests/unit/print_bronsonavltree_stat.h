@@ -47,6 +47,8 @@ namespace std {
             << "\t\t              m_nFindFailed: " << s.m_nFindFailed.get()          << "\n"
             << "\t\t               m_nFindRetry: " << s.m_nFindRetry.get()           << "\n"
             << "\t\t       m_nFindWaitShrinking: " << s.m_nFindWaitShrinking.get()   << "\n"
+            << "\t\t                    m_nScan: " << s.m_nScan.get()                << "\n"
+            << "\t\t               m_nScanRetry: " << s.m_nScanRetry.get()           << "\n"
             << "\t\t           m_nInsertSuccess: " << s.m_nInsertSuccess.get()       << "\n"
             << "\t\t            m_nInsertFailed: " << s.m_nInsertFailed.get()        << "\n"
             << "\t\t     m_nRelaxedInsertFailed: " << s.m_nRelaxedInsertFailed.get() << "\n"
@@ -104,6 +104,8 @@ namespace std {
             << "\t\t                  m_nFindFailed: " << s.m_nFindFailed.get()                     << "\n"
             << "\t\t             m_nFindWithSuccess: " << s.m_nFindWithSuccess.get()                << "\n"
             << "\t\t              m_nFindWithFailed: " << s.m_nFindWithFailed.get()                 << "\n"
+            << "\t\t         m_nOptimisticReadRetry: " << s.m_nOptimisticReadRetry.get()            << "\n"
+            << "\t\t      m_nOptimisticReadFallback: " << s.m_nOptimisticReadFallback.get()         << "\n"
 ;
     }
 
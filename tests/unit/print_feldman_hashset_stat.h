@@ -58,6 +58,7 @@ namespace std {
             << "\t\t            m_nSlotChanged: " << s.m_nSlotChanged.get()             << "\n"
             << "\t\t         m_nSlotConverting: " << s.m_nSlotConverting.get()          << "\n"
             << "\t\t         m_nArrayNodeCount: " << s.m_nArrayNodeCount.get()          << "\n"
+            << "\t\t         m_nArrayNodeFreed: " << s.m_nArrayNodeFreed.get()          << "\n"
             << "\t\t                 m_nHeight: " << s.m_nHeight.get()                  << "\n";
     }
 
@@ -83,6 +84,19 @@ namespace std {
         return o;
     }
 
+    static inline ostream& operator<<( ostream& o, cds::intrusive::feldman_hashset::memory_statistics const& s )
+    {
+        return
+        o << "Memory statistics\n"
+            << "\t\t          array_node_count: " << s.array_node_count        << "\n"
+            << "\t\t               memory_size: " << s.memory_size             << "\n"
+            << "\t\t           data_cell_count: " << s.data_cell_count         << "\n"
+            << "\t\t          array_cell_count: " << s.array_cell_count        << "\n"
+            << "\t\t          empty_cell_count: " << s.empty_cell_count        << "\n"
+            << "\t\t    compactable_node_count: " << s.compactable_node_count  << "\n"
+            << "\t\t   compactable_memory_size: " << s.compactable_memory_size << "\n";
+    }
+
 } // namespace std
 
 #endif // #ifndef CDSUNIT_PRINT_FELDMAN_HASHSET_STAT_H
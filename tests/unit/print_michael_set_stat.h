@@ -0,0 +1,58 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_PRINT_MICHAEL_SET_STAT_H
+#define CDSUNIT_PRINT_MICHAEL_SET_STAT_H
+
+#include <cds/intrusive/details/michael_set_base.h>
+#include <ostream>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::intrusive::michael_set::stat<> const& s )
+    {
+        return
+        o << "Michael's hash set stat [cds::intrusive::michael_set::stat]\n"
+            << "\t\t            m_nResizeStart: " << s.m_nResizeStart.get()             << "\n"
+            << "\t\t         m_nResizeComplete: " << s.m_nResizeComplete.get()          << "\n"
+            << "\t\t         m_nBucketMigrated: " << s.m_nBucketMigrated.get()          << "\n"
+            << "\t\t           m_nItemMigrated: " << s.m_nItemMigrated.get()            << "\n"
+            << "\t\t          m_nMigrationWait: " << s.m_nMigrationWait.get()           << "\n"
+            << "\t\t     m_nMigrationDrainWait: " << s.m_nMigrationDrainWait.get()      << "\n";
+    }
+
+    static inline ostream& operator <<( ostream& o, cds::intrusive::michael_set::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+} // namespace std
+
+#endif // #ifndef CDSUNIT_PRINT_MICHAEL_SET_STAT_H
@@ -78,7 +78,9 @@ namespace std {
             << "\t\t            m_nFastExtract: " << s.m_nFastExtract.get()             << "\n"
             << "\t\t            m_nSlowExtract: " << s.m_nSlowExtract.get()             << "\n"
             << "\t\t         m_nEraseWhileFind: " << s.m_nEraseWhileFind.get()          << "\n"
-            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n";
+            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n"
+            << "\t\t              m_nRangeScan: " << s.m_nRangeScan.get()               << "\n"
+            << "\t\t        m_nRangeScanReseek: " << s.m_nRangeScanReseek.get()         << "\n";
     }
 
     static inline ostream& operator <<( ostream& o, cds::intrusive::skip_list::empty_stat const& /*s*/ )
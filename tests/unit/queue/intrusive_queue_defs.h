@@ -137,6 +137,20 @@
     CPPUNIT_TEST(VyukovMPMCCycleQueue_dyn_ic)
 
 
+// MPSCQueue: single consumer only
+#define CDSUNIT_DECLARE_MPSCQueue \
+    TEST_MPSC(MPSCQueue_default,    cds::intrusive::mpsc_queue::node<> ) \
+    TEST_MPSC(MPSCQueue_ic,         cds::intrusive::mpsc_queue::node<> ) \
+    TEST_MPSC(MPSCQueue_stat,       cds::intrusive::mpsc_queue::node<> ) \
+    TEST_MPSC(MPSCQueue_seqcst,     cds::intrusive::mpsc_queue::node<> )
+
+#define CDSUNIT_TEST_MPSCQueue \
+    CPPUNIT_TEST(MPSCQueue_default) \
+    CPPUNIT_TEST(MPSCQueue_ic) \
+    CPPUNIT_TEST(MPSCQueue_stat) \
+    CPPUNIT_TEST(MPSCQueue_seqcst)
+
+
 // FCQueue
 #define CDSUNIT_DECLARE_FCQueue \
     TEST_FCQUEUE(FCQueue_list_delay2, boost::intrusive::list_base_hook<> ) \
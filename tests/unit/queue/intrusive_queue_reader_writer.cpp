@@ -42,6 +42,7 @@ namespace queue {
 #define TEST_FCQUEUE( Q, HOOK ) void Q() { test_fcqueue< Types< Value<HOOK> >::Q >(); }
 #define TEST_SEGMENTED( Q )     void Q() { test_segmented< Types< Value<> >::Q >(); }
 #define TEST_BOOST( Q, HOOK )   void Q() { test_boost< Types< Value<HOOK> >::Q >(); }
+#define TEST_MPSC( Q, HOOK )    void Q() { test_mpsc< Types< Value<HOOK> >::Q >(); }
 
     namespace {
         static size_t s_nReaderThreadCount = 4;
@@ -417,6 +418,29 @@ namespace queue {
             test_with(q, arrValue, 0, 0);
         }
 
+        template <typename Queue>
+        void test_mpsc()
+        {
+            // Multi-producer/single-consumer queue: force one reader
+            struct reader_count_guard {
+                size_t const nReaderCount;
+
+                reader_count_guard()
+                    : nReaderCount( s_nReaderThreadCount )
+                {
+                    s_nReaderThreadCount = 1;
+                }
+                ~reader_count_guard()
+                {
+                    s_nReaderThreadCount = nReaderCount;
+                }
+            } guard;
+
+            value_array<typename Queue::value_type> arrValue( s_nQueueSize );
+            Queue q;
+            test_with( q, arrValue, 0, 0 );
+        }
+
         template <typename Queue>
         void test_fcqueue()
         {
@@ -471,6 +495,7 @@ namespace queue {
         CDSUNIT_DECLARE_SegmentedQueue
         CDSUNIT_DECLARE_TsigasCycleQueue
         CDSUNIT_DECLARE_VyukovMPMCCycleQueue
+        CDSUNIT_DECLARE_MPSCQueue
         CDSUNIT_DECLARE_BoostSList
 
 
@@ -483,6 +508,7 @@ namespace queue {
             CDSUNIT_TEST_SegmentedQueue
             CDSUNIT_TEST_TsigasCycleQueue
             CDSUNIT_TEST_VyukovMPMCCycleQueue
+            CDSUNIT_TEST_MPSCQueue
             CDSUNIT_TEST_BoostSList
         CPPUNIT_TEST_SUITE_END();
     };
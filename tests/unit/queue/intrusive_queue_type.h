@@ -39,6 +39,7 @@
 #include <cds/intrusive/basket_queue.h>
 #include <cds/intrusive/fcqueue.h>
 #include <cds/intrusive/segmented_queue.h>
+#include <cds/intrusive/mpsc_queue.h>
 
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
@@ -343,6 +344,27 @@ namespace queue {
             }
         };
 
+        // MPSCQueue
+        typedef cds::intrusive::MPSCQueue< T > MPSCQueue_default;
+
+        struct traits_MPSCQueue_ic : public cds::intrusive::mpsc_queue::traits
+        {
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cds::intrusive::MPSCQueue< T, traits_MPSCQueue_ic > MPSCQueue_ic;
+
+        struct traits_MPSCQueue_stat : public cds::intrusive::mpsc_queue::traits
+        {
+            typedef cds::intrusive::mpsc_queue::stat<> stat;
+        };
+        typedef cds::intrusive::MPSCQueue< T, traits_MPSCQueue_stat > MPSCQueue_stat;
+
+        struct traits_MPSCQueue_seqcst : public cds::intrusive::mpsc_queue::traits
+        {
+            typedef cds::opt::v::sequential_consistent memory_model;
+        };
+        typedef cds::intrusive::MPSCQueue< T, traits_MPSCQueue_seqcst > MPSCQueue_seqcst;
+
         // BasketQueue
         struct traits_BasketQueue_HP : public
             cds::intrusive::basket_queue::make_traits <
@@ -558,6 +580,23 @@ namespace std {
         return o;
     }
 
+    template <typename Counter>
+    static inline std::ostream& operator <<( std::ostream& o, cds::intrusive::mpsc_queue::stat<Counter> const& s )
+    {
+        return o
+            << "\tStatistics:\n"
+            << "\t\tEnqueue count: " << s.m_EnqueueCount.get() << "\n"
+            << "\t\tDequeue count: " << s.m_DequeueCount.get() << "\n"
+            << "\t\tDequeue empty: " << s.m_EmptyDequeue.get() << "\n"
+            << "\t\t Dequeue race: " << s.m_DequeueRace.get()  << "\n"
+            << "\t\t Stub enqueue: " << s.m_StubEnqueue.get()  << "\n";
+    }
+
+    static inline std::ostream& operator <<( std::ostream& o, cds::intrusive::mpsc_queue::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
     static inline std::ostream& operator <<( std::ostream& o, cds::opt::none )
     {
         return o;
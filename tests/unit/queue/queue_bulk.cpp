@@ -0,0 +1,383 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+#include "queue/queue_type.h"
+
+#include <vector>
+
+// Multi-threaded queue test for enqueue_bulk/dequeue_bulk
+namespace queue {
+
+#define TEST_CASE( Q, V )       void Q() { test< Types<V>::Q >(); }
+
+    namespace ns_Queue_Bulk {
+        static size_t s_nReaderThreadCount = 4;
+        static size_t s_nWriterThreadCount = 4;
+        static size_t s_nQueueSize = 4000000;
+        static size_t s_nBatchSize = 64;
+
+        struct Value {
+            size_t      nNo;
+            size_t      nWriterNo;
+
+            Value()
+                : nNo( 0 )
+                , nWriterNo( 0 )
+            {}
+            Value( size_t nWriter, size_t n )
+                : nNo( n )
+                , nWriterNo( nWriter )
+            {}
+        };
+    }
+    using namespace ns_Queue_Bulk;
+
+    class Queue_Bulk: public CppUnitMini::TestCase
+    {
+        template <class Queue>
+        class WriterThread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new WriterThread( *this );
+            }
+        public:
+            Queue&              m_Queue;
+            double              m_fTime;
+            size_t              m_nPushFailed;
+
+        public:
+            WriterThread( CppUnitMini::ThreadPool& pool, Queue& q )
+                : CppUnitMini::TestThread( pool )
+                , m_Queue( q )
+            {}
+            WriterThread( WriterThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            Queue_Bulk&  getTest()
+            {
+                return reinterpret_cast<Queue_Bulk&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                size_t const nPushCount = getTest().m_nThreadPushCount;
+                size_t const nBatchSize = getTest().m_nBatchSize;
+                m_nPushFailed = 0;
+
+                std::vector<Value> batch;
+                batch.reserve( nBatchSize );
+
+                m_fTime = m_Timer.duration();
+
+                if ( nBatchSize == 1 ) {
+                    Value v( m_nThreadNo, 0 );
+                    while ( v.nNo < nPushCount ) {
+                        if ( m_Queue.push( v ))
+                            ++v.nNo;
+                        else
+                            ++m_nPushFailed;
+                    }
+                }
+                else {
+                    for ( size_t nNo = 0; nNo < nPushCount; ) {
+                        batch.clear();
+                        for ( ; nNo < nPushCount && batch.size() < nBatchSize; ++nNo )
+                            batch.push_back( Value( m_nThreadNo, nNo ));
+
+                        // A bounded queue can accept a part of the batch only
+                        for ( typename std::vector<Value>::iterator it = batch.begin(); it != batch.end(); ) {
+                            size_t n = m_Queue.enqueue_bulk( it, batch.end() );
+                            if ( n == 0 )
+                                ++m_nPushFailed;
+                            it += n;
+                        }
+                    }
+                }
+
+                m_fTime = m_Timer.duration() - m_fTime;
+                getTest().m_nWriterDone.fetch_add( 1 );
+            }
+        };
+
+        template <class Queue>
+        class ReaderThread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new ReaderThread( *this );
+            }
+        public:
+            Queue&              m_Queue;
+            double              m_fTime;
+            size_t              m_nPopEmpty;
+            size_t              m_nPopped;
+            size_t              m_nBadWriter;
+            size_t              m_nBadOrder;
+
+            std::vector<size_t> m_arrWriterCount;   // popped item count for each writer
+            std::vector<size_t> m_arrWriterSum;     // sum of popped item numbers for each writer
+            std::vector<size_t> m_arrWriterNext;    // the least item number that may be popped next for each writer
+
+        public:
+            ReaderThread( CppUnitMini::ThreadPool& pool, Queue& q )
+                : CppUnitMini::TestThread( pool )
+                , m_Queue( q )
+            {}
+            ReaderThread( ReaderThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            Queue_Bulk&  getTest()
+            {
+                return reinterpret_cast<Queue_Bulk&>( m_Pool.m_Test );
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            size_t pop( std::vector<Value>& buf )
+            {
+                if ( buf.size() == 1 )
+                    return m_Queue.pop( buf[0] ) ? 1 : 0;
+                return m_Queue.dequeue_bulk( buf.begin(), buf.size() );
+            }
+
+            void check( std::vector<Value> const& buf, size_t nCount )
+            {
+                m_nPopped += nCount;
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    Value const& v = buf[i];
+                    if ( v.nWriterNo >= m_arrWriterCount.size() ) {
+                        ++m_nBadWriter;
+                        continue;
+                    }
+
+                    // The items of a writer must be dequeued in FIFO order
+                    if ( v.nNo < m_arrWriterNext[ v.nWriterNo ] )
+                        ++m_nBadOrder;
+                    m_arrWriterNext[ v.nWriterNo ] = v.nNo + 1;
+                    ++m_arrWriterCount[ v.nWriterNo ];
+                    m_arrWriterSum[ v.nWriterNo ] += v.nNo;
+                }
+            }
+
+            virtual void test()
+            {
+                size_t const nTotalWriters = s_nWriterThreadCount;
+                m_nPopEmpty = 0;
+                m_nPopped = 0;
+                m_nBadWriter = 0;
+                m_nBadOrder = 0;
+                m_arrWriterCount.assign( nTotalWriters, 0 );
+                m_arrWriterSum.assign( nTotalWriters, 0 );
+                m_arrWriterNext.assign( nTotalWriters, 0 );
+
+                std::vector<Value> buf( getTest().m_nBatchSize );
+
+                m_fTime = m_Timer.duration();
+
+                while ( true ) {
+                    size_t nCount = pop( buf );
+                    if ( nCount )
+                        check( buf, nCount );
+                    else {
+                        ++m_nPopEmpty;
+                        if ( getTest().m_nWriterDone.load() >= nTotalWriters ) {
+                            // All items have been pushed; the queue is empty if nothing is popped now
+                            nCount = pop( buf );
+                            if ( nCount == 0 )
+                                break;
+                            check( buf, nCount );
+                        }
+                    }
+                }
+
+                m_fTime = m_Timer.duration() - m_fTime;
+            }
+        };
+
+    protected:
+        size_t                  m_nThreadPushCount;
+        size_t                  m_nBatchSize;
+        atomics::atomic<size_t> m_nWriterDone;
+
+    protected:
+        template <class Queue>
+        void analyze( CppUnitMini::ThreadPool& pool, Queue& testQueue, double fDuration )
+        {
+            typedef ReaderThread<Queue> Reader;
+            typedef WriterThread<Queue> Writer;
+
+            double fTimeWriter = 0;
+            double fTimeReader = 0;
+            size_t nTotalPops = 0;
+            size_t nPopEmpty = 0;
+            size_t nPushFailed = 0;
+            std::vector<size_t> arrWriterCount( s_nWriterThreadCount, 0 );
+            std::vector<size_t> arrWriterSum( s_nWriterThreadCount, 0 );
+
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Reader * pReader = dynamic_cast<Reader *>( *it );
+                if ( pReader ) {
+                    fTimeReader += pReader->m_fTime;
+                    nTotalPops += pReader->m_nPopped;
+                    nPopEmpty += pReader->m_nPopEmpty;
+                    CPPUNIT_CHECK_EX( pReader->m_nBadWriter == 0, "reader " << pReader->m_nThreadNo << " bad writer event count=" << pReader->m_nBadWriter );
+                    CPPUNIT_CHECK_EX( pReader->m_nBadOrder == 0, "reader " << pReader->m_nThreadNo << " FIFO order violation count=" << pReader->m_nBadOrder );
+                    for ( size_t i = 0; i < s_nWriterThreadCount; ++i ) {
+                        arrWriterCount[i] += pReader->m_arrWriterCount[i];
+                        arrWriterSum[i] += pReader->m_arrWriterSum[i];
+                    }
+                }
+                else {
+                    Writer * pWriter = dynamic_cast<Writer *>( *it );
+                    CPPUNIT_ASSERT( pWriter != nullptr );
+                    fTimeWriter += pWriter->m_fTime;
+                    nPushFailed += pWriter->m_nPushFailed;
+                    if ( !boost::is_base_of<cds::bounded_container, Queue>::value ) {
+                        CPPUNIT_CHECK_EX( pWriter->m_nPushFailed == 0,
+                            "writer " << pWriter->m_nThreadNo << " push failed count=" << pWriter->m_nPushFailed );
+                    }
+                }
+            }
+
+            size_t const nQueueSize = m_nThreadPushCount * s_nWriterThreadCount;
+            CPPUNIT_MSG( "    Readers: duration=" << fTimeReader / s_nReaderThreadCount << ", success pop=" << nTotalPops << ", failed pops=" << nPopEmpty );
+            CPPUNIT_MSG( "    Writers: duration=" << fTimeWriter / s_nWriterThreadCount << ", failed push=" << nPushFailed );
+            CPPUNIT_MSG( "    Throughput=" << static_cast<double>( nQueueSize ) / fDuration << " items/sec" );
+
+            CPPUNIT_CHECK_EX( nTotalPops == nQueueSize, "popped=" << nTotalPops << " must be " << nQueueSize );
+            CPPUNIT_CHECK( testQueue.empty() );
+
+            // Each item has been popped exactly once
+            size_t const nExpectedSum = m_nThreadPushCount * ( m_nThreadPushCount - 1 ) / 2;
+            for ( size_t i = 0; i < s_nWriterThreadCount; ++i ) {
+                CPPUNIT_CHECK_EX( arrWriterCount[i] == m_nThreadPushCount, "Writer " << i << ": popped=" << arrWriterCount[i] << " must be " << m_nThreadPushCount );
+                CPPUNIT_CHECK_EX( arrWriterSum[i] == nExpectedSum, "Writer " << i << ": sum=" << arrWriterSum[i] << " must be " << nExpectedSum );
+            }
+        }
+
+        template <class Queue>
+        void run_test( size_t nBatchSize )
+        {
+            m_nBatchSize = nBatchSize;
+            m_nWriterDone.store( 0 );
+
+            if ( nBatchSize == 1 ) {
+                CPPUNIT_MSG( "   Single push/pop:" );
+            }
+            else {
+                CPPUNIT_MSG( "   Bulk enqueue/dequeue, batch size=" << nBatchSize << ":" );
+            }
+
+            Queue testQueue;
+            CppUnitMini::ThreadPool pool( *this );
+
+            // Writers must be first
+            pool.add( new WriterThread<Queue>( pool, testQueue ), s_nWriterThreadCount );
+            pool.add( new ReaderThread<Queue>( pool, testQueue ), s_nReaderThreadCount );
+
+            cds::OS::Timer timer;
+            pool.run();
+            double const fDuration = timer.duration();
+
+            analyze( pool, testQueue, fDuration );
+            CPPUNIT_MSG( testQueue.statistics() );
+        }
+
+        template <class Queue>
+        void test()
+        {
+            m_nThreadPushCount = s_nQueueSize / s_nWriterThreadCount;
+            CPPUNIT_MSG( "    reader count=" << s_nReaderThreadCount << " writer count=" << s_nWriterThreadCount
+                << " item count=" << m_nThreadPushCount * s_nWriterThreadCount << "..." );
+
+            // The single-item run is the baseline for the bulk run
+            run_test<Queue>( 1 );
+            if ( s_nBatchSize > 1 )
+                run_test<Queue>( s_nBatchSize );
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nReaderThreadCount = cfg.getULong("ReaderCount", 4 );
+            s_nWriterThreadCount = cfg.getULong("WriterCount", 4 );
+            s_nQueueSize = cfg.getULong("QueueSize", 4000000 );
+            s_nBatchSize = cfg.getULong("BatchSize", 64 );
+            if ( s_nBatchSize == 0 )
+                s_nBatchSize = 1;
+        }
+
+    protected:
+        TEST_CASE( MSQueue_HP, Value )
+        TEST_CASE( MSQueue_HP_stat, Value )
+        TEST_CASE( MSQueue_DHP, Value )
+        TEST_CASE( MoirQueue_HP, Value )
+        TEST_CASE( MoirQueue_HP_stat, Value )
+        TEST_CASE( MoirQueue_DHP, Value )
+        TEST_CASE( MoirQueue_DHP_stat, Value )
+        TEST_CASE( VyukovMPMCCycleQueue_dyn, Value )
+        TEST_CASE( VyukovMPMCCycleQueue_dyn_ic, Value )
+
+        CPPUNIT_TEST_SUITE(Queue_Bulk)
+            CPPUNIT_TEST(MSQueue_HP)
+            CPPUNIT_TEST(MSQueue_HP_stat)
+            CPPUNIT_TEST(MSQueue_DHP)
+            CPPUNIT_TEST(MoirQueue_HP)
+            CPPUNIT_TEST(MoirQueue_HP_stat)
+            CPPUNIT_TEST(MoirQueue_DHP)
+            CPPUNIT_TEST(MoirQueue_DHP_stat)
+            CPPUNIT_TEST(VyukovMPMCCycleQueue_dyn)
+            CPPUNIT_TEST(VyukovMPMCCycleQueue_dyn_ic)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace queue
+
+CPPUNIT_TEST_SUITE_REGISTRATION(queue::Queue_Bulk);
@@ -82,6 +82,32 @@
     CPPUNIT_TEST(MSQueue_DHP_stat)
 
 
+// FAAArrayQueue
+#define CDSUNIT_DECLARE_FAAArrayQueue( ITEM_TYPE ) \
+    TEST_CASE( FAAArrayQueue_HP, ITEM_TYPE  ) \
+    TEST_CASE( FAAArrayQueue_HP_seqcst, ITEM_TYPE  ) \
+    TEST_CASE( FAAArrayQueue_HP_ic, ITEM_TYPE  ) \
+    TEST_CASE( FAAArrayQueue_HP_stat, ITEM_TYPE  ) \
+    TEST_CASE( FAAArrayQueue_HP_seg64, ITEM_TYPE  ) \
+    TEST_CASE( FAAArrayQueue_DHP, ITEM_TYPE ) \
+    TEST_CASE( FAAArrayQueue_DHP_seqcst, ITEM_TYPE ) \
+    TEST_CASE( FAAArrayQueue_DHP_ic, ITEM_TYPE ) \
+    TEST_CASE( FAAArrayQueue_DHP_stat, ITEM_TYPE ) \
+    TEST_CASE( FAAArrayQueue_DHP_seg64, ITEM_TYPE )
+
+#define CDSUNIT_TEST_FAAArrayQueue \
+    CPPUNIT_TEST(FAAArrayQueue_HP) \
+    CPPUNIT_TEST(FAAArrayQueue_HP_seqcst) \
+    CPPUNIT_TEST(FAAArrayQueue_HP_ic) \
+    CPPUNIT_TEST(FAAArrayQueue_HP_stat) \
+    CPPUNIT_TEST(FAAArrayQueue_HP_seg64) \
+    CPPUNIT_TEST(FAAArrayQueue_DHP) \
+    CPPUNIT_TEST(FAAArrayQueue_DHP_seqcst) \
+    CPPUNIT_TEST(FAAArrayQueue_DHP_ic) \
+    CPPUNIT_TEST(FAAArrayQueue_DHP_stat) \
+    CPPUNIT_TEST(FAAArrayQueue_DHP_seg64)
+
+
 // OptimisticQueue
 #define CDSUNIT_DECLARE_OptimisticQueue( ITEM_TYPE ) \
     TEST_CASE(OptimisticQueue_HP, ITEM_TYPE ) \
@@ -229,6 +255,17 @@
     CPPUNIT_TEST(VyukovMPMCCycleQueue_dyn_michaelAlloc) \
     CPPUNIT_TEST(VyukovMPMCCycleQueue_dyn_ic) \
 
+// SPSCRingQueue: single producer, single consumer only
+#define CDSUNIT_DECLARE_SPSCRingQueue( ITEM_TYPE ) \
+    TEST_SPSC(SPSCRingQueue_dyn, ITEM_TYPE) \
+    TEST_SPSC(SPSCRingQueue_dyn_ic, ITEM_TYPE) \
+    TEST_SPSC(SPSCRingQueue_dyn_stat, ITEM_TYPE)
+
+#define CDSUNIT_TEST_SPSCRingQueue \
+    CPPUNIT_TEST(SPSCRingQueue_dyn) \
+    CPPUNIT_TEST(SPSCRingQueue_dyn_ic) \
+    CPPUNIT_TEST(SPSCRingQueue_dyn_stat)
+
 // SegmentedQueue
 #define CDSUNIT_DECLARE_SegmentedQueue( ITEM_TYPE ) \
     TEST_SEGMENTED( SegmentedQueue_HP_spin, ITEM_TYPE ) \
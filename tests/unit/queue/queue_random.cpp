@@ -297,6 +297,7 @@ namespace queue {
     protected:
         CDSUNIT_DECLARE_MoirQueue( SimpleValue )
         CDSUNIT_DECLARE_MSQueue( SimpleValue )
+        CDSUNIT_DECLARE_FAAArrayQueue( SimpleValue )
         CDSUNIT_DECLARE_OptimisticQueue( SimpleValue )
         CDSUNIT_DECLARE_BasketQueue( SimpleValue )
         CDSUNIT_DECLARE_FCQueue( SimpleValue )
@@ -310,6 +311,7 @@ namespace queue {
         CPPUNIT_TEST_SUITE(Queue_Random)
             CDSUNIT_TEST_MoirQueue
             CDSUNIT_TEST_MSQueue
+            CDSUNIT_TEST_FAAArrayQueue
             CDSUNIT_TEST_OptimisticQueue
             CDSUNIT_TEST_BasketQueue
             CDSUNIT_TEST_FCQueue
@@ -41,6 +41,7 @@ namespace queue {
 #define TEST_CASE( Q, V )       void Q() { test< Types<V>::Q >(); }
 #define TEST_BOUNDED( Q, V )    TEST_CASE( Q, V )
 #define TEST_SEGMENTED( Q, V )  void Q() { test_segmented< Types< V >::Q >(); }
+#define TEST_SPSC( Q, V )       void Q() { test_spsc< Types< V >::Q >(); }
 
     namespace {
         static size_t s_nReaderThreadCount = 4;
@@ -329,6 +330,30 @@ namespace queue {
             CPPUNIT_MSG( testQueue.statistics() );
         }
 
+        template <class Queue>
+        void test_spsc()
+        {
+            // Single-producer/single-consumer queue: force one writer and one reader
+            struct thread_count_guard {
+                size_t const nReaderCount;
+                size_t const nWriterCount;
+
+                thread_count_guard()
+                    : nReaderCount( s_nReaderThreadCount )
+                    , nWriterCount( s_nWriterThreadCount )
+                {
+                    s_nReaderThreadCount = s_nWriterThreadCount = 1;
+                }
+                ~thread_count_guard()
+                {
+                    s_nReaderThreadCount = nReaderCount;
+                    s_nWriterThreadCount = nWriterCount;
+                }
+            } guard;
+
+            test<Queue>();
+        }
+
         template <class Queue>
         void test_segmented()
         {
@@ -364,6 +389,7 @@ namespace queue {
     protected:
         CDSUNIT_DECLARE_MoirQueue( Value )
         CDSUNIT_DECLARE_MSQueue( Value )
+        CDSUNIT_DECLARE_FAAArrayQueue( Value )
         CDSUNIT_DECLARE_OptimisticQueue( Value )
         CDSUNIT_DECLARE_BasketQueue( Value )
         CDSUNIT_DECLARE_FCQueue( Value )
@@ -372,11 +398,13 @@ namespace queue {
         CDSUNIT_DECLARE_RWQueue( Value )
         CDSUNIT_DECLARE_TsigasCycleQueue( Value )
         CDSUNIT_DECLARE_VyukovMPMCCycleQueue( Value )
+        CDSUNIT_DECLARE_SPSCRingQueue( Value )
         CDSUNIT_DECLARE_StdQueue( Value )
 
         CPPUNIT_TEST_SUITE(Queue_ReaderWriter)
             CDSUNIT_TEST_MoirQueue
             CDSUNIT_TEST_MSQueue
+            CDSUNIT_TEST_FAAArrayQueue
             CDSUNIT_TEST_OptimisticQueue
             CDSUNIT_TEST_BasketQueue
             CDSUNIT_TEST_FCQueue
@@ -385,6 +413,7 @@ namespace queue {
             CDSUNIT_TEST_RWQueue
             CDSUNIT_TEST_TsigasCycleQueue
             CDSUNIT_TEST_VyukovMPMCCycleQueue
+            CDSUNIT_TEST_SPSCRingQueue
             CDSUNIT_TEST_StdQueue
         CPPUNIT_TEST_SUITE_END();
     };
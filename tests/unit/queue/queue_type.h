@@ -41,6 +41,8 @@
 #include <cds/container/fcqueue.h>
 #include <cds/container/fcdeque.h>
 #include <cds/container/segmented_queue.h>
+#include <cds/container/faa_array_queue.h>
+#include <cds/container/spsc_ring_queue.h>
 
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
@@ -174,6 +176,46 @@ namespace queue {
         typedef cds::container::MoirQueue< cds::gc::HP, Value, traits_MSQueue_stat > MoirQueue_HP_stat;
         typedef cds::container::MoirQueue< cds::gc::DHP, Value, traits_MSQueue_stat > MoirQueue_DHP_stat;
 
+        // FAAArrayQueue
+        typedef cds::container::FAAArrayQueue< cds::gc::HP,  Value > FAAArrayQueue_HP;
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, Value > FAAArrayQueue_DHP;
+
+        struct traits_FAAArrayQueue_seqcst : public
+            cds::container::faa_array_queue::make_traits <
+                cds::opt::memory_model < cds::opt::v::sequential_consistent >
+            > ::type
+        {};
+        typedef cds::container::FAAArrayQueue< cds::gc::HP,  Value, traits_FAAArrayQueue_seqcst > FAAArrayQueue_HP_seqcst;
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, Value, traits_FAAArrayQueue_seqcst > FAAArrayQueue_DHP_seqcst;
+
+        // FAAArrayQueue + item counter
+        struct traits_FAAArrayQueue_ic : public
+            cds::container::faa_array_queue::make_traits <
+                cds::opt::item_counter < cds::atomicity::item_counter >
+            > ::type
+        {};
+        typedef cds::container::FAAArrayQueue< cds::gc::HP,  Value, traits_FAAArrayQueue_ic > FAAArrayQueue_HP_ic;
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, Value, traits_FAAArrayQueue_ic > FAAArrayQueue_DHP_ic;
+
+        // FAAArrayQueue + stat
+        struct traits_FAAArrayQueue_stat: public
+            cds::container::faa_array_queue::make_traits <
+                cds::opt::stat< cds::container::faa_array_queue::stat<> >
+            >::type
+        {};
+        typedef cds::container::FAAArrayQueue< cds::gc::HP,  Value, traits_FAAArrayQueue_stat > FAAArrayQueue_HP_stat;
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, Value, traits_FAAArrayQueue_stat > FAAArrayQueue_DHP_stat;
+
+        // FAAArrayQueue with small segments: frequent segment turnover
+        struct traits_FAAArrayQueue_seg64: public
+            cds::container::faa_array_queue::make_traits <
+                cds::container::faa_array_queue::segment_size< 64 >
+                , cds::opt::stat< cds::container::faa_array_queue::stat<> >
+            >::type
+        {};
+        typedef cds::container::FAAArrayQueue< cds::gc::HP,  Value, traits_FAAArrayQueue_seg64 > FAAArrayQueue_HP_seg64;
+        typedef cds::container::FAAArrayQueue< cds::gc::DHP, Value, traits_FAAArrayQueue_seg64 > FAAArrayQueue_DHP_seg64;
+
 
         // OptimisticQueue
         typedef cds::container::OptimisticQueue< cds::gc::HP, Value > OptimisticQueue_HP;
@@ -362,6 +404,58 @@ namespace queue {
             }
         };
 
+        // SPSCRingQueue
+        struct traits_SPSCRingQueue_dyn : public cds::container::spsc_ring_queue::traits
+        {
+            typedef cds::opt::v::dynamic_buffer< int > buffer;
+        };
+        class SPSCRingQueue_dyn
+            : public cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn >
+        {
+            typedef cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn > base_class;
+        public:
+            SPSCRingQueue_dyn()
+                : base_class( 1024 * 64 )
+            {}
+            SPSCRingQueue_dyn( size_t nCapacity )
+                : base_class( nCapacity )
+            {}
+        };
+
+        struct traits_SPSCRingQueue_dyn_ic : public traits_SPSCRingQueue_dyn
+        {
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        class SPSCRingQueue_dyn_ic
+            : public cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn_ic >
+        {
+            typedef cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn_ic > base_class;
+        public:
+            SPSCRingQueue_dyn_ic()
+                : base_class( 1024 * 64 )
+            {}
+            SPSCRingQueue_dyn_ic( size_t nCapacity )
+                : base_class( nCapacity )
+            {}
+        };
+
+        struct traits_SPSCRingQueue_dyn_stat : public traits_SPSCRingQueue_dyn
+        {
+            typedef cds::container::spsc_ring_queue::stat<> stat;
+        };
+        class SPSCRingQueue_dyn_stat
+            : public cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn_stat >
+        {
+            typedef cds::container::SPSCRingQueue< Value, traits_SPSCRingQueue_dyn_stat > base_class;
+        public:
+            SPSCRingQueue_dyn_stat()
+                : base_class( 1024 * 64 )
+            {}
+            SPSCRingQueue_dyn_stat( size_t nCapacity )
+                : base_class( nCapacity )
+            {}
+        };
+
 
         // BasketQueue
 
@@ -572,7 +666,8 @@ namespace std {
             << "\t\t     Dequeue empty: " << s.m_EmptyDequeue.get() << "\n"
             << "\t\t      Dequeue race: " << s.m_DequeueRace.get()  << "\n"
             << "\t\tAdvance tail error: " << s.m_AdvanceTailError.get() << "\n"
-            << "\t\t          Bad tail: " << s.m_BadTail.get() << "\n";
+            << "\t\t          Bad tail: " << s.m_BadTail.get() << "\n"
+            << "\t\t      Enqueue bulk: " << s.m_EnqueueBulkCount.get() << "\n";
     }
 
     static inline std::ostream& operator <<( std::ostream& o, cds::container::msqueue::empty_stat const& /*s*/ )
@@ -580,6 +675,44 @@ namespace std {
         return o;
     }
 
+    template <typename Counter>
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::faa_array_queue::stat<Counter> const& s )
+    {
+        return o
+            << "\tStatistics:\n"
+            << "\t\t   Enqueue count: " << s.m_EnqueueCount.get() << "\n"
+            << "\t\t    Enqueue race: " << s.m_EnqueueRace.get()  << "\n"
+            << "\t\t   Dequeue count: " << s.m_DequeueCount.get() << "\n"
+            << "\t\t   Dequeue empty: " << s.m_EmptyDequeue.get() << "\n"
+            << "\t\t    Dequeue race: " << s.m_DequeueRace.get()  << "\n"
+            << "\t\t Segment created: " << s.m_SegmentCreated.get() << "\n"
+            << "\t\t    Segment race: " << s.m_SegmentRace.get()  << "\n"
+            << "\t\t Segment deleted: " << s.m_SegmentDeleted.get() << "\n";
+    }
+
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::faa_array_queue::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    template <typename Counter>
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::spsc_ring_queue::stat<Counter> const& s )
+    {
+        return o
+            << "\tStatistics:\n"
+            << "\t\t Enqueue count: " << s.m_EnqueueCount.get() << "\n"
+            << "\t\t  Enqueue full: " << s.m_FullEnqueue.get()  << "\n"
+            << "\t\t   Head reload: " << s.m_HeadReload.get()   << "\n"
+            << "\t\t Dequeue count: " << s.m_DequeueCount.get() << "\n"
+            << "\t\t Dequeue empty: " << s.m_EmptyDequeue.get() << "\n"
+            << "\t\t   Tail reload: " << s.m_TailReload.get()   << "\n";
+    }
+
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::spsc_ring_queue::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
     static inline std::ostream& operator <<( std::ostream& o, cds::opt::none )
     {
         return o;
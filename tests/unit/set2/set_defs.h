@@ -67,6 +67,18 @@
 #endif
 
 
+#define CDSUNIT_DECLARE_MichaelSet_dyn  \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_HP_cmp_stdAlloc_dyn) \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_DHP_cmp_stdAlloc_dyn) \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_Lazy_HP_cmp_stdAlloc_dyn) \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_Lazy_DHP_cmp_stdAlloc_dyn)
+
+#define CDSUNIT_TEST_MichaelSet_dyn  \
+    CPPUNIT_TEST(MichaelSet_HP_cmp_stdAlloc_dyn) \
+    CPPUNIT_TEST(MichaelSet_DHP_cmp_stdAlloc_dyn) \
+    CPPUNIT_TEST(MichaelSet_Lazy_HP_cmp_stdAlloc_dyn) \
+    CPPUNIT_TEST(MichaelSet_Lazy_DHP_cmp_stdAlloc_dyn)
+
 #define CDSUNIT_DECLARE_MichaelSet  \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_HP_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_HP_less_michaelAlloc) \
@@ -0,0 +1,223 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set2/set_type.h"
+#include "cppunit/thread.h"
+
+namespace set2 {
+
+#define TEST_CASE(TAG, X)  void X();
+
+    class Set_Grow: public CppUnitMini::TestCase
+    {
+    public:
+        size_t c_nThreadCount = 8;          // thread count
+        size_t c_nSetSize = 1024;           // initial set size
+        size_t c_nFinalSetSize = 1000000;   // item count at the end of the test
+        size_t c_nLoadFactor = 2;
+        bool   c_bPrintGCState = true;
+
+    protected:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        template <class Set>
+        class Inserter: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual Inserter *    clone()
+            {
+                return new Inserter( *this );
+            }
+        public:
+            size_t  m_nInsertSuccess;
+            size_t  m_nInsertFailed;
+            size_t  m_nFindSuccess;
+            size_t  m_nFindFailed;
+            size_t  m_nCheckFailed;
+            double  m_fInsertDuration;
+            double  m_fCheckDuration;
+
+        public:
+            Inserter( CppUnitMini::ThreadPool& pool, Set& s )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( s )
+            {}
+            Inserter( Inserter& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_Grow&  getTest()
+            {
+                return reinterpret_cast<Set_Grow&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+
+                m_nInsertSuccess =
+                    m_nInsertFailed =
+                    m_nFindSuccess =
+                    m_nFindFailed =
+                    m_nCheckFailed = 0;
+
+                // The thread inserts keys nKey % nThreadCount == m_nThreadNo
+                size_t const nThreadCount = getTest().c_nThreadCount;
+                size_t const nFinalSize = getTest().c_nFinalSetSize;
+                size_t const nStart = m_nThreadNo;
+                size_t nInserted = 0;
+                size_t nRand = m_nThreadNo + 1;
+
+                cds::OS::Timer timer;
+                for ( size_t nKey = nStart; nKey < nFinalSize; nKey += nThreadCount ) {
+                    if ( rSet.insert( nKey ))
+                        ++m_nInsertSuccess;
+                    else
+                        ++m_nInsertFailed;
+                    ++nInserted;
+
+                    // Look up one of the keys inserted before: it must be found
+                    // even if its bucket is being moved to the new table
+                    if ( ( nInserted & 3 ) == 0 ) {
+                        nRand = cds::bitop::RandXorShift( nRand );
+                        if ( rSet.contains( nStart + ( nRand % nInserted ) * nThreadCount ))
+                            ++m_nFindSuccess;
+                        else
+                            ++m_nFindFailed;
+                    }
+                }
+                m_fInsertDuration = timer.duration();
+
+                timer.reset();
+                for ( size_t nKey = nStart; nKey < nFinalSize; nKey += nThreadCount ) {
+                    if ( !rSet.contains( nKey ))
+                        ++m_nCheckFailed;
+                }
+                m_fCheckDuration = timer.duration();
+            }
+        };
+
+    protected:
+        template <class Set>
+        void do_test( Set& testSet )
+        {
+            typedef Inserter<Set> inserter_thread;
+
+            size_t const nInitBucketCount = testSet.bucket_count();
+
+            cds::OS::Timer timer;
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new inserter_thread( pool, testSet ), c_nThreadCount );
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << timer.duration() );
+
+            size_t nInsertSuccess = 0;
+            size_t nInsertFailed = 0;
+            size_t nFindSuccess = 0;
+            size_t nFindFailed = 0;
+            size_t nCheckFailed = 0;
+            double fInsertDuration = 0;
+            double fCheckDuration = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                inserter_thread * pThread = static_cast<inserter_thread *>( *it );
+                assert( pThread != nullptr );
+                nInsertSuccess += pThread->m_nInsertSuccess;
+                nInsertFailed += pThread->m_nInsertFailed;
+                nFindSuccess += pThread->m_nFindSuccess;
+                nFindFailed += pThread->m_nFindFailed;
+                nCheckFailed += pThread->m_nCheckFailed;
+                fInsertDuration += pThread->m_fInsertDuration;
+                fCheckDuration += pThread->m_fCheckDuration;
+            }
+            fInsertDuration /= c_nThreadCount;
+            fCheckDuration /= c_nThreadCount;
+
+            CPPUNIT_MSG( "  Totals (success/failed): \n\t"
+                << "      Insert=" << nInsertSuccess << '/' << nInsertFailed << "\n\t"
+                << "        Find=" << nFindSuccess   << '/' << nFindFailed   << "\n\t"
+                << "       Check=" << (c_nFinalSetSize - nCheckFailed) << '/' << nCheckFailed << "\n\t"
+                << "Insert speed=" << static_cast<size_t>( nInsertSuccess / fInsertDuration ) << " insert/sec\n\t"
+                << " Check speed=" << static_cast<size_t>( c_nFinalSetSize / fCheckDuration ) << " find/sec\n\t"
+                << "Bucket count=" << nInitBucketCount << " -> " << testSet.bucket_count() << "\n\t"
+                << "    Set size=" << testSet.size()
+            );
+
+            CPPUNIT_CHECK_EX( nInsertSuccess == c_nFinalSetSize, "insert success=" << nInsertSuccess << ", expected=" << c_nFinalSetSize );
+            CPPUNIT_CHECK_EX( nInsertFailed == 0, "insert failed=" << nInsertFailed );
+            CPPUNIT_CHECK_EX( nFindFailed == 0, "find failed=" << nFindFailed );
+            CPPUNIT_CHECK_EX( nCheckFailed == 0, "check failed=" << nCheckFailed );
+            CPPUNIT_CHECK_EX( testSet.size() == c_nFinalSetSize, "size=" << testSet.size() << ", expected=" << c_nFinalSetSize );
+            if ( c_nFinalSetSize > nInitBucketCount * c_nLoadFactor )
+                CPPUNIT_CHECK( testSet.bucket_count() > nInitBucketCount );
+
+            CPPUNIT_MSG( testSet.statistics() );
+
+            CPPUNIT_MSG( "  Clear set (single-threaded)..." );
+            timer.reset();
+            testSet.clear();
+            CPPUNIT_MSG( "   Duration=" << timer.duration() );
+            CPPUNIT_CHECK_EX( testSet.empty(), ((long long) testSet.size()) );
+
+            additional_check( testSet );
+            additional_cleanup( testSet );
+        }
+
+        template <class Set>
+        void run_test()
+        {
+            CPPUNIT_MSG( "Thread count=" << c_nThreadCount
+                << " initial set size=" << c_nSetSize
+                << " final set size=" << c_nFinalSetSize
+                << " load factor=" << c_nLoadFactor
+                );
+
+            Set s( *this );
+            do_test( s );
+            if ( c_bPrintGCState )
+                print_gc_state();
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg );
+
+#   include "set2/set_defs.h"
+        CDSUNIT_DECLARE_MichaelSet_dyn
+
+        CPPUNIT_TEST_SUITE_(Set_Grow, "Map_Grow")
+            CDSUNIT_TEST_MichaelSet_dyn
+        CPPUNIT_TEST_SUITE_END();
+
+    };
+} // namespace set2
@@ -316,6 +316,10 @@ namespace set2 {
         std::vector< cds::intrusive::feldman_hashset::level_statistics > level_stat;
         s.get_level_statistics( level_stat );
         CPPUNIT_MSG( level_stat );
+
+        cds::intrusive::feldman_hashset::memory_statistics mem_stat;
+        s.get_memory_statistics( mem_stat );
+        CPPUNIT_MSG( mem_stat );
     }
 
 } // namespace set2
@@ -38,6 +38,7 @@
 #include <cds/container/michael_set_rcu.h>
 
 #include "michael_alloc.h"
+#include "print_michael_set_stat.h"
 
 namespace set2 {
 
@@ -108,6 +109,16 @@ namespace set2 {
         typedef MichaelHashSet< rcu_sht, typename ml::MichaelList_RCU_SHT_less_stdAlloc_seqcst, traits_MichaelSet_stdAlloc > MichaelSet_RCU_SHT_less_stdAlloc_seqcst;
 #endif
 
+        struct traits_MichaelSet_dyn :
+            public cc::michael_set::make_traits<
+                co::hash< hash >,
+                cc::michael_set::dynamic_bucket_table< true >,
+                co::stat< cc::michael_set::stat<> >
+            >::type
+        {};
+        typedef MichaelHashSet< cds::gc::HP,  typename ml::MichaelList_HP_cmp_stdAlloc,  traits_MichaelSet_dyn > MichaelSet_HP_cmp_stdAlloc_dyn;
+        typedef MichaelHashSet< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_stdAlloc, traits_MichaelSet_dyn > MichaelSet_DHP_cmp_stdAlloc_dyn;
+
         struct traits_MichaelSet_michaelAlloc :
             public cc::michael_set::make_traits<
                 co::hash< hash >,
@@ -170,6 +181,9 @@ namespace set2 {
         typedef MichaelHashSet< rcu_sht, typename ll::LazyList_RCU_SHT_less_stdAlloc_seqcst, traits_MichaelSet_stdAlloc > MichaelSet_Lazy_RCU_SHT_less_stdAlloc_seqcst;
 #endif
 
+        typedef MichaelHashSet< cds::gc::HP,  typename ll::LazyList_HP_cmp_stdAlloc,  traits_MichaelSet_dyn > MichaelSet_Lazy_HP_cmp_stdAlloc_dyn;
+        typedef MichaelHashSet< cds::gc::DHP, typename ll::LazyList_DHP_cmp_stdAlloc, traits_MichaelSet_dyn > MichaelSet_Lazy_DHP_cmp_stdAlloc_dyn;
+
         typedef MichaelHashSet< cds::gc::HP, typename ll::LazyList_HP_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelSet_Lazy_HP_cmp_michaelAlloc;
         typedef MichaelHashSet< cds::gc::DHP, typename ll::LazyList_DHP_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelSet_Lazy_DHP_cmp_michaelAlloc;
         typedef MichaelHashSet< rcu_gpi, typename ll::LazyList_RCU_GPI_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelSet_Lazy_RCU_GPI_cmp_michaelAlloc;